@@ -0,0 +1,1164 @@
+/**
+ * @file   rta_extract.c
+ *
+ * @brief  Batch feature extraction from audio files
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * rta_extract maps WAV or raw PCM files into memory, computes a chain
+ * of frame features over each, and writes one binary matrix file per
+ * input.
+ *
+ * Work is divided into jobs of a segment of frames of one file, which
+ * run on the threads of rta_parallel.h: many short files and a few
+ * long ones keep all threads busy alike. Each job writes its rows at
+ * their place in the output file.
+ *
+ * - compile (from bindings/console)
+ *
+ * cc -O2 rta_extract.c ../../src/signal/rta_fft.c ../../src/signal/rta_tables.c ../../src/signal/rta_window.c ../../src/signal/rta_mel.c ../../src/signal/rta_bands.c ../../src/signal/rta_dct.c ../../src/signal/rta_psy.c ../../src/statistics/rta_moments.c ../../src/util/rta_*.c -I . -I ../../src -I ../../src/util -I ../../src/signal -I ../../src/statistics -lm -lpthread -o rta_extract
+ *
+ * - run
+ *
+ * ./rta_extract -f mfcc,moments,pitch -j 8 -d features *.wav
+ *
+ * Output format (little-endian):
+ *
+ *   "RTAM"                  magic
+ *   uint32  version         1
+ *   uint64  rows            number of frames
+ *   uint32  columns         number of features per frame
+ *   uint32  names_size      size of the column names, padded to 8
+ *   float64 sample_rate     of the input
+ *   float64 hop_period      time between frames in seconds
+ *   char    names[names_size]  comma-separated column names
+ *   float32 data[rows][columns]
+ *
+ * Frame i ends with the hop i, at sample (i + 1) * hop_size, so that
+ * the frames cover the file; samples outside of the file are zeros.
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "rta_configuration.h"
+#include "rta_fft.h"
+#include "rta_window.h"
+#include "rta_mel.h"
+#include "rta_bands.h"
+#include "rta_dct.h"
+#include "rta_psy.h"
+#include "rta_moments.h"
+#include "rta_parallel.h"
+
+#define RTAM_VERSION 1
+#define RTAM_HEADER_SIZE 40
+#define LOG_FLOOR 1e-10
+
+/* psy pre-roll in seconds, before the first frame of a segment */
+#define PITCH_PREROLL 0.2
+
+/** features, in output column order */
+typedef enum
+{
+  feature_fft = 1,     /**< amplitude spectrum */
+  feature_bands = 2,   /**< mel band amplitudes */
+  feature_mfcc = 4,    /**< mel-frequency cepstral coefficients */
+  feature_moments = 8, /**< spectral centroid, spread, skewness, kurtosis */
+  feature_pitch = 16   /**< rta_psy pitch, energy, periodicity, voicing */
+} feature_t;
+
+static const struct
+{
+  const char * name;
+  feature_t feature;
+} feature_names[] =
+{
+  { "fft", feature_fft },
+  { "bands", feature_bands },
+  { "mfcc", feature_mfcc },
+  { "moments", feature_moments },
+  { "pitch", feature_pitch },
+  { NULL, 0 }
+};
+
+typedef enum
+{
+  sample_u8,
+  sample_s16,
+  sample_s24,
+  sample_s32,
+  sample_f32,
+  sample_f64
+} sample_format_t;
+
+static const int sample_sizes[] = { 1, 2, 3, 4, 4, 8 };
+
+typedef struct
+{
+  int features;
+  int frame_size;
+  int hop_size;
+  int fft_size;
+  int nbands;
+  int order;
+  int columns;
+  double segment_seconds;
+  double min_freq;
+  double max_freq;
+  double min_pitch;
+  double max_pitch;
+  /* raw input */
+  int raw;
+  double raw_sample_rate;
+  int raw_channels;
+  sample_format_t raw_format;
+  const char * output_directory;
+} options_t;
+
+/** one mapped input file and its output */
+typedef struct
+{
+  const char * path;
+  char * output_path;
+  void * map;
+  size_t map_size;
+  const unsigned char * samples;
+  sample_format_t format;
+  int channels;
+  int64_t nsamples; /* per channel */
+  double sample_rate;
+  int64_t nframes;
+  int failed;
+} audio_file_t;
+
+/** segment of frames of one file */
+typedef struct
+{
+  audio_file_t * file;
+  int64_t first_frame;
+  int64_t nframes;
+} job_t;
+
+typedef struct
+{
+  const options_t * options;
+  job_t * jobs;
+} extract_context_t;
+
+
+/* ---------------------------------------------------------------------- */
+/* input */
+
+static unsigned int
+read_u16(const unsigned char * p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static uint32_t
+read_u32(const unsigned char * p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static int
+map_file(audio_file_t * file)
+{
+#if defined(WIN32)
+  HANDLE handle, mapping;
+  LARGE_INTEGER size;
+
+  handle = CreateFileA(file->path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if(handle == INVALID_HANDLE_VALUE)
+  {
+    return 0;
+  }
+
+  GetFileSizeEx(handle, &size);
+  file->map_size = (size_t) size.QuadPart;
+  mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(handle);
+  if(mapping == NULL)
+  {
+    return 0;
+  }
+
+  file->map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  return file->map != NULL;
+#else
+  struct stat status;
+  int fd = open(file->path, O_RDONLY);
+
+  if(fd < 0)
+  {
+    return 0;
+  }
+
+  if(fstat(fd, &status) < 0 || status.st_size == 0)
+  {
+    close(fd);
+    return 0;
+  }
+
+  file->map_size = status.st_size;
+  file->map = mmap(NULL, file->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+
+  if(file->map == MAP_FAILED)
+  {
+    file->map = NULL;
+    return 0;
+  }
+
+#ifdef MADV_SEQUENTIAL
+  madvise(file->map, file->map_size, MADV_SEQUENTIAL);
+#endif
+  return 1;
+#endif
+}
+
+static void
+unmap_file(audio_file_t * file)
+{
+  if(file->map != NULL)
+  {
+#if defined(WIN32)
+    UnmapViewOfFile(file->map);
+#else
+    munmap(file->map, file->map_size);
+#endif
+    file->map = NULL;
+  }
+}
+
+/* find the format and data chunks of a RIFF WAVE file */
+static int
+parse_wav(audio_file_t * file)
+{
+  const unsigned char * p = file->map;
+  const unsigned char * end = p + file->map_size;
+  int format_found = 0, tag = 0, bits = 0;
+
+  if(file->map_size < 12 || memcmp(p, "RIFF", 4) != 0 || memcmp(p + 8, "WAVE", 4) != 0)
+  {
+    return 0;
+  }
+
+  for(p += 12; p + 8 <= end; p += 8 + ((read_u32(p + 4) + 1) & ~1u))
+  {
+    uint32_t size = read_u32(p + 4);
+
+    if(memcmp(p, "fmt ", 4) == 0 && size >= 16 && p + 24 <= end)
+    {
+      tag = read_u16(p + 8);
+      file->channels = read_u16(p + 10);
+      file->sample_rate = read_u32(p + 12);
+      bits = read_u16(p + 22);
+
+      /* WAVE_FORMAT_EXTENSIBLE: the tag starts the sub-format */
+      if(tag == 0xfffe && size >= 40 && p + 34 <= end)
+      {
+        tag = read_u16(p + 32);
+      }
+
+      format_found = 1;
+    }
+    else if(memcmp(p, "data", 4) == 0 && format_found)
+    {
+      size_t available = end - (p + 8);
+
+      switch(tag << 8 | bits)
+      {
+        case 1 << 8 | 8: file->format = sample_u8; break;
+        case 1 << 8 | 16: file->format = sample_s16; break;
+        case 1 << 8 | 24: file->format = sample_s24; break;
+        case 1 << 8 | 32: file->format = sample_s32; break;
+        case 3 << 8 | 32: file->format = sample_f32; break;
+        case 3 << 8 | 64: file->format = sample_f64; break;
+        default: return 0;
+      }
+
+      if(file->channels < 1)
+      {
+        return 0;
+      }
+
+      file->samples = p + 8;
+      file->nsamples = (size < available ? size : available)
+        / (sample_sizes[file->format] * file->channels);
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+/* mono sample i, 0 outside of the file */
+static rta_real_t
+read_sample(const audio_file_t * file, const int64_t i)
+{
+  const int size = sample_sizes[file->format];
+  const unsigned char * p;
+  double sum = 0.;
+  int c;
+
+  if(i < 0 || i >= file->nsamples)
+  {
+    return 0.;
+  }
+
+  p = file->samples + i * size * file->channels;
+
+  for(c = 0; c < file->channels; c++, p += size)
+  {
+    switch(file->format)
+    {
+      case sample_u8:
+        sum += (p[0] - 128) * (1. / 128.);
+        break;
+
+      case sample_s16:
+        sum += (int16_t) read_u16(p) * (1. / 32768.);
+        break;
+
+      case sample_s24:
+        sum += ((int32_t) (p[0] << 8 | p[1] << 16 | (uint32_t) p[2] << 24) >> 8)
+          * (1. / 8388608.);
+        break;
+
+      case sample_s32:
+        sum += (int32_t) read_u32(p) * (1. / 2147483648.);
+        break;
+
+      case sample_f32:
+      {
+        float value;
+
+        memcpy(&value, p, sizeof(float));
+        sum += value;
+        break;
+      }
+
+      case sample_f64:
+      {
+        double value;
+
+        memcpy(&value, p, sizeof(double));
+        sum += value;
+        break;
+      }
+    }
+  }
+
+  return sum / file->channels;
+}
+
+static void
+read_samples(const audio_file_t * file, const int64_t start, const int n,
+             rta_real_t * out)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+  {
+    out[i] = read_sample(file, start + i);
+  }
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* output */
+
+static void
+write_u32(unsigned char * p, const uint32_t value)
+{
+  p[0] = value;
+  p[1] = value >> 8;
+  p[2] = value >> 16;
+  p[3] = value >> 24;
+}
+
+static void
+write_f64(unsigned char * p, const double value)
+{
+  uint64_t bits;
+
+  memcpy(&bits, &value, sizeof(bits));
+  write_u32(p, (uint32_t) bits);
+  write_u32(p + 4, (uint32_t) (bits >> 32));
+}
+
+/* comma-separated column names, padded with zeros to 8 bytes */
+static char *
+column_names(const options_t * options, const int spectrum_size, size_t * size)
+{
+  static const char * moments = "centroid,spread,skewness,kurtosis,";
+  static const char * pitch = "pitch,energy,ac1,voiced,";
+  char * names = malloc(options->columns * 16 + 80);
+  char * p = names;
+  int i;
+
+  if(names == NULL)
+  {
+    return NULL;
+  }
+
+  if(options->features & feature_fft)
+  {
+    for(i = 0; i < spectrum_size; i++)
+    {
+      p += sprintf(p, "fft%d,", i);
+    }
+  }
+
+  if(options->features & feature_bands)
+  {
+    for(i = 0; i < options->nbands; i++)
+    {
+      p += sprintf(p, "band%d,", i);
+    }
+  }
+
+  if(options->features & feature_mfcc)
+  {
+    for(i = 0; i < options->order; i++)
+    {
+      p += sprintf(p, "mfcc%d,", i);
+    }
+  }
+
+  if(options->features & feature_moments)
+  {
+    p += sprintf(p, "%s", moments);
+  }
+
+  if(options->features & feature_pitch)
+  {
+    p += sprintf(p, "%s", pitch);
+  }
+
+  /* replace the last comma */
+  p--;
+  do
+  {
+    *p++ = '\0';
+  }
+  while((p - names) % 8 != 0);
+
+  *size = p - names;
+  return names;
+}
+
+/* header and full size of the output file */
+static int
+create_output(const options_t * options, audio_file_t * file)
+{
+  unsigned char header[RTAM_HEADER_SIZE];
+  size_t names_size;
+  char * names = column_names(options, options->fft_size / 2 + 1, &names_size);
+  FILE * out;
+  int ret;
+
+  if(names == NULL)
+  {
+    return 0;
+  }
+
+  memcpy(header, "RTAM", 4);
+  write_u32(header + 4, RTAM_VERSION);
+  write_u32(header + 8, (uint32_t) file->nframes);
+  write_u32(header + 12, (uint32_t) ((uint64_t) file->nframes >> 32));
+  write_u32(header + 16, options->columns);
+  write_u32(header + 20, names_size);
+  write_f64(header + 24, file->sample_rate);
+  write_f64(header + 32, options->hop_size / file->sample_rate);
+
+  out = fopen(file->output_path, "wb");
+  if(out == NULL)
+  {
+    free(names);
+    return 0;
+  }
+
+  ret = fwrite(header, RTAM_HEADER_SIZE, 1, out) == 1
+    && fwrite(names, names_size, 1, out) == 1;
+
+  /* allocate the data, written by the jobs */
+  if(ret && file->nframes > 0)
+  {
+    ret = fseek(out, (long) (file->nframes * options->columns * sizeof(float) - 1),
+                SEEK_CUR) == 0
+      && fputc(0, out) == 0;
+  }
+
+  ret = fclose(out) == 0 && ret;
+  free(names);
+  return ret;
+}
+
+static long
+data_offset(const options_t * options)
+{
+  size_t names_size;
+  char * names = column_names(options, options->fft_size / 2 + 1, &names_size);
+
+  free(names);
+  return RTAM_HEADER_SIZE + names_size;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* features */
+
+/** per-job state of the feature chain */
+typedef struct
+{
+  const options_t * options;
+  int spectrum_size;
+  rta_real_t * window;
+  rta_real_t * frame;       /* frame_size */
+  rta_real_t * spectrum;    /* fft_size, then amplitudes in place */
+  rta_real_t * bands;       /* nbands */
+  rta_real_t * mel_weights;
+  unsigned int * mel_bounds;
+  rta_real_t * dct_weights;
+  rta_real_t * row;         /* columns */
+  rta_fft_setup_t * fft_setup;
+  rta_real_t fft_scale;
+  rta_real_t nyquist;
+  rta_psy_ana_t psy;
+  float pitch[4];           /* latest psy report */
+  int psy_exp;
+} chain_t;
+
+static int
+psy_report(void * receiver, double time, double freq, double energy, double ac1,
+           double voiced)
+{
+  chain_t * chain = receiver;
+
+  chain->pitch[0] = freq;
+  chain->pitch[1] = energy;
+  chain->pitch[2] = ac1;
+  chain->pitch[3] = voiced;
+  return 1;
+}
+
+static void
+chain_delete(chain_t * chain)
+{
+  if(chain->fft_setup != NULL)
+  {
+    rta_fft_setup_delete(chain->fft_setup);
+  }
+
+  if(chain->options->features & feature_pitch)
+  {
+    rta_psy_deinit(&chain->psy);
+  }
+
+  rta_free(chain->window);
+  rta_free(chain->mel_weights);
+  rta_free(chain->mel_bounds);
+}
+
+static int
+chain_init(chain_t * chain, const options_t * options, const double sample_rate)
+{
+  const int nbands = options->nbands;
+  int ret = 1;
+
+  memset(chain, 0, sizeof(chain_t));
+  chain->options = options;
+  chain->spectrum_size = options->fft_size / 2 + 1;
+  chain->fft_scale = 1.;
+
+  chain->window = rta_malloc((options->frame_size * 2 + options->fft_size + nbands
+                              + nbands * options->order + options->columns)
+                             * sizeof(rta_real_t));
+  if(chain->window == NULL)
+  {
+    return 0;
+  }
+
+  chain->frame = chain->window + options->frame_size;
+  chain->spectrum = chain->frame + options->frame_size;
+  chain->bands = chain->spectrum + options->fft_size;
+  chain->dct_weights = chain->bands + nbands;
+  chain->row = chain->dct_weights + nbands * options->order;
+
+  rta_window_hann_weights(chain->window, options->frame_size);
+  rta_dct_weights(chain->dct_weights, nbands, options->order, rta_dct_slaney);
+
+  if(options->features & (feature_bands | feature_mfcc))
+  {
+    chain->mel_weights = rta_malloc(nbands * chain->spectrum_size * sizeof(rta_real_t));
+    chain->mel_bounds = rta_malloc(nbands * 2 * sizeof(unsigned int));
+
+    ret = chain->mel_weights != NULL && chain->mel_bounds != NULL
+      && rta_spectrum_to_mel_bands_weights(
+        chain->mel_weights, chain->mel_bounds, chain->spectrum_size,
+        sample_rate, nbands, options->min_freq,
+        options->max_freq > 0. ? options->max_freq : sample_rate / 2., 1.,
+        rta_hz_to_mel_slaney, rta_mel_to_hz_slaney, rta_mel_slaney);
+  }
+
+  if(options->features & feature_pitch)
+  {
+    rta_psy_init(&chain->psy);
+    rta_psy_set_callback(&chain->psy, chain, psy_report);
+
+    /* largest downsampling that divides the hop size */
+    for(chain->psy_exp = 2; options->hop_size % (1 << chain->psy_exp) != 0;
+        chain->psy_exp--)
+      ;
+
+    rta_psy_reset(&chain->psy, options->min_pitch, options->max_pitch, sample_rate,
+                  options->hop_size, chain->psy_exp);
+  }
+
+  ret = ret && rta_fft_real_setup_new(
+    &chain->fft_setup, rta_fft_real_to_complex_1d, &chain->fft_scale,
+    chain->frame, options->frame_size, chain->spectrum, options->fft_size,
+    &chain->nyquist);
+
+  if(! ret)
+  {
+    chain->fft_setup = NULL;
+    chain_delete(chain);
+  }
+
+  return ret;
+}
+
+/* compute the row of the frame at sample start */
+static void
+chain_frame(chain_t * chain, const audio_file_t * file, const int64_t start)
+{
+  const options_t * options = chain->options;
+  const int half = options->fft_size / 2;
+  rta_real_t * row = chain->row;
+  rta_real_t * spectrum = chain->spectrum;
+  int i;
+
+  read_samples(file, start, options->frame_size, chain->frame);
+
+  if(options->features & feature_pitch)
+  {
+    /* the last hop of the frame */
+    rta_psy_calculate_input_vector(
+      &chain->psy, chain->frame + options->frame_size - options->hop_size,
+      options->hop_size, 1);
+  }
+
+  rta_window_apply_in_place(chain->frame, options->frame_size, chain->window);
+  rta_fft_real_execute(spectrum, chain->frame, options->frame_size,
+                       chain->fft_setup, &chain->nyquist);
+
+  /* amplitude spectrum, in place */
+  for(i = 0; i < half; i++)
+  {
+    spectrum[i] = hypot(spectrum[2 * i], spectrum[2 * i + 1]);
+  }
+  spectrum[half] = fabs(chain->nyquist);
+
+  if(options->features & feature_fft)
+  {
+    memcpy(row, spectrum, chain->spectrum_size * sizeof(rta_real_t));
+    row += chain->spectrum_size;
+  }
+
+  if(options->features & (feature_bands | feature_mfcc))
+  {
+    rta_spectrum_to_bands_abs(chain->bands, spectrum, chain->mel_weights,
+                              chain->mel_bounds, chain->spectrum_size,
+                              options->nbands);
+
+    if(options->features & feature_bands)
+    {
+      memcpy(row, chain->bands, options->nbands * sizeof(rta_real_t));
+      row += options->nbands;
+    }
+
+    if(options->features & feature_mfcc)
+    {
+      for(i = 0; i < options->nbands; i++)
+      {
+        chain->bands[i] = log(chain->bands[i] > LOG_FLOOR ? chain->bands[i] : LOG_FLOOR);
+      }
+
+      rta_dct(row, chain->bands, chain->dct_weights, options->nbands, options->order);
+      row += options->order;
+    }
+  }
+
+  if(options->features & feature_moments)
+  {
+    const rta_real_t bin_hz = file->sample_rate / options->fft_size;
+    rta_real_t sum, centroid, spread;
+
+    centroid = rta_weighted_moment_1_indexes(&sum, spectrum, chain->spectrum_size);
+
+    if(sum > 0.)
+    {
+      spread = sqrt(rta_weighted_moment_2_indexes(spectrum, chain->spectrum_size,
+                                                  centroid, sum));
+      row[1] = spread * bin_hz;
+      row[2] = spread > 0. ? rta_std_weighted_moment_3_indexes(
+        spectrum, chain->spectrum_size, centroid, sum, spread) : 0.;
+      row[3] = spread > 0. ? rta_std_weighted_moment_4_indexes(
+        spectrum, chain->spectrum_size, centroid, sum, spread) : 0.;
+    }
+    else
+    {
+      row[1] = row[2] = row[3] = 0.;
+    }
+
+    row[0] = centroid * bin_hz;
+    row += 4;
+  }
+
+  if(options->features & feature_pitch)
+  {
+    for(i = 0; i < 4; i++)
+    {
+      row[i] = chain->pitch[i];
+    }
+  }
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* jobs */
+
+static int
+run_job(const options_t * options, const job_t * job)
+{
+  audio_file_t * file = job->file;
+  const int hop = options->hop_size;
+  /* the frame i ends at the end of the hop i */
+  const int64_t frame_offset = hop - options->frame_size;
+  chain_t chain;
+  FILE * out;
+  int64_t f;
+  int ret = 1;
+
+  if(! chain_init(&chain, options, file->sample_rate))
+  {
+    return 0;
+  }
+
+  out = fopen(file->output_path, "r+b");
+  if(out == NULL
+     || fseek(out, (long) (data_offset(options) + job->first_frame * options->columns
+                           * sizeof(float)), SEEK_SET) != 0)
+  {
+    ret = 0;
+  }
+
+  if(ret && (options->features & feature_pitch) && job->first_frame > 0)
+  {
+    /* warm up the pitch tracker before the segment */
+    const int64_t end = job->first_frame * hop;
+    int64_t start = end - (int64_t) (PITCH_PREROLL * file->sample_rate);
+
+    start = start > 0 ? start - start % hop : 0;
+
+    for(; start < end; start += hop)
+    {
+      read_samples(file, start, hop, chain.frame);
+      rta_psy_calculate_input_vector(&chain.psy, chain.frame, hop, 1);
+    }
+  }
+
+  for(f = job->first_frame; ret && f < job->first_frame + job->nframes; f++)
+  {
+    chain_frame(&chain, file, f * hop + frame_offset);
+    ret = fwrite(chain.row, sizeof(float), options->columns, out)
+      == (size_t) options->columns;
+  }
+
+  if(out != NULL && fclose(out) != 0)
+  {
+    ret = 0;
+  }
+
+  chain_delete(&chain);
+  return ret;
+}
+
+static void
+run_jobs(void * context, int begin, int end)
+{
+  extract_context_t * extract = context;
+  int j;
+
+  for(j = begin; j < end; j++)
+  {
+    if(! run_job(extract->options, &extract->jobs[j]))
+    {
+      /* only ever set to 1, a race is harmless */
+      extract->jobs[j].file->failed = 1;
+    }
+  }
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* main */
+
+static void
+usage(void)
+{
+  fprintf(stderr,
+"usage: rta_extract [options] files...\n"
+"  -f features   comma-separated chain of fft, bands, mfcc, moments, pitch\n"
+"                (default mfcc)\n"
+"  -w size       frame size in samples (default 1024)\n"
+"  -h size       hop size in samples (default 256)\n"
+"  -n size       FFT size, at least the frame size (default frame size)\n"
+"  -b bands      number of mel bands (default 40)\n"
+"  -o order      number of MFCC (default 13)\n"
+"  -l hz         lowest mel band frequency (default 0)\n"
+"  -u hz         highest mel band frequency (default sample rate / 2)\n"
+"  -p min,max    pitch range in Hz (default 50,2000)\n"
+"  -s seconds    segment length of the jobs (default 60)\n"
+"  -j threads    number of threads (default all processors)\n"
+"  -d directory  output directory (default next to the inputs)\n"
+"  -r rate,channels,format\n"
+"                raw PCM input, format u8, s16, s24, s32, f32 or f64\n"
+"Writes <input>.rtam for each input.\n");
+}
+
+static int
+parse_features(const char * list)
+{
+  int features = 0;
+
+  while(*list != '\0')
+  {
+    size_t length = strcspn(list, ",");
+    int i;
+
+    for(i = 0; feature_names[i].name != NULL; i++)
+    {
+      if(strlen(feature_names[i].name) == length
+         && strncmp(list, feature_names[i].name, length) == 0)
+      {
+        features |= feature_names[i].feature;
+        break;
+      }
+    }
+
+    if(feature_names[i].name == NULL)
+    {
+      return 0;
+    }
+
+    list += length + (list[length] == ',');
+  }
+
+  return features;
+}
+
+static int
+parse_raw(options_t * options, const char * spec)
+{
+  static const char * formats[] = { "u8", "s16", "s24", "s32", "f32", "f64", NULL };
+  char format[8];
+  int i;
+
+  if(sscanf(spec, "%lf,%d,%7s", &options->raw_sample_rate, &options->raw_channels,
+            format) != 3
+     || options->raw_sample_rate <= 0. || options->raw_channels < 1)
+  {
+    return 0;
+  }
+
+  for(i = 0; formats[i] != NULL; i++)
+  {
+    if(strcmp(format, formats[i]) == 0)
+    {
+      options->raw_format = i;
+      options->raw = 1;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+static char *
+output_path(const options_t * options, const char * input)
+{
+  const char * base = input;
+  const char * p;
+  char * path;
+
+  if(options->output_directory != NULL)
+  {
+    for(p = input; *p != '\0'; p++)
+    {
+      if(*p == '/' || *p == '\\')
+      {
+        base = p + 1;
+      }
+    }
+  }
+
+  path = malloc((options->output_directory != NULL ?
+                 strlen(options->output_directory) : 0) + strlen(base) + 7);
+
+  if(path != NULL)
+  {
+    if(options->output_directory != NULL)
+    {
+      sprintf(path, "%s/%s.rtam", options->output_directory, base);
+    }
+    else
+    {
+      sprintf(path, "%s.rtam", input);
+    }
+  }
+
+  return path;
+}
+
+static int
+open_file(const options_t * options, audio_file_t * file)
+{
+  if(! map_file(file))
+  {
+    fprintf(stderr, "rta_extract: %s: %s\n", file->path, strerror(errno));
+    return 0;
+  }
+
+  if(options->raw)
+  {
+    file->format = options->raw_format;
+    file->channels = options->raw_channels;
+    file->sample_rate = options->raw_sample_rate;
+    file->samples = file->map;
+    file->nsamples = file->map_size / (sample_sizes[file->format] * file->channels);
+  }
+  else if(! parse_wav(file))
+  {
+    fprintf(stderr, "rta_extract: %s: not a supported WAV file\n", file->path);
+    return 0;
+  }
+
+  file->nframes = (file->nsamples + options->hop_size - 1) / options->hop_size;
+  file->output_path = output_path(options, file->path);
+
+  if(file->output_path == NULL || ! create_output(options, file))
+  {
+    fprintf(stderr, "rta_extract: %s: can't write %s\n", file->path,
+            file->output_path != NULL ? file->output_path : "output");
+    return 0;
+  }
+
+  return 1;
+}
+
+int
+main(int argc, char * argv[])
+{
+  options_t options;
+  extract_context_t extract;
+  audio_file_t * files;
+  int nfiles, njobs = 0, nfailed = 0, num_threads = 0, fft_size, i;
+  const char * features = "mfcc";
+
+  options.frame_size = 1024;
+  options.hop_size = 256;
+  options.fft_size = 0;
+  options.nbands = 40;
+  options.order = 13;
+  options.segment_seconds = 60.;
+  options.min_freq = 0.;
+  options.max_freq = 0.;
+  options.min_pitch = 50.;
+  options.max_pitch = 2000.;
+  options.raw = 0;
+  options.output_directory = NULL;
+
+  for(i = 1; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++)
+  {
+    const char option = argv[i][1];
+    const char * value = argv[i][2] != '\0' ? argv[i] + 2 :
+      (i + 1 < argc ? argv[++i] : NULL);
+    int ok = value != NULL;
+
+    if(ok)
+    {
+      switch(option)
+      {
+        case 'f': features = value; break;
+        case 'w': options.frame_size = atoi(value); break;
+        case 'h': options.hop_size = atoi(value); break;
+        case 'n': options.fft_size = atoi(value); break;
+        case 'b': options.nbands = atoi(value); break;
+        case 'o': options.order = atoi(value); break;
+        case 'l': options.min_freq = atof(value); break;
+        case 'u': options.max_freq = atof(value); break;
+        case 'p':
+          ok = sscanf(value, "%lf,%lf", &options.min_pitch, &options.max_pitch) == 2;
+          break;
+        case 's': options.segment_seconds = atof(value); break;
+        case 'j': num_threads = atoi(value); break;
+        case 'd': options.output_directory = value; break;
+        case 'r': ok = parse_raw(&options, value); break;
+        default: ok = 0;
+      }
+    }
+
+    if(! ok)
+    {
+      usage();
+      return 2;
+    }
+  }
+
+  options.features = parse_features(features);
+  nfiles = argc - i;
+
+  /* the FFT works on powers of 2 */
+  for(fft_size = 1; fft_size < options.fft_size || fft_size < options.frame_size;
+      fft_size <<= 1)
+    ;
+  options.fft_size = fft_size;
+
+  if(options.features == 0 || nfiles < 1 || options.frame_size < 2
+     || options.hop_size < 1 || options.hop_size > options.frame_size
+     || options.nbands < 1 || options.order < 1 || options.segment_seconds <= 0.)
+  {
+    usage();
+    return 2;
+  }
+
+  options.columns =
+    (options.features & feature_fft ? options.fft_size / 2 + 1 : 0)
+    + (options.features & feature_bands ? options.nbands : 0)
+    + (options.features & feature_mfcc ? options.order : 0)
+    + (options.features & feature_moments ? 4 : 0)
+    + (options.features & feature_pitch ? 4 : 0);
+
+  files = calloc(nfiles, sizeof(audio_file_t));
+  if(files == NULL)
+  {
+    return 1;
+  }
+
+  /* open the inputs and create the outputs */
+  for(i = 0; i < nfiles; i++)
+  {
+    files[i].path = argv[argc - nfiles + i];
+
+    if(open_file(&options, &files[i]))
+    {
+      int64_t segment = (int64_t) (options.segment_seconds * files[i].sample_rate
+                                   / options.hop_size) + 1;
+
+      njobs += (files[i].nframes + segment - 1) / segment;
+    }
+    else
+    {
+      files[i].failed = 1;
+    }
+  }
+
+  /* split into segments */
+  extract.options = &options;
+  extract.jobs = malloc((njobs > 0 ? njobs : 1) * sizeof(job_t));
+  if(extract.jobs == NULL)
+  {
+    return 1;
+  }
+
+  for(i = 0, njobs = 0; i < nfiles; i++)
+  {
+    int64_t segment = (int64_t) (options.segment_seconds * files[i].sample_rate
+                                 / options.hop_size) + 1;
+    int64_t f;
+
+    for(f = 0; ! files[i].failed && f < files[i].nframes; f += segment)
+    {
+      extract.jobs[njobs].file = &files[i];
+      extract.jobs[njobs].first_frame = f;
+      extract.jobs[njobs].nframes =
+        f + segment < files[i].nframes ? segment : files[i].nframes - f;
+      njobs++;
+    }
+  }
+
+  rta_parallel_set_num_threads(num_threads);
+  rta_parallel_for(njobs, 1, run_jobs, &extract);
+  rta_parallel_shutdown();
+
+  for(i = 0; i < nfiles; i++)
+  {
+    if(files[i].failed)
+    {
+      if(files[i].map != NULL)
+      {
+        fprintf(stderr, "rta_extract: %s: extraction failed\n", files[i].path);
+      }
+
+      nfailed++;
+    }
+
+    unmap_file(&files[i]);
+    free(files[i].output_path);
+  }
+
+  free(extract.jobs);
+  free(files);
+
+  return nfailed > 0;
+}
@@ -0,0 +1,1007 @@
+/**
+ * @file   rtamodule.c
+ *
+ * @brief  Python extension: zero-copy access to rta over the buffer protocol
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Arrays are exchanged through the buffer protocol: inputs must be
+ * C-contiguous float32 buffers (NumPy arrays, memoryviews, array.array)
+ * and are used in place, without copies. Results are allocated once,
+ * written in place, and returned as NumPy arrays when NumPy can be
+ * imported, as memoryviews otherwise.
+ *
+ * All computations run without the GIL, so that calls from several
+ * Python threads run in parallel.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <structmember.h>
+#include <pythread.h>
+
+#include <math.h>
+#include <string.h>
+
+#include "rta_configuration.h"
+#include "rta_fft.h"
+#include "rta_window.h"
+#include "rta_mel.h"
+#include "rta_bands.h"
+#include "rta_dct.h"
+#include "rta_mean_variance.h"
+#include "rta_kdtree.h"
+#include "rta_dtw.h"
+#include "rta_parallel.h"
+
+/* numpy.asarray, or NULL without NumPy */
+static PyObject * numpy_asarray = NULL;
+
+/* log floor of the mel bands in mfcc */
+#define RTA_PY_LOG_FLOOR 1e-10
+
+
+/* ---------------------------------------------------------------------- */
+/* buffers */
+
+static int
+is_real_format(const char * format)
+{
+  if(format == NULL)
+  {
+    return 0;
+  }
+
+  /* native or standard size and byte order */
+  if(format[0] == '@' || format[0] == '='
+#if PY_LITTLE_ENDIAN
+     || format[0] == '<'
+#else
+     || format[0] == '>' || format[0] == '!'
+#endif
+    )
+  {
+    format++;
+  }
+
+  return strcmp(format, RTA_PY_REAL_FORMAT) == 0;
+}
+
+/* get a C-contiguous rta_real_t buffer of 1 or 2 dimensions, seen
+   as rows * columns */
+static int
+get_real_buffer(PyObject * object, Py_buffer * view, const char * name,
+                Py_ssize_t * rows, Py_ssize_t * columns)
+{
+  if(PyObject_GetBuffer(object, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0)
+  {
+    return 0;
+  }
+
+  if(! is_real_format(view->format) || view->itemsize != sizeof(rta_real_t)
+     || view->ndim < 1 || view->ndim > 2)
+  {
+    PyErr_Format(PyExc_TypeError,
+                 "%s must be a C-contiguous float32 array of 1 or 2 dimensions",
+                 name);
+    PyBuffer_Release(view);
+    return 0;
+  }
+
+  if(view->ndim == 1)
+  {
+    *rows = 1;
+    *columns = view->shape[0];
+  }
+  else
+  {
+    *rows = view->shape[0];
+    *columns = view->shape[1];
+  }
+
+  return 1;
+}
+
+/* new array of ndim dimensions, written through data */
+static PyObject *
+new_array(const char * format, const Py_ssize_t item_size,
+          const int ndim, const Py_ssize_t * shape, void ** data)
+{
+  PyObject * bytes, * view, * shape_tuple, * array;
+  Py_ssize_t size = item_size;
+  int i;
+
+  for(i = 0; i < ndim; i++)
+  {
+    size *= shape[i];
+  }
+
+  bytes = PyByteArray_FromStringAndSize(NULL, size);
+  if(bytes == NULL)
+  {
+    return NULL;
+  }
+
+  *data = PyByteArray_AS_STRING(bytes);
+  view = PyMemoryView_FromObject(bytes);
+  Py_DECREF(bytes);
+  if(view == NULL)
+  {
+    return NULL;
+  }
+
+  shape_tuple = PyTuple_New(ndim);
+  if(shape_tuple == NULL)
+  {
+    Py_DECREF(view);
+    return NULL;
+  }
+
+  for(i = 0; i < ndim; i++)
+  {
+    PyTuple_SET_ITEM(shape_tuple, i, PyLong_FromSsize_t(shape[i]));
+  }
+
+  array = PyObject_CallMethod(view, "cast", "sO", format, shape_tuple);
+  Py_DECREF(shape_tuple);
+  Py_DECREF(view);
+
+  if(array != NULL && numpy_asarray != NULL)
+  {
+    PyObject * numpy_array = PyObject_CallFunctionObjArgs(numpy_asarray, array, NULL);
+
+    Py_DECREF(array);
+    array = numpy_array;
+  }
+
+  return array;
+}
+
+/* new rta_real_t array with the rows of input (1 or 2 dimensions)
+   and columns, more dimensions in extra */
+static PyObject *
+new_real_array_like(const Py_buffer * input, const Py_ssize_t columns,
+                    const Py_ssize_t extra, rta_real_t ** data)
+{
+  Py_ssize_t shape[3];
+  int ndim = 0;
+
+  if(input->ndim == 2)
+  {
+    shape[ndim++] = input->shape[0];
+  }
+
+  shape[ndim++] = columns;
+
+  if(extra > 0)
+  {
+    shape[ndim++] = extra;
+  }
+
+  return new_array(RTA_PY_REAL_FORMAT, sizeof(rta_real_t), ndim, shape,
+                   (void **) data);
+}
+
+static unsigned int
+next_power_of_2(const unsigned int n)
+{
+  unsigned int size = 1;
+
+  while(size < n)
+  {
+    size <<= 1;
+  }
+
+  return size;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* fft */
+
+PyDoc_STRVAR(fft_doc,
+"fft(x, fft_size=0)\n\n"
+"Real FFT of x (n) or of each row of x (rows, n), zero-padded to\n"
+"fft_size (at least n, rounded up to a power of 2).\n"
+"Returns the spectrum up to Nyquist as (..., fft_size / 2 + 1, 2)\n"
+"real and imaginary parts.");
+
+static PyObject *
+rta_py_fft(PyObject * self, PyObject * args, PyObject * kwargs)
+{
+  static char * keywords[] = { "x", "fft_size", NULL };
+  PyObject * x_object, * result = NULL;
+  Py_buffer x;
+  Py_ssize_t rows, n, r;
+  unsigned int fft_size = 0;
+  rta_fft_setup_t * fft_setup;
+  rta_real_t * out, scale = 1., nyquist;
+  int ret;
+
+  if(! PyArg_ParseTupleAndKeywords(args, kwargs, "O|I:fft", keywords,
+                                   &x_object, &fft_size)
+     || ! get_real_buffer(x_object, &x, "x", &rows, &n))
+  {
+    return NULL;
+  }
+
+  fft_size = next_power_of_2(fft_size > n ? fft_size : (unsigned int) n);
+  result = new_real_array_like(&x, fft_size / 2 + 1, 2, &out);
+
+  if(result != NULL)
+  {
+    Py_BEGIN_ALLOW_THREADS
+    ret = rta_fft_real_setup_new(&fft_setup, rta_fft_real_to_complex_1d, &scale,
+                                 x.buf, n, out, fft_size, &nyquist);
+    if(ret)
+    {
+      for(r = 0; r < rows; r++)
+      {
+        rta_real_t * spectrum = out + r * (fft_size + 2);
+
+        rta_fft_real_execute(spectrum, (rta_real_t *) x.buf + r * n, n,
+                             fft_setup, &nyquist);
+        spectrum[fft_size] = nyquist;
+        spectrum[fft_size + 1] = 0.;
+      }
+
+      rta_fft_setup_delete(fft_setup);
+    }
+    Py_END_ALLOW_THREADS
+
+    if(! ret)
+    {
+      Py_CLEAR(result);
+      PyErr_NoMemory();
+    }
+  }
+
+  PyBuffer_Release(&x);
+  return result;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* mel bands, dct, mfcc */
+
+/* mel bands weights, NULL on failure (the caller sets the error) */
+static rta_real_t *
+mel_weights_new(unsigned int ** bounds, const unsigned int spectrum_size,
+                const rta_real_t sample_rate, const unsigned int nbands,
+                const rta_real_t min_freq, const rta_real_t max_freq, const int htk)
+{
+  rta_real_t * weights = rta_malloc(nbands * spectrum_size * sizeof(rta_real_t));
+
+  *bounds = rta_malloc(nbands * 2 * sizeof(unsigned int));
+
+  if(weights == NULL || *bounds == NULL
+     || ! rta_spectrum_to_mel_bands_weights(
+       weights, *bounds, spectrum_size, sample_rate, nbands,
+       min_freq, max_freq > 0. ? max_freq : sample_rate / 2., 1.,
+       htk ? rta_hz_to_mel_htk : rta_hz_to_mel_slaney,
+       htk ? rta_mel_to_hz_htk : rta_mel_to_hz_slaney,
+       htk ? rta_mel_htk : rta_mel_slaney))
+  {
+    rta_free(weights);
+    rta_free(*bounds);
+    return NULL;
+  }
+
+  return weights;
+}
+
+PyDoc_STRVAR(mel_bands_doc,
+"mel_bands(spectrum, sample_rate, nbands=40, min_freq=0, max_freq=0, htk=False)\n\n"
+"Mel bands of the amplitude spectrum (spectrum_size) or of each row of\n"
+"spectrum (rows, spectrum_size), where spectrum_size is fft_size / 2 + 1.\n"
+"max_freq 0 is sample_rate / 2. Returns (..., nbands).");
+
+static PyObject *
+rta_py_mel_bands(PyObject * self, PyObject * args, PyObject * kwargs)
+{
+  static char * keywords[] = { "spectrum", "sample_rate", "nbands",
+                               "min_freq", "max_freq", "htk", NULL };
+  PyObject * spectrum_object, * result = NULL;
+  Py_buffer spectrum;
+  Py_ssize_t rows, spectrum_size, r;
+  float sample_rate, min_freq = 0., max_freq = 0.;
+  unsigned int nbands = 40, * bounds;
+  int htk = 0;
+  rta_real_t * weights, * out;
+
+  if(! PyArg_ParseTupleAndKeywords(args, kwargs, "Of|Iffp:mel_bands", keywords,
+                                   &spectrum_object, &sample_rate, &nbands,
+                                   &min_freq, &max_freq, &htk)
+     || ! get_real_buffer(spectrum_object, &spectrum, "spectrum",
+                          &rows, &spectrum_size))
+  {
+    return NULL;
+  }
+
+  result = new_real_array_like(&spectrum, nbands, 0, &out);
+
+  if(result != NULL)
+  {
+    Py_BEGIN_ALLOW_THREADS
+    weights = mel_weights_new(&bounds, spectrum_size, sample_rate, nbands,
+                              min_freq, max_freq, htk);
+    if(weights != NULL)
+    {
+      for(r = 0; r < rows; r++)
+      {
+        rta_spectrum_to_bands_abs(out + r * nbands,
+                                  (rta_real_t *) spectrum.buf + r * spectrum_size,
+                                  weights, bounds, spectrum_size, nbands);
+      }
+
+      rta_free(weights);
+      rta_free(bounds);
+    }
+    Py_END_ALLOW_THREADS
+
+    if(weights == NULL)
+    {
+      Py_CLEAR(result);
+      PyErr_SetString(PyExc_ValueError, "mel_bands: invalid parameters");
+    }
+  }
+
+  PyBuffer_Release(&spectrum);
+  return result;
+}
+
+PyDoc_STRVAR(dct_doc,
+"dct(x, order=13)\n\n"
+"Unitary DCT-II (Slaney) of x (n) or of each row of x (rows, n).\n"
+"Returns the first order coefficients (..., order).");
+
+static PyObject *
+rta_py_dct(PyObject * self, PyObject * args, PyObject * kwargs)
+{
+  static char * keywords[] = { "x", "order", NULL };
+  PyObject * x_object, * result = NULL;
+  Py_buffer x;
+  Py_ssize_t rows, n, r;
+  unsigned int order = 13;
+  rta_real_t * weights, * out;
+
+  if(! PyArg_ParseTupleAndKeywords(args, kwargs, "O|I:dct", keywords,
+                                   &x_object, &order)
+     || ! get_real_buffer(x_object, &x, "x", &rows, &n))
+  {
+    return NULL;
+  }
+
+  result = new_real_array_like(&x, order, 0, &out);
+
+  if(result != NULL)
+  {
+    Py_BEGIN_ALLOW_THREADS
+    weights = rta_malloc(n * order * sizeof(rta_real_t));
+    if(weights != NULL)
+    {
+      rta_dct_weights(weights, n, order, rta_dct_slaney);
+
+      for(r = 0; r < rows; r++)
+      {
+        rta_dct(out + r * order, (rta_real_t *) x.buf + r * n, weights, n, order);
+      }
+
+      rta_free(weights);
+    }
+    Py_END_ALLOW_THREADS
+
+    if(weights == NULL)
+    {
+      Py_CLEAR(result);
+      PyErr_NoMemory();
+    }
+  }
+
+  PyBuffer_Release(&x);
+  return result;
+}
+
+PyDoc_STRVAR(mfcc_doc,
+"mfcc(frames, sample_rate, nbands=40, order=13, min_freq=0, max_freq=0,\n"
+"     fft_size=0, htk=False)\n\n"
+"MFCC of the frame (n) or of each row of frames (rows, n): Hann\n"
+"window, FFT, amplitude spectrum, mel bands, log, DCT.\n"
+"Returns (..., order).");
+
+static PyObject *
+rta_py_mfcc(PyObject * self, PyObject * args, PyObject * kwargs)
+{
+  static char * keywords[] = { "frames", "sample_rate", "nbands", "order",
+                               "min_freq", "max_freq", "fft_size", "htk", NULL };
+  PyObject * frames_object, * result = NULL;
+  Py_buffer frames;
+  Py_ssize_t rows, n, r;
+  float sample_rate, min_freq = 0., max_freq = 0.;
+  unsigned int nbands = 40, order = 13, fft_size = 0, spectrum_size, * bounds = NULL;
+  unsigned int i;
+  int htk = 0, ret = 0;
+  rta_fft_setup_t * fft_setup;
+  rta_real_t * window, * spectrum, * bands, * mel_weights = NULL, * dct_weights;
+  rta_real_t * out, scale = 1., nyquist;
+
+  if(! PyArg_ParseTupleAndKeywords(args, kwargs, "Of|IIffIp:mfcc", keywords,
+                                   &frames_object, &sample_rate, &nbands, &order,
+                                   &min_freq, &max_freq, &fft_size, &htk)
+     || ! get_real_buffer(frames_object, &frames, "frames", &rows, &n))
+  {
+    return NULL;
+  }
+
+  fft_size = next_power_of_2(fft_size > n ? fft_size : (unsigned int) n);
+  spectrum_size = fft_size / 2 + 1;
+  result = new_real_array_like(&frames, order, 0, &out);
+
+  if(result != NULL)
+  {
+    Py_BEGIN_ALLOW_THREADS
+    /* window, windowed frame and spectrum, bands, dct weights */
+    window = rta_malloc((n + fft_size + nbands + nbands * order) * sizeof(rta_real_t));
+    if(window != NULL)
+    {
+      rta_real_t * frame = window + n;
+
+      spectrum = frame;         /* in place */
+      bands = frame + fft_size;
+      dct_weights = bands + nbands;
+
+      rta_window_hann_weights(window, n);
+      rta_dct_weights(dct_weights, nbands, order, rta_dct_slaney);
+      mel_weights = mel_weights_new(&bounds, spectrum_size, sample_rate, nbands,
+                                    min_freq, max_freq, htk);
+
+      if(mel_weights != NULL
+         && rta_fft_real_setup_new(&fft_setup, rta_fft_real_to_complex_1d, &scale,
+                                   frame, n, frame, fft_size, &nyquist))
+      {
+        for(r = 0; r < rows; r++)
+        {
+          rta_window_apply(frame, n, (rta_real_t *) frames.buf + r * n, window);
+          rta_fft_real_execute(frame, frame, n, fft_setup, &nyquist);
+
+          /* amplitude spectrum, in place up to Nyquist */
+          for(i = 0; i < fft_size / 2; i++)
+          {
+            spectrum[i] = hypot(frame[2 * i], frame[2 * i + 1]);
+          }
+          spectrum[fft_size / 2] = fabs(nyquist);
+
+          rta_spectrum_to_bands_abs(bands, spectrum, mel_weights, bounds,
+                                    spectrum_size, nbands);
+
+          for(i = 0; i < nbands; i++)
+          {
+            bands[i] = log(bands[i] > RTA_PY_LOG_FLOOR ? bands[i] : RTA_PY_LOG_FLOOR);
+          }
+
+          rta_dct(out + r * order, bands, dct_weights, nbands, order);
+        }
+
+        rta_fft_setup_delete(fft_setup);
+        ret = 1;
+      }
+
+      rta_free(mel_weights);
+      rta_free(bounds);
+      rta_free(window);
+    }
+    Py_END_ALLOW_THREADS
+
+    if(! ret)
+    {
+      Py_CLEAR(result);
+      PyErr_SetString(PyExc_ValueError, "mfcc: invalid parameters or out of memory");
+    }
+  }
+
+  PyBuffer_Release(&frames);
+  return result;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* statistics */
+
+PyDoc_STRVAR(mean_variance_doc,
+"mean_variance(x, unbiased=False)\n\n"
+"Mean and variance of x (n), or of each column of x (rows, columns).\n"
+"Returns a tuple (mean, variance) of floats, or of (columns) arrays.");
+
+static PyObject *
+rta_py_mean_variance(PyObject * self, PyObject * args, PyObject * kwargs)
+{
+  static char * keywords[] = { "x", "unbiased", NULL };
+  PyObject * x_object, * mean_object, * variance_object;
+  Py_buffer x;
+  Py_ssize_t rows, columns, c;
+  int unbiased = 0;
+  rta_real_t mean, variance, * means, * variances;
+
+  if(! PyArg_ParseTupleAndKeywords(args, kwargs, "O|p:mean_variance", keywords,
+                                   &x_object, &unbiased)
+     || ! get_real_buffer(x_object, &x, "x", &rows, &columns))
+  {
+    return NULL;
+  }
+
+  if(x.ndim == 1)
+  {
+    Py_BEGIN_ALLOW_THREADS
+    if(unbiased)
+    {
+      rta_mean_variance_unbiased(&mean, &variance, x.buf, columns);
+    }
+    else
+    {
+      rta_mean_variance(&mean, &variance, x.buf, columns);
+    }
+    Py_END_ALLOW_THREADS
+
+    PyBuffer_Release(&x);
+    return Py_BuildValue("(ff)", mean, variance);
+  }
+
+  mean_object = new_array(RTA_PY_REAL_FORMAT, sizeof(rta_real_t), 1, &columns,
+                          (void **) &means);
+  variance_object = new_array(RTA_PY_REAL_FORMAT, sizeof(rta_real_t), 1, &columns,
+                              (void **) &variances);
+
+  if(mean_object == NULL || variance_object == NULL)
+  {
+    Py_XDECREF(mean_object);
+    Py_XDECREF(variance_object);
+    PyBuffer_Release(&x);
+    return NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  for(c = 0; c < columns; c++)
+  {
+    if(unbiased)
+    {
+      rta_mean_variance_unbiased_stride(means + c, variances + c,
+                                        (rta_real_t *) x.buf + c, columns, rows);
+    }
+    else
+    {
+      rta_mean_variance_stride(means + c, variances + c,
+                               (rta_real_t *) x.buf + c, columns, rows);
+    }
+  }
+  Py_END_ALLOW_THREADS
+
+  PyBuffer_Release(&x);
+  return Py_BuildValue("(NN)", mean_object, variance_object);
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* kd-tree */
+
+typedef struct
+{
+  PyObject_HEAD
+  rta_kdtree_t tree;
+  int initialised;
+  Py_buffer data;         /* held as long as the tree */
+  rta_real_t * block;     /* the tree data block */
+  int nvectors;           /* its size */
+  PyThread_type_lock lock; /* searches share the tree's stack */
+} rta_py_kdtree_t;
+
+static void
+kdtree_clear(rta_py_kdtree_t * self)
+{
+  if(self->initialised)
+  {
+    rta_kdtree_free(&self->tree);
+    PyBuffer_Release(&self->data);
+    self->initialised = 0;
+  }
+}
+
+static int
+kdtree_init(rta_py_kdtree_t * self, PyObject * args, PyObject * kwargs)
+{
+  static char * keywords[] = { "data", "height", NULL };
+  PyObject * data_object;
+  Py_ssize_t rows, columns;
+  int height = -1;
+
+  if(! PyArg_ParseTupleAndKeywords(args, kwargs, "O|i:KDTree", keywords,
+                                   &data_object, &height))
+  {
+    return -1;
+  }
+
+  if(self->lock == NULL)
+  {
+    self->lock = PyThread_allocate_lock();
+    if(self->lock == NULL)
+    {
+      PyErr_NoMemory();
+      return -1;
+    }
+  }
+
+  kdtree_clear(self);
+
+  if(! get_real_buffer(data_object, &self->data, "data", &rows, &columns))
+  {
+    return -1;
+  }
+
+  if(self->data.ndim != 2 || rows < 1 || rows > INT_MAX)
+  {
+    PyErr_SetString(PyExc_ValueError, "data must have (vectors, dimensions) rows");
+    PyBuffer_Release(&self->data);
+    return -1;
+  }
+
+  self->block = self->data.buf;
+  self->nvectors = rows;
+
+  Py_BEGIN_ALLOW_THREADS
+  rta_kdtree_init(&self->tree);
+  self->tree.givenheight = height;
+  rta_kdtree_set_data(&self->tree, 1, &self->block, NULL, &self->nvectors, columns);
+  rta_kdtree_init_nodes(&self->tree, NULL, NULL, NULL);
+  rta_kdtree_build(&self->tree, 0);
+  Py_END_ALLOW_THREADS
+
+  self->initialised = 1;
+  return 0;
+}
+
+static void
+kdtree_dealloc(rta_py_kdtree_t * self)
+{
+  kdtree_clear(self);
+
+  if(self->lock != NULL)
+  {
+    PyThread_free_lock(self->lock);
+  }
+
+  Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+PyDoc_STRVAR(kdtree_search_doc,
+"search(x, k=1, radius=0)\n\n"
+"The k nearest neighbours of x (dimensions) or of each row of x\n"
+"(rows, dimensions), within the squared distance radius (0 is no\n"
+"limit). Returns a tuple of (..., k) int32 data row indices and\n"
+"float32 squared distances, by increasing distance; missing\n"
+"neighbours have index -1 and an infinite distance.");
+
+static PyObject *
+kdtree_search(rta_py_kdtree_t * self, PyObject * args, PyObject * kwargs)
+{
+  static char * keywords[] = { "x", "k", "radius", NULL };
+  PyObject * x_object, * indices_object, * distances_object;
+  Py_buffer x;
+  Py_ssize_t rows, columns, r, shape[2];
+  unsigned int k = 1;
+  float radius = 0.;
+  int * indices, i, found;
+  rta_real_t * distances;
+  rta_kdtree_object_t * objects;
+
+  if(! self->initialised)
+  {
+    PyErr_SetString(PyExc_RuntimeError, "KDTree not initialised");
+    return NULL;
+  }
+
+  if(! PyArg_ParseTupleAndKeywords(args, kwargs, "O|If:search", keywords,
+                                   &x_object, &k, &radius)
+     || ! get_real_buffer(x_object, &x, "x", &rows, &columns))
+  {
+    return NULL;
+  }
+
+  if(columns != self->tree.ndim || k < 1)
+  {
+    PyErr_Format(PyExc_ValueError, "x must have %d dimensions, and k be positive",
+                 self->tree.ndim);
+    PyBuffer_Release(&x);
+    return NULL;
+  }
+
+  shape[0] = rows;
+  shape[1] = k;
+  indices_object = new_array("i", sizeof(int), x.ndim, shape + 2 - x.ndim,
+                             (void **) &indices);
+  distances_object = new_real_array_like(&x, k, 0, &distances);
+  objects = PyMem_Malloc(k * sizeof(rta_kdtree_object_t));
+
+  if(indices_object == NULL || distances_object == NULL || objects == NULL)
+  {
+    Py_XDECREF(indices_object);
+    Py_XDECREF(distances_object);
+    PyMem_Free(objects);
+    PyBuffer_Release(&x);
+    return objects == NULL ? PyErr_NoMemory() : NULL;
+  }
+
+  Py_BEGIN_ALLOW_THREADS
+  PyThread_acquire_lock(self->lock, WAIT_LOCK);
+
+  for(r = 0; r < rows; r++)
+  {
+    found = rta_kdtree_search_knn(&self->tree, (rta_real_t *) x.buf + r * columns, 1,
+                                  k, radius, 0, objects, distances + r * k);
+
+    for(i = 0; i < found; i++)
+    {
+      indices[r * k + i] = objects[i].index;
+    }
+
+    for(; i < (int) k; i++)
+    {
+      indices[r * k + i] = -1;
+      distances[r * k + i] = INFINITY;
+    }
+  }
+
+  PyThread_release_lock(self->lock);
+  Py_END_ALLOW_THREADS
+
+  PyMem_Free(objects);
+  PyBuffer_Release(&x);
+  return Py_BuildValue("(NN)", indices_object, distances_object);
+}
+
+static PyMethodDef kdtree_methods[] =
+{
+  { "search", (PyCFunction) kdtree_search, METH_VARARGS | METH_KEYWORDS,
+    kdtree_search_doc },
+  { NULL }
+};
+
+static PyMemberDef kdtree_members[] =
+{
+  { "ndim", T_INT, offsetof(rta_py_kdtree_t, tree.ndim), READONLY,
+    "dimension of the data vectors" },
+  { "nvectors", T_INT, offsetof(rta_py_kdtree_t, nvectors), READONLY,
+    "number of data vectors" },
+  { "height", T_INT, offsetof(rta_py_kdtree_t, tree.height), READONLY,
+    "height of the tree" },
+  { "nnodes", T_INT, offsetof(rta_py_kdtree_t, tree.nnodes), READONLY,
+    "number of nodes" },
+  { NULL }
+};
+
+PyDoc_STRVAR(kdtree_doc,
+"KDTree(data, height=-1)\n\n"
+"kd-tree over the rows of data (vectors, dimensions), which is used in\n"
+"place and must not change while the tree exists. A positive height\n"
+"sets the height of the tree, a negative height is subtracted from the\n"
+"maximum height.");
+
+static PyTypeObject rta_py_kdtree_type =
+{
+  PyVarObject_HEAD_INIT(NULL, 0)
+  .tp_name = "rta.KDTree",
+  .tp_basicsize = sizeof(rta_py_kdtree_t),
+  .tp_dealloc = (destructor) kdtree_dealloc,
+  .tp_flags = Py_TPFLAGS_DEFAULT,
+  .tp_doc = kdtree_doc,
+  .tp_methods = kdtree_methods,
+  .tp_members = kdtree_members,
+  .tp_init = (initproc) kdtree_init,
+  .tp_new = PyType_GenericNew,
+};
+
+
+/* ---------------------------------------------------------------------- */
+/* dtw */
+
+PyDoc_STRVAR(dtw_doc,
+"dtw(a, b)\n\n"
+"Dynamic time warping of the rows of a (m, dimensions) and b (n,\n"
+"dimensions). Returns a tuple (p, q, score) where a[p[i]] is aligned\n"
+"to b[q[i]] (int32 arrays of the path length), and score is the (m, n)\n"
+"normalised distance matrix.");
+
+static PyObject *
+rta_py_dtw(PyObject * self, PyObject * args)
+{
+  PyObject * a_object, * b_object, * p_object = NULL, * q_object = NULL, * score_object;
+  Py_buffer a, b;
+  Py_ssize_t a_rows, a_columns, b_rows, b_columns, shape[2];
+  rta_real_t * score, * path, * aligned;
+  int * p, * q, length = 0, i;
+
+  if(! PyArg_ParseTuple(args, "OO:dtw", &a_object, &b_object)
+     || ! get_real_buffer(a_object, &a, "a", &a_rows, &a_columns))
+  {
+    return NULL;
+  }
+
+  if(! get_real_buffer(b_object, &b, "b", &b_rows, &b_columns))
+  {
+    PyBuffer_Release(&a);
+    return NULL;
+  }
+
+  if(a_columns != b_columns || a_rows > INT_MAX || b_rows > INT_MAX)
+  {
+    PyErr_SetString(PyExc_ValueError, "a and b must have the same dimensions");
+    PyBuffer_Release(&a);
+    PyBuffer_Release(&b);
+    return NULL;
+  }
+
+  shape[0] = a_rows;
+  shape[1] = b_rows;
+  score_object = new_array(RTA_PY_REAL_FORMAT, sizeof(rta_real_t), 2, shape,
+                           (void **) &score);
+  /* p, q, then the aligned vectors of a and b */
+  path = PyMem_Malloc((a_rows + b_rows + 1) * (2 + 2 * a_columns) * sizeof(rta_real_t));
+
+  if(score_object == NULL || path == NULL)
+  {
+    Py_XDECREF(score_object);
+    PyMem_Free(path);
+    PyBuffer_Release(&a);
+    PyBuffer_Release(&b);
+    return path == NULL ? PyErr_NoMemory() : NULL;
+  }
+
+  aligned = path + 2 * (a_rows + b_rows + 1);
+
+  Py_BEGIN_ALLOW_THREADS
+  rta_dtw(a.buf, a_rows, a_columns, b.buf, b_rows, b_columns,
+          path, path + a_rows + b_rows + 1,
+          aligned, aligned + (a_rows + b_rows + 1) * a_columns, score, &length);
+  Py_END_ALLOW_THREADS
+
+  shape[0] = length;
+  p_object = new_array("i", sizeof(int), 1, shape, (void **) &p);
+  q_object = new_array("i", sizeof(int), 1, shape, (void **) &q);
+
+  if(p_object != NULL && q_object != NULL)
+  {
+    for(i = 0; i < length; i++)
+    {
+      p[i] = path[i];
+      q[i] = path[a_rows + b_rows + 1 + i];
+    }
+  }
+
+  PyMem_Free(path);
+  PyBuffer_Release(&a);
+  PyBuffer_Release(&b);
+
+  if(p_object == NULL || q_object == NULL)
+  {
+    Py_XDECREF(p_object);
+    Py_XDECREF(q_object);
+    Py_DECREF(score_object);
+    return NULL;
+  }
+
+  return Py_BuildValue("(NNN)", p_object, q_object, score_object);
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* threads */
+
+PyDoc_STRVAR(set_num_threads_doc,
+"set_num_threads(n)\n\n"
+"Number of threads of the library's parallel loops (kd-tree build,\n"
+"distance matrices), 0 for all processors. Returns the effective number.");
+
+static PyObject *
+rta_py_set_num_threads(PyObject * self, PyObject * args)
+{
+  int num_threads;
+
+  if(! PyArg_ParseTuple(args, "i:set_num_threads", &num_threads))
+  {
+    return NULL;
+  }
+
+  return PyLong_FromLong(rta_parallel_set_num_threads(num_threads));
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* module */
+
+static PyMethodDef rta_py_methods[] =
+{
+  { "fft", (PyCFunction) rta_py_fft, METH_VARARGS | METH_KEYWORDS, fft_doc },
+  { "mel_bands", (PyCFunction) rta_py_mel_bands, METH_VARARGS | METH_KEYWORDS,
+    mel_bands_doc },
+  { "dct", (PyCFunction) rta_py_dct, METH_VARARGS | METH_KEYWORDS, dct_doc },
+  { "mfcc", (PyCFunction) rta_py_mfcc, METH_VARARGS | METH_KEYWORDS, mfcc_doc },
+  { "mean_variance", (PyCFunction) rta_py_mean_variance,
+    METH_VARARGS | METH_KEYWORDS, mean_variance_doc },
+  { "dtw", rta_py_dtw, METH_VARARGS, dtw_doc },
+  { "set_num_threads", rta_py_set_num_threads, METH_VARARGS, set_num_threads_doc },
+  { NULL }
+};
+
+static struct PyModuleDef rta_py_module =
+{
+  PyModuleDef_HEAD_INIT,
+  "rta",
+  "Real-time audio analysis: FFT, mel bands, MFCC, statistics, kd-tree\n"
+  "search and DTW over float32 buffers, without copies.",
+  -1,
+  rta_py_methods
+};
+
+PyMODINIT_FUNC
+PyInit_rta(void)
+{
+  PyObject * module, * numpy;
+
+  if(PyType_Ready(&rta_py_kdtree_type) < 0)
+  {
+    return NULL;
+  }
+
+  module = PyModule_Create(&rta_py_module);
+  if(module == NULL)
+  {
+    return NULL;
+  }
+
+  Py_INCREF(&rta_py_kdtree_type);
+  if(PyModule_AddObject(module, "KDTree", (PyObject *) &rta_py_kdtree_type) < 0)
+  {
+    Py_DECREF(&rta_py_kdtree_type);
+    Py_DECREF(module);
+    return NULL;
+  }
+
+  /* NumPy is optional */
+  numpy = PyImport_ImportModule("numpy");
+  if(numpy != NULL)
+  {
+    numpy_asarray = PyObject_GetAttrString(numpy, "asarray");
+    Py_DECREF(numpy);
+  }
+  PyErr_Clear();
+
+  return module;
+}
@@ -0,0 +1,41 @@
+# Build the rta Python extension in place:
+#
+#   python setup.py build_ext --inplace
+#
+# NumPy is not needed to build; when it is installed, the results are
+# returned as NumPy arrays.
+
+import glob
+import os
+import sys
+
+from setuptools import setup, Extension
+
+here = os.path.dirname(os.path.abspath(__file__))
+src = os.path.join(here, '..', '..', 'src')
+
+def sources(directory, names):
+    return [os.path.relpath(os.path.join(src, directory, name), here)
+            for name in names]
+
+rta = Extension(
+    'rta',
+    sources=['rtamodule.c']
+    + sources('signal', ['rta_fft.c', 'rta_tables.c', 'rta_window.c',
+                         'rta_mel.c', 'rta_bands.c', 'rta_dct.c'])
+    + sources('statistics', ['rta_mean_variance.c'])
+    + sources('recognition', ['rta_kdtree.c', 'rta_kdtreebuild.c',
+                              'rta_kdtreesearch.c', 'rta_dtw.c'])
+    + sorted(os.path.relpath(path, here)
+             for path in glob.glob(os.path.join(src, 'util', 'rta_*.c'))),
+    # this directory first, for its rta_configuration.h
+    include_dirs=['.'] + [os.path.relpath(os.path.join(src, directory), here)
+                          for directory in ['', 'util', 'signal', 'statistics',
+                                            'recognition']],
+    libraries=[] if sys.platform == 'win32' else ['m', 'pthread'],
+)
+
+setup(name='rta',
+      version='1.0',
+      description='Real-time audio analysis library',
+      ext_modules=[rta])
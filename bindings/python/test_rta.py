@@ -0,0 +1,123 @@
+# Test of the rta Python extension, with or without NumPy:
+#
+#   python setup.py build_ext --inplace
+#   python test_rta.py
+
+import array
+import math
+import random
+import threading
+import unittest
+
+import rta
+
+
+def floats(values, rows=None):
+    """float32 buffer of values, seen as rows if given"""
+    view = memoryview(array.array('f', values)).cast('B').cast('f')
+    return view if rows is None else view.cast('B').cast('f', (rows, len(values) // rows))
+
+def flat(result):
+    """values of a result, NumPy array or memoryview"""
+    return list(memoryview(result).cast('B').cast(memoryview(result).format))
+
+
+class TestRta(unittest.TestCase):
+
+    def test_fft(self):
+        n = 64
+        x = floats([math.cos(2 * math.pi * 4 * i / n) for i in range(n)])
+        spectrum = rta.fft(x)
+        self.assertEqual(tuple(memoryview(spectrum).shape), (n // 2 + 1, 2))
+        values = flat(spectrum)
+        amplitude = [math.hypot(values[2 * i], values[2 * i + 1]) for i in range(n // 2 + 1)]
+        self.assertAlmostEqual(amplitude[4], n / 2, places=3)
+        self.assertLess(max(amplitude[:4] + amplitude[5:]), 1e-3)
+
+        frames = rta.fft(floats(list(x) * 3, rows=3), fft_size=100)
+        self.assertEqual(tuple(memoryview(frames).shape), (3, 65, 2))
+
+    def test_mfcc(self):
+        n, rows = 512, 8
+        noise = random.Random(1)
+        signal = [math.sin(0.05 * i) + noise.uniform(-0.1, 0.1) for i in range(n * rows)]
+        frames = floats(signal, rows=rows)
+        mfcc = rta.mfcc(frames, 16000., nbands=24, order=13)
+        self.assertEqual(tuple(memoryview(mfcc).shape), (rows, 13))
+        self.assertTrue(all(math.isfinite(v) for v in flat(mfcc)))
+
+        # the same as its steps
+        window = [0.5 - 0.5 * math.cos(2 * math.pi * i / n) for i in range(n)]
+        frame = floats([signal[i] * window[i] for i in range(n)])
+        spectrum = flat(rta.fft(frame))
+        amplitude = floats([math.hypot(spectrum[2 * i], spectrum[2 * i + 1])
+                            for i in range(n // 2 + 1)])
+        bands = flat(rta.mel_bands(amplitude, 16000., nbands=24))
+        cepstrum = flat(rta.dct(floats([math.log(max(b, 1e-10)) for b in bands]), order=13))
+        for expected, value in zip(cepstrum, flat(mfcc)[:13]):
+            self.assertAlmostEqual(expected, value, delta=1e-3 * (1 + abs(expected)))
+
+    def test_mean_variance(self):
+        mean, variance = rta.mean_variance(floats([1, 2, 3, 4]))
+        self.assertAlmostEqual(mean, 2.5)
+        self.assertAlmostEqual(variance, 1.25)
+        mean, variance = rta.mean_variance(floats([1, 10, 3, 30], rows=2), unbiased=True)
+        self.assertEqual(flat(mean), [2, 20])
+        self.assertEqual(flat(variance), [2, 200])
+
+    def test_kdtree(self):
+        ndim, nvectors = 3, 1000
+        noise = random.Random(2)
+        values = [noise.random() for i in range(ndim * nvectors)]
+        data = floats(values, rows=nvectors)
+        tree = rta.KDTree(data)
+        self.assertEqual((tree.ndim, tree.nvectors), (ndim, nvectors))
+
+        indices, distances = tree.search(data, k=1)
+        self.assertEqual(flat(indices), list(range(nvectors)))
+        self.assertEqual(max(flat(distances)), 0)
+
+        query = [0.3, 0.6, 0.9]
+        brute = sorted((sum((values[i * ndim + d] - query[d]) ** 2 for d in range(ndim)), i)
+                       for i in range(nvectors))
+        indices, distances = tree.search(floats(query), k=5)
+        self.assertEqual(flat(indices), [i for _, i in brute[:5]])
+
+        indices, distances = tree.search(floats(query), k=5, radius=(brute[1][0] + brute[2][0]) / 2)
+        self.assertEqual(flat(indices)[2:], [-1, -1, -1])
+        self.assertEqual(flat(distances)[4], math.inf)
+
+    def test_dtw(self):
+        a = floats([math.sin(0.2 * i) for i in range(40)], rows=20)
+        p, q, score = rta.dtw(a, a)
+        self.assertEqual(flat(p), list(range(20)))
+        self.assertEqual(flat(q), list(range(20)))
+        self.assertEqual(tuple(memoryview(score).shape), (20, 20))
+
+    def test_buffers(self):
+        self.assertRaises(TypeError, rta.fft, array.array('d', [0] * 8))
+        data = bytearray(array.array('f', [0.] * 12).tobytes())
+        tree = rta.KDTree(memoryview(data).cast('f', (4, 3)))
+        # the tree uses the data in place
+        self.assertRaises(BufferError, data.extend, b'1234')
+        del tree
+        data.extend(b'1234')
+
+    def test_threads(self):
+        frames = floats([math.sin(0.01 * i * i % 7) for i in range(256 * 64)], rows=64)
+        expected = flat(rta.mfcc(frames, 8000.))
+        results = []
+
+        def run():
+            results.append(flat(rta.mfcc(frames, 8000.)))
+
+        threads = [threading.Thread(target=run) for _ in range(4)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+        self.assertEqual(results, [expected] * 4)
+
+
+if __name__ == '__main__':
+    unittest.main()
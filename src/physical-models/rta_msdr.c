@@ -37,6 +37,9 @@
 
 #include "math.h"
 #include "rta_msdr.h"
+#include "rta_alloc.h"
+#include "rta_trace.h"
+#include "rta_parallel.h"
 #include <float.h>
 
 /* local abbreviation for number of dimensions */
@@ -243,12 +246,13 @@ static float rta_msdr_update_links_elasticity (rta_msdr_t *sys)
 }
 
 
-/* update masses from link forces */
-static void update_masses (rta_msdr_t *sys)
+/* update masses begin..end from link forces */
+static void update_mass_range (void *context, int begin, int end)
 {
+    rta_msdr_t *sys = (rta_msdr_t *) context;
     int i, d;
 
-    for (i = 0; i < sys->nmasses; i++)
+    for (i = begin; i < end; i++)
     {
 	int    massidx  = i * NDIM;
 
@@ -271,6 +275,14 @@ static void update_masses (rta_msdr_t *sys)
     }
 }
 
+/* update masses from link forces: masses are independent, the links
+   stay serial since they scatter into the shared force vectors */
+static void update_masses (rta_msdr_t *sys)
+{
+    rta_parallel_for(sys->nmasses, rta_parallel_grain(NDIM * 4),
+		     update_mass_range, sys);
+}
+
 
 /* update masses from link forces */
 static void rta_msdr_update_masses_ind (rta_msdr_t *sys, int nind, int *ind)
@@ -365,6 +377,7 @@ static void rta_msdr_update_masses_limp_ind (rta_msdr_t *sys, int nind, int *ind
 float rta_msdr_update (rta_msdr_t *sys)
 {
     float stress;
+    RTA_TRACE_BEGIN(rta_trace_msdr_update);
 
     /* two-step: */
     rta_msdr_update_links_damping(sys);
@@ -374,6 +387,8 @@ float rta_msdr_update (rta_msdr_t *sys)
 	rta_msdr_get_force(sys);
     update_masses(sys);
 
+    RTA_TRACE_COUNT(rta_trace_msdr_update, sys->nmasses);
+    RTA_TRACE_END(rta_trace_msdr_update);
     return stress;
 }
 
@@ -382,6 +397,7 @@ float rta_msdr_update (rta_msdr_t *sys)
    return total stress */
 float rta_msdr_update_limp (rta_msdr_t *sys)
 {
+    RTA_TRACE_BEGIN(rta_trace_msdr_update);
     float stress = update_links(sys);
 
     if (sys->outforce)
@@ -389,6 +405,8 @@ float rta_msdr_update_limp (rta_msdr_t *sys)
 
     rta_msdr_update_masses_limp(sys);
 
+    RTA_TRACE_COUNT(rta_trace_msdr_update, sys->nmasses);
+    RTA_TRACE_END(rta_trace_msdr_update);
     return stress;
 }
 
@@ -397,6 +415,7 @@ float rta_msdr_update_limp (rta_msdr_t *sys)
    return total stress */
 float rta_msdr_update_limp_ind (rta_msdr_t *sys, int nind, int *ind)
 {
+    RTA_TRACE_BEGIN(rta_trace_msdr_update);
     float stress = update_links(sys);
 
     if (sys->outforce)
@@ -404,6 +423,8 @@ float rta_msdr_update_limp_ind (rta_msdr_t *sys, int nind, int *ind)
 
     rta_msdr_update_masses_limp_ind(sys, nind, ind);
 
+    RTA_TRACE_COUNT(rta_trace_msdr_update, sys->nmasses);
+    RTA_TRACE_END(rta_trace_msdr_update);
     return stress;
 }
 
@@ -767,7 +788,7 @@ int rta_msdr_insert_link (rta_msdr_t *sys, int m1, int m2, float len, int cat,
     }
     else
     {
-	fts_post("REFUSED!!!  rta_msdr_insert_link %d %d len %f  cat %d -> nlinks %d %d\n",
+	rta_post("REFUSED!!!  rta_msdr_insert_link %d %d len %f  cat %d -> nlinks %d %d\n",
 		 m1, m2, len, cat, m1ptr->nlinks[cat], m2ptr->nlinks[cat]);
 	return -1;
     }
@@ -911,59 +932,60 @@ void rta_msdr_clear_cat_links (rta_msdr_t *sys, int cat)
 }
 
 
-static float *vectors_alloc (int n)
-{
-    int    size = n * NDIM * sizeof(float);
-    float *vect = (float *) rta_malloc(size);
-#ifndef WIN32
-    bzero(vect, size);
-#else
-	memset(vect, 0.0, size);
-#endif
-	return vect;
-}
-
-#define vect_alloc(n)    ((float *) rta_malloc((n) * sizeof(float)))
-
-
 void rta_msdr_init (rta_msdr_t *sys, int maxmass, int maxlinkstotal, int maxlinkscat)
 {
+    size_t masssize = maxmass * sizeof(rta_msdr_mass_t);
+    size_t vectsize = maxmass * NDIM * sizeof(float);
+    size_t listsize = maxlinkscat * sizeof(int);
+    size_t linksize = maxlinkstotal * sizeof(rta_msdr_link_t);
+    size_t paramsize = maxlinkstotal * sizeof(float);
+    rta_arena_t arena;
     int i, c;
 
     /* init masses */
     sys->nmasses       = 0;
     sys->massalloc     = maxmass;
     sys->linklistalloc = maxlinkscat;
+    sys->linksalloc    = maxlinkstotal;
+    sys->outforce      = NULL;
+
+    /* all buffers contiguous in one aligned arena, masses first, freed at once */
+    if (!rta_arena_new(&arena, rta_align_size(masssize)
+			       + 3 * rta_align_size(vectsize)
+			       + maxmass * RTA_MSDR_MAXCAT * rta_align_size(listsize)
+			       + RTA_MSDR_MAXCAT * (rta_align_size(linksize)
+						    + 10 * rta_align_size(paramsize))))
+    {
+	sys->masses = NULL;
+	return;
+    }
 
-    sys->masses = rta_malloc(maxmass * sizeof(rta_msdr_mass_t));
-    sys->force  = vectors_alloc(maxmass);
-    sys->speed  = vectors_alloc(maxmass);
-    sys->pos2   = vectors_alloc(maxmass);
-    sys->outforce = NULL;
+    sys->masses = rta_arena_alloc(&arena, masssize);
+    sys->force  = rta_arena_alloc(&arena, vectsize);	/* zeroed */
+    sys->speed  = rta_arena_alloc(&arena, vectsize);
+    sys->pos2   = rta_arena_alloc(&arena, vectsize);
 
     /* allocate masses' links lists */
     for (i = 0; i < sys->massalloc; i++)
     {
 	for (c = 0; c < RTA_MSDR_MAXCAT; c++)
-	     sys->masses[i].links[c] = rta_malloc(maxlinkscat * sizeof(int));
+	     sys->masses[i].links[c] = rta_arena_alloc(&arena, listsize);
     }
 
     /* allocate links */
-    sys->linksalloc = maxlinkstotal;
-
     for (c = 0; c < RTA_MSDR_MAXCAT; c++)
     {
-	sys->links[c] = rta_malloc(maxlinkstotal * sizeof(rta_msdr_link_t));
-	sys->K1[c]    = vect_alloc(maxlinkstotal);
-	sys->D1[c]    = vect_alloc(maxlinkstotal);
-	sys->D2[c]    = vect_alloc(maxlinkstotal);
-	sys->Rt[c]    = vect_alloc(maxlinkstotal);
-	sys->Rf[c]    = vect_alloc(maxlinkstotal);
-	sys->l0[c]    = vect_alloc(maxlinkstotal);
-	sys->lcurr[c] = vect_alloc(maxlinkstotal);
-	sys->lprev[c] = vect_alloc(maxlinkstotal);
-	sys->stress[c] = vect_alloc(maxlinkstotal);
-	sys->forceabs[c] = vect_alloc(maxlinkstotal);
+	sys->links[c] = rta_arena_alloc(&arena, linksize);
+	sys->K1[c]    = rta_arena_alloc(&arena, paramsize);
+	sys->D1[c]    = rta_arena_alloc(&arena, paramsize);
+	sys->D2[c]    = rta_arena_alloc(&arena, paramsize);
+	sys->Rt[c]    = rta_arena_alloc(&arena, paramsize);
+	sys->Rf[c]    = rta_arena_alloc(&arena, paramsize);
+	sys->l0[c]    = rta_arena_alloc(&arena, paramsize);
+	sys->lcurr[c] = rta_arena_alloc(&arena, paramsize);
+	sys->lprev[c] = rta_arena_alloc(&arena, paramsize);
+	sys->stress[c] = rta_arena_alloc(&arena, paramsize);
+	sys->forceabs[c] = rta_arena_alloc(&arena, paramsize);
     }
 
     /* init masses' links lists and links */
@@ -1000,37 +1022,8 @@ void rta_msdr_set (rta_msdr_t *sys, int nmasses, float *pos, float *invmass)
 
 void rta_msdr_free (rta_msdr_t *sys)
 {
-    int i, c;
-
-    /* free masses' links lists */
-    for (i = 0; i < sys->nmasses; i++)
-    {
-	rta_msdr_mass_t *m = sys->masses + i;
-
-	for (c = 0; c < RTA_MSDR_MAXCAT; c++)
-	{
-	    rta_free(m->links[c]);
-	}
-    }
-
-    /* free masses' vectors (pos and invmass given from outside) */
-    rta_free(sys->masses);
-    rta_free(sys->force);
-    rta_free(sys->speed);
-    rta_free(sys->pos2);
-
-    for (c = 0; c < RTA_MSDR_MAXCAT; c++)
-    {
-	rta_free(sys->links[c]);
-	rta_free(sys->K1[c]);
-	rta_free(sys->D1[c]);
-	rta_free(sys->D2[c]);
-	rta_free(sys->Rt[c]);
-	rta_free(sys->Rf[c]);
-	rta_free(sys->l0[c]);
-	rta_free(sys->lcurr[c]);
-	rta_free(sys->lprev[c]);
-	rta_free(sys->stress[c]);
-	rta_free(sys->forceabs[c]);
-    }
+    /* masses, links lists, vectors and link parameters are all in the
+       arena starting at masses (pos and invmass given from outside) */
+    rta_aligned_free(sys->masses);
+    sys->masses = NULL;
 }
@@ -428,6 +428,7 @@ UniSpringSpace::Polygon::Polygon () {
 	vx.push_back(2); vy.push_back(0);
 	
 	nVertices = 4;
+	gridNx = gridNy = 0;
 	
 	UniSpringSpace::Polygon::close();
 	
@@ -467,6 +468,7 @@ UniSpringSpace::Polygon::Polygon (std::vector< std::vector<double> > vertices) {
 		vy.push_back( (vertices[i][1] - minVY) / (maxVY - minVY) * 2 );
 	}
 	
+	gridNx = gridNy = 0;
 	UniSpringSpace::Polygon::close();
 	
 }
@@ -476,93 +478,129 @@ UniSpringSpace::Polygon::Polygon (std::vector< std::vector<double> > vertices) {
  */
 double UniSpringSpace::Polygon::fd_compute (double px, double py) {
 	
-	double mindist = fd_poly(px, py, vx, vy, nVertices);
-	return mindist;
+	if (gridNx > 0)
+		return fd_grid(px, py);
+	
+	return fd_poly(px, py, &vx[0], &vy[0], nVertices);
 	
 }
 
 
-double UniSpringSpace::Polygon::fd_poly(double px, double py, std::vector<double> &vx, std::vector<double> &vy, int nVertices) {
+/** 
+ Signed distance from (px,py) to the closed polygon vx, vy (nVertices points with last = first), 
+ negative inside. Distance to each rib and winding number are computed in a single pass without allocation.
+ */
+double UniSpringSpace::Polygon::fd_poly(double px, double py, const double *vx, const double *vy, int nVertices) {
 	
-	// Linear parameters of segments that connect the vertices (Ax + By + C = 0)
-	std::vector<double> A;
-	std::vector<double> B;
-	std::vector<double> C;
+	double mind2 = std::numeric_limits<double>::max();
+	int wn = 0; // winding number counter
 	
-	for (int i=1; i<nVertices; i++) {
-		A.push_back( -(vy[i] - vy[i-1]) );
-		B.push_back( (vx[i] - vx[i-1]) );
-		C.push_back( ( vy[i]*vx[i-1] - vx[i]*vy[i-1] ) );
+	for (int i=0; i<nVertices-1; i++) {
+		double ax = vx[i];
+		double ay = vy[i];
+		double bx = vx[i+1];
+		double by = vy[i+1];
+		double ex = bx - ax;
+		double ey = by - ay;
+		double len2 = ex*ex + ey*ey;
+		double t = 0;
+		
+		// Projection of point on the rib, clamped to the rib's segment
+		if (len2 > 0) {
+			t = ((px - ax)*ex + (py - ay)*ey) / len2;
+			if (t < 0) t = 0;
+			else if (t > 1) t = 1;
+		}
+		
+		double dx = ax + t*ex - px;
+		double dy = ay + t*ey - py;
+		double d2 = dx*dx + dy*dy;
+		
+		if (d2 < mind2)
+			mind2 = d2;
+		
+		// Winding number test (see isInPoly)
+		if (ay <= py) {
+			if (by > py && isLeft(ax, ay, bx, by, px, py) > 0)
+				++wn;
+		}
+		else {
+			if (by <= py && isLeft(ax, ay, bx, by, px, py) < 0)
+				--wn;
+		}
 	}
 	
-	// Find the projection of point (x,y) on each rib. A, B are of size nVertices-1
-	std::vector<double> projection_x;
-	std::vector<double> projection_y;
+	double distance = sqrt(mind2);
 	
-	for (int i=0; i<nVertices-1; i++) {
-		double AB = 1l / ( pow(A[i],2) + pow(B[i],2) );
-		double vv =  A[i]*px + B[i]*py + C[i];		
-		projection_x.push_back( px - A[i]*AB*vv );
-		projection_y.push_back( py - B[i]*AB*vv );
-	}
+	return wn != 0  ?  -distance  :  distance;
 	
-	// Test for the case where a polygon rib is either horizontal or vertical.
-	for (int i=0; i<nVertices-1; i++) {
-		if (B[i] == 0l) 
-			projection_x[i] = vx[i];
-		if (A[i] == 0l) 
-			projection_y[i] = vy[i];		
-	}
+}
+
+
+double UniSpringSpace::Polygon::fd_poly(double px, double py, std::vector<double> &vx, std::vector<double> &vy, int nVertices) {
 	
-	// Find all cases where projected point is between the two rib's vertices (inside the rib's segment)
-	std::vector<int> idx;
-	std::vector<double> dp;
+	return fd_poly(px, py, &vx[0], &vy[0], nVertices);
 	
-	for (int i=0; i<nVertices-1; i++) {
-		bool x_condition = ( ( ( projection_x[i] >= vx[i]) && (projection_x[i] <= vx[i+1]) ) || ( ( projection_x[i] >= vx[i+1] ) && ( projection_x[i] <= vx[i] ) ) );
-		bool y_condition = ( ( ( projection_y[i] >= vy[i]) && (projection_y[i] <= vy[i+1]) ) || ( ( projection_y[i] >= vy[i+1] ) && ( projection_y[i] <= vy[i] ) ) );
-		if (x_condition && y_condition) {
-			idx.push_back(i);
-			dp.push_back(sqrt( pow(projection_x[i] - px, 2) + pow(projection_y[i] - py, 2) ));
-		}
+}
+
+
+/** 
+ Sample the exact signed distance on a regular grid covering the scaled bounding box (llx = 0, lly = 0, urx = 2*ratio, ury = 2)
+ plus a margin of 10% on each side, for points that are pushed slightly outside.
+ */
+void UniSpringSpace::Polygon::buildDistanceGrid (double res) {
+	
+	if (res <= 0  ||  res >= 1) {
+		clearDistanceGrid();
+		return;
 	}
 	
-	// Distance from point (x,y) to the vertices
-	std::vector<double> dv;
+	int ncells = (int) lround(1 / res); // res slightly below 1/n gives n cells, not n + 1
+	int nmargin = (int) ceil(0.1 / res);
 	
-	for (int i=0; i<nVertices-1; i++)
-		dv.push_back( sqrt(pow(vx[i]-px,2) + pow(vy[i]-py,2)) );
+	gridDx = 2 * ratio / ncells;
+	gridDy = 2.0 / ncells;
+	gridX0 = -nmargin * gridDx;
+	gridY0 = -nmargin * gridDy;
+	gridNx = gridNy = ncells + 2 * nmargin + 1;
+	grid.resize(gridNx * gridNy);
 	
-	// Compute min of dp and dv
-	double minDv = dv[0];
+	for (int j=0; j<gridNy; j++)
+		for (int i=0; i<gridNx; i++)
+			grid[j * gridNx + i] = fd_poly(gridX0 + i * gridDx, gridY0 + j * gridDy, &vx[0], &vy[0], nVertices);
 	
-	for (int i=0; i<nVertices-1; i++) {
-		if (dv[i]<minDv)
-			minDv = dv[i];
-	}
+}
+
+
+void UniSpringSpace::Polygon::clearDistanceGrid () {
 	
-	double minDp;
-	if (dp.size() > 0) {
-		minDp = dp[0];
-		
-		for (int i=0; i<dp.size(); i++) {
-			if (dp[i]<minDp)
-				minDp = dp[i];
-		}
-	}
+	grid.clear();
+	gridNx = gridNy = 0;
 	
-	// Compute distance from (px,py) to polygon
-	double distance;
+}
+
+
+/** 
+ Bilinear lookup in the distance grid, exact computation outside of it.
+ */
+double UniSpringSpace::Polygon::fd_grid (double px, double py) {
 	
-	if (idx.size() == 0) // If all projections are outside rib segments
-		distance = minDv; // The distance is then the distance to the closest vertex
-	else 
-		distance = std::min(minDv,minDp);
+	double gx = (px - gridX0) / gridDx;
+	double gy = (py - gridY0) / gridDy;
 	
-	if (UniSpringSpace::Polygon::isInPoly(px, py, vx, vy))
-		distance = - distance;
+	if (!(gx >= 0  &&  gy >= 0  &&  gx < gridNx - 1  &&  gy < gridNy - 1))
+		return fd_poly(px, py, &vx[0], &vy[0], nVertices);
 	
-	return distance;
+	int i = (int) gx;
+	int j = (int) gy;
+	double fx = gx - i;
+	double fy = gy - j;
+	const double *g = &grid[j * gridNx + i];
+	
+	double d0 = g[0] + fx * (g[1] - g[0]);
+	double d1 = g[gridNx] + fx * (g[gridNx + 1] - g[gridNx]);
+	
+	return d0 + fy * (d1 - d0);
 	
 }
 
@@ -678,8 +716,10 @@ void UniSpringSpace::Polygon::findInscribedCircle(double *inscribedCircleCenterX
 		
 		while (y < 2) {
 			
-			if ( fd_compute(x, y) < 0 && -fd_compute(x, y) > *inscribedCircleRadius ) {
-				*inscribedCircleRadius = -fd_compute(x, y);
+			double d = fd_compute(x, y);
+			
+			if ( d < 0 && -d > *inscribedCircleRadius ) {
+				*inscribedCircleRadius = -d;
 				*inscribedCircleCenterX = x;
 				*inscribedCircleCenterY = y;
 			}
@@ -698,15 +738,14 @@ void UniSpringSpace::Polygon::findInscribedCircle(double *inscribedCircleCenterX
 
 void UniSpringSpace::Polygon::close() {
 	
-	if (vx[nVertices-1] != vx[0] || vx[nVertices-1] != vx[0]) {
+	if (vx[nVertices-1] != vx[0] || vy[nVertices-1] != vy[0]) {
 		
 		vx.push_back(vx[0]);
 		vy.push_back(vy[0]);
+		nVertices++;
 		
 	}
 	
-	nVertices++;
-	
 }
 
 /*
@@ -715,7 +754,7 @@ void UniSpringSpace::Polygon::close() {
  *          V[] = vertex points of a polygon V[n+1] with V[n]=V[0]
  * Return:  wn = the winding number (=0 only if P is outside V[])
  */ 
-bool UniSpringSpace::Polygon::isInPoly(double px, double py, std::vector<double> vx, std::vector<double> vy) {
+bool UniSpringSpace::Polygon::isInPoly(double px, double py, const std::vector<double> &vx, const std::vector<double> &vy) {
 	
 	int wn = 0;    // the winding number counter
 	
@@ -807,14 +846,6 @@ void Sphere::preUniformize(std::vector<hed::Node> *mPoints, int mNpoints) {
 		
 	}
 	
-	for (int i=0; i<mNpoints; i++) {
-		
-		mPointsX.push_back((*mPoints)[i].x());
-		mPointsY.push_back((*mPoints)[i].y());
-		mPointsZ.push_back((*mPoints)[i].z());
-		
-	}
-	
 	// sort coordinates
 	sort (mPointsX.begin(), mPointsX.end());
 	sort (mPointsY.begin(), mPointsY.end());
@@ -937,14 +968,6 @@ void Cube::preUniformize(std::vector<hed::Node> *mPoints, int mNpoints) {
 		
 	}
 	
-	for (int i=0; i<mNpoints; i++) {
-		
-		mPointsX.push_back((*mPoints)[i].x());
-		mPointsY.push_back((*mPoints)[i].y());
-		mPointsZ.push_back((*mPoints)[i].z());
-		
-	}
-	
 	// sort coordinates
 	sort (mPointsX.begin(), mPointsX.end());
 	sort (mPointsY.begin(), mPointsY.end());
@@ -1088,14 +1111,6 @@ void RParallel::preUniformize(std::vector<hed::Node> *mPoints, int mNpoints){
 		
 	}
 	
-	for (int i=0; i<mNpoints; i++) {
-		
-		mPointsX.push_back((*mPoints)[i].x());
-		mPointsY.push_back((*mPoints)[i].y());
-		mPointsZ.push_back((*mPoints)[i].z());
-		
-	}
-	
 	// sort coordinates
 	sort (mPointsX.begin(), mPointsX.end());
 	sort (mPointsY.begin(), mPointsY.end());
@@ -1180,6 +1195,10 @@ UniSpring::UniSpring() {
 	max_displ_prev = 0;
 	dptol = 0.0016;
 	stop = 0;
+	mMultilevelMin = 0;
+	mMultilevelFactor = 4;
+	mNactive = 0;
+	mNtriangulations = 0;
 	
 };
 
@@ -1214,9 +1233,27 @@ void UniSpring::set_points (int n, int cols, float *points, Shape *shape, bool p
 	if (preUni == true) mShape->preUniformize(&mPoints, mNpoints);
 	else mShape->scale(&mPoints, mNpoints);	
 	
+	mNactive = mNpoints;
+	stop = 0;
+	
+	if (mMultilevelMin > 0  &&  mNpoints > mMultilevelMin) {
+		
+		// Shuffle triangulation order (deterministic), every prefix is then a random subsample of the points
+		unsigned int seed = 1;
+		
+		for (int i = mNpoints - 1; i > 0; i--) {
+			seed = seed * 1664525 + 1013904223;
+			std::swap(nodes[i], nodes[(seed >> 8) % (i + 1)]);
+		}
+		
+		mNactive = mMultilevelMin;
+		storeLevelPositions();
+	}
+	
 	// Triangulate
-	triang.createDelaunay(nodes.begin(), nodes.end()); //new_end if using unique
+	triang.createDelaunay(nodes.begin(), nodes.begin() + mNactive); //new_end if using unique
 	getEdgeVector();
+	mNtriangulations = 1;
 	
 }
 
@@ -1231,10 +1268,12 @@ void UniSpring::set_points_3D(int n, float *points, Shape_3D *shape, bool preUni
 	mNpoints = n;
 	mPoints.resize(mNpoints);
 	mPointsOld.resize(mNpoints);
+	nodes.resize(mNpoints);
+	mNactive = mNpoints;
 	
 	for (int i=0; i<mNpoints; i++) {
-		mPoints[i].init(i, points[i*DIM],points[i*DIM+1],points[i*DIM+2]);
-		mPointsOld[i].init(i, points[i*DIM],points[i*DIM+1],points[i*DIM+2]);
+		mPoints[i].init(i, points[i*3],points[i*3+1],points[i*3+2]);
+		mPointsOld[i].init(i, points[i*3],points[i*3+1],points[i*3+2]);
 		nodes[i] = &mPoints[i];	
 	}
 	
@@ -1247,8 +1286,9 @@ void UniSpring::set_points_3D(int n, float *points, Shape_3D *shape, bool preUni
 	else mShape_3D->scale(&mPoints, mNpoints);	
 
 	// Triangulate
-	triang.createDelaunay(nodes.begin(), nodes.end()); //new_end if using unique
+	triangulate_3D();
 	getEdgeVector_3D();
+	mNtriangulations = 1;
 	
 }
 
@@ -1267,9 +1307,9 @@ void UniSpring::get_points_scaled_3D(float *points) {
 	
 	for (int i=0; i<mNpoints; i++) {
 		
-		points[i*DIM] = mPoints[i].x() * mShape_3D->scale_factor + mShape_3D->shift_scaled_x;
-		points[i*DIM+1] = mPoints[i].y() * mShape_3D->scale_factor + mShape_3D->shift_scaled_y;
-		points[i*DIM+2] = mPoints[i].z() * mShape_3D->scale_factor + mShape_3D->shift_scaled_z;
+		points[i*3] = mPoints[i].x() * mShape_3D->scale_factor + mShape_3D->shift_scaled_x;
+		points[i*3+1] = mPoints[i].y() * mShape_3D->scale_factor + mShape_3D->shift_scaled_y;
+		points[i*3+2] = mPoints[i].z() * mShape_3D->scale_factor + mShape_3D->shift_scaled_z;
 		
 	}
 	
@@ -1279,15 +1319,22 @@ int UniSpring::update() {
 	
 	if (max_displ_old / H0 > TTOL) { // Retriangulate
 		mPointsOld = mPoints; // Copy old points positions
-		triang.createDelaunay(nodes.begin(), nodes.end());
+		triang.createDelaunay(nodes.begin(), nodes.begin() + mNactive);
 		getEdgeVector();
+		mNtriangulations++;
 		//freeQhullMemory(); // Free memory
 	}	
 	
 	resetPhysicalModel();
 	updatePositions();
 	
-	if (max_displ_prev / H0 < dptol) stop = 1;
+	if (max_displ_prev / H0 < dptol) {
+		
+		if (mNactive < mNpoints)
+			nextLevel(); // Multilevel: current level converged, refine
+		else
+			stop = 1;
+	}
 	
 	return stop;
 	
@@ -1297,8 +1344,9 @@ int UniSpring::update_3D() {
 	
 	if (max_displ_old / H0 > TTOL) { // Retriangulate
 		mPointsOld = mPoints; // Copy old points positions
-		triang.createDelaunay(nodes.begin(), nodes.end());
+		triangulate_3D();
 		getEdgeVector_3D();
+		mNtriangulations++;
 	}	
 	
 	resetPhysicalModel_3D();
@@ -1316,8 +1364,181 @@ void UniSpring::set_tolerance (float tol) {
 	
 }
 
+void UniSpring::set_multilevel (int minpoints, int factor) {
+	
+	mMultilevelMin = std::max(minpoints, 0);
+	mMultilevelFactor = std::max(factor, 2);
+	
+}
+
+/** 
+ Multilevel: remember positions of the active points at the start of a level, as reference for interpolateInactive().
+ */
+void UniSpring::storeLevelPositions() {
+	
+	mLevelX.resize(mNactive);
+	mLevelY.resize(mNactive);
+	
+	for (int k=0; k<mNactive; k++) {
+		mLevelX[k] = nodes[k]->x();
+		mLevelY[k] = nodes[k]->y();
+	}
+	
+}
+
+/** 
+ Multilevel: move all inactive points by the inverse distance weighted displacement of their
+ 4 nearest active points since the start of the level (nearest in level start positions, found with a bucket grid).
+ */
+void UniSpring::interpolateInactive() {
+	
+	const int knn = 4;
+	int nlevel = mLevelX.size();
+	double deps = sqrt(EPS)*H0;
+	
+	// Bucket grid over level start positions, about 2 points per cell
+	double minX = mLevelX[0], maxX = mLevelX[0];
+	double minY = mLevelY[0], maxY = mLevelY[0];
+	
+	for (int k=1; k<nlevel; k++) {
+		minX = std::min(minX, mLevelX[k]);
+		maxX = std::max(maxX, mLevelX[k]);
+		minY = std::min(minY, mLevelY[k]);
+		maxY = std::max(maxY, mLevelY[k]);
+	}
+	
+	int ng = std::max(1, (int) sqrt(nlevel / 2.));
+	double cellX = std::max(maxX - minX, EPS) / ng;
+	double cellY = std::max(maxY - minY, EPS) / ng;
+	
+	mGridStart.assign(ng * ng + 1, 0);
+	mGridItems.resize(nlevel);
+	
+	for (int k=0; k<nlevel; k++) {
+		int cx = std::min((int) ((mLevelX[k] - minX) / cellX), ng - 1);
+		int cy = std::min((int) ((mLevelY[k] - minY) / cellY), ng - 1);
+		mGridStart[cy * ng + cx + 1]++;
+	}
+	
+	for (int c=0; c<ng*ng; c++)
+		mGridStart[c + 1] += mGridStart[c];
+	
+	std::vector<int> fill(mGridStart.begin(), mGridStart.end() - 1);
+	
+	for (int k=0; k<nlevel; k++) {
+		int cx = std::min((int) ((mLevelX[k] - minX) / cellX), ng - 1);
+		int cy = std::min((int) ((mLevelY[k] - minY) / cellY), ng - 1);
+		mGridItems[fill[cy * ng + cx]++] = k;
+	}
+	
+	for (int k=nlevel; k<mNpoints; k++) {
+		
+		hed::Node *node = nodes[k];
+		double px = node->x();
+		double py = node->y();
+		int cx = std::max(0, std::min((int) ((px - minX) / cellX), ng - 1));
+		int cy = std::max(0, std::min((int) ((py - minY) / cellY), ng - 1));
+		
+		// k nearest neighbours, searching rings of cells around (cx, cy)
+		int nbest = 0;
+		int best[knn];
+		double bestd2[knn];
+		
+		for (int r=0; r<ng; r++) {
+			
+			// stop when the next ring can not contain closer points
+			if (nbest == knn  &&  (r - 1) * std::min(cellX, cellY) > sqrt(bestd2[knn - 1]))
+				break;
+			
+			for (int gy = cy - r; gy <= cy + r; gy++) {
+				
+				if (gy < 0  ||  gy >= ng) continue;
+				
+				for (int gx = cx - r; gx <= cx + r; gx++) {
+					
+					if (gx < 0  ||  gx >= ng  ||  (std::abs(gx - cx) != r  &&  std::abs(gy - cy) != r)) continue;
+					
+					for (int c = mGridStart[gy * ng + gx]; c < mGridStart[gy * ng + gx + 1]; c++) {
+						
+						int j = mGridItems[c];
+						double dx = mLevelX[j] - px;
+						double dy = mLevelY[j] - py;
+						double d2 = dx*dx + dy*dy;
+						
+						if (nbest < knn  ||  d2 < bestd2[nbest - 1]) {
+							
+							// insertion into sorted best list
+							int pos = nbest < knn  ?  nbest++  :  knn - 1;
+							
+							while (pos > 0  &&  bestd2[pos - 1] > d2) {
+								best[pos] = best[pos - 1];
+								bestd2[pos] = bestd2[pos - 1];
+								pos--;
+							}
+							
+							best[pos] = j;
+							bestd2[pos] = d2;
+						}
+					}
+				}
+			}
+		}
+		
+		// Inverse distance weighted displacement
+		double wsum = 0, dispx = 0, dispy = 0;
+		
+		for (int b=0; b<nbest; b++) {
+			double w = 1 / (bestd2[b] + EPS);
+			dispx += w * (nodes[best[b]]->x() - mLevelX[best[b]]);
+			dispy += w * (nodes[best[b]]->y() - mLevelY[best[b]]);
+			wsum += w;
+		}
+		
+		if (wsum > 0)
+			node->setPosition(px + dispx / wsum, py + dispy / wsum);
+		
+		// Bring outside points back to boundary
+		double d = mShape->fd_compute(node->x(), node->y());
+		
+		if (d > 0) {
+			double dgradx = ( mShape->fd_compute(node->x() + deps, node->y()) - d ) / deps;
+			double dgrady = ( mShape->fd_compute(node->x(), node->y() + deps) - d ) / deps;
+			
+			node->setPosition(node->x() - d * dgradx, node->y() - d * dgrady);
+		}
+	}
+	
+}
+
+/** 
+ Multilevel: place remaining points from the converged level and activate the next level.
+ */
+void UniSpring::nextLevel() {
+	
+	interpolateInactive();
+	
+	mNactive = std::min(mNactive * mMultilevelFactor, mNpoints);
+	if (mNactive < mNpoints)
+		storeLevelPositions();
+	
+	// Retriangulate with the new points
+	mPointsOld = mPoints;
+	triang.createDelaunay(nodes.begin(), nodes.begin() + mNactive);
+	getEdgeVector();
+	mNtriangulations++;
+	max_displ_old = 0;
+	
+}
+
 std::vector< std::vector<int> > UniSpring::get_edges() {
 	
-	return mEdges;
+	std::vector< std::vector<int> > edges(get_num_edges(), std::vector<int>(2));
+	
+	for (int i = 0; i < get_num_edges(); i++) {
+		edges[i][0] = mEdges[2*i];
+		edges[i][1] = mEdges[2*i+1];
+	}
+	
+	return edges;
 	
 }
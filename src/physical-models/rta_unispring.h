@@ -40,6 +40,7 @@
 #include <limits>
 #include <numeric>
 #include <vector>
+#include <stdint.h>
 #include "halfedge/HeTriang.h"
 #include "halfedge/HeDart.h"
 #include "halfedge/HeTraits.h"
@@ -53,9 +54,9 @@
 #define GEPS 0.001*H0
 #define MAX_EDGE_LENGTH 0.2 // Max length edge allowed in triangulated structure
 #define FSCALE 1.2 // Must be >1 to help points spread accross the whole target region. 1.2 is ok for 2D
-//#define FSCALE 1.1 // given by distmesh_3D empirical formula for 3D
+#define FSCALE_3D 1.1 // given by distmesh_3D empirical formula for 3D
 #define DELTAT 0.2 // ok for 2D
-//#define DELTAT 0.1 // 0.1 better in 3D
+#define DELTAT_3D 0.1 // 0.1 better in 3D
 
 // Scale factor
 #define POLYGON_GRID_RES 0.01
@@ -121,14 +122,24 @@ public:
 	Polygon ();
 	Polygon (std::vector< std::vector<double> > vertices);
 	virtual double fd_compute (double px, double py);
+	static double fd_poly(double px, double py, const double *vx, const double *vy, int nVertices);
 	static double fd_poly(double px, double py, std::vector<double> &vx, std::vector<double> &vy, int nVertices);
 	virtual void preUniformize(std::vector<hed::Node> *mPoints, int mNpoints);
     virtual void scale (std::vector<hed::Node> *mPoints, int mNpoints);
-	static bool isInPoly(double px, double py, std::vector<double> vx, std::vector<double> vy);
+	static bool isInPoly(double px, double py, const std::vector<double> &vx, const std::vector<double> &vy);
 	static double isLeft( double P0x, double P0y, double P1x, double P1y, double P2x, double P2y );
+
+	/** precompute the signed distance on a regular grid covering the (scaled) bounding box plus a margin,
+	    fd_compute then uses bilinear lookup inside the grid and the exact distance outside
+	    @param res	grid step as fraction of the bounding box sides (as in findInscribedCircle)
+	 */
+	void buildDistanceGrid (double res = POLYGON_GRID_RES);
+	void clearDistanceGrid ();
+	bool hasDistanceGrid () { return gridNx > 0; };
 private:
 	void findInscribedCircle (double *inscribedCircleCenterX, double *inscribedCircleCenterY, double *inscribedCircleRadius);
 	void close(); // Check if polygon is closed, close it if necessary
+	double fd_grid (double px, double py);
 	std::vector<double> vx; // vertex x-coordinates
 	std::vector<double> vy; // vertex x-coordinates
 	int nVertices;
@@ -137,6 +148,14 @@ private:
 	double minVY;
 	double maxVY;
 
+	// Cached signed distance grid (empty if gridNx == 0)
+	std::vector<double> grid; // gridNy rows of gridNx values
+	int gridNx;
+	int gridNy;
+	double gridX0; // lower left corner of grid
+	double gridY0;
+	double gridDx; // grid steps
+	double gridDy;
 };
 
 
@@ -186,6 +205,49 @@ public:
 };
 
 
+/** Delaunay tetrahedralization of a 3D point set by incremental Bowyer-Watson insertion.
+    Points are inserted in Morton (Z-order) sequence so that the point location walk starting
+    from the last created tetrahedron stays short. Storage is kept between calls.
+ */
+class Delaunay3D
+{
+public:
+	Delaunay3D () : mLast(0), mStamp(0) { };
+
+	/** compute tetrahedralization of n points given as interleaved x, y, z
+	 @return number of tetrahedra
+	 */
+	int triangulate (int n, const double *xyz);
+
+	int get_num_tetrahedra () { return mResult.size() / 4; };
+
+	/** pointer to get_num_tetrahedra() quadruples of point indices */
+	const int *get_tetrahedra () { return mResult.empty()  ?  NULL  :  &mResult[0]; };
+
+private:
+	typedef struct { int v[4]; int n[4]; } tet_t; // vertices, neighbours opposite vertices (-1 if none, v[0] = -1 for free slot)
+
+	int newTet (int v0, int v1, int v2, int v3);
+	int locate (int p);
+	void insert (int p);
+	double orient (int t, int i, int p);
+	double insphere (int t, int p);
+
+	std::vector<double> mXYZ; // points and 4 super tetrahedron vertices
+	std::vector<tet_t> mTets;
+	std::vector<int> mFree; // free tetrahedron slots
+	std::vector<int> mMark; // per tetrahedron: stamp if in cavity, -stamp if tested outside
+	std::vector<int> mCavity;
+	std::vector<int> mBoundary; // cavity boundary faces as (tet, face) pairs
+	std::vector< std::pair<uint64_t, int> > mLinks; // faces of new tetrahedra to be linked: (edge key, tet << 2 | face)
+	std::vector<uint64_t> mOrder; // Morton code << 32 | point index
+	std::vector<int> mResult;
+	int mNpoints;
+	int mLast; // last created tetrahedron, start of location walk
+	int mStamp;
+};
+
+
 class UniSpring
 {
 public:
@@ -220,10 +282,15 @@ public:
 	void get_points_scaled_3D (float *points);
 	//void get_points_scaled (double *points);
 
-	/** get triangulation edges as vector of pairs of points ids.
+	/** get triangulation edges as vector of pairs of points ids (copy).
 	 */
 	std::vector< std::vector<int> > get_edges();
-	int get_num_edges() { return mEdges.size(); };
+	int get_num_edges() { return mEdges.size() / 2; };
+
+	/** get triangulation edges without copy:
+	    pointer to get_num_edges() pairs of point ids (smaller id first), valid until the next retriangulation
+	 */
+	const int *get_edge_indices() { return mEdges.empty()  ?  NULL  :  &mEdges[0]; };
 
     /** run one update step
 	@return stop flag, true if movement under tolerance
@@ -233,6 +300,22 @@ public:
 
     void set_tolerance (float tol);
 
+	/** enable multilevel (coarse-to-fine) solve for the next set_points (2D only):
+	 a random subsample of minpoints points is uniformised first, then the point count is multiplied by factor
+	 each time the current level has converged, the added points being placed by interpolating the
+	 displacements of their nearest solved neighbours. update() only returns stop once all points are solved.
+	 The coarsest level should have enough points for their spacing to stay below MAX_EDGE_LENGTH (a few hundred).
+	 @param minpoints	number of points of the coarsest level, 0 disables multilevel solve
+	 @param factor	point count ratio between successive levels (>= 2)
+	 */
+	void set_multilevel (int minpoints, int factor = 4);
+
+	/** number of points currently simulated (less than the number of points during the coarse levels of a multilevel solve) */
+	int get_num_active () { return mNactive; };
+
+	/** number of (re)triangulations since the last set_points or set_points_3D, including the initial one */
+	int get_num_triangulations () { return mNtriangulations; };
+
 	//static double fd_disk(double px, double py, double r, double cx, double cy); // TODO: redefine as Shape methods
 	//static double fd_rect(double px, double py, double llx, double lly, double urx, double ury);
 	//static double fd_sphere(double px, double py, double pz, double r, double cx, double cy, double cz);
@@ -247,18 +330,25 @@ private:
 	double fh(double px, double py);
 	double fh_3D(double px, double py, double pz);
 	double sum(std::vector<double> v);
+	void addEdge(int i0, int i1);
 	void removeDuplicateEdges();
 	void loadData();
 	void updatePositions();
 	void updatePositions_3D();
 	void getEdgeVector();
 	void getEdgeVector_3D();
+	void triangulate_3D();
 	void resetPhysicalModel();
 	void resetPhysicalModel_3D();
+	void storeLevelPositions();
+	void interpolateInactive();
+	void nextLevel();
 	void print_summary();
 
 	// TTL
 	hed::Triangulation      triang;
+	Delaunay3D              tetra; // 3D triangulation
+	std::vector<double>     mXYZ; // point coordinates for tetra
 	std::vector<hed::Node*> nodes; // vector of pointers to point coordinates data
 	std::vector<hed::Node>  mPoints;
 	std::vector<hed::Node>  mPointsOld;
@@ -269,7 +359,11 @@ private:
 	std::vector<double> mPointsX; // For preuniformisation step
 	std::vector<double> mPointsY;
 	std::vector<double> mPointsZ;
-	std::vector< std::vector<int> > mEdges; // Edge point indexes
+	std::vector<int> mEdges; // Edge point indexes, flat pairs (i0, i1) with i0 < i1
+	std::vector<uint64_t> mEdgeKeys; // Candidate edges packed as i0 << 32 | i1
+	std::vector<int> mEdgeStart; // Scratch for edge deduplication: bucket start per first point index
+	std::vector<int> mEdgeSecond; // Scratch: second point indexes sorted by bucket
+	std::vector<int> mEdgeMark; // Scratch: last bucket in which a second index was seen
 	int mNpoints; // Number of points
 	std::vector<double> hbars2; // Desired lengths (squared) (2D)
 	double hbars2_sum;
@@ -286,10 +380,18 @@ private:
 	double dptol; // Stop criterion
 	int stop;
 
+	// Multilevel solve
+	int mMultilevelMin; // Number of points of the coarsest level, 0 = no multilevel solve
+	int mMultilevelFactor; // Point count ratio between successive levels
+	int mNactive; // Number of points currently simulated: nodes[0 .. mNactive-1]
+	int mNtriangulations; // Number of (re)triangulations since set_points
+	std::vector<double> mLevelX; // Positions of active points at start of current level
+	std::vector<double> mLevelY;
+	std::vector<int> mGridStart; // Neighbour search grid on level start positions for interpolation
+	std::vector<int> mGridItems;
+
 };
 
 } // end namespace UniSpring
 
-bool operator<(std::vector<int> const& v1, std::vector<int> const& v2);
-bool operator==(std::vector<int> const& v1, std::vector<int> const& v2);
 #endif
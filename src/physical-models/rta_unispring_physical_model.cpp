@@ -131,15 +131,15 @@ void UniSpring::updatePositions(){
 	double deps = sqrt(EPS)*H0;
 	
 	// Compute edge lengths and initial target distances
-	for (int i = 0; i < mEdges.size(); i++) {
+	for (int i = 0; i < get_num_edges(); i++) {
 		
 		double middlex;
 		double middley;
 		double length;
 		
-		middlex = (mPoints[mEdges[i][0]].x()+mPoints[mEdges[i][1]].x())/2;
-		middley = (mPoints[mEdges[i][0]].y()+mPoints[mEdges[i][1]].y())/2;
-		length = euclDistance(mEdges[i][0],mEdges[i][1]);
+		middlex = (mPoints[mEdges[2*i]].x()+mPoints[mEdges[2*i+1]].x())/2;
+		middley = (mPoints[mEdges[2*i]].y()+mPoints[mEdges[2*i+1]].y())/2;
+		length = euclDistance(mEdges[2*i],mEdges[2*i+1]);
 				
 		hbars2.push_back(pow(fh(middlex,middley),2)); // compute squared value of target distance on edge's middle
 		L.push_back(length);
@@ -152,7 +152,7 @@ void UniSpring::updatePositions(){
 	L2_sum = sum(L2);
 	
 	// Compute total force components
-	for (int i = 0; i < mEdges.size(); i++) {
+	for (int i = 0; i < get_num_edges(); i++) {
 		
 		std::vector<double> Fvec(2);
 		std::vector<double> barvec(2);
@@ -162,27 +162,29 @@ void UniSpring::updatePositions(){
 		double F = std::max(L0-L[i],0.);
 		
 		// Get edge unit vector
-		barvec[0] = ( mPoints[mEdges[i][0]].x() - mPoints[mEdges[i][1]].x() ) / L[i];
-		barvec[1] = ( mPoints[mEdges[i][0]].y() - mPoints[mEdges[i][1]].y() ) / L[i];		
+		barvec[0] = ( mPoints[mEdges[2*i]].x() - mPoints[mEdges[2*i+1]].x() ) / L[i];
+		barvec[1] = ( mPoints[mEdges[2*i]].y() - mPoints[mEdges[2*i+1]].y() ) / L[i];		
 		
 		// Project force on edge unit vector
 		Fvec[0] = F * barvec[0];
 		Fvec[1] = F * barvec[1];
 		
 		// Assign force due to current edge to point indices in Ftot		
-		//int currentIndex = mEdges[i][0]; //debug
+		//int currentIndex = mEdges[2*i]; //debug
 		
-		Ftot[mEdges[i][0]][0] += Fvec[0];
-		Ftot[mEdges[i][0]][1] += Fvec[1];
-		Ftot[mEdges[i][1]][0] += -Fvec[0];
-		Ftot[mEdges[i][1]][1] += -Fvec[1];
+		Ftot[mEdges[2*i]][0] += Fvec[0];
+		Ftot[mEdges[2*i]][1] += Fvec[1];
+		Ftot[mEdges[2*i+1]][0] += -Fvec[0];
+		Ftot[mEdges[2*i+1]][1] += -Fvec[1];
 		
 	}
 	
 	// Move points & bring outside points back to boundary
 	std::vector<double> displ_temp(2);
 	
-	for (int i=0; i<mNpoints; i++) {
+	for (int k=0; k<mNactive; k++) {
+		
+		int i = nodes[k]->id();
 		
 		displ_temp[0] = DELTAT * Ftot[i][0];
 		displ_temp[1] = DELTAT * Ftot[i][1];
@@ -230,17 +232,17 @@ void UniSpring::updatePositions_3D(){
 	double deps = sqrt(EPS)*H0;
 	
 	// Compute edge lengths and initial target distances
-	for (int i = 0; i < mEdges.size(); i++) {
+	for (int i = 0; i < get_num_edges(); i++) {
 		
 		double middlex;
 		double middley;
 		double middlez;
 		double length;
 		
-		middlex = (mPoints[mEdges[i][0]].x()+mPoints[mEdges[i][1]].x())/2;
-		middley = (mPoints[mEdges[i][0]].y()+mPoints[mEdges[i][1]].y())/2;
-		middlez = (mPoints[mEdges[i][0]].z()+mPoints[mEdges[i][1]].z())/2;
-		length = euclDistance_3D(mEdges[i][0],mEdges[i][1]);
+		middlex = (mPoints[mEdges[2*i]].x()+mPoints[mEdges[2*i+1]].x())/2;
+		middley = (mPoints[mEdges[2*i]].y()+mPoints[mEdges[2*i+1]].y())/2;
+		middlez = (mPoints[mEdges[2*i]].z()+mPoints[mEdges[2*i+1]].z())/2;
+		length = euclDistance_3D(mEdges[2*i],mEdges[2*i+1]);
 		
 		//double length3 = pow(length,3);
 		
@@ -255,19 +257,19 @@ void UniSpring::updatePositions_3D(){
 	L3_sum = sum(L3);
 	
 	// Compute total force components
-	for (int i = 0; i < mEdges.size(); i++) {
+	for (int i = 0; i < get_num_edges(); i++) {
 		
 		std::vector<double> Fvec(3);
 		std::vector<double> barvec(3);
 		
 		// Compute edge force
-		double L0 = pow(hbars3[i],(double)1/3) * FSCALE * pow(L3_sum/hbars3_sum,(double)1/3);
+		double L0 = pow(hbars3[i],(double)1/3) * FSCALE_3D * pow(L3_sum/hbars3_sum,(double)1/3);
 		double F = std::max(L0-L[i],0.);
 		
 		// Get edge unit vector
-		barvec[0] = ( mPoints[mEdges[i][0]].x() - mPoints[mEdges[i][1]].x() ) / L[i];
-		barvec[1] = ( mPoints[mEdges[i][0]].y() - mPoints[mEdges[i][1]].y() ) / L[i];	
-		barvec[2] = ( mPoints[mEdges[i][0]].z() - mPoints[mEdges[i][1]].z() ) / L[i];
+		barvec[0] = ( mPoints[mEdges[2*i]].x() - mPoints[mEdges[2*i+1]].x() ) / L[i];
+		barvec[1] = ( mPoints[mEdges[2*i]].y() - mPoints[mEdges[2*i+1]].y() ) / L[i];	
+		barvec[2] = ( mPoints[mEdges[2*i]].z() - mPoints[mEdges[2*i+1]].z() ) / L[i];
 		
 		// Project force on edge unit vector
 		Fvec[0] = F * barvec[0];
@@ -276,12 +278,12 @@ void UniSpring::updatePositions_3D(){
 		
 		// Assign force due to current edge to point indices in Ftot		
 		
-		Ftot[mEdges[i][0]][0] += Fvec[0];
-		Ftot[mEdges[i][0]][1] += Fvec[1];
-		Ftot[mEdges[i][0]][2] += Fvec[2];
-		Ftot[mEdges[i][1]][0] += -Fvec[0];
-		Ftot[mEdges[i][1]][1] += -Fvec[1];
-		Ftot[mEdges[i][1]][2] += -Fvec[2];
+		Ftot[mEdges[2*i]][0] += Fvec[0];
+		Ftot[mEdges[2*i]][1] += Fvec[1];
+		Ftot[mEdges[2*i]][2] += Fvec[2];
+		Ftot[mEdges[2*i+1]][0] += -Fvec[0];
+		Ftot[mEdges[2*i+1]][1] += -Fvec[1];
+		Ftot[mEdges[2*i+1]][2] += -Fvec[2];
 		
 	}
 	
@@ -290,9 +292,9 @@ void UniSpring::updatePositions_3D(){
 	
 	for (int i=0; i<mNpoints; i++) {
 		
-		displ_temp[0] = DELTAT * Ftot[i][0];
-		displ_temp[1] = DELTAT * Ftot[i][1];
-		displ_temp[2] = DELTAT * Ftot[i][2];
+		displ_temp[0] = DELTAT_3D * Ftot[i][0];
+		displ_temp[1] = DELTAT_3D * Ftot[i][1];
+		displ_temp[2] = DELTAT_3D * Ftot[i][2];
 		
 		mPoints[i].setPosition(mPoints[i].x() + displ_temp[0], mPoints[i].y() + displ_temp[1], mPoints[i].z() + displ_temp[2]);
 		
@@ -341,9 +343,9 @@ void UniSpring::resetPhysicalModel(){
 	max_displ_old = 0;
 	max_displ_prev = 0;
 	std::vector<double> F_temp(2,0); 
-	for (int i=0; i<mNpoints; i++) {
+	for (int k=0; k<mNactive; k++) {
 		
-		Ftot[i]=F_temp;
+		Ftot[nodes[k]->id()]=F_temp;
 		
 	}
 	hbars2.clear();
@@ -0,0 +1,176 @@
+/**
+ * @file   rta_unispring_solver.cpp
+ *
+ * @brief  Background solver running UniSpring iterations on a worker thread
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_unispring_solver.h"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace UniSpringSpace ;
+
+
+UniSpringSolver::UniSpringSolver (UniSpring *unispring) {
+	
+	mUniSpring = unispring;
+	mStatus = solver_idle;
+	mCancel = false;
+	mIterations = 0;
+	m3D = false;
+	mNpoints = 0;
+	mFront = 0;
+	mSerial = 0;
+	
+}
+
+UniSpringSolver::~UniSpringSolver () {
+	
+	cancel();
+	
+}
+
+void UniSpringSolver::set_points (int n, int cols, float *points, Shape *shape, bool preUni) {
+	
+	cancel();
+	
+	m3D = false;
+	mNpoints = n;
+	mUniSpring->set_points(n, cols, points, shape, preUni);
+	mStatus = solver_idle;
+	mIterations = 0;
+	publish();
+	
+}
+
+void UniSpringSolver::set_points_3D (int n, float *points, Shape_3D *shape, bool preUni) {
+	
+	cancel();
+	
+	m3D = true;
+	mNpoints = n;
+	mUniSpring->set_points_3D(n, points, shape, preUni);
+	mStatus = solver_idle;
+	mIterations = 0;
+	publish();
+	
+}
+
+bool UniSpringSolver::start (double budget, int interval) {
+	
+	if (mNpoints <= 0  ||  is_running())
+		return false;
+	
+	if (mWorker.joinable())
+		mWorker.join(); // previous, finished solve
+	
+	mCancel = false;
+	mStatus = solver_running;
+	mWorker = std::thread(&UniSpringSolver::run, this, budget, std::max(interval, 1));
+	
+	return true;
+	
+}
+
+void UniSpringSolver::cancel () {
+	
+	mCancel = true;
+	
+	if (mWorker.joinable())
+		mWorker.join();
+	
+	mCancel = false;
+	
+}
+
+/** 
+ Worker thread: iterate until stop flag, budget or cancellation.
+ */
+void UniSpringSolver::run (double budget, int interval) {
+	
+	std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+	solver_status_t status = solver_running;
+	
+	while (status == solver_running) {
+		
+		int stop = m3D  ?  mUniSpring->update_3D()  :  mUniSpring->update();
+		int iter = ++mIterations;
+		
+		if (stop)
+			status = solver_converged;
+		else if (mCancel)
+			status = solver_cancelled;
+		else if (budget > 0  &&  std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() >= budget)
+			status = solver_timeout;
+		
+		if (status != solver_running  ||  iter % interval == 0)
+			publish();
+	}
+	
+	mStatus = status;
+	
+}
+
+/** 
+ Write scaled points into the back buffer, then make it the front buffer.
+ Only the swap is done under lock.
+ */
+void UniSpringSolver::publish () {
+	
+	int back = 1 - mFront; // only changed by the publishing thread
+	
+	mBuffer[back].resize(mNpoints * (m3D  ?  3  :  2));
+	
+	if (mNpoints > 0) {
+		if (m3D)
+			mUniSpring->get_points_scaled_3D(&mBuffer[back][0]);
+		else
+			mUniSpring->get_points_scaled(&mBuffer[back][0]);
+	}
+	
+	std::lock_guard<std::mutex> lock(mLock);
+	mFront = back;
+	mSerial++;
+	
+}
+
+int UniSpringSolver::get_points_scaled (float *points) {
+	
+	std::lock_guard<std::mutex> lock(mLock);
+	
+	std::copy(mBuffer[mFront].begin(), mBuffer[mFront].end(), points);
+	
+	return mSerial;
+	
+}
@@ -0,0 +1,112 @@
+/**
+ * @file   rta_unispring_solver.h
+ * @ingroup rta_physical_models
+ *
+ * @brief  Background solver running UniSpring iterations on a worker thread
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_UNISPRING_SOLVER
+#define _RTA_UNISPRING_SOLVER
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "rta_unispring.h"
+
+namespace UniSpringSpace
+{
+
+typedef enum { solver_idle, solver_running, solver_converged, solver_timeout, solver_cancelled } solver_status_t;
+
+/** Runs UniSpring::update() (or update_3D()) on a worker thread until the
+    tolerance (set_tolerance) or a wall-clock budget is reached.
+    Scaled point snapshots (as returned by get_points_scaled) are published
+    by double buffering, so the host thread can poll them at any time
+    without blocking on the iterations.
+
+    While a solve is running, the UniSpring object must only be accessed
+    through the solver: resetting points with set_points cancels the
+    running solve first.
+ */
+class UniSpringSolver
+{
+public:
+	UniSpringSolver (UniSpring *unispring);
+	~UniSpringSolver (); // cancels and joins the worker
+
+	/** cancel running solve, then set points (see UniSpring::set_points) and publish initial snapshot */
+	void set_points (int n, int cols, float *points, Shape *shape, bool preUni = true);
+	void set_points_3D (int n, float *points, Shape_3D *shape, bool preUni = true);
+
+	/** start iterating on the worker thread
+	 @param budget	wall-clock budget in seconds, <= 0 for no limit
+	 @param interval	publish a snapshot every interval iterations (and at the end)
+	 @return false if there are no points or a solve is already running
+	 */
+	bool start (double budget = 0, int interval = 1);
+
+	/** request stop and wait for the worker to finish */
+	void cancel ();
+
+	solver_status_t get_status () { return (solver_status_t) mStatus.load(); };
+	bool is_running () { return mStatus.load() == solver_running; };
+	int get_num_iterations () { return mIterations.load(); };
+
+	/** copy last published snapshot of scaled points (n * 2 or n * 3 floats)
+	 @return snapshot serial number (incremented on each publication), 0 if none published yet
+	 */
+	int get_points_scaled (float *points);
+
+private:
+	void run (double budget, int interval);
+	void publish ();
+
+	UniSpring *mUniSpring;
+	std::thread mWorker;
+	std::atomic<int> mStatus;
+	std::atomic<bool> mCancel;
+	std::atomic<int> mIterations;
+	bool m3D;
+	int mNpoints;
+
+	// double buffered snapshots: the worker writes the back buffer, then swaps under mLock
+	std::vector<float> mBuffer[2];
+	int mFront; // index of published buffer
+	int mSerial; // number of publications
+	std::mutex mLock;
+};
+
+} // end namespace UniSpring
+
+#endif
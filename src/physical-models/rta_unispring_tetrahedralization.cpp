@@ -0,0 +1,370 @@
+/**
+ * @file   rta_unispring_tetrahedralization.cpp
+ *
+ * @brief  Delaunay tetrahedralization for the 3D UniSpring model
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_unispring.h"
+#include <algorithm>
+
+using namespace UniSpringSpace ;
+
+
+/** 
+ Orientation of point p relative to face i of tetrahedron t:
+ orientation of t with vertex i replaced by p, positive if p is on the same side as vertex i.
+ (Shewchuk's orient3d, non-robust, coordinates relative to the 4th point)
+ */
+double Delaunay3D::orient (int t, int i, int p) {
+	
+	const int *v = mTets[t].v;
+	const double *pt[4];
+	
+	for (int k = 0; k < 4; k++)
+		pt[k] = &mXYZ[3 * (k == i  ?  p  :  v[k])];
+	
+	double adx = pt[0][0] - pt[3][0], ady = pt[0][1] - pt[3][1], adz = pt[0][2] - pt[3][2];
+	double bdx = pt[1][0] - pt[3][0], bdy = pt[1][1] - pt[3][1], bdz = pt[1][2] - pt[3][2];
+	double cdx = pt[2][0] - pt[3][0], cdy = pt[2][1] - pt[3][1], cdz = pt[2][2] - pt[3][2];
+	
+	return adx * (bdy * cdz - bdz * cdy) + bdx * (cdy * adz - cdz * ady) + cdx * (ady * bdz - adz * bdy);
+	
+}
+
+/** 
+ Positive if point p lies inside the circumsphere of (positively oriented) tetrahedron t.
+ (Shewchuk's insphere, non-robust, coordinates relative to p)
+ */
+double Delaunay3D::insphere (int t, int p) {
+	
+	const int *v = mTets[t].v;
+	const double *e = &mXYZ[3 * p];
+	const double *a = &mXYZ[3 * v[0]], *b = &mXYZ[3 * v[1]], *c = &mXYZ[3 * v[2]], *d = &mXYZ[3 * v[3]];
+	
+	double aex = a[0] - e[0], aey = a[1] - e[1], aez = a[2] - e[2];
+	double bex = b[0] - e[0], bey = b[1] - e[1], bez = b[2] - e[2];
+	double cex = c[0] - e[0], cey = c[1] - e[1], cez = c[2] - e[2];
+	double dex = d[0] - e[0], dey = d[1] - e[1], dez = d[2] - e[2];
+	
+	double ab = aex * bey - bex * aey;
+	double bc = bex * cey - cex * bey;
+	double cd = cex * dey - dex * cey;
+	double da = dex * aey - aex * dey;
+	double ac = aex * cey - cex * aey;
+	double bd = bex * dey - dex * bey;
+	
+	double abc = aez * bc - bez * ac + cez * ab;
+	double bcd = bez * cd - cez * bd + dez * bc;
+	double cda = cez * da + dez * ac + aez * cd;
+	double dab = dez * ab + aez * bd + bez * da;
+	
+	double alift = aex * aex + aey * aey + aez * aez;
+	double blift = bex * bex + bey * bey + bez * bez;
+	double clift = cex * cex + cey * cey + cez * cez;
+	double dlift = dex * dex + dey * dey + dez * dez;
+	
+	return (dlift * abc - clift * dab) + (blift * cda - alift * bcd);
+	
+}
+
+int Delaunay3D::newTet (int v0, int v1, int v2, int v3) {
+	
+	int t;
+	
+	if (!mFree.empty()) {
+		t = mFree.back();
+		mFree.pop_back();
+	}
+	else {
+		t = mTets.size();
+		mTets.resize(t + 1);
+		mMark.push_back(0);
+	}
+	
+	tet_t &tet = mTets[t];
+	tet.v[0] = v0; tet.v[1] = v1; tet.v[2] = v2; tet.v[3] = v3;
+	tet.n[0] = tet.n[1] = tet.n[2] = tet.n[3] = -1;
+	mMark[t] = 0;
+	
+	return t;
+	
+}
+
+/** 
+ Find a tetrahedron containing point p by walking from the last created one,
+ falls back to a linear search for a tetrahedron whose circumsphere contains p.
+ */
+int Delaunay3D::locate (int p) {
+	
+	int t = mLast;
+	int maxsteps = mTets.size();
+	int step;
+	
+	for (step = 0; step < maxsteps; step++) {
+		
+		int next = -1;
+		int start = step & 3; // vary the order of face tests to avoid cycling
+		
+		for (int k = 0; k < 4; k++) {
+			int i = (start + k) & 3;
+			
+			if (orient(t, i, p) < 0) {
+				next = mTets[t].n[i];
+				break;
+			}
+		}
+		
+		if (next < 0)
+			return t; // inside (or on hull face, can not happen within super tetrahedron)
+		
+		t = next;
+	}
+	
+	for (t = 0; t < (int) mTets.size(); t++)
+		if (mTets[t].v[0] >= 0  &&  insphere(t, p) > 0)
+			return t;
+	
+	return mLast;
+	
+}
+
+/** 
+ Bowyer-Watson insertion: remove all tetrahedra whose circumsphere contains p
+ and connect p to the faces of the resulting cavity.
+ */
+void Delaunay3D::insert (int p) {
+	
+	int t0 = locate(p);
+	
+	mStamp++;
+	mCavity.clear();
+	mBoundary.clear();
+	mCavity.push_back(t0);
+	mMark[t0] = mStamp;
+	
+	// grow cavity, collect boundary faces
+	for (int c = 0; c < (int) mCavity.size(); c++) {
+		
+		int t = mCavity[c];
+		
+		for (int i = 0; i < 4; i++) {
+			
+			int n = mTets[t].n[i];
+			
+			if (n >= 0  &&  mMark[n] == mStamp)
+				continue; // already in cavity
+			
+			if (n >= 0  &&  mMark[n] != -mStamp  &&  insphere(n, p) > 0) {
+				mMark[n] = mStamp;
+				mCavity.push_back(n);
+			}
+			else if (n >= 0  &&  orient(t, i, p) <= 0) {
+				// p not strictly visible from this face: take neighbour into cavity to keep it star-shaped
+				mMark[n] = mStamp;
+				mCavity.push_back(n);
+			}
+			else {
+				if (n >= 0)
+					mMark[n] = -mStamp;
+				
+				mBoundary.push_back(t);
+				mBoundary.push_back(i);
+			}
+		}
+	}
+	
+	// a boundary face may have been collected before its tetrahedron joined the cavity
+	int nb = 0;
+	
+	for (int b = 0; b < (int) mBoundary.size(); b += 2) {
+		int n = mTets[mBoundary[b]].n[mBoundary[b + 1]];
+		
+		if (n < 0  ||  mMark[n] != mStamp) {
+			mBoundary[nb++] = mBoundary[b];
+			mBoundary[nb++] = mBoundary[b + 1];
+		}
+	}
+	
+	mBoundary.resize(nb);
+	
+	// create new tetrahedra: cavity tetrahedron with the boundary face's opposite vertex replaced by p
+	mLinks.clear();
+	
+	for (int b = 0; b < nb; b += 2) {
+		
+		int t = mBoundary[b];
+		int i = mBoundary[b + 1];
+		tet_t old = mTets[t]; // copy, slots of cavity tetrahedra are only freed below
+		int nt = newTet(old.v[0], old.v[1], old.v[2], old.v[3]);
+		int n = old.n[i];
+		
+		mTets[nt].v[i] = p;
+		mTets[nt].n[i] = n;
+		
+		if (n >= 0)
+			for (int k = 0; k < 4; k++)
+				if (mTets[n].n[k] == t) {
+					mTets[n].n[k] = nt;
+					break;
+				}
+		
+		// the 3 other faces contain p, identify them by their edge not containing p
+		for (int j = 0; j < 4; j++) {
+			
+			if (j == i) continue;
+			
+			int a = -1, e = -1;
+			
+			for (int k = 0; k < 4; k++)
+				if (k != i  &&  k != j) {
+					if (a < 0) a = old.v[k];
+					else e = old.v[k];
+				}
+			
+			if (a > e) std::swap(a, e);
+			mLinks.push_back(std::make_pair(((uint64_t) a << 32) | (uint32_t) e, (nt << 2) | j));
+		}
+		
+		mLast = nt;
+	}
+	
+	// link new tetrahedra sharing a face: pairs of equal edge keys
+	std::sort(mLinks.begin(), mLinks.end());
+	
+	for (int l = 0; l + 1 < (int) mLinks.size(); l++) {
+		
+		if (mLinks[l].first == mLinks[l + 1].first) {
+			int ta = mLinks[l].second >> 2, fa = mLinks[l].second & 3;
+			int tb = mLinks[l + 1].second >> 2, fb = mLinks[l + 1].second & 3;
+			
+			mTets[ta].n[fa] = tb;
+			mTets[tb].n[fb] = ta;
+			l++;
+		}
+	}
+	
+	// free cavity
+	for (int c = 0; c < (int) mCavity.size(); c++) {
+		mTets[mCavity[c]].v[0] = -1;
+		mFree.push_back(mCavity[c]);
+	}
+	
+}
+
+/** 
+ Spread the 10 lower bits of x to every third bit.
+ */
+static uint32_t spreadBits (uint32_t x) {
+	
+	x &= 0x3ff;
+	x = (x | (x << 16)) & 0x030000ff;
+	x = (x | (x << 8))  & 0x0300f00f;
+	x = (x | (x << 4))  & 0x030c30c3;
+	x = (x | (x << 2))  & 0x09249249;
+	
+	return x;
+	
+}
+
+int Delaunay3D::triangulate (int n, const double *xyz) {
+	
+	mNpoints = n;
+	mTets.clear();
+	mFree.clear();
+	mMark.clear();
+	mResult.clear();
+	mStamp = 0;
+	
+	if (n < 4)
+		return 0;
+	
+	// bounding box
+	double lo[3], hi[3];
+	
+	for (int k = 0; k < 3; k++)
+		lo[k] = hi[k] = xyz[k];
+	
+	for (int i = 1; i < n; i++)
+		for (int k = 0; k < 3; k++) {
+			lo[k] = std::min(lo[k], xyz[3 * i + k]);
+			hi[k] = std::max(hi[k], xyz[3 * i + k]);
+		}
+	
+	double size = std::max(std::max(hi[0] - lo[0], hi[1] - lo[1]), std::max(hi[2] - lo[2], 1e-12));
+	
+	// points, then super tetrahedron enclosing the cube of side 2 * 10 * size around the box center
+	mXYZ.assign(xyz, xyz + 3 * n);
+	mXYZ.resize(3 * (n + 4));
+	
+	double k = 10 * size;
+	double *s = &mXYZ[3 * n];
+	
+	for (int v = 0; v < 4; v++)
+		for (int c = 0; c < 3; c++)
+			s[3 * v + c] = (lo[c] + hi[c]) / 2 - k + (v == c + 1  ?  6 * k  :  0);
+	
+	int t = newTet(n, n + 1, n + 2, n + 3);
+	
+	if (orient(t, 3, n + 3) < 0)
+		std::swap(mTets[t].v[0], mTets[t].v[1]);
+	
+	mLast = t;
+	
+	// insertion order along Morton curve
+	mOrder.resize(n);
+	
+	for (int i = 0; i < n; i++) {
+		uint32_t code = 0;
+		
+		for (int c = 0; c < 3; c++)
+			code |= spreadBits((uint32_t) ((xyz[3 * i + c] - lo[c]) / size * 1023)) << c;
+		
+		mOrder[i] = ((uint64_t) code << 32) | (uint32_t) i;
+	}
+	
+	std::sort(mOrder.begin(), mOrder.end());
+	
+	for (int i = 0; i < n; i++)
+		insert((int) (mOrder[i] & 0xffffffff));
+	
+	// keep tetrahedra not touching the super tetrahedron
+	for (t = 0; t < (int) mTets.size(); t++) {
+		const int *v = mTets[t].v;
+		
+		if (v[0] >= 0  &&  v[0] < n  &&  v[1] < n  &&  v[2] < n  &&  v[3] < n)
+			mResult.insert(mResult.end(), v, v + 4);
+	}
+	
+	return mResult.size() / 4;
+	
+}
@@ -76,20 +76,20 @@ void UniSpring::retriangulate(){
 
 /**
  Get delaunay triangulation edges by visiting each facet ridge once.
- Only edges belonging to a facet whose centroid is inside the target region boundaries are kept.
+ Only edges shorter than MAX_EDGE_LENGTH are kept.
  */
 void UniSpring::getEdgeVector(){
 	
 	const list<hed::Edge*>& leadingEdges = triang.getLeadingEdges();
 	list<hed::Edge*>::const_iterator it2;
 	
-	mEdges.clear(); // Reset		
+	mEdgeKeys.clear(); // Reset, keeps capacity of previous triangulations
+	mEdgeKeys.reserve(3 * leadingEdges.size());
 
 	// iterate over all triangles
 	for (it2 = leadingEdges.begin(); it2 != leadingEdges.end(); ++it2) {
 		hed::Edge* edge = *it2;
-		
-		std::vector<int> tmp_ids(3,0);
+		int tmp_ids[3];
 		
 		// get all nodes in triangle
 		for (int i = 0; i < 3; ++i) {
@@ -101,31 +101,9 @@ void UniSpring::getEdgeVector(){
 			
 		}
 		
-		std::vector<int> edge_temp1(2);
-		std::vector<int> edge_temp2(2);
-		std::vector<int> edge_temp3(2);
-		
-		edge_temp1[0] = tmp_ids[0];
-		edge_temp1[1] = tmp_ids[1];
-		edge_temp2[0] = tmp_ids[0];
-		edge_temp2[1] = tmp_ids[2];
-		edge_temp3[0] = tmp_ids[1];
-		edge_temp3[1] = tmp_ids[2];
-		
-		// put smaller indices first (needed by removeDuplicateEdges)
-		std::sort(edge_temp1.begin(), edge_temp1.end());
-		std::sort(edge_temp2.begin(), edge_temp2.end());
-		std::sort(edge_temp3.begin(), edge_temp3.end());
-		
-		if (euclDistance(edge_temp1[0], edge_temp1[1]) < MAX_EDGE_LENGTH) {
-			mEdges.push_back(edge_temp1);
-		}
-		if (euclDistance(edge_temp2[0], edge_temp2[1]) < MAX_EDGE_LENGTH) {
-			mEdges.push_back(edge_temp2);
-		}
-		if (euclDistance(edge_temp3[0], edge_temp3[1]) < MAX_EDGE_LENGTH) {
-			mEdges.push_back(edge_temp3);
-		}
+		addEdge(tmp_ids[0], tmp_ids[1]);
+		addEdge(tmp_ids[0], tmp_ids[2]);
+		addEdge(tmp_ids[1], tmp_ids[2]);
 		
 	}
 	
@@ -133,88 +111,117 @@ void UniSpring::getEdgeVector(){
 		
 }
 
-void UniSpring::getEdgeVector_3D(){ // TODO: check if it works in 3D
+/**
+ Delaunay tetrahedralization of the 3D points.
+ */
+void UniSpring::triangulate_3D(){
 	
-	const list<hed::Edge*>& leadingEdges = triang.getLeadingEdges();
-	list<hed::Edge*>::const_iterator it2;
+	mXYZ.resize(3 * mNpoints);
+	
+	for (int i = 0; i < mNpoints; i++) {
+		mXYZ[3*i] = mPoints[i].x();
+		mXYZ[3*i+1] = mPoints[i].y();
+		mXYZ[3*i+2] = mPoints[i].z();
+	}
+	
+	tetra.triangulate(mNpoints, mNpoints > 0  ?  &mXYZ[0]  :  NULL);
 	
-	mEdges.clear(); // Reset		
+}
 
-	// iterate over all triangles
-	for (it2 = leadingEdges.begin(); it2 != leadingEdges.end(); ++it2) {
-		hed::Edge* edge = *it2;
-		
-		std::vector<int> tmp_ids(3,0);
-		
-		// get all nodes in triangle
-		for (int i = 0; i < 3; ++i) {
-			
-			hed::Node* node = edge->getSourceNode();
-			tmp_ids[i] = node->id();
-			edge = edge->getNextEdgeInFace();
-			
-		}
+/**
+ Get tetrahedralization edges. Only edges belonging to a tetrahedron whose centroid is inside
+ the target region boundaries are kept (as in distmesh_3D).
+ */
+void UniSpring::getEdgeVector_3D(){
+	
+	int ntets = tetra.get_num_tetrahedra();
+	const int *tets = tetra.get_tetrahedra();
+	
+	mEdgeKeys.clear(); // Reset		
+	mEdgeKeys.reserve(6 * ntets);
+
+	// iterate over all tetrahedra
+	for (int t = 0; t < ntets; t++) {
+		const int *ids = tets + 4 * t;
 		
 		// Compute centroid
-		std::vector<double> centroid(2,0);
-		
-		centroid[0] = (mPoints[tmp_ids[0]].x() + mPoints[tmp_ids[1]].x() + mPoints[tmp_ids[2]].x())/3;
-		centroid[1] = (mPoints[tmp_ids[0]].y() + mPoints[tmp_ids[1]].y() + mPoints[tmp_ids[2]].y())/3;
-
-		if (mShape->fd_compute(centroid[0],centroid[1])<-GEPS) {
-			
-			std::vector<int> edge_temp1(2);
-			std::vector<int> edge_temp2(2);
-			std::vector<int> edge_temp3(2);
-			
-			edge_temp1[0] = tmp_ids[0];
-			edge_temp1[1] = tmp_ids[1];
-			edge_temp2[0] = tmp_ids[0];
-			edge_temp2[1] = tmp_ids[2];
-			edge_temp3[0] = tmp_ids[1];
-			edge_temp3[1] = tmp_ids[2];
-			
-			// put smaller indices first
-			std::sort(edge_temp1.begin(), edge_temp1.end());
-			std::sort(edge_temp2.begin(), edge_temp2.end());
-			std::sort(edge_temp3.begin(), edge_temp3.end());
+		double centroidx = (mPoints[ids[0]].x() + mPoints[ids[1]].x() + mPoints[ids[2]].x() + mPoints[ids[3]].x())/4;
+		double centroidy = (mPoints[ids[0]].y() + mPoints[ids[1]].y() + mPoints[ids[2]].y() + mPoints[ids[3]].y())/4;
+		double centroidz = (mPoints[ids[0]].z() + mPoints[ids[1]].z() + mPoints[ids[2]].z() + mPoints[ids[3]].z())/4;
 
-			if (euclDistance(edge_temp1[0], edge_temp1[1]) < MAX_EDGE_LENGTH) {
-				mEdges.push_back(edge_temp1);
-			}
-			if (euclDistance(edge_temp2[0], edge_temp2[1]) < MAX_EDGE_LENGTH) {
-				mEdges.push_back(edge_temp2);
-			}
-			if (euclDistance(edge_temp3[0], edge_temp3[1]) < MAX_EDGE_LENGTH) {
-				mEdges.push_back(edge_temp3);
-			}
+		if (mShape_3D->fd_compute(centroidx, centroidy, centroidz) < -GEPS) {
 			
+			for (int i = 0; i < 3; i++)
+				for (int j = i + 1; j < 4; j++) {
+					int i0 = std::min(ids[i], ids[j]);
+					int i1 = std::max(ids[i], ids[j]);
+					
+					mEdgeKeys.push_back(((uint64_t) i0 << 32) | (uint32_t) i1);
+				}
 		}
 		
 	}
 	
-	//removeDuplicateEdges();
-	
+	removeDuplicateEdges();
 	
 }
 
-void UniSpring::removeDuplicateEdges() {
+/**
+ Append edge i0-i1 to the candidate edge keys if it is shorter than MAX_EDGE_LENGTH.
+ The key packs the smaller index in the upper 32 bits.
+ */
+void UniSpring::addEdge(int i0, int i1) {
+	
+	if (euclDistance(i0, i1) < MAX_EDGE_LENGTH) {
+		if (i0 > i1) std::swap(i0, i1);
+		mEdgeKeys.push_back(((uint64_t) i0 << 32) | (uint32_t) i1);
+	}
 	
-	std::sort(mEdges.begin(), mEdges.end()); //sort uses operator<, overloaded below
-	mEdges.erase(std::unique(mEdges.begin(), mEdges.end()), mEdges.end()); // std::unique uses std::adjacent_find which in turn uses operator==, overloaded below	
 }
 
-
-bool operator<(std::vector<int> const& v1, std::vector<int> const& v2) {
+/**
+ Deduplicate candidate edge keys into mEdges in linear time:
+ counting sort on the first (smaller) index, then each bucket is scanned once,
+ marking second indices already seen in this bucket.
+ Resulting edges are ordered by first index.
+ */
+void UniSpring::removeDuplicateEdges() {
 	
-	if (v1[0] < v2[0]) return true;
-	else return false;
+	int nkeys = mEdgeKeys.size();
 	
-}
-
-bool operator==(std::vector<int> const& v1, std::vector<int> const& v2) { // assume that vectors have 2 elements (edge indices)
+	mEdgeStart.assign(mNpoints + 1, 0);
+	mEdgeMark.assign(mNpoints, -1);
+	mEdgeSecond.resize(nkeys);
+	mEdges.clear();
+	mEdges.reserve(2 * nkeys);
+	
+	// histogram and prefix sum of first indices
+	for (int k = 0; k < nkeys; k++)
+		mEdgeStart[(int) (mEdgeKeys[k] >> 32) + 1]++;
 	
-	if (v1[0] == v2[0] && v1[1] == v2[1]) return true;
-	else return false;
+	for (int i = 0; i < mNpoints; i++)
+		mEdgeStart[i + 1] += mEdgeStart[i];
 	
+	// scatter second indices, mEdgeStart[i] is advanced to the end of bucket i
+	for (int k = 0; k < nkeys; k++)
+		mEdgeSecond[mEdgeStart[(int) (mEdgeKeys[k] >> 32)]++] = (int) (mEdgeKeys[k] & 0xffffffff);
+	
+	// emit unique edges per bucket
+	int begin = 0;
+	
+	for (int i = 0; i < mNpoints; i++) {
+		int end = mEdgeStart[i];
+		
+		for (int k = begin; k < end; k++) {
+			int i1 = mEdgeSecond[k];
+			
+			if (mEdgeMark[i1] != i) {
+				mEdgeMark[i1] = i;
+				mEdges.push_back(i);
+				mEdges.push_back(i1);
+			}
+		}
+		
+		begin = end;
+	}
 }
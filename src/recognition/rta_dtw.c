@@ -40,6 +40,8 @@
 
 #include "rta_math.h"
 #include "rta_dtw.h"
+#include "rta_stdlib.h" /* rta_malloc, rta_free */
+#include "rta_parallel.h"
 
 #define INF HUGE_VAL
 
@@ -50,35 +52,85 @@
  *
  * Score matrix is based on euclidean distance
  * Signals must have the same number of observations
+ *
+ * Rows are computed in parallel, the maximum is reduced over rows
  */
-static int
-prepare_score_matrix(float * A, int m_A, float * B, int m_B, int n, float * out_R)
+typedef struct score_matrix_args
 {
+	float *	A;
+	int		m_A;
+	float *	B;
+	int		m_B;
+	int		n;
+	float *	out_R;
+	float	max_d;
+} score_matrix_args_t;
+
+static void
+score_rows(void * context, int begin, int end, void * partial)
+{
+	score_matrix_args_t * a = (score_matrix_args_t *) context;
+	float *	max_d = (float *) partial;
 	int		i, j, k;
-	float	max_d	= 0.;
-	float	tmp		= 0.;
 	
 	//Compute euclidean distance between the i-th first signal observation
 	//and the j-th second signal observation for all i
-	for ( i = 0; i < m_A; i++ )
-		for ( j = 0; j < m_B; j++ )
+	for ( i = begin; i < end; i++ )
+		for ( j = 0; j < a->m_B; j++ )
 		{
-			out_R[i * m_B + j] = 0.0;
+			float * r = &a->out_R[i * a->m_B + j];
+			
+			*r = 0.0;
 			
-			for ( k = 0; k < n; k++ )
-				out_R[i * m_B + j] += ( A[i * n + k] - B[j * n + k] ) * ( A[i * n + k] - B[j * n + k] );
+			for ( k = 0; k < a->n; k++ )
+				*r += ( a->A[i * a->n + k] - a->B[j * a->n + k] ) * ( a->A[i * a->n + k] - a->B[j * a->n + k] );
 			
-			if ( fabs(out_R[i * m_B + j]) > max_d)
-				max_d = fabs(out_R[i * m_B + j]);
+			if ( fabs(*r) > *max_d)
+				*max_d = fabs(*r);
 		}
+}
+
+static void
+max_combine(void * context, void * accumulator, const void * partial)
+{
+	if (*(const float *) partial > *(float *) accumulator)
+		*(float *) accumulator = *(const float *) partial;
+}
+
+static void
+normalize_rows(void * context, int begin, int end)
+{
+	score_matrix_args_t * a = (score_matrix_args_t *) context;
+	int		i, j;
+	
+	for ( i = begin; i < end; i++ )
+		for ( j = 0; j < a->m_B; j++ )
+			a->out_R[i * a->m_B + j] /= a->max_d;
+}
+
+static int
+prepare_score_matrix(float * A, int m_A, float * B, int m_B, int n, float * out_R)
+{
+	score_matrix_args_t args;
+	const float zero = 0.;
+	const int grain = rta_parallel_grain(m_B * n);
+	
+	args.A = A;
+	args.m_A = m_A;
+	args.B = B;
+	args.m_B = m_B;
+	args.n = n;
+	args.out_R = out_R;
+	
+	if (!rta_parallel_reduce(m_A, grain, sizeof(float), &zero,
+							 score_rows, max_combine, &args, &args.max_d))
+	{
+		args.max_d = 0.;
+		score_rows(&args, 0, m_A, &args.max_d);
+	}
 	
 	//Normalization
-	for ( i = 0; i < m_A; i++ )
-		for ( j = 0; j < m_B; j++ )
-		{
-			tmp = (out_R[i * m_B + j] / max_d);
-			out_R[i * m_B + j] = tmp;
-		}	
+	rta_parallel_for(m_A, grain, normalize_rows, &args);
 	
 	return 0;
 }
@@ -106,8 +158,8 @@ dpcore(float * pM, int rows, int cols, int * pC, int crows, int ccols, float * p
 	int ii;
 	
 	ncosts = crows;
-	costs = (float *)malloc( ncosts * sizeof(float));
-	steps = (int *)malloc( ncosts * 2 * sizeof(int));
+	costs = (float *)rta_malloc( ncosts * sizeof(float));
+	steps = (int *)rta_malloc( ncosts * 2 * sizeof(int));
 	
 	for (ii = 0; ii < ncosts; ++ii) 
 	{
@@ -146,8 +198,8 @@ dpcore(float * pM, int rows, int cols, int * pC, int crows, int ccols, float * p
 			v = INF;
 		}
 	}
-	free((void *)costs);
-	free((void *)steps);
+	rta_free(costs);
+	rta_free(steps);
 	
 	return 0;
 }
@@ -179,16 +231,16 @@ dpfast(float * SM, int m, int n, int T1, int T2, int * p, int * q, int * length)
 	 * two first columns : first and second dimension steps
 	 * thirs columns : the corresponding weight at (i,j)
 	 */
-	int * C = (int *)malloc( 9 * sizeof(int));
+	int * C = (int *)rta_malloc( 9 * sizeof(int));
 	C[0] = 1; C[1] = 1; C[2] = 1;
 	C[3] = 1; C[4] = 0; C[5] = 1;
 	C[6] = 0; C[7] = 1; C[8] = 1;
 	
 	//cost matrix
-	pD	= (float *)malloc( m * n * sizeof(float));
+	pD	= (float *)rta_malloc( m * n * sizeof(float));
 	
 	//index matrix
-	pP	= (int *)malloc( m * n * sizeof(int));
+	pP	= (int *)rta_malloc( m * n * sizeof(int));
 	
 	//initialization
 	for( k = 0; k < m * n; k++)
@@ -223,6 +275,10 @@ dpfast(float * SM, int m, int n, int T1, int T2, int * p, int * q, int * length)
 	
 	*length = cpt + 1;
 
+	rta_free(C);
+	rta_free(pD);
+	rta_free(pP);
+
 	return 0;
 }
 
@@ -247,13 +303,13 @@ rta_dtw(float * left_ptr, int left_m, int left_n, float * right_ptr, int right_m
 	int * q;
 
 	//Fill cost (or score) matrix : SM
-	float * SM	= (float *)malloc( left_m * right_m * sizeof(float));
+	float * SM	= (float *)rta_malloc( left_m * right_m * sizeof(float));
 	prepare_score_matrix( left_ptr, left_m, right_ptr, right_m, left_n, SM);
 	
 	
 	//Compute index tables p,q using dynamic programming
-	p = (int *)malloc( (left_m + right_m + 1) * sizeof(int));
-	q = (int *)malloc( (left_m + right_m + 1) * sizeof(int));
+	p = (int *)rta_malloc( (left_m + right_m + 1) * sizeof(int));
+	q = (int *)rta_malloc( (left_m + right_m + 1) * sizeof(int));
 	dpfast(SM, left_m, right_m, 1, 1, p, q, length);
 
 	
@@ -282,5 +338,9 @@ rta_dtw(float * left_ptr, int left_m, int left_n, float * right_ptr, int right_m
 		for (j = 0; j < right_m; j++)
 			output_SM[i * right_m + j] = SM[i * right_m + j];
 	
+	rta_free(SM);
+	rta_free(p);
+	rta_free(q);
+
 	return 0;
 }
@@ -77,6 +77,7 @@
 
 #include "rta_kdtree.h"
 #include "rta_kdtreeintern.h"
+#include "rta_alloc.h"
 
 const char *rta_kdtree_dmodestr[] = { "orthogonal", "hyperplane", "pca" };
 const char *rta_kdtree_mmodestr[] = { "mean", "middle", "median" };
@@ -298,21 +299,96 @@ int rta_kdtree_set_data (rta_kdtree_t *self, int nblocks, rta_real_t **data,
 }
 
 
+/* bits of rta_kdtree_t.nodesowned */
+#define OWNS_NODES 1
+#define OWNS_MEAN  2
+#define OWNS_SPLIT 4
+
+/* free the node memory allocated by the library, keep external memory */
+static void free_nodes (rta_kdtree_t *self)
+{
+  if (self->nodesblock)
+  { /* nodes, mean and split at once */
+    rta_aligned_free(self->nodesblock);
+    self->nodesblock = NULL;
+  }
+  else
+  {
+    if (self->nodesowned & OWNS_NODES) rta_free(self->nodes);
+    if (self->nodesowned & OWNS_MEAN)  rta_free(self->mean);
+    if (self->nodesowned & OWNS_SPLIT) rta_free(self->split);
+  }
+
+  self->nodes = NULL;
+  self->mean  = NULL;
+  self->split = NULL;
+  self->nodesowned = 0;
+}
+
+/* set field to external memory in, or (re)allocate it if in is NULL */
+#define rta_owned_alloc(field, in, size, bit) do { \
+  if (in == NULL) /* auto alloc */ \
+  { \
+    if (self->nodesowned & (bit)) field = rta_realloc(field, size * sizeof(*field)); \
+    else                          field = rta_malloc(size * sizeof(*field)); \
+    self->nodesowned |= (bit); \
+  } \
+  else /* external alloc */ \
+  { \
+    if (self->nodesowned & (bit)) rta_free(field); \
+    field = in; \
+    self->nodesowned &= ~(bit); \
+  } } while (0)
+
 void rta_kdtree_init_nodes (rta_kdtree_t* self, rta_kdtree_node_t *nodes,
                             rta_real_t *planes, rta_real_t *means)
 {
-  rta_auto_alloc(self->nodes, nodes, self->nnodes);
+  int withsplit = self->dmode != dmode_orthogonal;
+
+  if (nodes == NULL  &&  means == NULL  &&  (planes == NULL  ||  !withsplit))
+  { /* all auto alloc: nodes, means and planes contiguous in one aligned arena */
+    size_t nodesize  = self->nnodes * sizeof(rta_kdtree_node_t);
+    size_t meansize  = self->nnodes * self->ndim * sizeof(rta_real_t);
+    size_t splitsize = withsplit  ?  meansize  :  0;
+    rta_arena_t arena;
+
+    free_nodes(self);
+
+    if (rta_arena_new(&arena, rta_align_size(nodesize) + rta_align_size(meansize)
+                              + rta_align_size(splitsize)))
+    {
+      self->nodesblock = arena.base;
+      self->nodes = rta_arena_alloc(&arena, nodesize); /* zeroed */
+      self->mean  = rta_arena_alloc(&arena, meansize);
+      if (withsplit)
+        self->split = rta_arena_alloc(&arena, splitsize);
+    }
+  }
+  else
+  {
+    if (self->nodesblock) /* previous arena can't be reallocated piecewise */
+      free_nodes(self);
+
+    rta_owned_alloc(self->nodes, nodes, self->nnodes, OWNS_NODES);
 #ifndef WIN32
-  bzero(self->nodes, self->nnodes * sizeof(rta_kdtree_node_t));
+    bzero(self->nodes, self->nnodes * sizeof(rta_kdtree_node_t));
 #else
-  memset(self->nodes, 0.0, self->nnodes * sizeof(rta_kdtree_node_t));
+    memset(self->nodes, 0.0, self->nnodes * sizeof(rta_kdtree_node_t));
 #endif
-  rta_auto_alloc(self->mean, means, self->nnodes * self->ndim);
+    rta_owned_alloc(self->mean, means, self->nnodes * self->ndim, OWNS_MEAN);
 
-  if (self->dmode != dmode_orthogonal)
-    rta_auto_alloc(self->split, planes, self->nnodes * self->ndim);
+    if (withsplit)
+      rta_owned_alloc(self->split, planes, self->nnodes * self->ndim, OWNS_SPLIT);
+    else
+    {
+      if (self->nodesowned & OWNS_SPLIT)
+        rta_free(self->split);
+      self->split = NULL;
+      self->nodesowned &= ~OWNS_SPLIT;
+    }
+  }
 
-  if (self->nnodes > 0)
+  if (self->nnodes > 0  &&  self->nodes != NULL)
   {   /* init root node */
     self->nodes[0].startind = 0;
     self->nodes[0].endind   = self->ndatatot - 1;
@@ -370,6 +446,9 @@ void rta_kdtree_init (rta_kdtree_t *self)
   self->nodes       = NULL;
   self->data        = NULL;
   self->mean        = NULL;
+  self->split       = NULL;
+  self->nodesblock  = NULL;
+  self->nodesowned  = 0;
   self->sigma       = NULL;
   self->sigma_nnz   = 0;
   self->sigma_indnz = NULL;
@@ -386,9 +465,8 @@ void rta_kdtree_init (rta_kdtree_t *self)
 void rta_kdtree_free (rta_kdtree_t *self)
 {
   if (self->dataindex) rta_free(self->dataindex);
-  if (self->nodes) rta_free(self->nodes);
-  if (self->mean) rta_free(self->mean);
-  if (self->split) rta_free(self->split);
+
+  free_nodes(self);
   if (self->sigma_indnz) rta_free(self->sigma_indnz);
 
   rta_kdtree_stack_free(&self->stack);
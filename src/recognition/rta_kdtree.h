@@ -204,6 +204,10 @@ typedef struct _kdtree_struct
   rta_real_t *mean;   /**< mean vectors in nnodes rows (todo: median), always present */
   rta_real_t *split;    /**< hyperplanes A1*X1 + A2*X2 +...+ An*Xn + An+1 = 0,
          in nnodes rows or NULL in dmode_orthogonal */
+  void   *nodesblock; /**< aligned arena holding automatically allocated
+         nodes, mean and split, or NULL */
+  int     nodesowned; /**< bits of nodes, mean and split allocated one by
+         one by the library (outside of the arena) */
 
   int     sort;   /**< sort search result by distance */
   rta_kdtree_stack_t stack;
@@ -280,7 +284,8 @@ void rta_kdtree_init (rta_kdtree_t *self);
 
 /** free auto-allocated tree memory
 
-    Call this ONLY when you gave the required node memory pointers as NULL.
+    Memory given to rta_kdtree_set_data() and rta_kdtree_init_nodes()
+    is not freed.
 */
 void rta_kdtree_free (rta_kdtree_t *self);
 
@@ -35,6 +35,8 @@
 
 #include "rta_kdtree.h"
 #include "rta_kdtreeintern.h"
+#include "rta_trace.h"
+#include "rta_parallel.h"
 #include <stdlib.h>
 #include <math.h>
 #include <assert.h>
@@ -480,11 +482,121 @@ void kdtree_rebuild (kdtree_t* t)
 #endif
 
 
+/* the nodes of a level cover disjoint ranges of the data index, and
+   can be split in parallel */
+typedef struct build_level
+{
+  rta_kdtree_t *t;
+  int level;
+  int nstart;   /* first node of level */
+  int use_sigma;
+} build_level_t;
+
+/* split nodes nstart + [begin, end[ of the level into their children */
+static void split_nodes (rta_kdtree_t *t, build_level_t *b, int begin, int end)
+{
+  int l = b->level;
+  int use_sigma = b->use_sigma;
+  int n;    // current node number
+  int i, j; // loop counters
+
+  for (n = b->nstart + begin; n < b->nstart + end; n++)
+  {   /* for all nodes at tree level l */
+    int startind = t->nodes[n].startind;
+    int endind   = t->nodes[n].endind;
+
+    if (decompose_node(t, n, l, use_sigma))
+    {   /* well-behaved node */
+#if RTA_DEBUG_KDTREEBUILD
+      rta_post("Node #%i (%i..%i): mean = ", n, startind, endind);
+      rta_row_post(t->mean, n, t->ndim, "\n");
+#endif
+      i = startind;
+      j = endind;
+
+      while (i < j)
+      { /* sort node vectors by distance to splitplane */
+        while (i < j  &&  distV2N(t, rta_kdtree_get_vector(t, i), n) <= 0)
+          i++;  // if (i >= t->ndata) rta_post("n %d: i=%d\n", n, i);
+
+        while (i < j  &&  distV2N(t, rta_kdtree_get_vector(t, j), n) > 0)
+          j--;  // if (j < 0) rta_post("n %d: j=%d\n", n, j);
+
+        if (i < j)
+          swap(t, i, j);    // rta_post("swap %i and %i\n", i ,j);
+      }
+    }
+    else
+    {
+      if (startind == endind)
+      {   /* singleton node: don't split, pass through to left lower (leaf) level node */
+        j = startind + 1;
+        i = endind + 1; /* create empty right node */
+      }
+      else
+      { /* degenerate node: all points on splitplane -> halve */
+        int middle = (startind + endind) >> 1;
+        j = middle;
+        i = middle + 1;
+#if RTA_DEBUG_KDTREEBUILD
+        rta_post("degenerate Node #%i (%i..%i): splitting at %d, %d  mean = ",
+                 n, startind, endind, j, i);
+        rta_row_post(t->mean, n, t->ndim, "\n");
+#endif
+      }
+    }
+#if RTA_DEBUG_KDTREEBUILD > 1
+    rta_post("  --> decomposition (%i..%i), (%i..%i)\n", startind, j - 1, i, endind);
+#endif
+
+    assert(2*n+2 < t->nnodes);
+    t->nodes[2*n+1].startind = startind; // start index of left child of node n
+    t->nodes[2*n+1].endind   = j - 1;  // end   index of left child of node n
+    t->nodes[2*n+1].size     = j - startind;
+
+    t->nodes[2*n+2].startind = i;  // start index of right child of node n
+    t->nodes[2*n+2].endind   = endind;   // end   index of right child of node n
+    t->nodes[2*n+2].size     = endind - i + 1;
+  }   /* end for nodes n */
+}
+
+static void build_nodes (void *context, int begin, int end)
+{
+  build_level_t *b = (build_level_t *) context;
+
+  split_nodes(b->t, b, begin, end);
+}
+
+#if RTA_KDTREE_PROFILE_BUILD
+/* count in a copy of the tree, whose node and data arrays are shared,
+   then sum the counts in node order */
+static void build_nodes_profile (void *context, int begin, int end, void *partial)
+{
+  build_level_t *b = (build_level_t *) context;
+  rta_kdtree_t local = *b->t;
+
+  rta_kdtree_profile_clear(&local);
+  split_nodes(&local, b, begin, end);
+  *(rta_kdtree_profile_t *) partial = local.profile;
+}
+
+static void add_profile (void *context, void *accumulator, const void *partial)
+{
+  rta_kdtree_profile_t *sum = (rta_kdtree_profile_t *) accumulator;
+  const rta_kdtree_profile_t *p = (const rta_kdtree_profile_t *) partial;
+
+  sum->v2v    += p->v2v;
+  sum->v2n    += p->v2n;
+  sum->mean   += p->mean;
+  sum->hyperp += p->hyperp;
+}
+#endif
+
+
 void rta_kdtree_build (rta_kdtree_t* t, int use_sigma)
 {
   int l;    // current level number
-  int n;    // current node number
-  int i, j;   // loop counters
+  build_level_t level;
 
   /* Maximum length is equal to pow2(height-1) */
   if (pow2(t->height - 1) > t->ndatatot  ||  t->ndim == 0)
@@ -500,6 +612,11 @@ void rta_kdtree_build (rta_kdtree_t* t, int use_sigma)
     return;
   }
 
+  RTA_TRACE_BEGIN(rta_trace_kdtree_build);
+
+  level.t = t;
+  level.use_sigma = use_sigma;
+
   for (l = 0; l < t->height - 1; l++)
   {   /* initialise inner nodes */
     int nstart = pow2(l)   - 1;
@@ -508,63 +625,28 @@ void rta_kdtree_build (rta_kdtree_t* t, int use_sigma)
     rta_post("\nLevel #%i  nodes %d..%d\n", l, nstart, nend);
 #endif
 
-    for (n = nstart; n < nend; n++)
-    {   /* for all nodes at tree level l */
-      int startind = t->nodes[n].startind;
-      int endind   = t->nodes[n].endind;
-
-      if (decompose_node(t, n, l, use_sigma))
-      {   /* well-behaved node */
+    level.level = l;
+    level.nstart = nstart;
 #if RTA_DEBUG_KDTREEBUILD
-        rta_post("Node #%i (%i..%i): mean = ", n, startind, endind);
-        rta_row_post(t->mean, n, t->ndim, "\n");
-#endif
-        i = startind;
-        j = endind;
-
-        while (i < j)
-        { /* sort node vectors by distance to splitplane */
-          while (i < j  &&  distV2N(t, rta_kdtree_get_vector(t, i), n) <= 0)
-            i++;  // if (i >= t->ndata) rta_post("n %d: i=%d\n", n, i);
-
-          while (i < j  &&  distV2N(t, rta_kdtree_get_vector(t, j), n) > 0)
-            j--;  // if (j < 0) rta_post("n %d: j=%d\n", n, j);
+    build_nodes(&level, 0, nend - nstart); /* keep the posts in order */
+#elif RTA_KDTREE_PROFILE_BUILD
+    {
+      rta_kdtree_profile_t zero = { 0 }, counts = { 0 };
 
-          if (i < j)
-            swap(t, i, j);    // rta_post("swap %i and %i\n", i ,j);
-        }
-      }
+      /* a node sorts its (ndatatot >> l) vectors */
+      if (rta_parallel_reduce(nend - nstart, rta_parallel_grain((t->ndatatot >> l) * t->ndim),
+                              sizeof(rta_kdtree_profile_t), &zero,
+                              build_nodes_profile, add_profile, &level, &counts))
+        add_profile(NULL, &t->profile, &counts);
       else
-      {
-        if (startind == endind)
-        {   /* singleton node: don't split, pass through to left lower (leaf) level node */
-          j = startind + 1;
-          i = endind + 1; /* create empty right node */
-        }
-        else
-        { /* degenerate node: all points on splitplane -> halve */
-          int middle = (startind + endind) >> 1;
-          j = middle;
-          i = middle + 1;
-#if RTA_DEBUG_KDTREEBUILD
-          rta_post("degenerate Node #%i (%i..%i): splitting at %d, %d  mean = ",
-                   n, startind, endind, j, i);
-          rta_row_post(t->mean, n, t->ndim, "\n");
-#endif
-        }
-      }
-#if RTA_DEBUG_KDTREEBUILD > 1
-      rta_post("  --> decomposition (%i..%i), (%i..%i)\n", startind, j - 1, i, endind);
+        build_nodes(&level, 0, nend - nstart);
+    }
+#else
+    rta_parallel_for(nend - nstart, rta_parallel_grain((t->ndatatot >> l) * t->ndim),
+                     build_nodes, &level);
 #endif
-
-      assert(2*n+2 < t->nnodes);
-      t->nodes[2*n+1].startind = startind; // start index of left child of node n
-      t->nodes[2*n+1].endind   = j - 1;  // end   index of left child of node n
-      t->nodes[2*n+1].size     = j - startind;
-
-      t->nodes[2*n+2].startind = i;  // start index of right child of node n
-      t->nodes[2*n+2].endind   = endind;   // end   index of right child of node n
-      t->nodes[2*n+2].size     = endind - i + 1;
-    }   /* end for nodes n */
   }
+
+  RTA_TRACE_COUNT(rta_trace_kdtree_build, t->ndatatot);
+  RTA_TRACE_END(rta_trace_kdtree_build);
 }
@@ -37,6 +37,7 @@
 #include <math.h>
 #include "rta_kdtree.h"
 #include "rta_kdtreeintern.h"
+#include "rta_trace.h"
 
 
 #ifdef DEBUG
@@ -237,9 +238,15 @@ int rta_kdtree_search_knn (rta_kdtree_t *t, rta_real_t* vector, int stride,
 
   rta_kdtree_stack_t *s = &t->stack;
   rta_kdtree_stack_elem_t cur; /* current (node, dist) couple */
+  RTA_TRACE_BEGIN(rta_trace_kdtree_search);
+
+  RTA_TRACE_COUNT(rta_trace_kdtree_search, 1);
 
   if (t->ndatatot == 0)
+  {
+    RTA_TRACE_END(rta_trace_kdtree_search);
     return 0;
+  }
 
   if (k < 1)
     k = 1;
@@ -372,5 +379,6 @@ int rta_kdtree_search_knn (rta_kdtree_t *t, rta_real_t* vector, int stride,
 
   /* return actual number of found neighbours, can be less than k,
      then kmax is the index of the next one to find */
+  RTA_TRACE_END(rta_trace_kdtree_search);
   return kmax + (dist[kmax] < sentinel);
 }
@@ -43,6 +43,7 @@
 #include <math.h>
 
 #include "rta_mahalanobis.h"
+#include "rta_parallel.h"
 
 
 /* update non-zero sigma index list */
@@ -59,6 +60,57 @@ int rta_find_nz (int n, rta_real_t *vec, int stride, int *indnz)
 
 
 
+/* arguments of rta_mahalanobis and rta_mahalanobis_nz for parallel rows */
+typedef struct mahalanobis_args
+{
+  int N, C;
+  rta_real_t *inptr;    int instride,    inskip;
+  rta_real_t *muptr;    int mustride,    muskip;
+  rta_real_t *sigmaptr; int sigmastride, sigmaskip;
+  rta_real_t *outptr;   int outstride,   outskip;
+  int nnz;
+  int *sigma_indnz;
+  rta_bpf_t **distfuncs;
+} mahalanobis_args_t;
+
+/* input rows / output columns [begin, end[ of rta_mahalanobis */
+static void mahalanobis_rows (void *context, int begin, int end)
+{
+  mahalanobis_args_t *a = (mahalanobis_args_t *) context;
+  rta_real_t *inptr  = a->inptr  + begin * a->inskip;
+  rta_real_t *outptr = a->outptr + begin * a->outskip;
+  int i, j, k;
+
+  /* for each input row k / output column k */
+  for (k = begin; k < end; k++, inptr += a->inskip, outptr += a->outskip)
+  {
+    rta_real_t *outcol = outptr;
+
+    /* for each mu / output row i */
+    for (i = 0; i < a->C; i++, outcol += a->outstride)
+    {
+      rta_real_t *inrow = inptr;
+      rta_real_t *murow = a->muptr  + i * a->muskip;
+      rta_real_t *sigmarow = a->sigmaptr + i * a->sigmaskip;
+      rta_real_t  v = 0.f;
+
+      /*
+        for each input column j: calculate
+         y(i, k) = sum(j=1..N) (x(k, j) - mu(i, j))^2 / sigma(i, j)^2
+      */
+      for (j = 0; j < a->N; j++, inrow += a->instride,
+                                 murow += a->mustride,
+                                 sigmarow += a->sigmastride)
+      {
+        rta_real_t x = (*inrow - *murow) / *sigmarow;
+        v += x * x;
+      }
+
+      *outcol = v;
+    }
+  }
+}
+
 /** Pure Mahalanbis distance calculation
  *
  * out = sum((in - mu) .^ 2 ./ sigma)
@@ -82,51 +134,74 @@ int rta_mahalanobis(int M, int N, int C,
                     rta_real_t *sigmaptr, int sigmastride, int sigmaskip,
                     rta_real_t *outptr,   int outstride,   int outskip)
 {
-  int i, j, k;
+  mahalanobis_args_t args;
 
   /*  rta_post("M %d N %d C %d,  inptr %p  instride %d  inskip %d,  muptr %p  mustride %d  muskip %d,  sigmaptr %p  sigmastride %d  sigmaskip %d,  outptr %p  outstride %d  outskip %d\n",
              M, N, C, inptr, instride, inskip, muptr, mustride, muskip,
              sigmaptr, sigmastride, sigmaskip, outptr, outstride, outskip); */
 
+  args.N = N;
+  args.C = C;
+  args.inptr    = inptr;    args.instride    = instride;    args.inskip    = inskip;
+  args.muptr    = muptr;    args.mustride    = mustride;    args.muskip    = muskip;
+  args.sigmaptr = sigmaptr; args.sigmastride = sigmastride; args.sigmaskip = sigmaskip;
+  args.outptr   = outptr;   args.outstride   = outstride;   args.outskip   = outskip;
+
+  /* input rows are independent */
+  rta_parallel_for(M, rta_parallel_grain(C * N), mahalanobis_rows, &args);
+
+  return 1;
+}
+
+
+
+/* input rows / output columns [begin, end[ of rta_mahalanobis_nz */
+static void mahalanobis_nz_rows (void *context, int begin, int end)
+{
+  mahalanobis_args_t *a = (mahalanobis_args_t *) context;
+  rta_real_t *inptr  = a->inptr  + begin * a->inskip;
+  rta_real_t *outptr = a->outptr + begin * a->outskip;
+  int i, j, k;
+
   /* for each input row k / output column k */
-  for (k = 0; k < M; k++, inptr += inskip, outptr += outskip)
+  for (k = begin; k < end; k++, inptr += a->inskip, outptr += a->outskip)
   {
-    rta_real_t *outcol = outptr;
+    rta_real_t *outcol    = outptr;
 
     /* for each mu / output row i */
-    for (i = 0; i < C; i++, outcol += outstride)
+    for (i = 0; i < a->C; i++, outcol += a->outstride)
     {
-      rta_real_t *inrow = inptr;
-      rta_real_t *murow = muptr  + i * muskip;
-      rta_real_t *sigmarow = sigmaptr + i * sigmaskip;
+      rta_real_t *inrow     = inptr;
+      rta_real_t *murow     = a->muptr    + i * a->muskip;
+      rta_real_t *sigmarow  = a->sigmaptr + i * a->sigmaskip;
       rta_real_t  v = 0.f;
 
       /*
-        for each input column j: calculate
-         y(i, k) = sum(j=1..N) (x(k, j) - mu(i, j))^2 / sigma(i, j)^2
+        for each NON-zero-sigma input column jj: calculate
+        y(i, k) = sum(j=1..N) (x(k, j) - mu(i, j))^2 / sigma(i, j)^2
       */
-      for (j = 0; j < N; j++, inrow += instride,
-                              murow += mustride,
-                              sigmarow += sigmastride)
+      for (j = 0; j < a->nnz; j++)
       {
-        rta_real_t x = (*inrow - *murow) / *sigmarow;
-        v += x * x;
+        int jj = a->sigma_indnz[j];
+#if RTA_USE_DISTFUNC // uses rta_bpf_t, (data-compatible to FTM bpfunc_t)
+        rta_real_t  d    = inrow[jj * a->instride] - murow[jj * a->mustride];
+        rta_bpf_t  *dfun = a->distfuncs[jj];
 
-        /*
-          rta_post("k %d  i %d  j %d,  inrow %d (%p)  outcol %d (%p)  murow %d (%p) sigmarow %d (%p) -- x %f  v %f\n",
-          k, i, j, inrow - inptr, inrow, outcol - outptr, outcol, murow - muptr, murow, sigmarow - sigmaptr, sigmarow, x, v);
-        */
+        if (dfun)
+          d = rta_bpf_get_interpolated(dfun, d);
+        d /= sigmarow[jj * a->sigmastride];
+#else
+        rta_real_t d  = (inrow[jj * a->instride] - murow[jj * a->mustride]) /
+                        sigmarow[jj * a->sigmastride];
+#endif /* RTA_USE_DISTFUNC */
+        v += d * d;
       }
 
       *outcol = v;
     }
   }
-
-  return 1;
 }
 
-
-
 /** Mahalanbis distance calculation on non-zero dimensions
  *
  * out = sum(distfunc(in - mu) .^ 2 ./ sigma^2)
@@ -153,45 +228,19 @@ int rta_mahalanobis_nz(int M, int N, int C,
                        rta_real_t *outptr,   int outstride,   int outskip,
                        int nnz, int *sigma_indnz, rta_bpf_t *distfuncs[])
 {
-  int i, j, k;
-
-  /* for each input row k / output column k */
-  for (k = 0; k < M; k++, inptr += inskip, outptr += outskip)
-  {
-    rta_real_t *outcol    = outptr;
-
-    /* for each mu / output row i */
-    for (i = 0; i < C; i++, outcol += outstride)
-    {
-      rta_real_t *inrow     = inptr;
-      rta_real_t *murow     = muptr    + i * muskip;
-      rta_real_t *sigmarow  = sigmaptr + i * sigmaskip;
-      rta_real_t  v = 0.f;
-
-      /*
-        for each NON-zero-sigma input column jj: calculate
-        y(i, k) = sum(j=1..N) (x(k, j) - mu(i, j))^2 / sigma(i, j)^2
-      */
-      for (j = 0; j < nnz; j++)
-      {
-        int jj = sigma_indnz[j];
-#if RTA_USE_DISTFUNC // uses rta_bpf_t, (data-compatible to FTM bpfunc_t)
-        rta_real_t  d    = inrow[jj * instride] - murow[jj * mustride];
-        rta_bpf_t  *dfun = distfuncs[jj];
-
-        if (dfun)
-          d = rta_bpf_get_interpolated(dfun, d);
-        d /= sigmarow[jj * sigmastride];
-#else
-        rta_real_t d  = (inrow[jj * instride] - murow[jj * mustride]) /
-                        sigmarow[jj * sigmastride];
-#endif /* RTA_USE_DISTFUNC */
-        v += d * d;
-      }
-
-      *outcol = v;
-    }
-  }
+  mahalanobis_args_t args;
+
+  args.N = N;
+  args.C = C;
+  args.inptr    = inptr;    args.instride    = instride;    args.inskip    = inskip;
+  args.muptr    = muptr;    args.mustride    = mustride;    args.muskip    = muskip;
+  args.sigmaptr = sigmaptr; args.sigmastride = sigmastride; args.sigmaskip = sigmaskip;
+  args.outptr   = outptr;   args.outstride   = outstride;   args.outskip   = outskip;
+  args.nnz = nnz;
+  args.sigma_indnz = sigma_indnz;
+  args.distfuncs = distfuncs;
+
+  rta_parallel_for(M, rta_parallel_grain(C * nnz), mahalanobis_nz_rows, &args);
 
   return 1;
 }
@@ -43,6 +43,7 @@
 #include "rta_mel.h"
 #include "rta_math.h"
 #include "rta_stdlib.h"
+#include "rta_trace.h" /* RTA_TRACE_BEGIN, RTA_TRACE_END */
 
 
 int rta_spectrum_to_mel_bands_weights(
@@ -353,6 +354,7 @@ void rta_spectrum_to_bands_abs(
   const unsigned int spectrum_size, const unsigned int filters_number)
 {
   unsigned int i,j;
+  RTA_TRACE_BEGIN(rta_trace_spectrum_to_bands);
 
   for(i=0; i<filters_number; i++)
   {
@@ -363,6 +365,8 @@ void rta_spectrum_to_bands_abs(
     }
   }
 
+  RTA_TRACE_COUNT(rta_trace_spectrum_to_bands, spectrum_size);
+  RTA_TRACE_END(rta_trace_spectrum_to_bands);
   return;
 }
 
@@ -375,6 +379,7 @@ void rta_spectrum_to_bands_abs_stride(
   const unsigned int spectrum_size, const unsigned int filters_number)
 {
   unsigned int i,j;
+  RTA_TRACE_BEGIN(rta_trace_spectrum_to_bands);
 
   for(i=0; i<filters_number; i++)
   {
@@ -386,6 +391,8 @@ void rta_spectrum_to_bands_abs_stride(
     }
   }
 
+  RTA_TRACE_COUNT(rta_trace_spectrum_to_bands, spectrum_size);
+  RTA_TRACE_END(rta_trace_spectrum_to_bands);
   return;
 }
 
@@ -396,6 +403,7 @@ void rta_spectrum_to_bands_square_abs(
   const unsigned int spectrum_size, const unsigned int filters_number)
 {
   unsigned int i,j;
+  RTA_TRACE_BEGIN(rta_trace_spectrum_to_bands);
 
   for(i=0; i<filters_number; i++)
   {
@@ -407,6 +415,8 @@ void rta_spectrum_to_bands_square_abs(
     bands[i] = rta_pow(bands[i], 2);
   }
 
+  RTA_TRACE_COUNT(rta_trace_spectrum_to_bands, spectrum_size);
+  RTA_TRACE_END(rta_trace_spectrum_to_bands);
   return;
 }
 
@@ -419,6 +429,7 @@ void rta_spectrum_to_bands_square_abs_stride(
   const unsigned int spectrum_size, const unsigned int filters_number)
 {
   unsigned int i,j;
+  RTA_TRACE_BEGIN(rta_trace_spectrum_to_bands);
 
   for(i=0; i<filters_number; i++)
   {
@@ -431,5 +442,7 @@ void rta_spectrum_to_bands_square_abs_stride(
     bands[i*b_stride] = rta_pow(bands[i*b_stride], 2);
   }
 
+  RTA_TRACE_COUNT(rta_trace_spectrum_to_bands, spectrum_size);
+  RTA_TRACE_END(rta_trace_spectrum_to_bands);
   return;
 }
@@ -42,6 +42,7 @@
 #include "rta_biquad.h"
 #include "rta_filter.h" /* filter types */
 #include "rta_math.h" /* rta_sin, rta_cos, M_PI */
+#include "rta_trace.h" /* RTA_TRACE_BEGIN, RTA_TRACE_END */
 
 /* y(n) = b0 x(n) + b1 x(n-1) + b2 x(n-2)  */
 /*                - a1 x(n-1) - a2 x(n-2)  */
@@ -701,6 +702,7 @@ void rta_biquad_df1_vector(rta_real_t * y,
                            rta_real_t * states)
 {
   unsigned int i;
+  RTA_TRACE_BEGIN(rta_trace_biquad_vector);
   
   for(i = 0; i < x_size; i++)
   {
@@ -708,6 +710,8 @@ void rta_biquad_df1_vector(rta_real_t * y,
   }
   
 
+  RTA_TRACE_COUNT(rta_trace_biquad_vector, x_size);
+  RTA_TRACE_END(rta_trace_biquad_vector);
   return;
 }
 
@@ -717,6 +721,7 @@ void rta_biquad_df2t_vector(rta_real_t * y,
                             rta_real_t * states)
 {
   unsigned int i;
+  RTA_TRACE_BEGIN(rta_trace_biquad_vector);
   
   for(i = 0; i < x_size; i++)
   {
@@ -724,6 +729,8 @@ void rta_biquad_df2t_vector(rta_real_t * y,
   }
   
 
+  RTA_TRACE_COUNT(rta_trace_biquad_vector, x_size);
+  RTA_TRACE_END(rta_trace_biquad_vector);
   return;
 }
 
@@ -735,6 +742,7 @@ void rta_biquad_df1_vector_stride(
   rta_real_t * states, const int s_stride)
 {
   int ix, iy;
+  RTA_TRACE_BEGIN(rta_trace_biquad_vector);
   
   for(ix = 0, iy = 0;
       ix < (int) x_size*x_stride;
@@ -744,6 +752,8 @@ void rta_biquad_df1_vector_stride(
       x[ix], b, b_stride, a, a_stride, states, s_stride);
   }
 
+  RTA_TRACE_COUNT(rta_trace_biquad_vector, x_size);
+  RTA_TRACE_END(rta_trace_biquad_vector);
   return;
 }
 
@@ -755,6 +765,7 @@ void rta_biquad_df2t_vector_stride(
   rta_real_t * states, const int s_stride)
 {
   int ix, iy;
+  RTA_TRACE_BEGIN(rta_trace_biquad_vector);
   
   for(ix = 0, iy = 0;
       ix < (int) x_size*x_stride;
@@ -764,5 +775,7 @@ void rta_biquad_df2t_vector_stride(
       x[ix], b, b_stride, a, a_stride, states, s_stride);
   }
 
+  RTA_TRACE_COUNT(rta_trace_biquad_vector, x_size);
+  RTA_TRACE_END(rta_trace_biquad_vector);
   return;
 }
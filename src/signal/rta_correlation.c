@@ -37,6 +37,7 @@
  */
 
 #include "rta_correlation.h"
+#include "rta_cpu.h" /* rta_cpu_get_level */
 
 
 /* specific implementations */
@@ -44,6 +45,219 @@
 #include <Accelerate/Accelerate.h>
 #endif
 
+/* ------- dot product kernels, dispatched at run time ------- */
+
+typedef rta_real_t (*dot_function_t) (const rta_real_t * a,
+                                      const rta_real_t * b,
+                                      const unsigned int size);
+
+static rta_real_t
+dot_generic(const rta_real_t * a, const rta_real_t * b,
+            const unsigned int size)
+{
+  rta_real_t sum = 0.0;
+  unsigned int f;
+  for(f=0; f<size; f++)
+  {
+    sum += a[f] * b[f];
+  }
+  return sum;
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE || RTA_REAL_TYPE == RTA_DOUBLE_TYPE)
+
+#if defined(RTA_CPU_X86)
+#include <immintrin.h>
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+#define SSE_WIDTH 4
+#define sse_t __m128
+#define sse_zero _mm_setzero_ps
+#define sse_load _mm_loadu_ps
+#define sse_store _mm_storeu_ps
+#define sse_mul_add(acc, x, y) _mm_add_ps((acc), _mm_mul_ps((x), (y)))
+#define AVX_WIDTH 8
+#define avx_t __m256
+#define avx_zero _mm256_setzero_ps
+#define avx_load _mm256_loadu_ps
+#define avx_store _mm256_storeu_ps
+#define avx_mul_add(acc, x, y) _mm256_fmadd_ps((x), (y), (acc))
+#define AVX512_WIDTH 16
+#define avx512_t __m512
+#define avx512_zero _mm512_setzero_ps
+#define avx512_load _mm512_loadu_ps
+#define avx512_store _mm512_storeu_ps
+#define avx512_mul_add(acc, x, y) _mm512_fmadd_ps((x), (y), (acc))
+#else
+#define SSE_WIDTH 2
+#define sse_t __m128d
+#define sse_zero _mm_setzero_pd
+#define sse_load _mm_loadu_pd
+#define sse_store _mm_storeu_pd
+#define sse_mul_add(acc, x, y) _mm_add_pd((acc), _mm_mul_pd((x), (y)))
+#define AVX_WIDTH 4
+#define avx_t __m256d
+#define avx_zero _mm256_setzero_pd
+#define avx_load _mm256_loadu_pd
+#define avx_store _mm256_storeu_pd
+#define avx_mul_add(acc, x, y) _mm256_fmadd_pd((x), (y), (acc))
+#define AVX512_WIDTH 8
+#define avx512_t __m512d
+#define avx512_zero _mm512_setzero_pd
+#define avx512_load _mm512_loadu_pd
+#define avx512_store _mm512_storeu_pd
+#define avx512_mul_add(acc, x, y) _mm512_fmadd_pd((x), (y), (acc))
+#endif
+
+RTA_CPU_TARGET("sse2") static rta_real_t
+dot_sse2(const rta_real_t * a, const rta_real_t * b, const unsigned int size)
+{
+  sse_t acc = sse_zero();
+  rta_real_t lanes[SSE_WIDTH];
+  rta_real_t sum = 0.0;
+  unsigned int f, l;
+
+  for(f=0; f+SSE_WIDTH<=size; f+=SSE_WIDTH)
+  {
+    acc = sse_mul_add(acc, sse_load(a + f), sse_load(b + f));
+  }
+  sse_store(lanes, acc);
+
+  for(l=0; l<SSE_WIDTH; l++)
+  {
+    sum += lanes[l];
+  }
+  for(; f<size; f++)
+  {
+    sum += a[f] * b[f];
+  }
+  return sum;
+}
+
+RTA_CPU_TARGET("avx2,fma") static rta_real_t
+dot_avx2(const rta_real_t * a, const rta_real_t * b, const unsigned int size)
+{
+  /* two accumulators to hide the fma latency */
+  avx_t acc0 = avx_zero();
+  avx_t acc1 = avx_zero();
+  rta_real_t lanes[2 * AVX_WIDTH];
+  rta_real_t sum = 0.0;
+  unsigned int f, l;
+
+  for(f=0; f+2*AVX_WIDTH<=size; f+=2*AVX_WIDTH)
+  {
+    acc0 = avx_mul_add(acc0, avx_load(a + f), avx_load(b + f));
+    acc1 = avx_mul_add(acc1, avx_load(a + f + AVX_WIDTH),
+                       avx_load(b + f + AVX_WIDTH));
+  }
+  avx_store(lanes, acc0);
+  avx_store(lanes + AVX_WIDTH, acc1);
+
+  for(l=0; l<2*AVX_WIDTH; l++)
+  {
+    sum += lanes[l];
+  }
+  for(; f<size; f++)
+  {
+    sum += a[f] * b[f];
+  }
+  return sum;
+}
+
+RTA_CPU_TARGET("avx512f") static rta_real_t
+dot_avx512(const rta_real_t * a, const rta_real_t * b, const unsigned int size)
+{
+  avx512_t acc0 = avx512_zero();
+  avx512_t acc1 = avx512_zero();
+  rta_real_t lanes[2 * AVX512_WIDTH];
+  rta_real_t sum = 0.0;
+  unsigned int f, l;
+
+  for(f=0; f+2*AVX512_WIDTH<=size; f+=2*AVX512_WIDTH)
+  {
+    acc0 = avx512_mul_add(acc0, avx512_load(a + f), avx512_load(b + f));
+    acc1 = avx512_mul_add(acc1, avx512_load(a + f + AVX512_WIDTH),
+                          avx512_load(b + f + AVX512_WIDTH));
+  }
+  avx512_store(lanes, acc0);
+  avx512_store(lanes + AVX512_WIDTH, acc1);
+
+  for(l=0; l<2*AVX512_WIDTH; l++)
+  {
+    sum += lanes[l];
+  }
+  for(; f<size; f++)
+  {
+    sum += a[f] * b[f];
+  }
+  return sum;
+}
+
+#define HAVE_DOT_KERNELS 1
+static const dot_function_t dot_kernels[rta_cpu_num_levels] =
+{
+  dot_generic, dot_sse2, dot_avx2, dot_avx512, dot_generic
+};
+
+#elif defined(RTA_CPU_ARM) && defined(__ARM_NEON) \
+  && (RTA_REAL_TYPE == RTA_FLOAT_TYPE || defined(__aarch64__))
+#include <arm_neon.h>
+
+static rta_real_t
+dot_neon(const rta_real_t * a, const rta_real_t * b, const unsigned int size)
+{
+  rta_real_t sum = 0.0;
+  unsigned int f;
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+  float32x4_t acc = vdupq_n_f32(0.0f);
+  float lanes[4];
+  for(f=0; f+4<=size; f+=4)
+  {
+    acc = vmlaq_f32(acc, vld1q_f32(a + f), vld1q_f32(b + f));
+  }
+  vst1q_f32(lanes, acc);
+  sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#else
+  float64x2_t acc = vdupq_n_f64(0.0);
+  double lanes[2];
+  for(f=0; f+2<=size; f+=2)
+  {
+    acc = vfmaq_f64(acc, vld1q_f64(a + f), vld1q_f64(b + f));
+  }
+  vst1q_f64(lanes, acc);
+  sum = lanes[0] + lanes[1];
+#endif
+
+  for(; f<size; f++)
+  {
+    sum += a[f] * b[f];
+  }
+  return sum;
+}
+
+#define HAVE_DOT_KERNELS 1
+static const dot_function_t dot_kernels[rta_cpu_num_levels] =
+{
+  dot_generic, dot_generic, dot_generic, dot_generic, dot_neon
+};
+
+#endif /* RTA_CPU_X86, RTA_CPU_ARM */
+#endif /* float or double */
+
+/* best dot product for the current dispatch level */
+static dot_function_t
+get_dot(void)
+{
+#if defined(HAVE_DOT_KERNELS)
+  return dot_kernels[rta_cpu_get_level()];
+#else
+  return dot_generic;
+#endif
+}
+
+/* ------- end of kernels ------- */
+
 /* Fast, unbiased by nature, recommended if (c_size / filter_size > 20) */
 /* Requirement: (a_size, b_size) >= c_size + filter_size */
 /* Warning: for VecLib, a_size is required to be aligned on a multiple */
@@ -71,14 +285,11 @@ void rta_correlation_fast(
 #endif /* RTA_USE_VECLIB */
 
 /* Base algorithm */
-    unsigned int c,f;
+    const dot_function_t dot = get_dot();
+    unsigned int c;
     for(c=0; c<c_size; c++)
     {
-      correlation[c] = 0.0;
-      for(f=0; f<filter_size; f++)
-      {
-        correlation[c] += input_vector_a[f+c] * input_vector_b[f];
-      }
+      correlation[c] = dot(input_vector_a + c, input_vector_b, filter_size);
     } /* end of base algorithm */
 
 #if defined(RTA_USE_VECLIB)
@@ -138,14 +349,12 @@ void rta_correlation_raw(
   const rta_real_t * input_vector_b,
   const unsigned int max_filter_size)
 {
-  unsigned int c,f;
+  const dot_function_t dot = get_dot();
+  unsigned int c;
   for(c=0; c<c_size; c++)
   {
-    correlation[c] = 0.0;
-    for(f=0; f<max_filter_size-c; f++)
-    {
-      correlation[c] += input_vector_a[f+c] * input_vector_b[f];
-    }
+    correlation[c] = dot(input_vector_a + c, input_vector_b,
+                         max_filter_size - c);
   }
   return;
 }
@@ -179,15 +388,12 @@ void rta_correlation_unbiased(
   const rta_real_t * input_vector_b,
   const unsigned int max_filter_size)
 {
-  unsigned int c,f;
+  const dot_function_t dot = get_dot();
+  unsigned int c;
   for(c=0; c<c_size; c++)
   {
-    correlation[c] = 0.0;
-    for(f=0; f<max_filter_size-c; f++)
-    {
-      correlation[c] += input_vector_a[f+c] * input_vector_b[f];
-    }
-    correlation[c] /= f;
+    correlation[c] = dot(input_vector_a + c, input_vector_b,
+                         max_filter_size - c) / (max_filter_size - c);
   }
   return;
 }
@@ -246,15 +452,12 @@ void rta_correlation_fast_scaled(
   const rta_real_t * input_vector_b,
   const unsigned int filter_size, const rta_real_t scale)
 {
-  unsigned int c,f;
+  const dot_function_t dot = get_dot();
+  unsigned int c;
   for(c=0; c<c_size; c++)
   {
-    correlation[c] = 0.0;
-    for(f=0; f<filter_size; f++)
-    {
-      correlation[c] += input_vector_a[f+c] * input_vector_b[f];
-    }
-    correlation[c] *= scale;
+    correlation[c] = dot(input_vector_a + c, input_vector_b, filter_size)
+      * scale;
   }
   return;
 }
@@ -288,15 +491,12 @@ void rta_correlation_raw_scaled(
   const rta_real_t * input_vector_b,
   const unsigned int max_filter_size, const rta_real_t scale)
 {
-  unsigned int c,f;
+  const dot_function_t dot = get_dot();
+  unsigned int c;
   for(c=0; c<c_size; c++)
   {
-    correlation[c] = 0.0;
-    for(f=0; f<max_filter_size-c; f++)
-    {
-      correlation[c] += input_vector_a[f+c] * input_vector_b[f];
-    }
-    correlation[c] *= scale;
+    correlation[c] = dot(input_vector_a + c, input_vector_b,
+                         max_filter_size - c) * scale;
   }
   return;
 }
@@ -0,0 +1,782 @@
+/**
+ * @file   rta_cqt.c
+ * @ingroup rta_signal
+ *
+ * @brief  Constant-Q transform by sparse spectral kernels
+ *
+ * @see rta_cqt.h
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_cqt.h"
+#include "rta_fft.h"
+#include "rta_window.h"
+#include "rta_alloc.h"
+#include "rta_cpu.h" /* rta_cpu_get_level */
+#include "rta_int.h" /* rta_inextpow2 */
+#include "rta_math.h"
+
+#include <string.h> /* memset, memcpy */
+
+/* half-band filter of the decimation: 2 * DECIMATOR_TAPS odd taps
+   around the centre one, which is 0.5 */
+#define DECIMATOR_TAPS 16
+
+/* coefficients of each kernel start on a multiple of this number of
+   reals (32 bytes in single precision) */
+#define KERNEL_ALIGNMENT 8
+
+struct rta_cqt
+{
+  rta_cqt_params_t params;
+  unsigned int num_bins;
+  unsigned int num_kernels;    /**< all the bins, or the highest octave */
+  unsigned int num_octaves;
+  unsigned int fft_size;
+  unsigned int frame_size;
+  unsigned int num_coefficients;
+
+  rta_real_t * frequencies;    /**< of the bins, in Hz */
+  unsigned int * kernel_start; /**< first spectrum bin of each kernel */
+  unsigned int * kernel_size;  /**< complex coefficients of each kernel */
+  unsigned int * kernel_offset; /**< in reals, in direct and crossed */
+  rta_real_t * direct;         /**< (re, im) of the conjugate product */
+  rta_real_t * crossed;        /**< (-im, re) */
+  rta_real_t decimator[DECIMATOR_TAPS];
+
+  rta_real_t * decimated[2];   /**< successive octaves, alternately */
+  rta_real_t * odd;            /**< odd samples of the octave above */
+  rta_real_t * frame;          /**< centre of an octave, for the FFT */
+  rta_real_t * spectrum;
+  rta_fft_setup_t * fft_setup;
+  rta_real_t fft_scale;
+  rta_real_t nyquist;
+};
+
+/* ------- sparse product kernels, dispatched at run time ------- */
+
+/* real and imaginary parts of the sum of the products of the complex
+   'spectrum' with the conjugate of a kernel, given as its 'direct'
+   and 'crossed' coefficients; 'size' is in reals */
+typedef void (*product_function_t) (rta_real_t * real, rta_real_t * imag,
+                                    const rta_real_t * spectrum,
+                                    const rta_real_t * direct,
+                                    const rta_real_t * crossed,
+                                    const unsigned int size);
+
+static void
+product_generic(rta_real_t * real, rta_real_t * imag,
+                const rta_real_t * spectrum, const rta_real_t * direct,
+                const rta_real_t * crossed, const unsigned int size)
+{
+  rta_real_t re = 0.0;
+  rta_real_t im = 0.0;
+  unsigned int i;
+
+  for(i=0; i<size; i++)
+  {
+    re += spectrum[i] * direct[i];
+    im += spectrum[i] * crossed[i];
+  }
+
+  *real = re;
+  *imag = im;
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE) && defined(RTA_CPU_X86)
+#include <immintrin.h>
+
+RTA_CPU_TARGET("sse2") static void
+product_sse2(rta_real_t * real, rta_real_t * imag,
+             const rta_real_t * spectrum, const rta_real_t * direct,
+             const rta_real_t * crossed, const unsigned int size)
+{
+  __m128 re = _mm_setzero_ps();
+  __m128 im = _mm_setzero_ps();
+  float lanes_re[4], lanes_im[4];
+  rta_real_t tail_re, tail_im;
+  unsigned int i;
+
+  for(i=0; i+4<=size; i+=4)
+  {
+    const __m128 x = _mm_loadu_ps(spectrum + i);
+
+    re = _mm_add_ps(re, _mm_mul_ps(x, _mm_load_ps(direct + i)));
+    im = _mm_add_ps(im, _mm_mul_ps(x, _mm_load_ps(crossed + i)));
+  }
+  _mm_storeu_ps(lanes_re, re);
+  _mm_storeu_ps(lanes_im, im);
+
+  product_generic(&tail_re, &tail_im, spectrum + i, direct + i, crossed + i,
+                  size - i);
+  *real = (lanes_re[0] + lanes_re[1]) + (lanes_re[2] + lanes_re[3]) + tail_re;
+  *imag = (lanes_im[0] + lanes_im[1]) + (lanes_im[2] + lanes_im[3]) + tail_im;
+}
+
+RTA_CPU_TARGET("avx2,fma") static void
+product_avx2(rta_real_t * real, rta_real_t * imag,
+             const rta_real_t * spectrum, const rta_real_t * direct,
+             const rta_real_t * crossed, const unsigned int size)
+{
+  __m256 re = _mm256_setzero_ps();
+  __m256 im = _mm256_setzero_ps();
+  __m128 re4, im4;
+  float lanes_re[4], lanes_im[4];
+  rta_real_t tail_re, tail_im;
+  unsigned int i;
+
+  for(i=0; i+8<=size; i+=8)
+  {
+    const __m256 x = _mm256_loadu_ps(spectrum + i);
+
+    re = _mm256_fmadd_ps(x, _mm256_load_ps(direct + i), re);
+    im = _mm256_fmadd_ps(x, _mm256_load_ps(crossed + i), im);
+  }
+  re4 = _mm_add_ps(_mm256_castps256_ps128(re), _mm256_extractf128_ps(re, 1));
+  im4 = _mm_add_ps(_mm256_castps256_ps128(im), _mm256_extractf128_ps(im, 1));
+  _mm_storeu_ps(lanes_re, re4);
+  _mm_storeu_ps(lanes_im, im4);
+
+  product_generic(&tail_re, &tail_im, spectrum + i, direct + i, crossed + i,
+                  size - i);
+  *real = (lanes_re[0] + lanes_re[1]) + (lanes_re[2] + lanes_re[3]) + tail_re;
+  *imag = (lanes_im[0] + lanes_im[1]) + (lanes_im[2] + lanes_im[3]) + tail_im;
+}
+
+#define HAVE_PRODUCT_KERNELS 1
+static const product_function_t product_kernels[rta_cpu_num_levels] =
+{
+  product_generic, product_sse2, product_avx2, product_avx2, product_generic
+};
+
+#endif /* float on x86 */
+
+/* best product kernel for the current dispatch level */
+static product_function_t
+get_product(void)
+{
+#if defined(HAVE_PRODUCT_KERNELS)
+  return product_kernels[rta_cpu_get_level()];
+#else
+  return product_generic;
+#endif
+}
+
+/* ------- decimation kernels, dispatched at run time ------- */
+
+/* add the odd taps of the half-band filter to the outputs of indexes
+   'begin' to 'end', all of whose input samples are in 'odd' (the odd
+   samples of the input) */
+typedef void (*taps_function_t) (rta_real_t * output, const rta_real_t * odd,
+                                 const rta_real_t * taps,
+                                 const unsigned int begin,
+                                 const unsigned int end);
+
+static void
+taps_generic(rta_real_t * output, const rta_real_t * odd,
+             const rta_real_t * taps, const unsigned int begin,
+             const unsigned int end)
+{
+  unsigned int m, k;
+
+  for(m=begin; m<end; m++)
+  {
+    rta_real_t sum = output[m];
+
+    for(k=0; k<DECIMATOR_TAPS; k++)
+    {
+      sum += taps[k] * (odd[m - k - 1] + odd[m + k]);
+    }
+    output[m] = sum;
+  }
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE) && defined(RTA_CPU_X86)
+
+RTA_CPU_TARGET("sse2") static void
+taps_sse2(rta_real_t * output, const rta_real_t * odd,
+          const rta_real_t * taps, const unsigned int begin,
+          const unsigned int end)
+{
+  unsigned int m, k;
+
+  for(m=begin; m+4<=end; m+=4)
+  {
+    __m128 sum = _mm_loadu_ps(output + m);
+
+    for(k=0; k<DECIMATOR_TAPS; k++)
+    {
+      sum = _mm_add_ps(sum, _mm_mul_ps(
+                         _mm_set1_ps(taps[k]),
+                         _mm_add_ps(_mm_loadu_ps(odd + m - k - 1),
+                                    _mm_loadu_ps(odd + m + k))));
+    }
+    _mm_storeu_ps(output + m, sum);
+  }
+
+  taps_generic(output, odd, taps, m, end);
+}
+
+RTA_CPU_TARGET("avx2,fma") static void
+taps_avx2(rta_real_t * output, const rta_real_t * odd,
+          const rta_real_t * taps, const unsigned int begin,
+          const unsigned int end)
+{
+  unsigned int m, k;
+
+  for(m=begin; m+8<=end; m+=8)
+  {
+    __m256 sum = _mm256_loadu_ps(output + m);
+
+    for(k=0; k<DECIMATOR_TAPS; k++)
+    {
+      sum = _mm256_fmadd_ps(_mm256_set1_ps(taps[k]),
+                            _mm256_add_ps(_mm256_loadu_ps(odd + m - k - 1),
+                                          _mm256_loadu_ps(odd + m + k)),
+                            sum);
+    }
+    _mm256_storeu_ps(output + m, sum);
+  }
+
+  taps_generic(output, odd, taps, m, end);
+}
+
+#define HAVE_TAPS_KERNELS 1
+static const taps_function_t taps_kernels[rta_cpu_num_levels] =
+{
+  taps_generic, taps_sse2, taps_avx2, taps_avx2, taps_generic
+};
+
+#endif /* float on x86 */
+
+/* best decimation kernel for the current dispatch level */
+static taps_function_t
+get_taps(void)
+{
+#if defined(HAVE_TAPS_KERNELS)
+  return taps_kernels[rta_cpu_get_level()];
+#else
+  return taps_generic;
+#endif
+}
+
+/* ------- end of kernels ------- */
+
+/* add the taps to output 'm', whose input samples may be missing */
+static void
+taps_border(rta_real_t * output, const rta_real_t * odd,
+            const rta_real_t * taps, const unsigned int m,
+            const unsigned int size)
+{
+  rta_real_t sum = output[m];
+  unsigned int k;
+
+  for(k=0; k<DECIMATOR_TAPS; k++)
+  {
+    if(m >= k + 1)
+    {
+      sum += taps[k] * odd[m - k - 1];
+    }
+    if(m + k < size)
+    {
+      sum += taps[k] * odd[m + k];
+    }
+  }
+  output[m] = sum;
+}
+
+/* low-pass by the half-band filter and keep every other sample,
+   without delay; the input is 0 outside of its 'input_size' samples.
+   Polyphase: the odd input samples are gathered in 'odd', so that the
+   taps apply to contiguous samples. */
+static void
+decimate(rta_real_t * output, rta_real_t * odd, const rta_real_t * input,
+         const unsigned int input_size, const rta_real_t * taps)
+{
+  const unsigned int output_size = input_size / 2;
+  unsigned int m;
+
+  for(m=0; m<output_size; m++)
+  {
+    output[m] = 0.5 * input[2 * m];
+    odd[m] = input[2 * m + 1];
+  }
+
+  if(output_size >= 2 * DECIMATOR_TAPS)
+  {
+    for(m=0; m<DECIMATOR_TAPS; m++)
+    {
+      taps_border(output, odd, taps, m, output_size);
+    }
+
+    get_taps()(output, odd, taps, DECIMATOR_TAPS,
+               output_size - DECIMATOR_TAPS + 1);
+
+    for(m=output_size-DECIMATOR_TAPS+1; m<output_size; m++)
+    {
+      taps_border(output, odd, taps, m, output_size);
+    }
+  }
+  else
+  {
+    for(m=0; m<output_size; m++)
+    {
+      taps_border(output, odd, taps, m, output_size);
+    }
+  }
+}
+
+/* Blackman-windowed half-band sinc, odd taps only, unit gain at 0 Hz */
+static void
+decimator_taps(rta_real_t * taps)
+{
+  const double length = 2 * DECIMATOR_TAPS;
+  double sum = 0.0;
+  double h[DECIMATOR_TAPS];
+  unsigned int k;
+
+  for(k=0; k<DECIMATOR_TAPS; k++)
+  {
+    const double t = 2 * k + 1;
+
+    h[k] = sin(M_PI * t * 0.5) / (M_PI * t)
+      * (0.42 + 0.5 * cos(M_PI * t / length)
+         + 0.08 * cos(2. * M_PI * t / length));
+    sum += 2. * h[k];
+  }
+
+  for(k=0; k<DECIMATOR_TAPS; k++)
+  {
+    taps[k] = h[k] * 0.5 / sum;
+  }
+}
+
+/* length in samples of the temporal kernel of 'freq' Hz, at 'rate' */
+static unsigned int
+kernel_length(const rta_real_t quality, const rta_real_t freq,
+              const rta_real_t rate)
+{
+  return (unsigned int) ceil(quality * rate / freq);
+}
+
+/* Spectral kernel of frequency 'freq', relative to the sample rate,
+   in the complex 'buffer' of fft_size values: a Hann-windowed
+   complex exponential, centred in the frame, normalised for the
+   amplitude of a real sinusoid. 'window' has fft_size values. */
+static void
+spectral_kernel(rta_real_t * buffer, rta_real_t * window,
+                rta_fft_setup_t * setup, const unsigned int fft_size,
+                const unsigned int length, const double freq)
+{
+  const unsigned int begin = (fft_size - length) / 2;
+  const double centre = begin + length * 0.5;
+  double sum = 0.0;
+  unsigned int n;
+
+  rta_window_hann_weights(window, length);
+
+  for(n=0; n<length; n++)
+  {
+    sum += window[n];
+  }
+
+  memset(buffer, 0, 2 * fft_size * sizeof(rta_real_t));
+
+  for(n=0; n<length; n++)
+  {
+    /* twice the mean, divided by the fft_size of the spectral product */
+    const double weight = 2. * window[n] / (sum * fft_size);
+    const double phase = 2. * M_PI * freq * (begin + n - centre);
+
+    buffer[2 * (begin + n)] = weight * cos(phase);
+    buffer[2 * (begin + n) + 1] = weight * sin(phase);
+  }
+
+  rta_fft_execute(buffer, buffer, fft_size, setup);
+}
+
+/* contiguous span of the significant values of the positive
+   frequencies of a spectral kernel */
+static void
+kernel_span(unsigned int * start, unsigned int * size,
+            const rta_real_t * buffer, const unsigned int fft_size,
+            const rta_real_t threshold)
+{
+  const unsigned int half = fft_size / 2;
+  double max = 0.0;
+  double limit;
+  unsigned int j, first = half, last = 0;
+
+  for(j=0; j<half; j++)
+  {
+    const double power = buffer[2 * j] * buffer[2 * j]
+      + buffer[2 * j + 1] * buffer[2 * j + 1];
+
+    if(power > max)
+    {
+      max = power;
+    }
+  }
+
+  limit = max * threshold * threshold;
+
+  for(j=0; j<half; j++)
+  {
+    const double power = buffer[2 * j] * buffer[2 * j]
+      + buffer[2 * j + 1] * buffer[2 * j + 1];
+
+    if(power >= limit && power > 0.0)
+    {
+      if(j < first)
+      {
+        first = j;
+      }
+      last = j;
+    }
+  }
+
+  *start = first < half ? first : 0;
+  *size = first < half ? last - first + 1 : 0;
+}
+
+void
+rta_cqt_params_default(rta_cqt_params_t * params,
+                       const rta_real_t sample_rate)
+{
+  params->sample_rate = sample_rate;
+  params->min_freq = 55.;
+  params->max_freq = 55. * 128.;
+  if(params->max_freq > 0.4 * sample_rate)
+  {
+    params->max_freq = 0.4 * sample_rate;
+  }
+  params->bins_per_octave = 24;
+  params->q_scale = 1.;
+  params->threshold = 0.0054;
+  params->multirate = 1;
+}
+
+int
+rta_cqt_new(rta_cqt_t ** cqt, const rta_cqt_params_t * params)
+{
+  const unsigned int bins_per_octave = params->bins_per_octave;
+  rta_cqt_t * self;
+  rta_arena_t arena;
+  rta_fft_setup_t * kernel_setup = NULL;
+  rta_real_t * buffer = NULL;
+  rta_real_t * window = NULL;
+  rta_real_t kernel_scale = 1.0;
+  double quality;
+  unsigned int num_bins, num_kernels, num_octaves, fft_size, frame_size;
+  unsigned int first_kernel, num_reals, i, j;
+  int ret = 1;
+
+  *cqt = NULL;
+
+  if(params->sample_rate <= 0.0 || bins_per_octave < 1
+     || params->min_freq <= 0.0 || params->max_freq < params->min_freq
+     || params->max_freq >= 0.5 * params->sample_rate
+     || (params->multirate && params->max_freq > 0.4 * params->sample_rate)
+     || params->q_scale <= 0.0
+     || params->threshold < 0.0 || params->threshold >= 1.0)
+  {
+    return 0;
+  }
+
+  quality = params->q_scale / (pow(2., 1. / bins_per_octave) - 1.);
+  num_bins = (unsigned int)
+    floor(bins_per_octave * log2(params->max_freq / params->min_freq) + 1e-6) + 1;
+
+  if(params->multirate)
+  {
+    num_kernels = num_bins < bins_per_octave ? num_bins : bins_per_octave;
+    num_octaves = (num_bins + bins_per_octave - 1) / bins_per_octave;
+  }
+  else
+  {
+    num_kernels = num_bins;
+    num_octaves = 1;
+  }
+  first_kernel = num_bins - num_kernels;
+
+  /* the lowest kernel is the longest, in its octave */
+  frame_size = kernel_length(
+    quality, params->min_freq * pow(2., (double) first_kernel / bins_per_octave),
+    params->sample_rate);
+  fft_size = rta_inextpow2(frame_size);
+  if(fft_size < 16)
+  {
+    fft_size = 16;
+  }
+  frame_size <<= num_octaves - 1;
+
+  /* first pass: span of the kernels */
+  buffer = (rta_real_t *) rta_malloc(2 * fft_size * sizeof(rta_real_t));
+  window = (rta_real_t *) rta_malloc(fft_size * sizeof(rta_real_t));
+  ret = buffer != NULL && window != NULL
+    && rta_fft_setup_new(&kernel_setup, rta_fft_complex_1d, &kernel_scale,
+                         (rta_complex_t *) buffer, fft_size,
+                         (rta_complex_t *) buffer, fft_size);
+
+  num_reals = 0;
+
+  for(i=0; ret && i<num_kernels; i++)
+  {
+    const double freq = params->min_freq
+      * pow(2., (double) (first_kernel + i) / bins_per_octave);
+    unsigned int start, size;
+
+    spectral_kernel(buffer, window, kernel_setup, fft_size,
+                    kernel_length(quality, freq, params->sample_rate),
+                    freq / params->sample_rate);
+    kernel_span(&start, &size, buffer, fft_size, params->threshold);
+    num_reals += (2 * size + KERNEL_ALIGNMENT - 1)
+      / KERNEL_ALIGNMENT * KERNEL_ALIGNMENT;
+  }
+
+  ret = ret && rta_arena_new(
+    &arena, rta_align_size(sizeof(rta_cqt_t))
+    + rta_align_size(num_bins * sizeof(rta_real_t))
+    + 3 * rta_align_size(num_kernels * sizeof(unsigned int))
+    + 2 * rta_align_size(num_reals * sizeof(rta_real_t))
+    + 3 * rta_align_size(frame_size / 2 * sizeof(rta_real_t))
+    + rta_align_size(fft_size * sizeof(rta_real_t))
+    + rta_align_size((fft_size + 2) * sizeof(rta_real_t))) != 0;
+
+  if(! ret)
+  {
+    if(kernel_setup != NULL)
+    {
+      rta_fft_setup_delete(kernel_setup);
+    }
+    rta_free(buffer);
+    rta_free(window);
+    return 0;
+  }
+
+  /* the transform comes first: its address is the arena base */
+  self = (rta_cqt_t *) rta_arena_alloc(&arena, sizeof(rta_cqt_t));
+  self->params = *params;
+  self->num_bins = num_bins;
+  self->num_kernels = num_kernels;
+  self->num_octaves = num_octaves;
+  self->fft_size = fft_size;
+  self->frame_size = frame_size;
+  self->fft_scale = 1.0;
+
+  self->frequencies = (rta_real_t *) rta_arena_alloc(&arena, num_bins * sizeof(rta_real_t));
+  self->kernel_start = (unsigned int *) rta_arena_alloc(&arena, num_kernels * sizeof(unsigned int));
+  self->kernel_size = (unsigned int *) rta_arena_alloc(&arena, num_kernels * sizeof(unsigned int));
+  self->kernel_offset = (unsigned int *) rta_arena_alloc(&arena, num_kernels * sizeof(unsigned int));
+  self->direct = (rta_real_t *) rta_arena_alloc(&arena, num_reals * sizeof(rta_real_t));
+  self->crossed = (rta_real_t *) rta_arena_alloc(&arena, num_reals * sizeof(rta_real_t));
+  self->decimated[0] = (rta_real_t *) rta_arena_alloc(&arena, frame_size / 2 * sizeof(rta_real_t));
+  self->decimated[1] = (rta_real_t *) rta_arena_alloc(&arena, frame_size / 2 * sizeof(rta_real_t));
+  self->odd = (rta_real_t *) rta_arena_alloc(&arena, frame_size / 2 * sizeof(rta_real_t));
+  self->frame = (rta_real_t *) rta_arena_alloc(&arena, fft_size * sizeof(rta_real_t));
+  self->spectrum = (rta_real_t *) rta_arena_alloc(&arena, (fft_size + 2) * sizeof(rta_real_t));
+
+  for(i=0; i<num_bins; i++)
+  {
+    self->frequencies[i] = params->min_freq
+      * pow(2., (double) i / bins_per_octave);
+  }
+
+  decimator_taps(self->decimator);
+
+  /* second pass: keep the significant coefficients */
+  num_reals = 0;
+  self->num_coefficients = 0;
+
+  for(i=0; i<num_kernels; i++)
+  {
+    const double freq = self->frequencies[first_kernel + i];
+    unsigned int start, size;
+
+    spectral_kernel(buffer, window, kernel_setup, fft_size,
+                    kernel_length(quality, freq, params->sample_rate),
+                    freq / params->sample_rate);
+    kernel_span(&start, &size, buffer, fft_size, params->threshold);
+
+    self->kernel_start[i] = start;
+    self->kernel_size[i] = size;
+    self->kernel_offset[i] = num_reals;
+
+    for(j=0; j<size; j++)
+    {
+      const rta_real_t re = buffer[2 * (start + j)];
+      const rta_real_t im = buffer[2 * (start + j) + 1];
+
+      self->direct[num_reals + 2 * j] = re;
+      self->direct[num_reals + 2 * j + 1] = im;
+      self->crossed[num_reals + 2 * j] = -im;
+      self->crossed[num_reals + 2 * j + 1] = re;
+    }
+
+    num_reals += (2 * size + KERNEL_ALIGNMENT - 1)
+      / KERNEL_ALIGNMENT * KERNEL_ALIGNMENT;
+    self->num_coefficients += size;
+  }
+
+  rta_fft_setup_delete(kernel_setup);
+  rta_free(buffer);
+  rta_free(window);
+
+  if(! rta_fft_real_setup_new(
+       &self->fft_setup, rta_fft_real_to_complex_1d, &self->fft_scale,
+       self->frame, fft_size, self->spectrum, fft_size, &self->nyquist))
+  {
+    rta_arena_delete(&arena);
+    return 0;
+  }
+
+  *cqt = self;
+
+  return 1;
+}
+
+void
+rta_cqt_delete(rta_cqt_t * cqt)
+{
+  if(cqt != NULL)
+  {
+    rta_fft_setup_delete(cqt->fft_setup);
+
+    /* buffers are in the same arena */
+    rta_aligned_free(cqt);
+  }
+
+  return;
+}
+
+unsigned int
+rta_cqt_get_num_bins(const rta_cqt_t * cqt)
+{
+  return cqt->num_bins;
+}
+
+rta_real_t
+rta_cqt_get_frequency(const rta_cqt_t * cqt, const unsigned int bin)
+{
+  return cqt->frequencies[bin];
+}
+
+unsigned int
+rta_cqt_get_frame_size(const rta_cqt_t * cqt)
+{
+  return cqt->frame_size;
+}
+
+unsigned int
+rta_cqt_get_fft_size(const rta_cqt_t * cqt)
+{
+  return cqt->fft_size;
+}
+
+unsigned int
+rta_cqt_get_num_octaves(const rta_cqt_t * cqt)
+{
+  return cqt->num_octaves;
+}
+
+unsigned int
+rta_cqt_get_num_coefficients(const rta_cqt_t * cqt)
+{
+  return cqt->num_coefficients;
+}
+
+void
+rta_cqt_spectrum(const rta_cqt_t * cqt, rta_real_t * output,
+                 const rta_real_t * spectrum, const unsigned int octave)
+{
+  const product_function_t product = get_product();
+  /* bin of the first kernel in this octave */
+  const long first = (long) (cqt->num_bins - cqt->num_kernels)
+    - (long) octave * cqt->params.bins_per_octave;
+  unsigned int i;
+
+  for(i=0; i<cqt->num_kernels; i++)
+  {
+    rta_real_t re, im;
+
+    if(first + (long) i < 0)
+    {
+      continue;
+    }
+
+    product(&re, &im, spectrum + 2 * cqt->kernel_start[i],
+            cqt->direct + cqt->kernel_offset[i],
+            cqt->crossed + cqt->kernel_offset[i],
+            2 * cqt->kernel_size[i]);
+    output[first + i] = rta_sqrt(re * re + im * im);
+  }
+}
+
+void
+rta_cqt_execute(rta_cqt_t * cqt, rta_real_t * output,
+                const rta_real_t * input)
+{
+  const unsigned int fft_size = cqt->fft_size;
+  const rta_real_t * signal = input;
+  unsigned int size = cqt->frame_size;
+  unsigned int octave;
+
+  for(octave=0; octave<cqt->num_octaves; octave++)
+  {
+    long begin;
+    unsigned int first, last;
+
+    if(octave > 0)
+    {
+      rta_real_t * decimated = cqt->decimated[octave % 2];
+
+      decimate(decimated, cqt->odd, signal, size, cqt->decimator);
+      signal = decimated;
+      size /= 2;
+    }
+
+    /* fft_size samples around the middle one, zero-padded */
+    begin = (long) (size / 2) - (long) (fft_size / 2);
+    first = begin < 0 ? (unsigned int) -begin : 0;
+    last = begin + (long) fft_size > (long) size
+      ? (unsigned int) ((long) size - begin) : fft_size;
+
+    memset(cqt->frame, 0, first * sizeof(rta_real_t));
+    memcpy(cqt->frame + first, signal + begin + first,
+           (last - first) * sizeof(rta_real_t));
+    memset(cqt->frame + last, 0, (fft_size - last) * sizeof(rta_real_t));
+
+    rta_fft_real_execute(cqt->spectrum, cqt->frame, fft_size,
+                         cqt->fft_setup, &cqt->nyquist);
+    rta_cqt_spectrum(cqt, output, cqt->spectrum, octave);
+  }
+}
@@ -0,0 +1,154 @@
+/**
+ * @file   rta_cqt.h
+ * @ingroup rta_signal
+ *
+ * @brief  Constant-Q transform by sparse spectral kernels
+ *
+ * The kernels of Brown and Puckette: each bin is the inner product of
+ * the input frame with a windowed complex exponential, whose length
+ * is inversely proportional to its frequency. These temporal kernels
+ * are transformed once by rta_fft, and their negligible coefficients
+ * dropped, so that a frame is one FFT followed by a short complex
+ * product per bin, over the few spectral coefficients around its
+ * frequency.
+ *
+ * With the multi-rate option, only the kernels of the highest octave
+ * are kept, in a small FFT. The lower octaves reuse them on the input
+ * decimated by 2, 4, 8, etc., with a half-band filter.
+ *
+ * All the memory is allocated by rta_cqt_new: the processing does
+ * not allocate and may run in a real-time thread.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_CQT_H_
+#define _RTA_CQT_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** parameters of a constant-Q transform */
+typedef struct rta_cqt_params
+{
+  rta_real_t sample_rate;        /**< of the input, in Hz */
+  rta_real_t min_freq;           /**< centre of the first bin, in Hz */
+  rta_real_t max_freq;           /**< upper limit of the bin centres, in Hz */
+  unsigned int bins_per_octave;  /**< frequency resolution */
+  rta_real_t q_scale;            /**< factor of the quality, 1 for
+                                    adjacent bins, lower for shorter
+                                    and wider kernels */
+  rta_real_t threshold;          /**< spectral coefficients under this
+                                    fraction of the kernel maximum are
+                                    dropped */
+  int multirate;                 /**< 1 to decimate the lower octaves,
+                                    then 'max_freq' must be at most 0.4
+                                    * 'sample_rate' */
+} rta_cqt_params_t;
+
+typedef struct rta_cqt rta_cqt_t;
+
+/**
+ * Default parameters for 'sample_rate': 7 octaves from 55 Hz (limited
+ * to 0.4 * 'sample_rate'), 24 bins per octave, q_scale of 1, threshold
+ * of 0.0054 and multi-rate.
+ */
+void rta_cqt_params_default(rta_cqt_params_t * params,
+                            const rta_real_t sample_rate);
+
+/**
+ * Allocate and initialise a constant-Q transform, compute its kernels
+ *
+ * @param cqt is set to the new transform, or NULL on failure
+ * @param params are copied
+ *
+ * @return 1 on success, 0 on failure (invalid parameters or memory)
+ */
+int rta_cqt_new(rta_cqt_t ** cqt, const rta_cqt_params_t * params);
+
+/** free 'cqt' */
+void rta_cqt_delete(rta_cqt_t * cqt);
+
+/** number of bins, from 'min_freq' to 'max_freq' */
+unsigned int rta_cqt_get_num_bins(const rta_cqt_t * cqt);
+
+/** centre frequency of 'bin', in Hz */
+rta_real_t rta_cqt_get_frequency(const rta_cqt_t * cqt,
+                                 const unsigned int bin);
+
+/** input samples of a frame: the length of the longest kernel */
+unsigned int rta_cqt_get_frame_size(const rta_cqt_t * cqt);
+
+/** FFT size of the spectra taken by rta_cqt_spectrum */
+unsigned int rta_cqt_get_fft_size(const rta_cqt_t * cqt);
+
+/** number of octaves computed by rta_cqt_spectrum: 1 without multi-rate */
+unsigned int rta_cqt_get_num_octaves(const rta_cqt_t * cqt);
+
+/** number of complex coefficients kept in all the kernels */
+unsigned int rta_cqt_get_num_coefficients(const rta_cqt_t * cqt);
+
+/**
+ * Constant-Q amplitudes of a frame. A sinusoid at the centre
+ * frequency of a bin gives its amplitude in this bin.
+ *
+ * @param cqt transform
+ * @param output size is rta_cqt_get_num_bins
+ * @param input size is rta_cqt_get_frame_size, the bins are centred on
+ * its middle sample
+ */
+void rta_cqt_execute(rta_cqt_t * cqt, rta_real_t * output,
+                     const rta_real_t * input);
+
+/**
+ * Apply the kernels to a spectrum, for one octave
+ *
+ * @param cqt transform
+ * @param output size is rta_cqt_get_num_bins, only the bins of
+ * 'octave' are written
+ * @param spectrum is the output of rta_fft_real_execute for a real
+ * frame of rta_cqt_get_fft_size samples (its Nyquist value is not used)
+ * @param octave is 0 without multi-rate. With multi-rate, it is the
+ * number of decimations of the frame by 2, and octave 0 gives the
+ * highest bins.
+ */
+void rta_cqt_spectrum(const rta_cqt_t * cqt, rta_real_t * output,
+                      const rta_real_t * spectrum,
+                      const unsigned int octave);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_CQT_H_ */
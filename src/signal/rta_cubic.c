@@ -38,28 +38,32 @@
 
 #include "rta_cubic.h"
 
-/* global coefficient atable for cubic interpolation */
-static int rta_cubic_table_initialized = 0;
-static rta_cubic_coefs_t _rta_cubic_table[RTA_CUBIC_TABLE_SIZE];
-rta_cubic_coefs_t *rta_cubic_table = _rta_cubic_table;
+/* global coefficient table for cubic interpolation, computed by the
+   compiler: it is read-only data, shared between processes, and needs
+   no initialisation */
+#if RTA_CUBIC_TABLE_SIZE != 256
+#error "the table expansion below assumes RTA_CUBIC_TABLE_SIZE == 256"
+#endif
 
+#define F(i) ((i) * (1.0 / RTA_CUBIC_TABLE_SIZE))
+
+#define COEFS(i) \
+  { (float) (-0.1666667 * F(i) * (1 - F(i)) * (2 - F(i))), \
+    (float) (0.5 * (1 + F(i)) * (1 - F(i)) * (2 - F(i))), \
+    (float) (0.5 * (1 + F(i)) * F(i) * (2 - F(i))), \
+    (float) (-0.1666667 * (1 + F(i)) * F(i) * (1 - F(i))) }
+
+#define COEFS_4(i) COEFS(i), COEFS(i + 1), COEFS(i + 2), COEFS(i + 3)
+#define COEFS_16(i) COEFS_4(i), COEFS_4(i + 4), COEFS_4(i + 8), COEFS_4(i + 12)
+#define COEFS_64(i) COEFS_16(i), COEFS_16(i + 16), COEFS_16(i + 32), COEFS_16(i + 48)
+
+const rta_cubic_coefs_t rta_cubic_table[RTA_CUBIC_TABLE_SIZE] =
+{
+  COEFS_64(0), COEFS_64(64), COEFS_64(128), COEFS_64(192)
+};
+
+/* nothing to do any more, kept for existing callers */
 void rta_cubic_table_init()
 {
-  if (rta_cubic_table_initialized == 0)
-  {
-    int i;
-    float f;
-    rta_cubic_coefs_t *p = rta_cubic_table;
-      
-    for (i = 0; i < RTA_CUBIC_TABLE_SIZE; i++)
-    {
-      f = i * (1.0 / RTA_CUBIC_TABLE_SIZE);
-      p->pm1 = -0.1666667 * f * (1 - f) * (2 - f);
-      p->p0 = 0.5 * (1 + f) * (1 - f) * (2 - f);
-      p->p1 = 0.5 * (1 + f) * f * (2 - f);
-      p->p2 = -0.1666667 * (1 + f) * f * (1 - f);
-      p++;
-    }
-    rta_cubic_table_initialized = 1;
-  }
+  return;
 }
@@ -10,9 +10,8 @@
  * read-accessible data, because each output sample is a weighted sum
  * of the 4 input samples at i-1...i+2.
  *
- * N.B.2: Before any cubic interpolation function can be used, the
- * table of cubic interpolation coefficients must have been
- * initialized by calling rta_cubic_table_init().
+ * N.B.2: The table of cubic interpolation coefficients is computed at
+ * compile time, rta_cubic_table_init() is not needed any more.
  *
  * @copyright
  * Copyright (C) 1994, 1995, 1998, 1999, 2007 by IRCAM-Centre Georges Pompidou, Paris, France.
@@ -90,8 +89,10 @@ typedef struct
   float p2;
 } rta_cubic_coefs_t;
 
-// static table, must be initialized by rta_cubic_table_init() before any calculation
-extern rta_cubic_coefs_t *rta_cubic_table;
+// static read-only table, computed at compile time
+extern const rta_cubic_coefs_t rta_cubic_table[RTA_CUBIC_TABLE_SIZE];
+
+// obsolete: does nothing
 void rta_cubic_table_init(void);
 
 #define rta_cubic_get_coefs(f) \
@@ -135,26 +136,26 @@ void rta_cubic_table_init(void);
 
 #define rta_cubic_idefix_interpolate(p, i, y) \
   do { \
-    rta_cubic_coefs_t *ft = rta_cubic_table + rta_cubic_get_table_index_from_idefix(i); \
+    const rta_cubic_coefs_t *ft = rta_cubic_table + rta_cubic_get_table_index_from_idefix(i); \
       *(y) = rta_cubic_calc((p) + (i).index, ft); \
   } while(0)
 
 #define rta_cubic_idefix_interpolate_stride(p, i, s, y) \
   do { \
-    rta_cubic_coefs_t *ft = rta_cubic_table + rta_cubic_get_table_index_from_idefix(i); \
+    const rta_cubic_coefs_t *ft = rta_cubic_table + rta_cubic_get_table_index_from_idefix(i); \
       *(y) = rta_cubic_calc_stride((p) + (s) * (i).index, ft, (s)); \
   } while(0)
 
 #define rta_cubic_intphase_interpolate(p, i, y) \
   do { \
     float* q = (p) + ((i) >> RTA_CUBIC_INTPHASE_FRAC_BITS); \
-    rta_cubic_coefs_t *ft = rta_cubic_table + (((i) >> RTA_CUBIC_INTPHASE_LOST_BITS) & (RTA_CUBIC_TABLE_SIZE - 1)); \
+    const rta_cubic_coefs_t *ft = rta_cubic_table + (((i) >> RTA_CUBIC_INTPHASE_LOST_BITS) & (RTA_CUBIC_TABLE_SIZE - 1)); \
     *(y) = rta_cubic_calc(q, ft); \
   } while(0)
 
 #define rta_cubic_interpolate(p, i, f, y) \
   do { \
-    rta_cubic_coefs_t *ft = rta_cubic_table + rta_cubic_get_table_index_from_frac(f); \
+    const rta_cubic_coefs_t *ft = rta_cubic_table + rta_cubic_get_table_index_from_frac(f); \
     *(y) = rta_cubic_calc((p) + (i), ft); \
   } while(0)
 
@@ -0,0 +1,433 @@
+/**
+ * @file   rta_envelope.c
+ * @ingroup rta_signal
+ *
+ * @brief  Multi-channel envelope followers
+ *
+ * @see rta_envelope.h
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_envelope.h"
+#include "rta_alloc.h"
+#include "rta_cpu.h" /* rta_cpu_get_level */
+#include "rta_math.h"
+
+#include <string.h> /* memset */
+
+struct rta_envelope
+{
+  rta_envelope_params_t params;
+  rta_real_t attack_coef;      /**< smoothing of rising envelopes */
+  rta_real_t release_coef;     /**< smoothing of falling envelopes */
+  rta_real_t floor;            /**< of the detector values, for dB */
+  rta_real_t db_scale;         /**< dB per octave of the detector values */
+  unsigned int phase;          /**< input frames since the last output */
+  rta_real_t * states;         /**< envelope of each channel, as
+                                  amplitude or power */
+};
+
+/* log2(x) = e + log2(m), x = m * 2^e with m in [1, 2), and
+   log2(m) = 2 / ln(2) * atanh(t) with t = (m - 1) / (m + 1) in
+   [0, 1/3], by its series up to t^7 (error below 2e-5) */
+#define LOG2_C1 ((rta_real_t) 2.8853900817779268)
+#define LOG2_C3 ((rta_real_t) (2.8853900817779268 / 3.))
+#define LOG2_C5 ((rta_real_t) (2.8853900817779268 / 5.))
+#define LOG2_C7 ((rta_real_t) (2.8853900817779268 / 7.))
+
+/* ------- envelope kernels, dispatched at run time ------- */
+
+/* follow the channels 'begin' to 'end' of 'input', write their
+   outputs every decimation frames, from the current phase */
+typedef void (*follow_function_t) (const rta_envelope_t * self,
+                                   rta_real_t * states,
+                                   rta_real_t * output,
+                                   const rta_real_t * input,
+                                   const unsigned int num_frames,
+                                   const unsigned int begin,
+                                   const unsigned int end);
+
+static rta_real_t
+fast_log2(const rta_real_t x)
+{
+  int exponent;
+  const rta_real_t m = (rta_real_t) frexp(x, &exponent) * 2;
+  const rta_real_t t = (m - 1) / (m + 1);
+  const rta_real_t t2 = t * t;
+
+  return (rta_real_t) (exponent - 1)
+    + t * (LOG2_C1 + t2 * (LOG2_C3 + t2 * (LOG2_C5 + t2 * LOG2_C7)));
+}
+
+/* output of an envelope state */
+static rta_real_t
+finish_generic(const rta_envelope_t * self, const rta_real_t state)
+{
+  if(self->params.decibels)
+  {
+    return self->db_scale
+      * fast_log2(state > self->floor ? state : self->floor);
+  }
+  else if(self->params.mode == rta_envelope_rms)
+  {
+    return rta_sqrt(state);
+  }
+  else
+  {
+    return state;
+  }
+}
+
+static void
+follow_generic(const rta_envelope_t * self, rta_real_t * states,
+               rta_real_t * output, const rta_real_t * input,
+               const unsigned int num_frames, const unsigned int begin,
+               const unsigned int end)
+{
+  const unsigned int num_channels = self->params.num_channels;
+  const unsigned int decimation = self->params.decimation;
+  const int rms = self->params.mode == rta_envelope_rms;
+  unsigned int c, f;
+
+  for(c=begin; c<end; c++)
+  {
+    rta_real_t state = states[c];
+    rta_real_t * out = output + c;
+    unsigned int phase = self->phase;
+
+    for(f=0; f<num_frames; f++)
+    {
+      const rta_real_t x = input[f * num_channels + c];
+      const rta_real_t value = rms ? x * x : rta_abs(x);
+      const rta_real_t coef =
+        value > state ? self->attack_coef : self->release_coef;
+
+      state = value + coef * (state - value);
+
+      if(++phase == decimation)
+      {
+        phase = 0;
+        *out = finish_generic(self, state);
+        out += num_channels;
+      }
+    }
+
+    states[c] = state;
+  }
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE) && defined(RTA_CPU_X86)
+#include <immintrin.h>
+
+RTA_CPU_TARGET("sse2") static __m128
+finish_sse2(const rta_envelope_t * self, const __m128 state)
+{
+  if(self->params.decibels)
+  {
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 x = _mm_max_ps(state, _mm_set1_ps(self->floor));
+    const __m128i bits = _mm_castps_si128(x);
+    const __m128 exponent = _mm_cvtepi32_ps(
+      _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    const __m128 m = _mm_castsi128_ps(
+      _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)),
+                   _mm_set1_epi32(0x3f800000)));
+    const __m128 t = _mm_div_ps(_mm_sub_ps(m, one), _mm_add_ps(m, one));
+    const __m128 t2 = _mm_mul_ps(t, t);
+    __m128 poly = _mm_add_ps(_mm_set1_ps(LOG2_C5),
+                             _mm_mul_ps(t2, _mm_set1_ps(LOG2_C7)));
+
+    poly = _mm_add_ps(_mm_set1_ps(LOG2_C3), _mm_mul_ps(t2, poly));
+    poly = _mm_add_ps(_mm_set1_ps(LOG2_C1), _mm_mul_ps(t2, poly));
+
+    return _mm_mul_ps(_mm_set1_ps(self->db_scale),
+                      _mm_add_ps(exponent, _mm_mul_ps(t, poly)));
+  }
+  else if(self->params.mode == rta_envelope_rms)
+  {
+    return _mm_sqrt_ps(state);
+  }
+  else
+  {
+    return state;
+  }
+}
+
+RTA_CPU_TARGET("sse2") static void
+follow_sse2(const rta_envelope_t * self, rta_real_t * states,
+            rta_real_t * output, const rta_real_t * input,
+            const unsigned int num_frames, const unsigned int begin,
+            const unsigned int end)
+{
+  const unsigned int num_channels = self->params.num_channels;
+  const unsigned int decimation = self->params.decimation;
+  const int rms = self->params.mode == rta_envelope_rms;
+  const __m128 attack = _mm_set1_ps(self->attack_coef);
+  const __m128 release = _mm_set1_ps(self->release_coef);
+  const __m128 sign = _mm_set1_ps(-0.f);
+  unsigned int c, f;
+
+  for(c=begin; c+4<=end; c+=4)
+  {
+    __m128 state = _mm_loadu_ps(states + c);
+    rta_real_t * out = output + c;
+    unsigned int phase = self->phase;
+
+    for(f=0; f<num_frames; f++)
+    {
+      const __m128 x = _mm_loadu_ps(input + f * num_channels + c);
+      const __m128 value = rms ? _mm_mul_ps(x, x) : _mm_andnot_ps(sign, x);
+      const __m128 rising = _mm_cmpgt_ps(value, state);
+      const __m128 coef = _mm_or_ps(_mm_and_ps(rising, attack),
+                                    _mm_andnot_ps(rising, release));
+
+      state = _mm_add_ps(value, _mm_mul_ps(coef, _mm_sub_ps(state, value)));
+
+      if(++phase == decimation)
+      {
+        phase = 0;
+        _mm_storeu_ps(out, finish_sse2(self, state));
+        out += num_channels;
+      }
+    }
+
+    _mm_storeu_ps(states + c, state);
+  }
+
+  follow_generic(self, states, output, input, num_frames, c, end);
+}
+
+RTA_CPU_TARGET("avx2") static __m256
+finish_avx2(const rta_envelope_t * self, const __m256 state)
+{
+  if(self->params.decibels)
+  {
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 x = _mm256_max_ps(state, _mm256_set1_ps(self->floor));
+    const __m256i bits = _mm256_castps_si256(x);
+    const __m256 exponent = _mm256_cvtepi32_ps(
+      _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+    const __m256 m = _mm256_castsi256_ps(
+      _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)),
+                      _mm256_set1_epi32(0x3f800000)));
+    const __m256 t = _mm256_div_ps(_mm256_sub_ps(m, one), _mm256_add_ps(m, one));
+    const __m256 t2 = _mm256_mul_ps(t, t);
+    __m256 poly = _mm256_add_ps(_mm256_set1_ps(LOG2_C5),
+                                _mm256_mul_ps(t2, _mm256_set1_ps(LOG2_C7)));
+
+    poly = _mm256_add_ps(_mm256_set1_ps(LOG2_C3), _mm256_mul_ps(t2, poly));
+    poly = _mm256_add_ps(_mm256_set1_ps(LOG2_C1), _mm256_mul_ps(t2, poly));
+
+    return _mm256_mul_ps(_mm256_set1_ps(self->db_scale),
+                         _mm256_add_ps(exponent, _mm256_mul_ps(t, poly)));
+  }
+  else if(self->params.mode == rta_envelope_rms)
+  {
+    return _mm256_sqrt_ps(state);
+  }
+  else
+  {
+    return state;
+  }
+}
+
+RTA_CPU_TARGET("avx2") static void
+follow_avx2(const rta_envelope_t * self, rta_real_t * states,
+            rta_real_t * output, const rta_real_t * input,
+            const unsigned int num_frames, const unsigned int begin,
+            const unsigned int end)
+{
+  const unsigned int num_channels = self->params.num_channels;
+  const unsigned int decimation = self->params.decimation;
+  const int rms = self->params.mode == rta_envelope_rms;
+  const __m256 attack = _mm256_set1_ps(self->attack_coef);
+  const __m256 release = _mm256_set1_ps(self->release_coef);
+  const __m256 sign = _mm256_set1_ps(-0.f);
+  unsigned int c, f;
+
+  for(c=begin; c+8<=end; c+=8)
+  {
+    __m256 state = _mm256_loadu_ps(states + c);
+    rta_real_t * out = output + c;
+    unsigned int phase = self->phase;
+
+    for(f=0; f<num_frames; f++)
+    {
+      const __m256 x = _mm256_loadu_ps(input + f * num_channels + c);
+      const __m256 value = rms ? _mm256_mul_ps(x, x) : _mm256_andnot_ps(sign, x);
+      const __m256 coef = _mm256_blendv_ps(
+        release, attack, _mm256_cmp_ps(value, state, _CMP_GT_OQ));
+
+      state = _mm256_add_ps(value,
+                            _mm256_mul_ps(coef, _mm256_sub_ps(state, value)));
+
+      if(++phase == decimation)
+      {
+        phase = 0;
+        _mm256_storeu_ps(out, finish_avx2(self, state));
+        out += num_channels;
+      }
+    }
+
+    _mm256_storeu_ps(states + c, state);
+  }
+
+  /* remaining channels by 4, then 1 */
+  follow_sse2(self, states, output, input, num_frames, c, end);
+}
+
+#define HAVE_FOLLOW_KERNELS 1
+static const follow_function_t follow_kernels[rta_cpu_num_levels] =
+{
+  follow_generic, follow_sse2, follow_avx2, follow_avx2, follow_generic
+};
+
+#endif /* float on x86 */
+
+/* best envelope kernel for the current dispatch level */
+static follow_function_t
+get_follow(void)
+{
+#if defined(HAVE_FOLLOW_KERNELS)
+  return follow_kernels[rta_cpu_get_level()];
+#else
+  return follow_generic;
+#endif
+}
+
+/* ------- end of kernels ------- */
+
+void
+rta_envelope_params_default(rta_envelope_params_t * params,
+                            const rta_real_t sample_rate,
+                            const unsigned int num_channels)
+{
+  params->sample_rate = sample_rate;
+  params->num_channels = num_channels;
+  params->mode = rta_envelope_rms;
+  params->attack = 0.05;
+  params->release = 0.3;
+  params->decimation = 64;
+  params->decibels = 1;
+  params->floor_db = -120.;
+}
+
+int
+rta_envelope_new(rta_envelope_t ** envelope,
+                 const rta_envelope_params_t * params)
+{
+  const int rms = params->mode == rta_envelope_rms;
+  rta_envelope_t * self;
+  rta_arena_t arena;
+
+  *envelope = NULL;
+
+  if(params->sample_rate <= 0.0 || params->num_channels < 1
+     || (params->mode != rta_envelope_peak && params->mode != rta_envelope_rms)
+     || params->attack < 0.0 || params->release < 0.0
+     || params->decimation < 1 || params->floor_db < -300.)
+  {
+    return 0;
+  }
+
+  if(rta_arena_new(&arena, rta_align_size(sizeof(rta_envelope_t))
+                   + rta_align_size(params->num_channels
+                                    * sizeof(rta_real_t))) == 0)
+  {
+    return 0;
+  }
+
+  /* the bank comes first: its address is the arena base */
+  self = (rta_envelope_t *) rta_arena_alloc(&arena, sizeof(rta_envelope_t));
+  self->params = *params;
+  self->states = (rta_real_t *) rta_arena_alloc(
+    &arena, params->num_channels * sizeof(rta_real_t));
+
+  /* time constants: 1 - 1/e of a step */
+  self->attack_coef = params->attack > 0.0
+    ? exp(-1. / (params->attack * params->sample_rate)) : 0.0;
+  self->release_coef = params->release > 0.0
+    ? exp(-1. / (params->release * params->sample_rate)) : 0.0;
+
+  /* powers for RMS, amplitudes for peaks */
+  self->floor = pow(10., params->floor_db / (rms ? 10. : 20.));
+  self->db_scale = (rms ? 10. : 20.) * log10(2.);
+
+  rta_envelope_reset(self);
+  *envelope = self;
+
+  return 1;
+}
+
+void
+rta_envelope_delete(rta_envelope_t * envelope)
+{
+  if(envelope != NULL)
+  {
+    /* states are in the same arena */
+    rta_aligned_free(envelope);
+  }
+
+  return;
+}
+
+void
+rta_envelope_reset(rta_envelope_t * envelope)
+{
+  memset(envelope->states, 0,
+         envelope->params.num_channels * sizeof(rta_real_t));
+  envelope->phase = 0;
+
+  return;
+}
+
+unsigned int
+rta_envelope_get_output_frames(const rta_envelope_t * envelope,
+                               const unsigned int num_frames)
+{
+  return (envelope->phase + num_frames) / envelope->params.decimation;
+}
+
+unsigned int
+rta_envelope_process(rta_envelope_t * envelope, rta_real_t * output,
+                     const rta_real_t * input, const unsigned int num_frames)
+{
+  const unsigned int num_outputs =
+    rta_envelope_get_output_frames(envelope, num_frames);
+
+  get_follow()(envelope, envelope->states, output, input, num_frames,
+               0, envelope->params.num_channels);
+  envelope->phase =
+    (envelope->phase + num_frames) % envelope->params.decimation;
+
+  return num_outputs;
+}
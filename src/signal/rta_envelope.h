@@ -0,0 +1,138 @@
+/**
+ * @file   rta_envelope.h
+ * @ingroup rta_signal
+ *
+ * @brief  Multi-channel envelope followers
+ *
+ * A bank of peak or RMS envelope followers with separate attack and
+ * release times, one per channel of channel-interleaved blocks. The
+ * channels are processed side by side in SIMD registers. The
+ * envelopes are output once every 'decimation' input frames, as
+ * amplitudes or in decibels (by a fast logarithm, accurate to about
+ * 0.001 dB).
+ *
+ * All the memory is allocated by rta_envelope_new: the processing
+ * does not allocate and may run in a real-time thread.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_ENVELOPE_H_
+#define _RTA_ENVELOPE_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** envelope detector */
+typedef enum
+{
+  rta_envelope_peak = 0,      /**< absolute value of the input */
+  rta_envelope_rms = 1        /**< square root of the smoothed power */
+} rta_envelope_mode_t;
+
+/** parameters of an envelope bank */
+typedef struct rta_envelope_params
+{
+  rta_real_t sample_rate;     /**< of the input, in Hz */
+  unsigned int num_channels;  /**< interleaved in the input and output */
+  rta_envelope_mode_t mode;
+  rta_real_t attack;          /**< time constant of rising envelopes,
+                                 in seconds, 0 for none */
+  rta_real_t release;         /**< time constant of falling envelopes,
+                                 in seconds, 0 for none */
+  unsigned int decimation;    /**< input frames per output frame, >= 1 */
+  int decibels;               /**< 1 for outputs in dB, 0 for amplitudes */
+  rta_real_t floor_db;        /**< lower limit of the dB outputs */
+} rta_envelope_params_t;
+
+typedef struct rta_envelope rta_envelope_t;
+
+/**
+ * Default parameters for 'sample_rate' and 'num_channels': RMS, attack
+ * of 50 ms and release of 300 ms, output every 64 frames, in dB down
+ * to -120 dB.
+ */
+void rta_envelope_params_default(rta_envelope_params_t * params,
+                                 const rta_real_t sample_rate,
+                                 const unsigned int num_channels);
+
+/**
+ * Allocate and initialise an envelope bank
+ *
+ * @param envelope is set to the new bank, or NULL on failure
+ * @param params are copied
+ *
+ * @return 1 on success, 0 on failure (invalid parameters or memory)
+ */
+int rta_envelope_new(rta_envelope_t ** envelope,
+                     const rta_envelope_params_t * params);
+
+/** free 'envelope' */
+void rta_envelope_delete(rta_envelope_t * envelope);
+
+/** set the envelopes to 0 and restart the decimation */
+void rta_envelope_reset(rta_envelope_t * envelope);
+
+/**
+ * Number of output frames of the next rta_envelope_process call
+ *
+ * @param envelope bank
+ * @param num_frames is the number of input frames of the call
+ *
+ * @return number of output frames
+ */
+unsigned int rta_envelope_get_output_frames(const rta_envelope_t * envelope,
+                                            const unsigned int num_frames);
+
+/**
+ * Follow the envelopes of a block
+ *
+ * @param envelope bank
+ * @param output size is rta_envelope_get_output_frames('num_frames')
+ * * num_channels, channel-interleaved
+ * @param input size is 'num_frames' * num_channels, channel-interleaved
+ * @param num_frames can be anything, including 0
+ *
+ * @return the number of output frames written
+ */
+unsigned int rta_envelope_process(rta_envelope_t * envelope,
+                                  rta_real_t * output,
+                                  const rta_real_t * input,
+                                  const unsigned int num_frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_ENVELOPE_H_ */
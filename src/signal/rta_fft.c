@@ -41,10 +41,22 @@
 
 #include "rta_fft.h"
 #include "rta_complex.h"
-#include "rta_stdlib.h" /* memory management */
+#include "rta_alloc.h" /* memory management */
 
 #include "rta_int.h"  /* integer log2 function */
 #include "rta_math.h" /* M_PI, cos, sin */
+#include "rta_trace.h" /* RTA_TRACE_BEGIN, RTA_TRACE_END */
+#include "rta_tables.h" /* rta_tables_sin, rta_tables_bitrev */
+#include "rta_planner.h" /* rta_planner_choose */
+
+#include <string.h> /* memset */
+
+/* without measurement or wisdom: radix-4 passes from this size of the
+   complex transform, where the buffer no longer fits in the first
+   cache levels and halving the passes over it pays; below, radix-2 is
+   as fast or faster */
+#define RTA_FFT_RADIX4_MIN_SIZE 8192
+#define RTA_FFT_RADIX4_HEURISTIC(size) ((size) >= RTA_FFT_RADIX4_MIN_SIZE ? 1 : 0)
 
 /* -------  private (depends on implementation) ------ */
 /* from FTS implementation (Butterfly) */
@@ -60,9 +72,10 @@ struct rta_fft_setup
   rta_fft_t fft_type;
   rta_real_t * nyquist;    /**< last coefficient for real transforms */
   rta_real_t * scale;
-  rta_real_t * cos;
-  rta_real_t * sin;
-  unsigned int * bitrev;
+  const rta_real_t * cos;
+  const rta_real_t * sin;
+  const unsigned int * bitrev;
+  unsigned int radix;      /**< of the passes without stride: 2 or 4 */
 }; /* from fft_lookup_t */
 
 
@@ -460,6 +473,124 @@ ifft_inplace_oversampled_coefficients_stride(rta_complex_t * buf,
 }
 
 
+/* radix-2^2: the passes of fft_inplace, ifft_inplace or their
+   oversampled versions, fused two by two on bit reversed data. In
+   each group of 4, the twiddle factor of the second pass for the odd
+   outputs is the one for the even outputs times -i (direct) or i
+   (inverse): 3 complex multiplications instead of 4, and the buffer
+   is read and written half as many times. 'step' is the stride in the
+   coefficient tables: 1, or 2 for the oversampled ones. */
+static void
+fft_inplace_radix4(rta_complex_t * buf,
+                   const rta_real_t * coef_real,
+                   const rta_real_t * coef_imag,
+                   const unsigned int size,
+                   const unsigned int step,
+                   const int inverse)
+{
+  /* conjugate coefficients for the direct transform */
+  const rta_real_t sign = inverse ? 1. : -1.;
+  unsigned int m, j, up = 1;
+
+  /* odd number of passes: the first one alone, where W = 1 */
+  if(rta_ilog2(size) & 1)
+  {
+    for(m=0; m+1<size; m+=2)
+    {
+      rta_complex_t A = buf[m];
+      rta_complex_t B = buf[m + 1];
+
+      buf[m] = rta_add_complex(A, B);
+      buf[m + 1] = rta_sub_complex(A, B);
+    }
+
+    up = 2;
+  }
+
+  for(; up<size; up<<=2)
+  {
+    const unsigned int down = size / (2 * up) * step;
+    const unsigned int incr = 4 * up;
+
+    for(j=0; j<up; j++)
+    {
+      const rta_real_t w1_real = coef_real[j * down];
+      const rta_real_t w1_imag = sign * coef_imag[j * down];
+      const rta_real_t w2_real = coef_real[j * down / 2];
+      const rta_real_t w2_imag = sign * coef_imag[j * down / 2];
+
+      for(m=j; m<size; m+=incr)
+      {
+        rta_complex_t * x = buf + m;
+        rta_complex_t A = x[0];
+        rta_complex_t B = x[up];
+        rta_complex_t C = x[2 * up];
+        rta_complex_t D = x[3 * up];
+        rta_real_t re, im;
+
+        /* first pass: (A, B) and (C, D) */
+        re = rta_creal(B) * w1_real - rta_cimag(B) * w1_imag;
+        im = rta_creal(B) * w1_imag + rta_cimag(B) * w1_real;
+        B = rta_make_complex(rta_creal(A) - re, rta_cimag(A) - im);
+        A = rta_make_complex(rta_creal(A) + re, rta_cimag(A) + im);
+
+        re = rta_creal(D) * w1_real - rta_cimag(D) * w1_imag;
+        im = rta_creal(D) * w1_imag + rta_cimag(D) * w1_real;
+        D = rta_make_complex(rta_creal(C) - re, rta_cimag(C) - im);
+        C = rta_make_complex(rta_creal(C) + re, rta_cimag(C) + im);
+
+        /* second pass: (A, C) and (B, D), D turned by a quarter */
+        re = rta_creal(C) * w2_real - rta_cimag(C) * w2_imag;
+        im = rta_creal(C) * w2_imag + rta_cimag(C) * w2_real;
+        x[0] = rta_make_complex(rta_creal(A) + re, rta_cimag(A) + im);
+        x[2 * up] = rta_make_complex(rta_creal(A) - re, rta_cimag(A) - im);
+
+        re = rta_creal(D) * w2_real - rta_cimag(D) * w2_imag;
+        im = rta_creal(D) * w2_imag + rta_cimag(D) * w2_real;
+        x[up] = rta_make_complex(rta_creal(B) - sign * im, rta_cimag(B) + sign * re);
+        x[3 * up] = rta_make_complex(rta_creal(B) + sign * im, rta_cimag(B) - sign * re);
+      }
+    }
+  }
+
+  return;
+}
+
+/* passes of a transform without stride, by the radix of the setup */
+static void
+fft_passes(const rta_fft_setup_t * fft_setup, rta_complex_t * buf,
+           const unsigned int size, const unsigned int step, const int inverse)
+{
+  if(fft_setup->radix == 4)
+  {
+    fft_inplace_radix4(buf, fft_setup->cos, fft_setup->sin, size, step, inverse);
+  }
+  else if(step == 1)
+  {
+    if(inverse)
+    {
+      ifft_inplace(buf, fft_setup->cos, fft_setup->sin, size);
+    }
+    else
+    {
+      fft_inplace(buf, fft_setup->cos, fft_setup->sin, size);
+    }
+  }
+  else
+  {
+    if(inverse)
+    {
+      ifft_inplace_oversampled_coefficients(buf, fft_setup->cos, fft_setup->sin, size);
+    }
+    else
+    {
+      fft_inplace_oversampled_coefficients(buf, fft_setup->cos, fft_setup->sin, size);
+    }
+  }
+
+  return;
+}
+
 /* from rfft_shuffle_after_fft_inplc */
 /**************************************************************************
  *
@@ -1040,66 +1171,146 @@ scale_complex_zero_pad_in_place_stride(
 
 
 
-/* sine, cosine and bitreverse tables */
+/* the transform without stride of a setup, run by the planner on a
+   scratch buffer: candidate 0 is radix-2, 1 is radix-4 */
+typedef struct fft_plan
+{
+  rta_fft_setup_t * fft_setup;
+  rta_complex_t * buf;
+  unsigned int size;
+  unsigned int step;
+} fft_plan_t;
+
+static void
+fft_plan_run(void * context, const unsigned int candidate)
+{
+  fft_plan_t * plan = (fft_plan_t *) context;
+
+  if(plan->buf == NULL)
+  {
+    plan->buf = (rta_complex_t *) rta_aligned_malloc(
+      plan->size * sizeof(rta_complex_t), 0);
+    if(plan->buf == NULL)
+    {
+      return;
+    }
+    memset(plan->buf, 0, plan->size * sizeof(rta_complex_t));
+  }
+
+  plan->fft_setup->radix = candidate == 1 ? 4 : 2;
+  fft_passes(plan->fft_setup, plan->buf, plan->size, plan->step, 0);
+}
+
+/* radix of the passes without stride: real transforms run a complex
+   one of half the size on oversampled coefficients */
+static unsigned int
+fft_plan_radix(rta_fft_setup_t * fft_setup, const rta_fft_t fft_type)
+{
+  const int real = fft_type == rta_fft_real_to_complex_1d
+    || fft_type == rta_fft_complex_to_real_1d;
+  fft_plan_t plan;
+  unsigned int candidate;
+
+  plan.fft_setup = fft_setup;
+  plan.buf = NULL;
+  plan.size = real ? fft_setup->fft_size / 2 : fft_setup->fft_size;
+  plan.step = real ? 2 : 1;
+
+  candidate = rta_planner_choose(real ? "fft_real" : "fft_complex", plan.size,
+                                 2, RTA_FFT_RADIX4_HEURISTIC(plan.size),
+                                 fft_plan_run, &plan);
+  rta_aligned_free(plan.buf);
+
+  return candidate == 1 ? 4 : 2;
+}
+
+/* setup structure, sine, cosine and bitreverse tables, all in one */
+/* aligned arena, to be freed at once by rta_fft_setup_delete */
+/* the tables of the sizes of rta_tables.h are not computed, but shared */
 /* retrun 1 on success, 0 on fail */
 static int
-tables_new(rta_fft_setup_t * fft_setup)
+setup_tables_new(rta_fft_setup_t ** fft_setup, const unsigned int fft_size,
+                 const rta_fft_t fft_type)
 {
-  int ret = 0;
-  /* sine (and cosine) table */
+  /* actual FFT size is the next power of 2 of the given argument */
+  const unsigned int size = rta_inextpow2(fft_size);
 
   /* 1/4 more for cosine as phase shift and one more point at the end */
   /* => total size is 5/4*sine_size + 1 */
-  fft_setup->sin = (rta_real_t *) rta_malloc(
-    sizeof(rta_real_t) * (fft_setup->fft_size * 5/4 + 1));
+  const size_t sin_size = sizeof(rta_real_t) * (size * 5/4 + 1);
+  const size_t bitrev_size = sizeof(unsigned int) * size;
+  const rta_real_t * sin_table = rta_tables_sin(size);
+  const unsigned int * bitrev_table = rta_tables_bitrev(size);
+  rta_arena_t arena;
 
-  if(fft_setup->sin != NULL)
+  *fft_setup = NULL;
+
+  if(rta_arena_new(&arena, rta_align_size(sizeof(rta_fft_setup_t))
+                   + (sin_table == NULL ? rta_align_size(sin_size) : 0)
+                   + (bitrev_table == NULL ? rta_align_size(bitrev_size) : 0)) == 0)
   {
+    return 0;
+  }
+
+  /* the setup comes first: its address is the arena base */
+  *fft_setup = (rta_fft_setup_t *) rta_arena_alloc(
+    &arena, sizeof(rta_fft_setup_t));
+  (*fft_setup)->fft_size = size;
+  (*fft_setup)->log2_size = rta_ilog2(size);
+
+  if(sin_table == NULL)
+  {
+    rta_fft_setup_t * setup = *fft_setup;
+    rta_real_t * sin_computed = (rta_real_t *) rta_arena_alloc(&arena, sin_size);
+
     /* sine function from 0 to 2pi, inclusive (plus 1/4 for cosine) */
     /* step = 5/4 * 2 pi / (5/4 * size) = 2 * pi / size */
-    const rta_real_t step = 2. * M_PI / fft_setup->fft_size;
+    const rta_real_t step = 2. * M_PI / setup->fft_size;
     unsigned int i;
-    for(i=0; i<=fft_setup->fft_size * 5/4; i++)
+
+    for(i=0; i<=setup->fft_size * 5/4; i++)
     {
-      fft_setup->sin[i] = rta_sin(i*step);
+      sin_computed[i] = rta_sin(i*step);
     }
 
-    /* cosine function is just a phase-shifted sine */
-    /* Memory is shared */
-    fft_setup->cos = fft_setup->sin + (fft_setup->fft_size / 4);
+    sin_table = sin_computed;
+  }
 
-    /* Bit reversal table */
-    fft_setup->bitrev = (unsigned int *) rta_malloc(
-      sizeof(unsigned int) * fft_setup->fft_size);
+  if(bitrev_table == NULL)
+  {
+    rta_fft_setup_t * setup = *fft_setup;
+    unsigned int * bitrev_computed = (unsigned int *) rta_arena_alloc(&arena, bitrev_size);
+    unsigned int idx, xdi;
+    unsigned int i, j;
 
-    if(fft_setup->bitrev != NULL)
+    /* Bit reversal table */
+    for(i=0; i<setup->fft_size; i++)
     {
-      unsigned int idx, xdi;
-      unsigned int i, j;
-          
-      for(i=0; i<fft_setup->fft_size; i++)
-      {
-        idx = i;
-        xdi = 0;
+      idx = i;
+      xdi = 0;
     
-        for(j=1; j<fft_setup->log2_size; j++)
-        {
-          xdi += (idx & 1);
-          xdi <<= 1;
-          idx >>= 1;
-        }
-    
-        fft_setup->bitrev[i] = xdi + (idx & 1);
+      for(j=1; j<setup->log2_size; j++)
+      {
+        xdi += (idx & 1);
+        xdi <<= 1;
+        idx >>= 1;
       }
-        
-      ret = 1; /* setup complete */
+    
+      bitrev_computed[i] = xdi + (idx & 1);
     }
-    else /* bitrev failed */
-      rta_free(fft_setup->sin);
+
+    bitrev_table = bitrev_computed;
   }
-  /* else: sin failed */
-  
-  return ret;
+
+  (*fft_setup)->sin = sin_table;
+
+  /* cosine function is just a phase-shifted sine */
+  /* Memory is shared */
+  (*fft_setup)->cos = sin_table + (size / 4);
+  (*fft_setup)->bitrev = bitrev_table;
+  (*fft_setup)->radix = fft_plan_radix(*fft_setup, fft_type);
+
+  return 1;
 }
 
 /* ------- end of private ---------------------------- */
@@ -1114,15 +1325,10 @@ rta_fft_real_setup_new(rta_fft_setup_t ** fft_setup,
                        rta_real_t * nyquist)
 /* FFTW uses input and output to plan executions */
 {
-  int ret = 0;
+  int ret = setup_tables_new(fft_setup, fft_size, fft_type);
 
-  *fft_setup = (rta_fft_setup_t *) rta_malloc(sizeof(rta_fft_setup_t));
-
-  if(*fft_setup != NULL)
+  if(ret != 0)
   {
-    /* actual FFT size is the next power of 2 of the given argument */
-    (*fft_setup)->fft_size = rta_inextpow2(fft_size);
-    (*fft_setup)->log2_size = rta_ilog2((*fft_setup)->fft_size);
     (*fft_setup)->input_size = input_size;
 
     (*fft_setup)->output = output;
@@ -1135,13 +1341,6 @@ rta_fft_real_setup_new(rta_fft_setup_t ** fft_setup,
 
     (*fft_setup)->scale = scale;
     (*fft_setup)->fft_type = fft_type;
-    
-    ret = tables_new(*fft_setup);
-    if(ret == 0)
-    {
-      rta_free(*fft_setup);
-      *fft_setup = NULL;
-    }
   }
 
   return ret;
@@ -1156,15 +1355,10 @@ rta_fft_real_setup_new_stride(
   rta_real_t * nyquist)
 /* FFTW uses input and output to plan executions */
 {
-  int ret = 0;
+  int ret = setup_tables_new(fft_setup, fft_size, fft_type);
 
-  *fft_setup = (rta_fft_setup_t *) rta_malloc(sizeof(rta_fft_setup_t));
-
-  if(fft_setup != NULL)
+  if(ret != 0)
   {
-    /* actual FFT size is the next power of 2 of the given argument */
-    (*fft_setup)->fft_size = rta_inextpow2(fft_size);
-    (*fft_setup)->log2_size = rta_ilog2((*fft_setup)->fft_size);
     (*fft_setup)->input_size = input_size;
 
     (*fft_setup)->output = output;
@@ -1177,13 +1371,6 @@ rta_fft_real_setup_new_stride(
 
     (*fft_setup)->scale = scale;
     (*fft_setup)->fft_type = fft_type;
-    
-    ret = tables_new(*fft_setup);
-    if(ret == 0)
-    {
-      rta_free(*fft_setup);
-      *fft_setup = NULL;
-    }
   }
 
   return ret;
@@ -1196,15 +1383,10 @@ rta_fft_setup_new(rta_fft_setup_t ** fft_setup,
                   rta_complex_t * output, const unsigned int fft_size)
 /* FFTW uses input and output to plan executions */
 {
-  int ret = 0;
-
-  *fft_setup = (rta_fft_setup_t *) rta_malloc(sizeof(rta_fft_setup_t));
+  int ret = setup_tables_new(fft_setup, fft_size, fft_type);
 
-  if(*fft_setup != NULL)
+  if(ret != 0)
   {
-    /* actual FFT size is the next power of 2 of the given argument */
-    (*fft_setup)->fft_size = rta_inextpow2(fft_size);
-    (*fft_setup)->log2_size = rta_ilog2((*fft_setup)->fft_size);
     (*fft_setup)->input_size = input_size;
 
     (*fft_setup)->output = (void *) output;
@@ -1217,13 +1399,6 @@ rta_fft_setup_new(rta_fft_setup_t ** fft_setup,
 
     (*fft_setup)->scale = scale;
     (*fft_setup)->fft_type = fft_type;
-    
-    ret = tables_new(*fft_setup);
-    if(ret == 0)
-    {
-      rta_free(*fft_setup);
-      *fft_setup = NULL;
-    }
   }
 
   return ret;
@@ -1237,15 +1412,10 @@ rta_fft_setup_new_stride(
   rta_complex_t * output, const int o_stride, const unsigned int fft_size)
 /* FFTW uses input and output to plan executions */
 {
-  int ret = 0;
-
-  *fft_setup = (rta_fft_setup_t *) rta_malloc(sizeof(rta_fft_setup_t));
+  int ret = setup_tables_new(fft_setup, fft_size, fft_type);
 
-  if(*fft_setup != NULL)
+  if(ret != 0)
   {
-    /* actual FFT size is the next power of 2 of the given argument */
-    (*fft_setup)->fft_size = rta_inextpow2(fft_size);
-    (*fft_setup)->log2_size = rta_ilog2((*fft_setup)->fft_size);
     (*fft_setup)->input_size = input_size;
 
     (*fft_setup)->output = (void *) output;
@@ -1258,13 +1428,6 @@ rta_fft_setup_new_stride(
 
     (*fft_setup)->scale = scale;
     (*fft_setup)->fft_type = fft_type;
-    
-    ret = tables_new(*fft_setup);
-    if(ret == 0)
-    {
-      rta_free(*fft_setup);
-      *fft_setup = NULL;
-    }
   }
 
   return ret;
@@ -1274,20 +1437,8 @@ rta_fft_setup_new_stride(
 void
 rta_fft_setup_delete(rta_fft_setup_t * fft_setup)
 {
-  if(fft_setup != NULL)
-  {
-    if(fft_setup->sin != NULL)
-    {
-      rta_free(fft_setup->sin);
-    }
-
-    if(fft_setup->bitrev != NULL)
-    {
-      rta_free(fft_setup->bitrev);
-    }
-
-    rta_free(fft_setup);
-  }
+  /* tables are in the same arena */
+  rta_aligned_free(fft_setup);
 
   return;
 }
@@ -1300,6 +1451,8 @@ rta_fft_execute(void * output, void * input, const unsigned int input_size,
   const unsigned int no_stride = 
     fft_setup->i_stride == 1 && fft_setup->o_stride == 1;
   unsigned int spectrum_size = fft_setup->fft_size >> 1;
+  RTA_TRACE_BEGIN(rta_trace_fft_execute);
+
   fft_setup->input = input;
   fft_setup->output = output;
   fft_setup->input_size = input_size;
@@ -1353,8 +1506,7 @@ rta_fft_execute(void * output, void * input, const unsigned int input_size,
         bitreversal_oversampled_inplace(
           complex_output, fft_setup->bitrev, spectrum_size);
         
-        fft_inplace_oversampled_coefficients(
-          complex_output, fft_setup->cos, fft_setup->sin, spectrum_size);
+        fft_passes(fft_setup, complex_output, spectrum_size, 2, 0);
           
         shuffle_after_real_fft_inplace(
           complex_output, fft_setup->cos, fft_setup->sin, spectrum_size);
@@ -1440,8 +1592,7 @@ rta_fft_execute(void * output, void * input, const unsigned int input_size,
         bitreversal_oversampled_inplace(
           complex_output, fft_setup->bitrev, spectrum_size);
         
-        ifft_inplace_oversampled_coefficients(
-          complex_output, fft_setup->cos, fft_setup->sin, spectrum_size);
+        fft_passes(fft_setup, complex_output, spectrum_size, 2, 1);
       }
       else
       {
@@ -1505,7 +1656,7 @@ rta_fft_execute(void * output, void * input, const unsigned int input_size,
       {
         bitreversal_inplace(complex_output, fft_setup->bitrev, fft_setup->fft_size);
 
-        fft_inplace(complex_output, fft_setup->cos, fft_setup->sin, fft_setup->fft_size);
+        fft_passes(fft_setup, complex_output, fft_setup->fft_size, 1, 0);
       }
       else
       {
@@ -1564,8 +1715,7 @@ rta_fft_execute(void * output, void * input, const unsigned int input_size,
         bitreversal_inplace(
           complex_output, fft_setup->bitrev, fft_setup->fft_size);
 
-        ifft_inplace(
-          complex_output, fft_setup->cos, fft_setup->sin, fft_setup->fft_size);
+        fft_passes(fft_setup, complex_output, fft_setup->fft_size, 1, 1);
       }
       else
       {
@@ -1581,6 +1731,9 @@ rta_fft_execute(void * output, void * input, const unsigned int input_size,
     default:
       break;
   }
+
+  RTA_TRACE_COUNT(rta_trace_fft_execute, fft_setup->fft_size);
+  RTA_TRACE_END(rta_trace_fft_execute);
   return;
 }
 
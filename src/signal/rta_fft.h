@@ -61,6 +61,20 @@ typedef enum
 /* rta_fft_setup is private (depends on implementation) */
 typedef struct rta_fft_setup rta_fft_setup_t;
 
+/*
+ * The passes of the transforms whose output has no stride are
+ * radix-2 or radix-4, as the setup asks the planner (rta_planner.h),
+ * for the problem "fft_complex" of size 'fft_size', or "fft_real" of
+ * size 'fft_size' / 2 for real transforms: from the wisdom, by
+ * measuring both once in rta_planner_measure mode, or else radix-4
+ * from 8192 complex points. Both give the same results, up to
+ * rounding errors.
+ *
+ * Hosts building the FFT therefore also need rta_planner.c, with its
+ * own dependencies rta_cpu.c, rta_thread.c and rta_trace.c, besides
+ * rta_tables.c, rta_int.c and rta_alloc.c.
+ */
+
 
 /**
  * Allocate and initialize an FFT setup for real to complex or complex
@@ -0,0 +1,550 @@
+/**
+ * @file   rta_granular.c
+ * @ingroup rta_signal
+ *
+ * @brief  Multi-voice granular playback
+ *
+ * @see rta_granular.h
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_granular.h"
+#include "rta_cubic.h"
+#include "rta_util.h" /* rta_idefix_t */
+#include "rta_alloc.h"
+#include "rta_cpu.h" /* rta_cpu_get_level */
+#include "rta_math.h"
+
+#include <stdint.h>
+
+typedef struct voice
+{
+  const rta_real_t * buffer;
+  rta_idefix_t position;       /**< in 'buffer' */
+  rta_idefix_t increment;      /**< rate */
+  unsigned int time;           /**< samples played */
+  unsigned int duration;
+  unsigned int delay;          /**< before the first sample */
+  rta_real_t in_offset;        /**< fade in of 'time': (time + in_offset)
+                                  * in_scale, up to 1 */
+  rta_real_t in_scale;
+  rta_real_t out_scale;        /**< fade out of (duration - 1 - time)
+                                  * out_scale, up to 1 */
+  rta_real_t out_offset;
+  rta_real_t gain;
+  unsigned int bus;
+} voice_t;
+
+struct rta_granular
+{
+  unsigned int max_voices;
+  unsigned int num_buses;
+  unsigned int num_voices;     /**< playing, first in 'voices' */
+  voice_t * voices;
+};
+
+/* sin(pi/2 x) = x (S1 + x^2 (S3 + ...)), x in [0, 1], by its Taylor
+   series up to x^9, with S1 corrected so that the sum is 1 at x = 1
+   (error below 3e-6) */
+/* as in the rta_cubic_table expansion */
+#define CUBIC_SIXTH (-0.1666667f)
+
+#define FADE_S1 ((rta_real_t) 1.5707927842106104)
+#define FADE_S3 ((rta_real_t) -0.64596409750624625)
+#define FADE_S5 ((rta_real_t) 0.079692626246167045)
+#define FADE_S7 ((rta_real_t) -0.0046817541353186881)
+#define FADE_S9 ((rta_real_t) 0.00016044118478735982)
+
+/* raised cosine from 0 to 1: sin^2(pi/2 x) */
+static rta_real_t
+fade(const rta_real_t x)
+{
+  const rta_real_t x2 = x * x;
+  const rta_real_t s =
+    x * (FADE_S1 + x2 * (FADE_S3 + x2 * (FADE_S5 + x2 * (FADE_S7 + x2 * FADE_S9))));
+
+  return s * s;
+}
+
+/* gain and envelope of 'voice' at 'time': the lower of the fade in
+   and the fade out, which do not overlap unless the grain is shorter
+   than both */
+static rta_real_t
+envelope(const voice_t * voice, const unsigned int time)
+{
+  rta_real_t in = ((rta_real_t) time + voice->in_offset) * voice->in_scale;
+  const rta_real_t out = ((rta_real_t) (voice->duration - 1 - time) + voice->out_offset)
+    * voice->out_scale;
+
+  if(out < in)
+  {
+    in = out;
+  }
+  if(in > 1)
+  {
+    in = 1;
+  }
+
+  return voice->gain * fade(in);
+}
+
+/* ------- voice kernels, dispatched at run time ------- */
+
+/* add 'num_frames' samples of 'voice' to 'output', advance it */
+typedef void (*render_function_t) (voice_t * voice, rta_real_t * output,
+                                   const unsigned int num_frames);
+
+static void
+render_generic(voice_t * voice, rta_real_t * output,
+               const unsigned int num_frames)
+{
+  const rta_real_t * buffer = voice->buffer;
+  rta_idefix_t position = voice->position;
+  unsigned int i;
+
+  for(i=0; i<num_frames; i++)
+  {
+    rta_real_t y;
+
+    rta_cubic_idefix_interpolate(buffer, position, &y);
+    output[i] += envelope(voice, voice->time + i) * y;
+    rta_idefix_incr(&position, voice->increment);
+  }
+
+  voice->position = position;
+  voice->time += num_frames;
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE) && defined(RTA_CPU_X86)
+#include <immintrin.h>
+
+/* idefix as one 64-bit fixed-point number: index in the upper half,
+   fraction in the lower one, so that rta_idefix_incr is an addition */
+static uint64_t
+idefix_to_64(const rta_idefix_t x)
+{
+  return ((uint64_t) (uint32_t) x.index << 32) | x.frac;
+}
+
+static rta_idefix_t
+idefix_from_64(const uint64_t x)
+{
+  rta_idefix_t y;
+
+  y.index = (int) (uint32_t) (x >> 32);
+  y.frac = (unsigned int) x;
+
+  return y;
+}
+
+RTA_CPU_TARGET("sse2") static __m128
+fade_sse2(const __m128 x)
+{
+  const __m128 x2 = _mm_mul_ps(x, x);
+  __m128 s = _mm_add_ps(_mm_set1_ps(FADE_S7), _mm_mul_ps(x2, _mm_set1_ps(FADE_S9)));
+
+  s = _mm_add_ps(_mm_set1_ps(FADE_S5), _mm_mul_ps(x2, s));
+  s = _mm_add_ps(_mm_set1_ps(FADE_S3), _mm_mul_ps(x2, s));
+  s = _mm_mul_ps(x, _mm_add_ps(_mm_set1_ps(FADE_S1), _mm_mul_ps(x2, s)));
+
+  return _mm_mul_ps(s, s);
+}
+
+/* 4 samples per step, the input samples and the coefficients of each
+   output sample are contiguous: load them and transpose */
+RTA_CPU_TARGET("sse2") static void
+render_sse2(voice_t * voice, rta_real_t * output,
+            const unsigned int num_frames)
+{
+  const rta_real_t * buffer = voice->buffer;
+  const __m128 one = _mm_set1_ps(1.f);
+  const __m128 four = _mm_set1_ps(4.f);
+  const __m128 in_scale = _mm_set1_ps(voice->in_scale);
+  const __m128 out_scale = _mm_set1_ps(voice->out_scale);
+  const __m128 gain = _mm_set1_ps(voice->gain);
+  const uint64_t increment = idefix_to_64(voice->increment);
+  uint64_t position = idefix_to_64(voice->position);
+  /* fade arguments before scaling, per lane */
+  __m128 in = _mm_add_ps(_mm_set1_ps((rta_real_t) voice->time + voice->in_offset),
+                         _mm_set_ps(3.f, 2.f, 1.f, 0.f));
+  __m128 out = _mm_sub_ps(_mm_set1_ps((rta_real_t) (voice->duration - 1 - voice->time)
+                                      + voice->out_offset),
+                          _mm_set_ps(3.f, 2.f, 1.f, 0.f));
+  unsigned int i;
+
+  for(i=0; i+4<=num_frames; i+=4)
+  {
+    __m128 x0, x1, x2, x3, c0, c1, c2, c3, y, envelope;
+    const rta_real_t * x[4];
+    const float * c[4];
+    unsigned int l;
+
+    for(l=0; l<4; l++)
+    {
+      x[l] = buffer + (int) (uint32_t) (position >> 32) - 1;
+      c[l] = &rta_cubic_table[(uint32_t) position >> RTA_CUBIC_IDEFIX_SHIFT_BITS].pm1;
+      position += increment;
+    }
+
+    /* rows: x[-1], x[0], x[1], x[2] of each sample, then columns */
+    x0 = _mm_loadu_ps(x[0]);
+    x1 = _mm_loadu_ps(x[1]);
+    x2 = _mm_loadu_ps(x[2]);
+    x3 = _mm_loadu_ps(x[3]);
+    _MM_TRANSPOSE4_PS(x0, x1, x2, x3);
+    c0 = _mm_loadu_ps(c[0]);
+    c1 = _mm_loadu_ps(c[1]);
+    c2 = _mm_loadu_ps(c[2]);
+    c3 = _mm_loadu_ps(c[3]);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    y = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x0, c0), _mm_mul_ps(x1, c1)),
+                              _mm_mul_ps(x2, c2)),
+                   _mm_mul_ps(x3, c3));
+
+    envelope = fade_sse2(_mm_min_ps(_mm_min_ps(_mm_mul_ps(in, in_scale),
+                                               _mm_mul_ps(out, out_scale)), one));
+    in = _mm_add_ps(in, four);
+    out = _mm_sub_ps(out, four);
+
+    _mm_storeu_ps(output + i, _mm_add_ps(_mm_loadu_ps(output + i),
+                                         _mm_mul_ps(_mm_mul_ps(gain, envelope), y)));
+  }
+
+  voice->position = idefix_from_64(position);
+  voice->time += i;
+  render_generic(voice, output + i, num_frames - i);
+}
+
+RTA_CPU_TARGET("avx2,fma") static __m256
+fade_avx2(const __m256 x)
+{
+  const __m256 x2 = _mm256_mul_ps(x, x);
+  __m256 s = _mm256_fmadd_ps(x2, _mm256_set1_ps(FADE_S9), _mm256_set1_ps(FADE_S7));
+
+  s = _mm256_fmadd_ps(x2, s, _mm256_set1_ps(FADE_S5));
+  s = _mm256_fmadd_ps(x2, s, _mm256_set1_ps(FADE_S3));
+  s = _mm256_mul_ps(x, _mm256_fmadd_ps(x2, s, _mm256_set1_ps(FADE_S1)));
+
+  return _mm256_mul_ps(s, s);
+}
+
+/* the 4 coefficients of rta_cubic_table at the table indices in 'k':
+   computing them takes fewer instructions than loading them */
+RTA_CPU_TARGET("avx2,fma") static inline void
+cubic_coefs_avx2(const __m256i k, __m256 c[4])
+{
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 f = _mm256_mul_ps(_mm256_cvtepi32_ps(k),
+                                 _mm256_set1_ps(1.f / RTA_CUBIC_TABLE_SIZE));
+  const __m256 a = _mm256_add_ps(one, f);
+  const __m256 b = _mm256_sub_ps(one, f);
+  const __m256 fb = _mm256_mul_ps(f, b);
+  const __m256 ac = _mm256_mul_ps(a, _mm256_add_ps(b, one)); /* 2 - f */
+
+  c[0] = _mm256_mul_ps(_mm256_mul_ps(fb, _mm256_add_ps(b, one)), _mm256_set1_ps(CUBIC_SIXTH));
+  c[1] = _mm256_mul_ps(_mm256_mul_ps(ac, b), _mm256_set1_ps(0.5f));
+  c[2] = _mm256_mul_ps(_mm256_mul_ps(ac, f), _mm256_set1_ps(0.5f));
+  c[3] = _mm256_mul_ps(_mm256_mul_ps(fb, a), _mm256_set1_ps(CUBIC_SIXTH));
+}
+
+/* columns of the 4 contiguous values at p[0] ... p[7]: c[k] holds
+   p[l][k] in lane l */
+RTA_CPU_TARGET("avx2,fma") static inline void
+load_transpose_avx2(const float * const p[8], __m256 c[4])
+{
+  const __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p[0])),
+                                         _mm_loadu_ps(p[4]), 1);
+  const __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p[1])),
+                                         _mm_loadu_ps(p[5]), 1);
+  const __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p[2])),
+                                         _mm_loadu_ps(p[6]), 1);
+  const __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p[3])),
+                                         _mm_loadu_ps(p[7]), 1);
+  const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+  const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+  const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+  const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+  c[0] = _mm256_shuffle_ps(t0, t2, 0x44);
+  c[1] = _mm256_shuffle_ps(t0, t2, 0xee);
+  c[2] = _mm256_shuffle_ps(t1, t3, 0x44);
+  c[3] = _mm256_shuffle_ps(t1, t3, 0xee);
+}
+
+/* 8 samples per step: the positions of the 8 lanes advance as 64-bit
+   fixed point; the input samples are loaded by 4 and transposed, which
+   takes fewer loads than gathering them */
+RTA_CPU_TARGET("avx2,fma") static void
+render_avx2(voice_t * voice, rta_real_t * output,
+            const unsigned int num_frames)
+{
+  const rta_real_t * buffer = voice->buffer - 1;
+  const __m256i split = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  const __m256 one = _mm256_set1_ps(1.f);
+  const __m256 eight = _mm256_set1_ps(8.f);
+  const __m256 in_scale = _mm256_set1_ps(voice->in_scale);
+  const __m256 out_scale = _mm256_set1_ps(voice->out_scale);
+  const __m256 gain = _mm256_set1_ps(voice->gain);
+  const uint64_t increment = idefix_to_64(voice->increment);
+  const uint64_t start = idefix_to_64(voice->position);
+  const __m256i step = _mm256_set1_epi64x((long long) (increment * 8));
+  __m256i low = _mm256_setr_epi64x((long long) start,
+                                   (long long) (start + increment),
+                                   (long long) (start + increment * 2),
+                                   (long long) (start + increment * 3));
+  __m256i high = _mm256_add_epi64(low, _mm256_set1_epi64x((long long) (increment * 4)));
+  __m256 in = _mm256_add_ps(_mm256_set1_ps((rta_real_t) voice->time + voice->in_offset),
+                            _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f));
+  __m256 out = _mm256_sub_ps(_mm256_set1_ps((rta_real_t) (voice->duration - 1 - voice->time)
+                                            + voice->out_offset),
+                             _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f));
+  unsigned int i;
+
+  for(i=0; i+8<=num_frames; i+=8)
+  {
+    /* fractions and indices of the 8 lanes, in order */
+    const __m256i a = _mm256_permutevar8x32_epi32(low, split);
+    const __m256i b = _mm256_permutevar8x32_epi32(high, split);
+    int index[8];
+    const float * x[8];
+    __m256 xc[4], cc[4], y, envelope;
+    unsigned int l;
+
+    _mm256_storeu_si256((__m256i *) index, _mm256_permute2x128_si256(a, b, 0x31));
+    for(l=0; l<8; l++)
+    {
+      x[l] = buffer + index[l];
+    }
+
+    load_transpose_avx2(x, xc);
+    cubic_coefs_avx2(_mm256_srli_epi32(_mm256_permute2x128_si256(a, b, 0x20),
+                                       RTA_CUBIC_IDEFIX_SHIFT_BITS), cc);
+
+    y = _mm256_mul_ps(xc[0], cc[0]);
+    y = _mm256_fmadd_ps(xc[1], cc[1], y);
+    y = _mm256_fmadd_ps(xc[2], cc[2], y);
+    y = _mm256_fmadd_ps(xc[3], cc[3], y);
+
+    envelope = fade_avx2(_mm256_min_ps(_mm256_min_ps(_mm256_mul_ps(in, in_scale),
+                                                     _mm256_mul_ps(out, out_scale)), one));
+    in = _mm256_add_ps(in, eight);
+    out = _mm256_sub_ps(out, eight);
+    low = _mm256_add_epi64(low, step);
+    high = _mm256_add_epi64(high, step);
+
+    _mm256_storeu_ps(output + i, _mm256_fmadd_ps(_mm256_mul_ps(gain, envelope), y,
+                                                 _mm256_loadu_ps(output + i)));
+  }
+
+  voice->position = idefix_from_64(start + increment * i);
+  voice->time += i;
+  render_generic(voice, output + i, num_frames - i);
+}
+
+#define HAVE_RENDER_KERNELS 1
+static const render_function_t render_kernels[rta_cpu_num_levels] =
+{
+  render_generic, render_sse2, render_avx2, render_avx2, render_generic
+};
+
+#endif /* float on x86 */
+
+/* best voice kernel for the current dispatch level */
+static render_function_t
+get_render(void)
+{
+#if defined(HAVE_RENDER_KERNELS)
+  return render_kernels[rta_cpu_get_level()];
+#else
+  return render_generic;
+#endif
+}
+
+/* ------- end of kernels ------- */
+
+int
+rta_granular_new(rta_granular_t ** granular, const unsigned int max_voices,
+                 const unsigned int num_buses)
+{
+  rta_granular_t * self;
+  rta_arena_t arena;
+
+  *granular = NULL;
+
+  if(max_voices < 1 || num_buses < 1)
+  {
+    return 0;
+  }
+
+  if(rta_arena_new(&arena, rta_align_size(sizeof(rta_granular_t))
+                   + rta_align_size(max_voices * sizeof(voice_t))) == 0)
+  {
+    return 0;
+  }
+
+  /* the pool comes first: its address is the arena base */
+  self = (rta_granular_t *) rta_arena_alloc(&arena, sizeof(rta_granular_t));
+  self->voices = (voice_t *) rta_arena_alloc(&arena, max_voices * sizeof(voice_t));
+  self->max_voices = max_voices;
+  self->num_buses = num_buses;
+  self->num_voices = 0;
+
+  *granular = self;
+
+  return 1;
+}
+
+void
+rta_granular_delete(rta_granular_t * granular)
+{
+  if(granular != NULL)
+  {
+    /* voices are in the same arena */
+    rta_aligned_free(granular);
+  }
+
+  return;
+}
+
+int
+rta_granular_trigger(rta_granular_t * granular,
+                     const rta_granular_grain_t * grain)
+{
+  /* cubic interpolation reads from index - 1 to index + 2 */
+  const double first = RTA_CUBIC_HEAD;
+  const double last = (double) grain->buffer_size - 1 - RTA_CUBIC_TAIL;
+  voice_t * voice;
+  double onset, rate, frames;
+  unsigned int duration = grain->duration;
+
+  if(granular->num_voices >= granular->max_voices
+     || grain->buffer == NULL || grain->bus >= granular->num_buses
+     || duration < 1 || ! (grain->onset >= first && grain->onset <= last))
+  {
+    return 0;
+  }
+
+  voice = granular->voices + granular->num_voices;
+  rta_idefix_set_float(&voice->position, grain->onset);
+  rta_idefix_set_float(&voice->increment, grain->rate);
+
+  /* samples before leaving the buffer, as actually accumulated, with
+     one of margin */
+  onset = rta_idefix_get_float(voice->position);
+  rate = rta_idefix_get_float(voice->increment);
+  frames = 1e300;
+  if(rate > 0.0)
+  {
+    frames = floor((last - onset) / rate);
+  }
+  else if(rate < 0.0)
+  {
+    frames = floor((onset - first) / -rate);
+  }
+
+  if(frames < 1.0)
+  {
+    frames = 1.0;
+  }
+  if(duration > frames)
+  {
+    duration = (unsigned int) frames;
+  }
+
+  voice->buffer = grain->buffer;
+  voice->time = 0;
+  voice->duration = duration;
+  voice->delay = grain->delay;
+  voice->in_offset = grain->attack > 0 ? 0. : 1.;
+  voice->in_scale = grain->attack > 0 ? 1. / grain->attack : 1.;
+  voice->out_offset = grain->release > 0 ? 0. : 1.;
+  voice->out_scale = grain->release > 0 ? 1. / grain->release : 1.;
+  voice->gain = grain->gain;
+  voice->bus = grain->bus;
+
+  granular->num_voices++;
+
+  return 1;
+}
+
+void
+rta_granular_stop(rta_granular_t * granular)
+{
+  granular->num_voices = 0;
+
+  return;
+}
+
+unsigned int
+rta_granular_get_num_voices(const rta_granular_t * granular)
+{
+  return granular->num_voices;
+}
+
+void
+rta_granular_render(rta_granular_t * granular, rta_real_t ** buses,
+                    const unsigned int num_frames)
+{
+  const render_function_t render = get_render();
+  unsigned int v = 0;
+
+  while(v < granular->num_voices)
+  {
+    voice_t * voice = granular->voices + v;
+    const unsigned int start =
+      voice->delay < num_frames ? voice->delay : num_frames;
+    unsigned int size = voice->duration - voice->time;
+
+    if(size > num_frames - start)
+    {
+      size = num_frames - start;
+    }
+
+    voice->delay -= start;
+
+    if(size > 0)
+    {
+      render(voice, buses[voice->bus] + start, size);
+    }
+
+    if(voice->time == voice->duration)
+    {
+      /* finished: the last voice takes its place */
+      *voice = granular->voices[--granular->num_voices];
+    }
+    else
+    {
+      v++;
+    }
+  }
+}
@@ -0,0 +1,131 @@
+/**
+ * @file   rta_granular.h
+ * @ingroup rta_signal
+ *
+ * @brief  Multi-voice granular playback
+ *
+ * A pool of voices reading sound buffers by cubic interpolation
+ * (rta_cubic.h) at their own rate, with raised-cosine attack and
+ * release, and adding into output buses. The positions advance as
+ * rta_idefix_t phases, and each voice renders a whole block at once,
+ * 4 or 8 samples per step: the 4 input samples of each output sample
+ * are loaded together and transposed into the lanes, and the AVX2
+ * kernel computes the interpolation coefficients instead of loading
+ * them from rta_cubic_table.
+ *
+ * All the memory is allocated by rta_granular_new: triggering and
+ * rendering do not allocate and may run in a real-time thread.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_GRANULAR_H_
+#define _RTA_GRANULAR_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** a grain to play */
+typedef struct rta_granular_grain
+{
+  const rta_real_t * buffer;  /**< mono sound, not copied: it must stay
+                                 valid while the grain plays */
+  unsigned int buffer_size;   /**< in samples */
+  double onset;               /**< first position in 'buffer', in samples */
+  double rate;                /**< of the reading, 1 for the original
+                                 pitch, negative to play backwards */
+  unsigned int duration;      /**< in output samples, shortened so that
+                                 the reading stays in 'buffer' */
+  unsigned int attack;        /**< samples of fade in, 0 for none */
+  unsigned int release;       /**< samples of fade out, 0 for none;
+                                 where the fades overlap, the lower
+                                 one applies */
+  rta_real_t gain;
+  unsigned int bus;           /**< output bus, < num_buses */
+  unsigned int delay;         /**< samples into the next rendered block */
+} rta_granular_grain_t;
+
+typedef struct rta_granular rta_granular_t;
+
+/**
+ * Allocate and initialise a voice pool
+ *
+ * @param granular is set to the new pool, or NULL on failure
+ * @param max_voices is the maximum number of simultaneous grains
+ * @param num_buses is the number of output buses
+ *
+ * @return 1 on success, 0 on failure (invalid parameters or memory)
+ */
+int rta_granular_new(rta_granular_t ** granular,
+                     const unsigned int max_voices,
+                     const unsigned int num_buses);
+
+/** free 'granular' */
+void rta_granular_delete(rta_granular_t * granular);
+
+/**
+ * Start a grain on a free voice, from the next rendered block
+ *
+ * @param granular pool
+ * @param grain parameters are copied
+ *
+ * @return 1 on success, 0 if all the voices are playing or 'grain'
+ * is invalid (its onset is not inside the buffer, or its bus does not
+ * exist)
+ */
+int rta_granular_trigger(rta_granular_t * granular,
+                         const rta_granular_grain_t * grain);
+
+/** stop all the voices */
+void rta_granular_stop(rta_granular_t * granular);
+
+/** number of grains playing */
+unsigned int rta_granular_get_num_voices(const rta_granular_t * granular);
+
+/**
+ * Render a block of all the playing grains
+ *
+ * @param granular pool
+ * @param buses are num_buses vectors of 'num_frames' samples, to
+ * which the grains are added (they are not cleared)
+ * @param num_frames can be anything, including 0
+ */
+void rta_granular_render(rta_granular_t * granular, rta_real_t ** buses,
+                         const unsigned int num_frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_GRANULAR_H_ */
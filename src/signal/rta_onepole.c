@@ -40,6 +40,7 @@
  */
 
 #include "rta_onepole.h"
+#include "rta_trace.h" /* RTA_TRACE_BEGIN, RTA_TRACE_END */
 
 inline rta_real_t rta_onepole_lowpass(const rta_real_t x, const rta_real_t f0,
                                       rta_real_t * state)
@@ -64,12 +65,15 @@ void rta_onepole_lowpass_vector(
   const rta_real_t f0, rta_real_t * state)
 {
   unsigned int i;
+  RTA_TRACE_BEGIN(rta_trace_onepole_vector);
 
   for(i=0; i<x_size; i++)
   {
     y[i] = rta_onepole_lowpass(x[i], f0, state);
   }
 
+  RTA_TRACE_COUNT(rta_trace_onepole_vector, x_size);
+  RTA_TRACE_END(rta_trace_onepole_vector);
   return;
 }
 
@@ -79,6 +83,7 @@ void rta_onepole_lowpass_vector_stride(
   const rta_real_t f0, rta_real_t * state)
 {
   int ix, iy;
+  RTA_TRACE_BEGIN(rta_trace_onepole_vector);
 
   for(ix = 0, iy = 0;
       ix < x_size*x_stride;
@@ -87,6 +92,8 @@ void rta_onepole_lowpass_vector_stride(
     y[iy] = rta_onepole_lowpass(x[ix], f0, state);
   }
 
+  RTA_TRACE_COUNT(rta_trace_onepole_vector, x_size);
+  RTA_TRACE_END(rta_trace_onepole_vector);
   return;
 }
 
@@ -96,12 +103,15 @@ void rta_onepole_highpass_vector(
   const rta_real_t f0, rta_real_t * state)
 {
   unsigned int i;
+  RTA_TRACE_BEGIN(rta_trace_onepole_vector);
 
   for(i=0; i<x_size; i++)
   {
     y[i] = rta_onepole_highpass(x[i], f0, state);
   }
 
+  RTA_TRACE_COUNT(rta_trace_onepole_vector, x_size);
+  RTA_TRACE_END(rta_trace_onepole_vector);
   return;
 }
 
@@ -111,6 +121,7 @@ void rta_onepole_highpass_vector_stride(
   const rta_real_t f0, rta_real_t * state)
 {
   int ix, iy;
+  RTA_TRACE_BEGIN(rta_trace_onepole_vector);
 
   for(ix = 0, iy = 0;
       ix < x_size*x_stride;
@@ -119,5 +130,7 @@ void rta_onepole_highpass_vector_stride(
     y[iy] = rta_onepole_highpass(x[ix], f0, state);
   }
 
+  RTA_TRACE_COUNT(rta_trace_onepole_vector, x_size);
+  RTA_TRACE_END(rta_trace_onepole_vector);
   return;
 }
@@ -0,0 +1,500 @@
+/**
+ * @file   rta_onset.c
+ *
+ * @brief  Streaming onset detection by spectral flux
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_onset.h"
+#include "rta_fft.h"
+#include "rta_window.h"
+#include "rta_mel.h"
+#include "rta_bands.h"
+#include "rta_selection.h" /* median */
+#include "rta_alloc.h"
+#include "rta_cpu.h" /* rta_cpu_get_level */
+#include "rta_int.h" /* rta_inextpow2 */
+#include "rta_math.h"
+
+#include <string.h> /* memset, memmove */
+
+struct rta_onset
+{
+  rta_onset_params_t params;
+  rta_onset_callback_t callback;
+  void * receiver;
+
+  rta_fft_setup_t * fft_setup;
+  rta_real_t fft_scale;
+  rta_real_t nyquist;
+  unsigned int spectrum_size;  /**< frame_size / 2 + 1 */
+  unsigned int num_values;     /**< bands or bins per frame */
+
+  rta_real_t * input;          /**< last frame_size samples */
+  unsigned int input_fill;     /**< samples of the next hop */
+  rta_real_t * window;
+  rta_real_t * frame;          /**< windowed input */
+  rta_real_t * spectrum;       /**< complex spectrum, then amplitudes */
+  rta_real_t * mel_weights;
+  unsigned int * mel_bounds;
+  rta_real_t * values[2];      /**< current and previous frame values */
+  int current;
+
+  rta_real_t * novelty;        /**< ring of the last history_size frames */
+  rta_real_t * scratch;        /**< for the median */
+  unsigned int history_size;
+  unsigned long num_frames;    /**< analysed since reset */
+  double last_onset;           /**< time, in seconds */
+};
+
+/* ------- spectral flux kernels, dispatched at run time ------- */
+
+/* sum of the positive differences of 'current' and 'previous' */
+typedef rta_real_t (*flux_function_t) (const rta_real_t * current,
+                                       const rta_real_t * previous,
+                                       const unsigned int size);
+
+static rta_real_t
+flux_generic(const rta_real_t * current, const rta_real_t * previous,
+             const unsigned int size)
+{
+  rta_real_t sum = 0.0;
+  unsigned int i;
+
+  for(i=0; i<size; i++)
+  {
+    const rta_real_t difference = current[i] - previous[i];
+
+    if(difference > 0.0)
+    {
+      sum += difference;
+    }
+  }
+  return sum;
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE) && defined(RTA_CPU_X86)
+#include <immintrin.h>
+
+RTA_CPU_TARGET("sse2") static rta_real_t
+flux_sse2(const rta_real_t * current, const rta_real_t * previous,
+          const unsigned int size)
+{
+  const __m128 zero = _mm_setzero_ps();
+  __m128 acc = zero;
+  float lanes[4];
+  rta_real_t sum;
+  unsigned int i;
+
+  for(i=0; i+4<=size; i+=4)
+  {
+    acc = _mm_add_ps(acc, _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(current + i),
+                                                _mm_loadu_ps(previous + i)),
+                                     zero));
+  }
+  _mm_storeu_ps(lanes, acc);
+  sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+
+  return sum + flux_generic(current + i, previous + i, size - i);
+}
+
+RTA_CPU_TARGET("avx2") static rta_real_t
+flux_avx2(const rta_real_t * current, const rta_real_t * previous,
+          const unsigned int size)
+{
+  const __m256 zero = _mm256_setzero_ps();
+  __m256 acc0 = zero;
+  __m256 acc1 = zero;
+  float lanes[8];
+  rta_real_t sum = 0.0;
+  unsigned int i, l;
+
+  for(i=0; i+16<=size; i+=16)
+  {
+    acc0 = _mm256_add_ps(acc0, _mm256_max_ps(
+                           _mm256_sub_ps(_mm256_loadu_ps(current + i),
+                                         _mm256_loadu_ps(previous + i)), zero));
+    acc1 = _mm256_add_ps(acc1, _mm256_max_ps(
+                           _mm256_sub_ps(_mm256_loadu_ps(current + i + 8),
+                                         _mm256_loadu_ps(previous + i + 8)), zero));
+  }
+  _mm256_storeu_ps(lanes, _mm256_add_ps(acc0, acc1));
+
+  for(l=0; l<8; l++)
+  {
+    sum += lanes[l];
+  }
+
+  return sum + flux_generic(current + i, previous + i, size - i);
+}
+
+#define HAVE_FLUX_KERNELS 1
+static const flux_function_t flux_kernels[rta_cpu_num_levels] =
+{
+  flux_generic, flux_sse2, flux_avx2, flux_avx2, flux_generic
+};
+
+#endif /* float on x86 */
+
+/* best flux kernel for the current dispatch level */
+static flux_function_t
+get_flux(void)
+{
+#if defined(HAVE_FLUX_KERNELS)
+  return flux_kernels[rta_cpu_get_level()];
+#else
+  return flux_generic;
+#endif
+}
+
+/* ------- end of kernels ------- */
+
+/* novelty of frame k, 0 before the first one */
+#define NOVELTY(self, k) \
+  ((k) < 0 ? 0.0 : (self)->novelty[(unsigned long) (k) % (self)->history_size])
+
+/* amplitude spectrum and bands of the current input frame, return
+   its novelty */
+static rta_real_t
+analyse_frame(rta_onset_t * self)
+{
+  const rta_onset_params_t * params = &self->params;
+  const unsigned int half = params->frame_size / 2;
+  rta_real_t * spectrum = self->spectrum;
+  rta_real_t * values;
+  unsigned int i;
+
+  rta_window_apply(self->frame, params->frame_size, self->input, self->window);
+  rta_fft_real_execute(spectrum, self->frame, params->frame_size,
+                       self->fft_setup, &self->nyquist);
+
+  self->current = 1 - self->current;
+  values = self->values[self->current];
+
+  if(params->num_bands > 0)
+  {
+    /* amplitude spectrum, in place */
+    for(i=0; i<half; i++)
+    {
+      spectrum[i] = rta_hypot(spectrum[2 * i], spectrum[2 * i + 1]);
+    }
+    spectrum[half] = rta_abs(self->nyquist);
+
+    rta_spectrum_to_bands_abs(values, spectrum, self->mel_weights,
+                              self->mel_bounds, self->spectrum_size,
+                              params->num_bands);
+  }
+  else
+  {
+    for(i=0; i<half; i++)
+    {
+      values[i] = rta_hypot(spectrum[2 * i], spectrum[2 * i + 1]);
+    }
+    values[half] = rta_abs(self->nyquist);
+  }
+
+  if(params->compression > 0.0)
+  {
+    for(i=0; i<self->num_values; i++)
+    {
+      values[i] = rta_log1p(params->compression * values[i]);
+    }
+  }
+
+  return get_flux()(values, self->values[1 - self->current], self->num_values)
+    / self->num_values;
+}
+
+/* decide on the frame lookahead frames before the last one, return 1
+   for an onset */
+static int
+pick_peak(rta_onset_t * self)
+{
+  const rta_onset_params_t * params = &self->params;
+  const long last = (long) self->num_frames - 1;
+  const long candidate = last - (long) params->lookahead;
+  const long first = candidate - (long) params->median_frames;
+  rta_real_t value, median;
+  double time;
+  long k;
+  unsigned int n = 0;
+
+  if(candidate < 0)
+  {
+    return 0;
+  }
+
+  /* local maximum: above the past, not below the look-ahead */
+  value = NOVELTY(self, candidate);
+
+  for(k=1; k<=(long) params->lookahead; k++)
+  {
+    if(NOVELTY(self, candidate - k) >= value
+       || NOVELTY(self, candidate + k) > value)
+    {
+      return 0;
+    }
+  }
+
+  /* adaptive threshold */
+  for(k=(first > 0 ? first : 0); k<=last; k++)
+  {
+    self->scratch[n++] = NOVELTY(self, k);
+  }
+  median = rta_selection(self->scratch, n, (n - 1) * 0.5);
+
+  if(value <= median + params->threshold)
+  {
+    return 0;
+  }
+
+  /* centre of the frame */
+  time = ((double) (candidate + 1) * params->hop_size - params->frame_size / 2)
+    / params->sample_rate;
+  if(time < 0.0)
+  {
+    time = 0.0;
+  }
+
+  if(time - self->last_onset < params->min_interval)
+  {
+    return 0;
+  }
+
+  self->last_onset = time;
+
+  if(self->callback != NULL)
+  {
+    self->callback(self->receiver, time, value);
+  }
+
+  return 1;
+}
+
+void
+rta_onset_params_default(rta_onset_params_t * params,
+                         const rta_real_t sample_rate)
+{
+  params->sample_rate = sample_rate;
+  /* 1024 at 44.1 kHz, rounded to the nearest power of 2 */
+  params->frame_size = rta_inextpow2((unsigned int) (sample_rate * (1024. / 44100.) * 0.75));
+  params->hop_size = params->frame_size / 4;
+  params->num_bands = 40;
+  params->compression = 100.;
+  params->median_frames = 8;
+  params->lookahead = 2;
+  params->threshold = 0.15;
+  params->min_interval = 0.03;
+}
+
+int
+rta_onset_new(rta_onset_t ** onset, const rta_onset_params_t * params)
+{
+  const unsigned int frame_size = params->frame_size;
+  const unsigned int spectrum_size = frame_size / 2 + 1;
+  const unsigned int num_values =
+    params->num_bands > 0 ? params->num_bands : spectrum_size;
+  const unsigned int history_size = params->lookahead
+    + (params->median_frames > params->lookahead
+       ? params->median_frames : params->lookahead) + 1;
+  rta_onset_t * self;
+  rta_arena_t arena;
+  int ret;
+
+  *onset = NULL;
+
+  if(params->sample_rate <= 0.0 || frame_size < 16
+     || frame_size != rta_inextpow2(frame_size)
+     || params->hop_size < 1 || params->hop_size > frame_size
+     || params->num_bands > spectrum_size)
+  {
+    return 0;
+  }
+
+  if(rta_arena_new(&arena, rta_align_size(sizeof(rta_onset_t))
+                   + 3 * rta_align_size(frame_size * sizeof(rta_real_t))
+                   + rta_align_size((frame_size + 2) * sizeof(rta_real_t))
+                   + 2 * rta_align_size(num_values * sizeof(rta_real_t))
+                   + 2 * rta_align_size(history_size * sizeof(rta_real_t))
+                   + (params->num_bands > 0
+                      ? rta_align_size(params->num_bands * spectrum_size
+                                       * sizeof(rta_real_t))
+                      + rta_align_size(params->num_bands * 2
+                                       * sizeof(unsigned int))
+                      : 0)) == 0)
+  {
+    return 0;
+  }
+
+  /* the detector comes first: its address is the arena base */
+  self = (rta_onset_t *) rta_arena_alloc(&arena, sizeof(rta_onset_t));
+  self->params = *params;
+  self->spectrum_size = spectrum_size;
+  self->num_values = num_values;
+  self->history_size = history_size;
+  self->fft_scale = 1.0;
+
+  self->input = (rta_real_t *) rta_arena_alloc(&arena, frame_size * sizeof(rta_real_t));
+  self->window = (rta_real_t *) rta_arena_alloc(&arena, frame_size * sizeof(rta_real_t));
+  self->frame = (rta_real_t *) rta_arena_alloc(&arena, frame_size * sizeof(rta_real_t));
+  self->spectrum = (rta_real_t *) rta_arena_alloc(&arena, (frame_size + 2) * sizeof(rta_real_t));
+  self->values[0] = (rta_real_t *) rta_arena_alloc(&arena, num_values * sizeof(rta_real_t));
+  self->values[1] = (rta_real_t *) rta_arena_alloc(&arena, num_values * sizeof(rta_real_t));
+  self->novelty = (rta_real_t *) rta_arena_alloc(&arena, history_size * sizeof(rta_real_t));
+  self->scratch = (rta_real_t *) rta_arena_alloc(&arena, history_size * sizeof(rta_real_t));
+
+  ret = rta_window_hann_weights(self->window, frame_size);
+
+  if(params->num_bands > 0)
+  {
+    self->mel_weights = (rta_real_t *) rta_arena_alloc(
+      &arena, params->num_bands * spectrum_size * sizeof(rta_real_t));
+    self->mel_bounds = (unsigned int *) rta_arena_alloc(
+      &arena, params->num_bands * 2 * sizeof(unsigned int));
+
+    ret = ret && rta_spectrum_to_mel_bands_weights(
+      self->mel_weights, self->mel_bounds, spectrum_size,
+      params->sample_rate, params->num_bands, 0., params->sample_rate * 0.5, 1.,
+      rta_hz_to_mel_slaney, rta_mel_to_hz_slaney, rta_mel_slaney);
+  }
+
+  ret = ret && rta_fft_real_setup_new(
+    &self->fft_setup, rta_fft_real_to_complex_1d, &self->fft_scale,
+    self->frame, frame_size, self->spectrum, frame_size, &self->nyquist);
+
+  if(! ret)
+  {
+    rta_arena_delete(&arena);
+    return 0;
+  }
+
+  rta_onset_reset(self);
+  *onset = self;
+
+  return 1;
+}
+
+void
+rta_onset_delete(rta_onset_t * onset)
+{
+  if(onset != NULL)
+  {
+    rta_fft_setup_delete(onset->fft_setup);
+
+    /* buffers are in the same arena */
+    rta_aligned_free(onset);
+  }
+
+  return;
+}
+
+void
+rta_onset_set_callback(rta_onset_t * onset, void * receiver,
+                       rta_onset_callback_t callback)
+{
+  onset->receiver = receiver;
+  onset->callback = callback;
+
+  return;
+}
+
+void
+rta_onset_reset(rta_onset_t * onset)
+{
+  memset(onset->input, 0, onset->params.frame_size * sizeof(rta_real_t));
+  memset(onset->values[0], 0, onset->num_values * sizeof(rta_real_t));
+  memset(onset->values[1], 0, onset->num_values * sizeof(rta_real_t));
+  memset(onset->novelty, 0, onset->history_size * sizeof(rta_real_t));
+  onset->input_fill = 0;
+  onset->current = 0;
+  onset->num_frames = 0;
+  onset->last_onset = -1e30;
+
+  return;
+}
+
+int
+rta_onset_process(rta_onset_t * onset, const rta_real_t * input,
+                  const unsigned int input_size)
+{
+  const unsigned int frame_size = onset->params.frame_size;
+  const unsigned int hop_size = onset->params.hop_size;
+  unsigned int i = 0;
+  int found = 0;
+
+  while(i < input_size)
+  {
+    /* the hop is appended at the end of the frame */
+    unsigned int n = hop_size - onset->input_fill;
+
+    if(n > input_size - i)
+    {
+      n = input_size - i;
+    }
+
+    memcpy(onset->input + frame_size - hop_size + onset->input_fill,
+           input + i, n * sizeof(rta_real_t));
+    onset->input_fill += n;
+    i += n;
+
+    if(onset->input_fill == hop_size)
+    {
+      const rta_real_t novelty = analyse_frame(onset);
+
+      onset->novelty[onset->num_frames % onset->history_size] = novelty;
+      onset->num_frames++;
+      found += pick_peak(onset);
+
+      memmove(onset->input, onset->input + hop_size,
+              (frame_size - hop_size) * sizeof(rta_real_t));
+      onset->input_fill = 0;
+    }
+  }
+
+  return found;
+}
+
+double
+rta_onset_get_latency(const rta_onset_t * onset)
+{
+  return (onset->params.frame_size / 2
+          + (double) onset->params.lookahead * onset->params.hop_size)
+    / onset->params.sample_rate;
+}
+
+rta_real_t
+rta_onset_get_novelty(const rta_onset_t * onset)
+{
+  return (onset->num_frames > 0
+          ? onset->novelty[(onset->num_frames - 1) % onset->history_size]
+          : 0.0);
+}
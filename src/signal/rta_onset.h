@@ -0,0 +1,143 @@
+/**
+ * @file   rta_onset.h
+ * @ingroup rta_signal
+ *
+ * @brief  Streaming onset detection by spectral flux
+ *
+ * Audio blocks of any size are cut into Hann-windowed frames, whose
+ * amplitude spectra (rta_fft) are optionally integrated into mel bands
+ * (rta_bands) and log-compressed. The novelty of a frame is its
+ * spectral flux: the mean of the positive differences with the
+ * previous frame. A frame is an onset when its novelty is a local
+ * maximum that exceeds the median of the surrounding novelties plus a
+ * threshold. The decision waits for a fixed number of frames of
+ * look-ahead, which is the whole latency of the detector besides the
+ * half frame.
+ *
+ * All the memory is allocated by rta_onset_new: the processing does
+ * not allocate and may run in a real-time thread.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_ONSET_H_
+#define _RTA_ONSET_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** parameters of an onset detector */
+typedef struct rta_onset_params
+{
+  rta_real_t sample_rate;     /**< of the input, in Hz */
+  unsigned int frame_size;    /**< window and FFT size, a power of 2 */
+  unsigned int hop_size;      /**< samples between frames */
+  unsigned int num_bands;     /**< mel bands, or 0 for the FFT bins */
+  rta_real_t compression;     /**< novelty of log(1 + compression * x),
+                                 or 0 for the amplitudes */
+  unsigned int median_frames; /**< frames before the candidate in the median */
+  unsigned int lookahead;     /**< frames after the candidate, in the
+                                 median and the local maximum */
+  rta_real_t threshold;       /**< added to the median */
+  rta_real_t min_interval;    /**< minimum time between onsets, in seconds */
+} rta_onset_params_t;
+
+/** onset callback: 'time' is in seconds from the first input
+    sample, 'strength' is the novelty of the frame */
+typedef void (*rta_onset_callback_t) (void * receiver, double time,
+                                      rta_real_t strength);
+
+typedef struct rta_onset rta_onset_t;
+
+/**
+ * Default parameters for 'sample_rate': frames of 1024 samples at
+ * 44.1 kHz (scaled for other rates), hops of 1/4 frame, 40 bands,
+ * compression of 100, median over 8 frames, 2 frames of look-ahead,
+ * threshold of 0.15 and 30 ms between onsets.
+ */
+void rta_onset_params_default(rta_onset_params_t * params,
+                              const rta_real_t sample_rate);
+
+/**
+ * Allocate and initialise an onset detector
+ *
+ * @param onset is set to the new detector, or NULL on failure
+ * @param params are copied
+ *
+ * @return 1 on success, 0 on failure (invalid parameters or memory)
+ */
+int rta_onset_new(rta_onset_t ** onset, const rta_onset_params_t * params);
+
+/** free 'onset' */
+void rta_onset_delete(rta_onset_t * onset);
+
+/** set the function called for each onset, from rta_onset_process */
+void rta_onset_set_callback(rta_onset_t * onset, void * receiver,
+                            rta_onset_callback_t callback);
+
+/** clear the input and the novelty history, and restart the time */
+void rta_onset_reset(rta_onset_t * onset);
+
+/**
+ * Analyse a block of input samples
+ *
+ * @param onset detector
+ * @param input size is 'input_size'
+ * @param input_size can be anything, including 0
+ *
+ * @return the number of onsets found (and passed to the callback)
+ */
+int rta_onset_process(rta_onset_t * onset, const rta_real_t * input,
+                      const unsigned int input_size);
+
+/**
+ * Delay between the input of the centre of an onset frame and its
+ * report: the half frame plus the hops of look-ahead.
+ *
+ * @return latency in seconds
+ */
+double rta_onset_get_latency(const rta_onset_t * onset);
+
+/**
+ * Novelty of the last frame
+ *
+ * @return the spectral flux of the last analysed frame
+ */
+rta_real_t rta_onset_get_novelty(const rta_onset_t * onset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_ONSET_H_ */
@@ -0,0 +1,392 @@
+/**
+ * @file   rta_pcm.c
+ *
+ * @brief  Framing of integer PCM samples
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_pcm.h"
+#include "rta_cpu.h" /* rta_cpu_get_level */
+
+#include <stdint.h>
+#include <string.h> /* memcpy */
+
+/* ------- sample readers ------- */
+
+static const unsigned int sample_sizes[] = { 2, 3, 4 };
+
+/* full scales, as 1 / 2^(bits - 1) */
+static const double sample_scales[] =
+{
+  1. / 32768., 1. / 8388608., 1. / 2147483648.
+};
+
+static rta_real_t
+read_int16(const unsigned char * p)
+{
+  int16_t value;
+
+  memcpy(&value, p, sizeof(int16_t));
+  return (rta_real_t) value;
+}
+
+static rta_real_t
+read_int24(const unsigned char * p)
+{
+  return (rta_real_t)
+    ((int32_t) ((uint32_t) p[0] << 8 | (uint32_t) p[1] << 16 | (uint32_t) p[2] << 24) >> 8);
+}
+
+static rta_real_t
+read_int32(const unsigned char * p)
+{
+  int32_t value;
+
+  memcpy(&value, p, sizeof(int32_t));
+  return (rta_real_t) value;
+}
+
+/* ------- frame kernels, dispatched at run time ------- */
+
+/* 'stride' is in bytes, 'scale' includes the full scale; return the
+   last sample, before pre-emphasis */
+typedef rta_real_t (*frame_function_t) (rta_real_t * output,
+                                        const unsigned char * input,
+                                        const unsigned int stride,
+                                        const unsigned int size,
+                                        const rta_real_t scale,
+                                        rta_real_t previous,
+                                        const rta_real_t preemphasis,
+                                        const rta_real_t * weights);
+
+#define FRAME_LOOP(read)                                        \
+  do {                                                          \
+    unsigned int i;                                             \
+                                                                \
+    for(i=0; i<size; i++, input+=stride)                        \
+    {                                                           \
+      const rta_real_t x = read(input) * scale;                 \
+      const rta_real_t y = x - preemphasis * previous;          \
+                                                                \
+      output[i] = (weights != NULL ? y * weights[i] : y);       \
+      previous = x;                                             \
+    }                                                           \
+  } while(0)
+
+static rta_real_t
+frame_int16_generic(rta_real_t * output, const unsigned char * input,
+                    const unsigned int stride, const unsigned int size,
+                    const rta_real_t scale, rta_real_t previous,
+                    const rta_real_t preemphasis, const rta_real_t * weights)
+{
+  FRAME_LOOP(read_int16);
+  return previous;
+}
+
+static rta_real_t
+frame_int24_generic(rta_real_t * output, const unsigned char * input,
+                    const unsigned int stride, const unsigned int size,
+                    const rta_real_t scale, rta_real_t previous,
+                    const rta_real_t preemphasis, const rta_real_t * weights)
+{
+  FRAME_LOOP(read_int24);
+  return previous;
+}
+
+static rta_real_t
+frame_int32_generic(rta_real_t * output, const unsigned char * input,
+                    const unsigned int stride, const unsigned int size,
+                    const rta_real_t scale, rta_real_t previous,
+                    const rta_real_t preemphasis, const rta_real_t * weights)
+{
+  FRAME_LOOP(read_int32);
+  return previous;
+}
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE) && defined(RTA_CPU_X86)
+#include <immintrin.h>
+
+/* The vector kernels read contiguous samples only (a single channel).
+   They process the samples from 1 to 'end' - 1, reading each vector
+   at i and at i-1 for the pre-emphasis. The generic kernel computes
+   the first sample, and this the remaining ones. */
+static rta_real_t
+frame_tail(const frame_function_t generic,
+           rta_real_t (* read) (const unsigned char * p),
+           rta_real_t * output, const unsigned char * input,
+           const unsigned int stride, const unsigned int size,
+           const unsigned int end, const rta_real_t scale,
+           const rta_real_t preemphasis, const rta_real_t * weights)
+{
+  const rta_real_t previous = read(input + (end - 1) * stride) * scale;
+
+  if(end < size)
+  {
+    return generic(output + end, input + end * stride, stride, size - end,
+                   scale, previous, preemphasis,
+                   weights != NULL ? weights + end : NULL);
+  }
+
+  return previous;
+}
+
+RTA_CPU_TARGET("sse2") static __m128
+load_int16_sse2(const int16_t * p)
+{
+  const __m128i v = _mm_loadl_epi64((const __m128i *) p);
+
+  /* sign extension, without SSE4.1 */
+  return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+}
+
+RTA_CPU_TARGET("sse2") static __m128
+load_int32_sse2(const int32_t * p)
+{
+  return _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *) p));
+}
+
+RTA_CPU_TARGET("avx2") static __m256
+load_int16_avx2(const int16_t * p)
+{
+  return _mm256_cvtepi32_ps(
+    _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) p)));
+}
+
+RTA_CPU_TARGET("avx2") static __m256
+load_int32_avx2(const int32_t * p)
+{
+  return _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *) p));
+}
+
+RTA_CPU_TARGET("sse2") static rta_real_t
+frame_int16_sse2(rta_real_t * output, const unsigned char * input,
+                 const unsigned int stride, const unsigned int size,
+                 const rta_real_t scale, rta_real_t previous,
+                 const rta_real_t preemphasis, const rta_real_t * weights)
+{
+  const int16_t * in = (const int16_t *) input;
+  const __m128 s = _mm_set1_ps(scale);
+  const __m128 p = _mm_set1_ps(preemphasis);
+  unsigned int i;
+
+  if(stride != sizeof(int16_t) || size <= 4)
+  {
+    return frame_int16_generic(output, input, stride, size, scale,
+                               previous, preemphasis, weights);
+  }
+
+  frame_int16_generic(output, input, stride, 1, scale, previous,
+                      preemphasis, weights);
+
+  for(i=1; i+4<=size; i+=4)
+  {
+    const __m128 x = _mm_mul_ps(load_int16_sse2(in + i), s);
+    const __m128 xm1 = _mm_mul_ps(load_int16_sse2(in + i - 1), s);
+    __m128 y = _mm_sub_ps(x, _mm_mul_ps(p, xm1));
+
+    if(weights != NULL)
+    {
+      y = _mm_mul_ps(y, _mm_loadu_ps(weights + i));
+    }
+    _mm_storeu_ps(output + i, y);
+  }
+
+  return frame_tail(frame_int16_generic, read_int16, output, input, stride,
+                    size, i, scale, preemphasis, weights);
+}
+
+RTA_CPU_TARGET("sse2") static rta_real_t
+frame_int32_sse2(rta_real_t * output, const unsigned char * input,
+                 const unsigned int stride, const unsigned int size,
+                 const rta_real_t scale, rta_real_t previous,
+                 const rta_real_t preemphasis, const rta_real_t * weights)
+{
+  const int32_t * in = (const int32_t *) input;
+  const __m128 s = _mm_set1_ps(scale);
+  const __m128 p = _mm_set1_ps(preemphasis);
+  unsigned int i;
+
+  if(stride != sizeof(int32_t) || size <= 4)
+  {
+    return frame_int32_generic(output, input, stride, size, scale,
+                               previous, preemphasis, weights);
+  }
+
+  frame_int32_generic(output, input, stride, 1, scale, previous,
+                      preemphasis, weights);
+
+  for(i=1; i+4<=size; i+=4)
+  {
+    const __m128 x = _mm_mul_ps(load_int32_sse2(in + i), s);
+    const __m128 xm1 = _mm_mul_ps(load_int32_sse2(in + i - 1), s);
+    __m128 y = _mm_sub_ps(x, _mm_mul_ps(p, xm1));
+
+    if(weights != NULL)
+    {
+      y = _mm_mul_ps(y, _mm_loadu_ps(weights + i));
+    }
+    _mm_storeu_ps(output + i, y);
+  }
+
+  return frame_tail(frame_int32_generic, read_int32, output, input, stride,
+                    size, i, scale, preemphasis, weights);
+}
+
+RTA_CPU_TARGET("avx2") static rta_real_t
+frame_int16_avx2(rta_real_t * output, const unsigned char * input,
+                 const unsigned int stride, const unsigned int size,
+                 const rta_real_t scale, rta_real_t previous,
+                 const rta_real_t preemphasis, const rta_real_t * weights)
+{
+  const int16_t * in = (const int16_t *) input;
+  const __m256 s = _mm256_set1_ps(scale);
+  const __m256 p = _mm256_set1_ps(preemphasis);
+  unsigned int i;
+
+  if(stride != sizeof(int16_t) || size <= 8)
+  {
+    return frame_int16_generic(output, input, stride, size, scale,
+                               previous, preemphasis, weights);
+  }
+
+  frame_int16_generic(output, input, stride, 1, scale, previous,
+                      preemphasis, weights);
+
+  for(i=1; i+8<=size; i+=8)
+  {
+    const __m256 x = _mm256_mul_ps(load_int16_avx2(in + i), s);
+    const __m256 xm1 = _mm256_mul_ps(load_int16_avx2(in + i - 1), s);
+    __m256 y = _mm256_sub_ps(x, _mm256_mul_ps(p, xm1));
+
+    if(weights != NULL)
+    {
+      y = _mm256_mul_ps(y, _mm256_loadu_ps(weights + i));
+    }
+    _mm256_storeu_ps(output + i, y);
+  }
+
+  return frame_tail(frame_int16_generic, read_int16, output, input, stride,
+                    size, i, scale, preemphasis, weights);
+}
+
+RTA_CPU_TARGET("avx2") static rta_real_t
+frame_int32_avx2(rta_real_t * output, const unsigned char * input,
+                 const unsigned int stride, const unsigned int size,
+                 const rta_real_t scale, rta_real_t previous,
+                 const rta_real_t preemphasis, const rta_real_t * weights)
+{
+  const int32_t * in = (const int32_t *) input;
+  const __m256 s = _mm256_set1_ps(scale);
+  const __m256 p = _mm256_set1_ps(preemphasis);
+  unsigned int i;
+
+  if(stride != sizeof(int32_t) || size <= 8)
+  {
+    return frame_int32_generic(output, input, stride, size, scale,
+                               previous, preemphasis, weights);
+  }
+
+  frame_int32_generic(output, input, stride, 1, scale, previous,
+                      preemphasis, weights);
+
+  for(i=1; i+8<=size; i+=8)
+  {
+    const __m256 x = _mm256_mul_ps(load_int32_avx2(in + i), s);
+    const __m256 xm1 = _mm256_mul_ps(load_int32_avx2(in + i - 1), s);
+    __m256 y = _mm256_sub_ps(x, _mm256_mul_ps(p, xm1));
+
+    if(weights != NULL)
+    {
+      y = _mm256_mul_ps(y, _mm256_loadu_ps(weights + i));
+    }
+    _mm256_storeu_ps(output + i, y);
+  }
+
+  return frame_tail(frame_int32_generic, read_int32, output, input, stride,
+                    size, i, scale, preemphasis, weights);
+}
+
+/* packed 24-bit samples stay generic */
+#define HAVE_FRAME_KERNELS 1
+static const frame_function_t frame_kernels[3][rta_cpu_num_levels] =
+{
+  { frame_int16_generic, frame_int16_sse2, frame_int16_avx2,
+    frame_int16_avx2, frame_int16_generic },
+  { frame_int24_generic, frame_int24_generic, frame_int24_generic,
+    frame_int24_generic, frame_int24_generic },
+  { frame_int32_generic, frame_int32_sse2, frame_int32_avx2,
+    frame_int32_avx2, frame_int32_generic }
+};
+
+#endif /* float on x86 */
+
+/* best frame kernel of format for the current dispatch level */
+static frame_function_t
+get_frame(const rta_pcm_format_t format)
+{
+#if defined(HAVE_FRAME_KERNELS)
+  return frame_kernels[format][rta_cpu_get_level()];
+#else
+  static const frame_function_t generic[3] =
+  {
+    frame_int16_generic, frame_int24_generic, frame_int32_generic
+  };
+
+  return generic[format];
+#endif
+}
+
+/* ------- end of kernels ------- */
+
+unsigned int
+rta_pcm_sample_size(const rta_pcm_format_t format)
+{
+  return sample_sizes[format];
+}
+
+void
+rta_pcm_frame(rta_real_t * output,
+              const void * input, const rta_pcm_format_t format,
+              const unsigned int channels, const unsigned int channel,
+              const unsigned int output_size, const rta_real_t gain,
+              rta_real_t * previous_sample, const rta_real_t preemphasis,
+              const rta_real_t * weights)
+{
+  const unsigned int sample_size = sample_sizes[format];
+
+  *previous_sample = get_frame(format)(
+    output, (const unsigned char *) input + channel * sample_size,
+    channels * sample_size, output_size, gain * sample_scales[format],
+    *previous_sample, preemphasis, weights);
+
+  return;
+}
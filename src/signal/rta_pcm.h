@@ -0,0 +1,103 @@
+/**
+ * @file   rta_pcm.h
+ * @ingroup rta_signal
+ *
+ * @brief  Framing of integer PCM samples
+ *
+ * Read a frame of one channel of interleaved integer samples and
+ * write it ready for the FFT: the conversion to rta_real_t, the gain,
+ * the pre-emphasis and the window are applied in a single pass,
+ * without any intermediate buffer. This is equivalent to the
+ * conversion followed by rta_preemphasis_signal and
+ * rta_window_apply.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_PCM_H_
+#define _RTA_PCM_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** integer sample formats */
+typedef enum
+{
+  rta_pcm_int16 = 0, /**< 16 bits, native byte order */
+  rta_pcm_int24 = 1, /**< 24 bits packed in 3 bytes, little endian (WAV) */
+  rta_pcm_int32 = 2  /**< 32 bits, native byte order */
+} rta_pcm_format_t;
+
+/**
+ * Size of a sample of 'format'
+ *
+ * @return number of bytes
+ */
+unsigned int rta_pcm_sample_size(const rta_pcm_format_t format);
+
+/**
+ * Read a frame of integer samples into 'output', as
+ *  x[i] = 'gain' * 'input'[i * 'channels' + 'channel'] / full scale
+ *  'output'[i] = 'weights'[i] * (x[i] - 'preemphasis' * x[i-1])
+ * where x[-1] is (*'previous_sample') and full scale is 2^15, 2^23
+ * or 2^31 depending on 'format', so that x is in [-'gain', 'gain'[.
+ *
+ * The kernels of single channel frames use the instruction set
+ * selected by rta_cpu_get_level().
+ *
+ * @param output size is 'output_size'
+ * @param input is the first frame of samples (as many as 'channels')
+ * @param format of the samples of 'input'
+ * @param channels is the number of interleaved channels of 'input'
+ * @param channel to read, in [0, 'channels' - 1]
+ * @param output_size is the number of frames to read and must be > 0
+ * @param gain applied to the samples
+ * @param previous_sample is the sample before the first one, after
+ * 'gain', and is updated as (*'previous_sample') = x['output_size'-1]
+ * @param preemphasis factor, generally 0.97 for voice analysis, or 0
+ * @param weights size is 'output_size', or NULL for no window
+ * \see rta_window_hann_weights
+ */
+void rta_pcm_frame(rta_real_t * output,
+                   const void * input, const rta_pcm_format_t format,
+                   const unsigned int channels, const unsigned int channel,
+                   const unsigned int output_size, const rta_real_t gain,
+                   rta_real_t * previous_sample, const rta_real_t preemphasis,
+                   const rta_real_t * weights);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_PCM_H_ */
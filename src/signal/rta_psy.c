@@ -41,6 +41,7 @@
 #include <float.h>
 
 #include "rta_psy.h"
+#include "rta_trace.h" /* RTA_TRACE_BEGIN, RTA_TRACE_END */
 
 #if defined(__APPLE__) && defined(__MACH__) && \
 (RTA_REAL_TYPE == RTA_FLOAT_TYPE || RTA_REAL_TYPE == RTA_DOUBLE_TYPE)
@@ -510,6 +511,9 @@ rta_psy_calculate_input_vector(rta_psy_ana_t *self, float *in, int vectorSize, i
   double outputTime = self->outputTime;
   int maxTime;
   int i, j;
+  RTA_TRACE_BEGIN(rta_trace_psy);
+
+  RTA_TRACE_COUNT(rta_trace_psy, vectorSize);
 
   if(downVectorSize > 0)
   {
@@ -571,7 +575,10 @@ rta_psy_calculate_input_vector(rta_psy_ana_t *self, float *in, int vectorSize, i
     self->trackingIndex = (self->trackingIndex + 1) % RTA_PSY_NUM_TRACKING_STATES;
 
     if(reportState(self, self->trackingStates, self->trackingIndex) == 0)
+    {
+      RTA_TRACE_END(rta_trace_psy);
       return 0;
+    }
 
     /* advance time */
     outputTime += period;
@@ -592,5 +599,6 @@ rta_psy_calculate_input_vector(rta_psy_ana_t *self, float *in, int vectorSize, i
 
   self->outputTime = outputTime;
 
+  RTA_TRACE_END(rta_trace_psy);
   return vectorSize;
 }
@@ -39,9 +39,12 @@
 #ifndef _RTA_PSY_H_
 #define _RTA_PSY_H_ 1
 
-#define rta_psy_malloc malloc
-#define rta_psy_realloc realloc
-#define rta_psy_free free
+#include "rta.h"
+#include "rta_stdlib.h"
+
+#define rta_psy_malloc rta_malloc
+#define rta_psy_realloc rta_realloc
+#define rta_psy_free rta_free
 
 #define RTA_PSY_MAX_DOWN_SAMPLING_EXP 3
 #define RTA_PSY_MAX_DOWN_SAMPLING (1 << RTA_PSY_MAX_DOWN_SAMPLING_EXP)
@@ -282,8 +282,6 @@ int rta_resample_cubic (rta_real_t * out_values,
 {
   int retValue = 0;
 
-  rta_cubic_table_init(); // conditional initialization
-  
   if (factor == 1.0)
   { /* copy through */
     memcpy(out_values, in_values, i_size * i_channels * sizeof(rta_real_t));
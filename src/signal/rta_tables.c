@@ -0,0 +1,4747 @@
+/**
+ * @file   rta_tables.c
+ * @ingroup rta_signal
+ *
+ * @brief  Read-only sine and bit-reversal tables for common FFT sizes
+ *
+ * Generated by rta_tables.py 4 12, do not edit.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause), see rta_tables.h
+ */
+
+#include "rta_tables.h"
+
+#if RTA_TABLES_MIN_LOG2 != 4 || RTA_TABLES_MAX_LOG2 != 12
+#error "rta_tables.c does not match rta_tables.h: run rta_tables.py"
+#endif
+
+static const rta_tables_real_t sin_16[21] =
+{
+  0.0, 0.3826834323650898, 0.7071067811865475, 0.9238795325112867,
+  1.0, 0.9238795325112867, 0.7071067811865475, 0.3826834323650898,
+  0.0, -0.3826834323650898, -0.7071067811865475, -0.9238795325112867,
+  -1.0, -0.9238795325112867, -0.7071067811865475, -0.3826834323650898,
+  0.0, 0.3826834323650898, 0.7071067811865475, 0.9238795325112867,
+  1.0,
+};
+
+static const unsigned int bitrev_16[16] =
+{
+  0, 8, 4, 12,
+  2, 10, 6, 14,
+  1, 9, 5, 13,
+  3, 11, 7, 15,
+};
+
+static const rta_tables_real_t sin_32[41] =
+{
+  0.0, 0.19509032201612825, 0.3826834323650898, 0.5555702330196022,
+  0.7071067811865475, 0.8314696123025452, 0.9238795325112867, 0.9807852804032304,
+  1.0, 0.9807852804032304, 0.9238795325112867, 0.8314696123025452,
+  0.7071067811865475, 0.5555702330196022, 0.3826834323650898, 0.19509032201612825,
+  0.0, -0.19509032201612825, -0.3826834323650898, -0.5555702330196022,
+  -0.7071067811865475, -0.8314696123025452, -0.9238795325112867, -0.9807852804032304,
+  -1.0, -0.9807852804032304, -0.9238795325112867, -0.8314696123025452,
+  -0.7071067811865475, -0.5555702330196022, -0.3826834323650898, -0.19509032201612825,
+  0.0, 0.19509032201612825, 0.3826834323650898, 0.5555702330196022,
+  0.7071067811865475, 0.8314696123025452, 0.9238795325112867, 0.9807852804032304,
+  1.0,
+};
+
+static const unsigned int bitrev_32[32] =
+{
+  0, 16, 8, 24,
+  4, 20, 12, 28,
+  2, 18, 10, 26,
+  6, 22, 14, 30,
+  1, 17, 9, 25,
+  5, 21, 13, 29,
+  3, 19, 11, 27,
+  7, 23, 15, 31,
+};
+
+static const rta_tables_real_t sin_64[81] =
+{
+  0.0, 0.0980171403295606, 0.19509032201612825, 0.29028467725446233,
+  0.3826834323650898, 0.47139673682599764, 0.5555702330196022, 0.6343932841636455,
+  0.7071067811865475, 0.773010453362737, 0.8314696123025452, 0.881921264348355,
+  0.9238795325112867, 0.9569403357322088, 0.9807852804032304, 0.9951847266721969,
+  1.0, 0.9951847266721969, 0.9807852804032304, 0.9569403357322088,
+  0.9238795325112867, 0.881921264348355, 0.8314696123025452, 0.773010453362737,
+  0.7071067811865475, 0.6343932841636455, 0.5555702330196022, 0.47139673682599764,
+  0.3826834323650898, 0.29028467725446233, 0.19509032201612825, 0.0980171403295606,
+  0.0, -0.0980171403295606, -0.19509032201612825, -0.29028467725446233,
+  -0.3826834323650898, -0.47139673682599764, -0.5555702330196022, -0.6343932841636455,
+  -0.7071067811865475, -0.773010453362737, -0.8314696123025452, -0.881921264348355,
+  -0.9238795325112867, -0.9569403357322088, -0.9807852804032304, -0.9951847266721969,
+  -1.0, -0.9951847266721969, -0.9807852804032304, -0.9569403357322088,
+  -0.9238795325112867, -0.881921264348355, -0.8314696123025452, -0.773010453362737,
+  -0.7071067811865475, -0.6343932841636455, -0.5555702330196022, -0.47139673682599764,
+  -0.3826834323650898, -0.29028467725446233, -0.19509032201612825, -0.0980171403295606,
+  0.0, 0.0980171403295606, 0.19509032201612825, 0.29028467725446233,
+  0.3826834323650898, 0.47139673682599764, 0.5555702330196022, 0.6343932841636455,
+  0.7071067811865475, 0.773010453362737, 0.8314696123025452, 0.881921264348355,
+  0.9238795325112867, 0.9569403357322088, 0.9807852804032304, 0.9951847266721969,
+  1.0,
+};
+
+static const unsigned int bitrev_64[64] =
+{
+  0, 32, 16, 48,
+  8, 40, 24, 56,
+  4, 36, 20, 52,
+  12, 44, 28, 60,
+  2, 34, 18, 50,
+  10, 42, 26, 58,
+  6, 38, 22, 54,
+  14, 46, 30, 62,
+  1, 33, 17, 49,
+  9, 41, 25, 57,
+  5, 37, 21, 53,
+  13, 45, 29, 61,
+  3, 35, 19, 51,
+  11, 43, 27, 59,
+  7, 39, 23, 55,
+  15, 47, 31, 63,
+};
+
+static const rta_tables_real_t sin_128[161] =
+{
+  0.0, 0.049067674327418015, 0.0980171403295606, 0.14673047445536175,
+  0.19509032201612825, 0.24298017990326387, 0.29028467725446233, 0.33688985339222005,
+  0.3826834323650898, 0.4275550934302821, 0.47139673682599764, 0.5141027441932217,
+  0.5555702330196022, 0.5956993044924334, 0.6343932841636455, 0.6715589548470183,
+  0.7071067811865475, 0.7409511253549591, 0.773010453362737, 0.8032075314806449,
+  0.8314696123025452, 0.8577286100002721, 0.881921264348355, 0.9039892931234433,
+  0.9238795325112867, 0.9415440651830208, 0.9569403357322088, 0.970031253194544,
+  0.9807852804032304, 0.989176509964781, 0.9951847266721969, 0.9987954562051724,
+  1.0, 0.9987954562051724, 0.9951847266721969, 0.989176509964781,
+  0.9807852804032304, 0.970031253194544, 0.9569403357322088, 0.9415440651830208,
+  0.9238795325112867, 0.9039892931234433, 0.881921264348355, 0.8577286100002721,
+  0.8314696123025452, 0.8032075314806449, 0.773010453362737, 0.7409511253549591,
+  0.7071067811865475, 0.6715589548470183, 0.6343932841636455, 0.5956993044924334,
+  0.5555702330196022, 0.5141027441932217, 0.47139673682599764, 0.4275550934302821,
+  0.3826834323650898, 0.33688985339222005, 0.29028467725446233, 0.24298017990326387,
+  0.19509032201612825, 0.14673047445536175, 0.0980171403295606, 0.049067674327418015,
+  0.0, -0.049067674327418015, -0.0980171403295606, -0.14673047445536175,
+  -0.19509032201612825, -0.24298017990326387, -0.29028467725446233, -0.33688985339222005,
+  -0.3826834323650898, -0.4275550934302821, -0.47139673682599764, -0.5141027441932217,
+  -0.5555702330196022, -0.5956993044924334, -0.6343932841636455, -0.6715589548470183,
+  -0.7071067811865475, -0.7409511253549591, -0.773010453362737, -0.8032075314806449,
+  -0.8314696123025452, -0.8577286100002721, -0.881921264348355, -0.9039892931234433,
+  -0.9238795325112867, -0.9415440651830208, -0.9569403357322088, -0.970031253194544,
+  -0.9807852804032304, -0.989176509964781, -0.9951847266721969, -0.9987954562051724,
+  -1.0, -0.9987954562051724, -0.9951847266721969, -0.989176509964781,
+  -0.9807852804032304, -0.970031253194544, -0.9569403357322088, -0.9415440651830208,
+  -0.9238795325112867, -0.9039892931234433, -0.881921264348355, -0.8577286100002721,
+  -0.8314696123025452, -0.8032075314806449, -0.773010453362737, -0.7409511253549591,
+  -0.7071067811865475, -0.6715589548470183, -0.6343932841636455, -0.5956993044924334,
+  -0.5555702330196022, -0.5141027441932217, -0.47139673682599764, -0.4275550934302821,
+  -0.3826834323650898, -0.33688985339222005, -0.29028467725446233, -0.24298017990326387,
+  -0.19509032201612825, -0.14673047445536175, -0.0980171403295606, -0.049067674327418015,
+  0.0, 0.049067674327418015, 0.0980171403295606, 0.14673047445536175,
+  0.19509032201612825, 0.24298017990326387, 0.29028467725446233, 0.33688985339222005,
+  0.3826834323650898, 0.4275550934302821, 0.47139673682599764, 0.5141027441932217,
+  0.5555702330196022, 0.5956993044924334, 0.6343932841636455, 0.6715589548470183,
+  0.7071067811865475, 0.7409511253549591, 0.773010453362737, 0.8032075314806449,
+  0.8314696123025452, 0.8577286100002721, 0.881921264348355, 0.9039892931234433,
+  0.9238795325112867, 0.9415440651830208, 0.9569403357322088, 0.970031253194544,
+  0.9807852804032304, 0.989176509964781, 0.9951847266721969, 0.9987954562051724,
+  1.0,
+};
+
+static const unsigned int bitrev_128[128] =
+{
+  0, 64, 32, 96,
+  16, 80, 48, 112,
+  8, 72, 40, 104,
+  24, 88, 56, 120,
+  4, 68, 36, 100,
+  20, 84, 52, 116,
+  12, 76, 44, 108,
+  28, 92, 60, 124,
+  2, 66, 34, 98,
+  18, 82, 50, 114,
+  10, 74, 42, 106,
+  26, 90, 58, 122,
+  6, 70, 38, 102,
+  22, 86, 54, 118,
+  14, 78, 46, 110,
+  30, 94, 62, 126,
+  1, 65, 33, 97,
+  17, 81, 49, 113,
+  9, 73, 41, 105,
+  25, 89, 57, 121,
+  5, 69, 37, 101,
+  21, 85, 53, 117,
+  13, 77, 45, 109,
+  29, 93, 61, 125,
+  3, 67, 35, 99,
+  19, 83, 51, 115,
+  11, 75, 43, 107,
+  27, 91, 59, 123,
+  7, 71, 39, 103,
+  23, 87, 55, 119,
+  15, 79, 47, 111,
+  31, 95, 63, 127,
+};
+
+static const rta_tables_real_t sin_256[321] =
+{
+  0.0, 0.024541228522912288, 0.049067674327418015, 0.07356456359966743,
+  0.0980171403295606, 0.1224106751992162, 0.14673047445536175, 0.17096188876030122,
+  0.19509032201612825, 0.2191012401568698, 0.24298017990326387, 0.26671275747489837,
+  0.29028467725446233, 0.3136817403988915, 0.33688985339222005, 0.3598950365349881,
+  0.3826834323650898, 0.40524131400498986, 0.4275550934302821, 0.44961132965460654,
+  0.47139673682599764, 0.49289819222978404, 0.5141027441932217, 0.5349976198870972,
+  0.5555702330196022, 0.5758081914178453, 0.5956993044924334, 0.6152315905806268,
+  0.6343932841636455, 0.6531728429537768, 0.6715589548470183, 0.6895405447370668,
+  0.7071067811865475, 0.724247082951467, 0.7409511253549591, 0.7572088465064846,
+  0.773010453362737, 0.7883464276266063, 0.8032075314806449, 0.8175848131515837,
+  0.8314696123025452, 0.8448535652497071, 0.8577286100002721, 0.8700869911087115,
+  0.881921264348355, 0.8932243011955153, 0.9039892931234433, 0.9142097557035307,
+  0.9238795325112867, 0.932992798834739, 0.9415440651830208, 0.9495281805930367,
+  0.9569403357322088, 0.9637760657954398, 0.970031253194544, 0.9757021300385286,
+  0.9807852804032304, 0.9852776423889412, 0.989176509964781, 0.99247953459871,
+  0.9951847266721969, 0.9972904566786902, 0.9987954562051724, 0.9996988186962042,
+  1.0, 0.9996988186962042, 0.9987954562051724, 0.9972904566786902,
+  0.9951847266721969, 0.99247953459871, 0.989176509964781, 0.9852776423889412,
+  0.9807852804032304, 0.9757021300385286, 0.970031253194544, 0.9637760657954398,
+  0.9569403357322088, 0.9495281805930367, 0.9415440651830208, 0.932992798834739,
+  0.9238795325112867, 0.9142097557035307, 0.9039892931234433, 0.8932243011955153,
+  0.881921264348355, 0.8700869911087115, 0.8577286100002721, 0.8448535652497071,
+  0.8314696123025452, 0.8175848131515837, 0.8032075314806449, 0.7883464276266063,
+  0.773010453362737, 0.7572088465064846, 0.7409511253549591, 0.724247082951467,
+  0.7071067811865475, 0.6895405447370668, 0.6715589548470183, 0.6531728429537768,
+  0.6343932841636455, 0.6152315905806268, 0.5956993044924334, 0.5758081914178453,
+  0.5555702330196022, 0.5349976198870972, 0.5141027441932217, 0.49289819222978404,
+  0.47139673682599764, 0.44961132965460654, 0.4275550934302821, 0.40524131400498986,
+  0.3826834323650898, 0.3598950365349881, 0.33688985339222005, 0.3136817403988915,
+  0.29028467725446233, 0.26671275747489837, 0.24298017990326387, 0.2191012401568698,
+  0.19509032201612825, 0.17096188876030122, 0.14673047445536175, 0.1224106751992162,
+  0.0980171403295606, 0.07356456359966743, 0.049067674327418015, 0.024541228522912288,
+  0.0, -0.024541228522912288, -0.049067674327418015, -0.07356456359966743,
+  -0.0980171403295606, -0.1224106751992162, -0.14673047445536175, -0.17096188876030122,
+  -0.19509032201612825, -0.2191012401568698, -0.24298017990326387, -0.26671275747489837,
+  -0.29028467725446233, -0.3136817403988915, -0.33688985339222005, -0.3598950365349881,
+  -0.3826834323650898, -0.40524131400498986, -0.4275550934302821, -0.44961132965460654,
+  -0.47139673682599764, -0.49289819222978404, -0.5141027441932217, -0.5349976198870972,
+  -0.5555702330196022, -0.5758081914178453, -0.5956993044924334, -0.6152315905806268,
+  -0.6343932841636455, -0.6531728429537768, -0.6715589548470183, -0.6895405447370668,
+  -0.7071067811865475, -0.724247082951467, -0.7409511253549591, -0.7572088465064846,
+  -0.773010453362737, -0.7883464276266063, -0.8032075314806449, -0.8175848131515837,
+  -0.8314696123025452, -0.8448535652497071, -0.8577286100002721, -0.8700869911087115,
+  -0.881921264348355, -0.8932243011955153, -0.9039892931234433, -0.9142097557035307,
+  -0.9238795325112867, -0.932992798834739, -0.9415440651830208, -0.9495281805930367,
+  -0.9569403357322088, -0.9637760657954398, -0.970031253194544, -0.9757021300385286,
+  -0.9807852804032304, -0.9852776423889412, -0.989176509964781, -0.99247953459871,
+  -0.9951847266721969, -0.9972904566786902, -0.9987954562051724, -0.9996988186962042,
+  -1.0, -0.9996988186962042, -0.9987954562051724, -0.9972904566786902,
+  -0.9951847266721969, -0.99247953459871, -0.989176509964781, -0.9852776423889412,
+  -0.9807852804032304, -0.9757021300385286, -0.970031253194544, -0.9637760657954398,
+  -0.9569403357322088, -0.9495281805930367, -0.9415440651830208, -0.932992798834739,
+  -0.9238795325112867, -0.9142097557035307, -0.9039892931234433, -0.8932243011955153,
+  -0.881921264348355, -0.8700869911087115, -0.8577286100002721, -0.8448535652497071,
+  -0.8314696123025452, -0.8175848131515837, -0.8032075314806449, -0.7883464276266063,
+  -0.773010453362737, -0.7572088465064846, -0.7409511253549591, -0.724247082951467,
+  -0.7071067811865475, -0.6895405447370668, -0.6715589548470183, -0.6531728429537768,
+  -0.6343932841636455, -0.6152315905806268, -0.5956993044924334, -0.5758081914178453,
+  -0.5555702330196022, -0.5349976198870972, -0.5141027441932217, -0.49289819222978404,
+  -0.47139673682599764, -0.44961132965460654, -0.4275550934302821, -0.40524131400498986,
+  -0.3826834323650898, -0.3598950365349881, -0.33688985339222005, -0.3136817403988915,
+  -0.29028467725446233, -0.26671275747489837, -0.24298017990326387, -0.2191012401568698,
+  -0.19509032201612825, -0.17096188876030122, -0.14673047445536175, -0.1224106751992162,
+  -0.0980171403295606, -0.07356456359966743, -0.049067674327418015, -0.024541228522912288,
+  0.0, 0.024541228522912288, 0.049067674327418015, 0.07356456359966743,
+  0.0980171403295606, 0.1224106751992162, 0.14673047445536175, 0.17096188876030122,
+  0.19509032201612825, 0.2191012401568698, 0.24298017990326387, 0.26671275747489837,
+  0.29028467725446233, 0.3136817403988915, 0.33688985339222005, 0.3598950365349881,
+  0.3826834323650898, 0.40524131400498986, 0.4275550934302821, 0.44961132965460654,
+  0.47139673682599764, 0.49289819222978404, 0.5141027441932217, 0.5349976198870972,
+  0.5555702330196022, 0.5758081914178453, 0.5956993044924334, 0.6152315905806268,
+  0.6343932841636455, 0.6531728429537768, 0.6715589548470183, 0.6895405447370668,
+  0.7071067811865475, 0.724247082951467, 0.7409511253549591, 0.7572088465064846,
+  0.773010453362737, 0.7883464276266063, 0.8032075314806449, 0.8175848131515837,
+  0.8314696123025452, 0.8448535652497071, 0.8577286100002721, 0.8700869911087115,
+  0.881921264348355, 0.8932243011955153, 0.9039892931234433, 0.9142097557035307,
+  0.9238795325112867, 0.932992798834739, 0.9415440651830208, 0.9495281805930367,
+  0.9569403357322088, 0.9637760657954398, 0.970031253194544, 0.9757021300385286,
+  0.9807852804032304, 0.9852776423889412, 0.989176509964781, 0.99247953459871,
+  0.9951847266721969, 0.9972904566786902, 0.9987954562051724, 0.9996988186962042,
+  1.0,
+};
+
+static const unsigned int bitrev_256[256] =
+{
+  0, 128, 64, 192,
+  32, 160, 96, 224,
+  16, 144, 80, 208,
+  48, 176, 112, 240,
+  8, 136, 72, 200,
+  40, 168, 104, 232,
+  24, 152, 88, 216,
+  56, 184, 120, 248,
+  4, 132, 68, 196,
+  36, 164, 100, 228,
+  20, 148, 84, 212,
+  52, 180, 116, 244,
+  12, 140, 76, 204,
+  44, 172, 108, 236,
+  28, 156, 92, 220,
+  60, 188, 124, 252,
+  2, 130, 66, 194,
+  34, 162, 98, 226,
+  18, 146, 82, 210,
+  50, 178, 114, 242,
+  10, 138, 74, 202,
+  42, 170, 106, 234,
+  26, 154, 90, 218,
+  58, 186, 122, 250,
+  6, 134, 70, 198,
+  38, 166, 102, 230,
+  22, 150, 86, 214,
+  54, 182, 118, 246,
+  14, 142, 78, 206,
+  46, 174, 110, 238,
+  30, 158, 94, 222,
+  62, 190, 126, 254,
+  1, 129, 65, 193,
+  33, 161, 97, 225,
+  17, 145, 81, 209,
+  49, 177, 113, 241,
+  9, 137, 73, 201,
+  41, 169, 105, 233,
+  25, 153, 89, 217,
+  57, 185, 121, 249,
+  5, 133, 69, 197,
+  37, 165, 101, 229,
+  21, 149, 85, 213,
+  53, 181, 117, 245,
+  13, 141, 77, 205,
+  45, 173, 109, 237,
+  29, 157, 93, 221,
+  61, 189, 125, 253,
+  3, 131, 67, 195,
+  35, 163, 99, 227,
+  19, 147, 83, 211,
+  51, 179, 115, 243,
+  11, 139, 75, 203,
+  43, 171, 107, 235,
+  27, 155, 91, 219,
+  59, 187, 123, 251,
+  7, 135, 71, 199,
+  39, 167, 103, 231,
+  23, 151, 87, 215,
+  55, 183, 119, 247,
+  15, 143, 79, 207,
+  47, 175, 111, 239,
+  31, 159, 95, 223,
+  63, 191, 127, 255,
+};
+
+static const rta_tables_real_t sin_512[641] =
+{
+  0.0, 0.012271538285719925, 0.024541228522912288, 0.03680722294135883,
+  0.049067674327418015, 0.06132073630220858, 0.07356456359966743, 0.0857973123444399,
+  0.0980171403295606, 0.11022220729388306, 0.1224106751992162, 0.13458070850712617,
+  0.14673047445536175, 0.15885814333386145, 0.17096188876030122, 0.18303988795514095,
+  0.19509032201612825, 0.20711137619221856, 0.2191012401568698, 0.2310581082806711,
+  0.24298017990326387, 0.25486565960451457, 0.26671275747489837, 0.27851968938505306,
+  0.29028467725446233, 0.3020059493192281, 0.3136817403988915, 0.3253102921622629,
+  0.33688985339222005, 0.34841868024943456, 0.3598950365349881, 0.37131719395183754,
+  0.3826834323650898, 0.3939920400610481, 0.40524131400498986, 0.41642956009763715,
+  0.4275550934302821, 0.43861623853852766, 0.44961132965460654, 0.46053871095824,
+  0.47139673682599764, 0.4821837720791227, 0.49289819222978404, 0.5035383837257176,
+  0.5141027441932217, 0.524589682678469, 0.5349976198870972, 0.5453249884220465,
+  0.5555702330196022, 0.5657318107836131, 0.5758081914178453, 0.5857978574564389,
+  0.5956993044924334, 0.6055110414043255, 0.6152315905806268, 0.6248594881423863,
+  0.6343932841636455, 0.6438315428897914, 0.6531728429537768, 0.6624157775901718,
+  0.6715589548470183, 0.680600997795453, 0.6895405447370668, 0.6983762494089729,
+  0.7071067811865475, 0.7157308252838186, 0.724247082951467, 0.7326542716724128,
+  0.7409511253549591, 0.7491363945234594, 0.7572088465064846, 0.765167265622459,
+  0.773010453362737, 0.7807372285720945, 0.7883464276266063, 0.7958369046088836,
+  0.8032075314806449, 0.8104571982525948, 0.8175848131515837, 0.8245893027850253,
+  0.8314696123025452, 0.8382247055548381, 0.8448535652497071, 0.8513551931052652,
+  0.8577286100002721, 0.8639728561215868, 0.8700869911087115, 0.8760700941954066,
+  0.881921264348355, 0.8876396204028539, 0.8932243011955153, 0.8986744656939538,
+  0.9039892931234433, 0.9091679830905224, 0.9142097557035307, 0.9191138516900578,
+  0.9238795325112867, 0.9285060804732156, 0.932992798834739, 0.937339011912575,
+  0.9415440651830208, 0.9456073253805213, 0.9495281805930367, 0.9533060403541939,
+  0.9569403357322088, 0.9604305194155658, 0.9637760657954398, 0.9669764710448521,
+  0.970031253194544, 0.9729399522055602, 0.9757021300385286, 0.9783173707196277,
+  0.9807852804032304, 0.9831054874312163, 0.9852776423889412, 0.9873014181578584,
+  0.989176509964781, 0.99090263542778, 0.99247953459871, 0.9939069700023561,
+  0.9951847266721969, 0.996312612182778, 0.9972904566786902, 0.9981181129001492,
+  0.9987954562051724, 0.9993223845883495, 0.9996988186962042, 0.9999247018391445,
+  1.0, 0.9999247018391445, 0.9996988186962042, 0.9993223845883495,
+  0.9987954562051724, 0.9981181129001492, 0.9972904566786902, 0.996312612182778,
+  0.9951847266721969, 0.9939069700023561, 0.99247953459871, 0.99090263542778,
+  0.989176509964781, 0.9873014181578584, 0.9852776423889412, 0.9831054874312163,
+  0.9807852804032304, 0.9783173707196277, 0.9757021300385286, 0.9729399522055602,
+  0.970031253194544, 0.9669764710448521, 0.9637760657954398, 0.9604305194155658,
+  0.9569403357322088, 0.9533060403541939, 0.9495281805930367, 0.9456073253805213,
+  0.9415440651830208, 0.937339011912575, 0.932992798834739, 0.9285060804732156,
+  0.9238795325112867, 0.9191138516900578, 0.9142097557035307, 0.9091679830905224,
+  0.9039892931234433, 0.8986744656939538, 0.8932243011955153, 0.8876396204028539,
+  0.881921264348355, 0.8760700941954066, 0.8700869911087115, 0.8639728561215868,
+  0.8577286100002721, 0.8513551931052652, 0.8448535652497071, 0.8382247055548381,
+  0.8314696123025452, 0.8245893027850253, 0.8175848131515837, 0.8104571982525948,
+  0.8032075314806449, 0.7958369046088836, 0.7883464276266063, 0.7807372285720945,
+  0.773010453362737, 0.765167265622459, 0.7572088465064846, 0.7491363945234594,
+  0.7409511253549591, 0.7326542716724128, 0.724247082951467, 0.7157308252838186,
+  0.7071067811865475, 0.6983762494089729, 0.6895405447370668, 0.680600997795453,
+  0.6715589548470183, 0.6624157775901718, 0.6531728429537768, 0.6438315428897914,
+  0.6343932841636455, 0.6248594881423863, 0.6152315905806268, 0.6055110414043255,
+  0.5956993044924334, 0.5857978574564389, 0.5758081914178453, 0.5657318107836131,
+  0.5555702330196022, 0.5453249884220465, 0.5349976198870972, 0.524589682678469,
+  0.5141027441932217, 0.5035383837257176, 0.49289819222978404, 0.4821837720791227,
+  0.47139673682599764, 0.46053871095824, 0.44961132965460654, 0.43861623853852766,
+  0.4275550934302821, 0.41642956009763715, 0.40524131400498986, 0.3939920400610481,
+  0.3826834323650898, 0.37131719395183754, 0.3598950365349881, 0.34841868024943456,
+  0.33688985339222005, 0.3253102921622629, 0.3136817403988915, 0.3020059493192281,
+  0.29028467725446233, 0.27851968938505306, 0.26671275747489837, 0.25486565960451457,
+  0.24298017990326387, 0.2310581082806711, 0.2191012401568698, 0.20711137619221856,
+  0.19509032201612825, 0.18303988795514095, 0.17096188876030122, 0.15885814333386145,
+  0.14673047445536175, 0.13458070850712617, 0.1224106751992162, 0.11022220729388306,
+  0.0980171403295606, 0.0857973123444399, 0.07356456359966743, 0.06132073630220858,
+  0.049067674327418015, 0.03680722294135883, 0.024541228522912288, 0.012271538285719925,
+  0.0, -0.012271538285719925, -0.024541228522912288, -0.03680722294135883,
+  -0.049067674327418015, -0.06132073630220858, -0.07356456359966743, -0.0857973123444399,
+  -0.0980171403295606, -0.11022220729388306, -0.1224106751992162, -0.13458070850712617,
+  -0.14673047445536175, -0.15885814333386145, -0.17096188876030122, -0.18303988795514095,
+  -0.19509032201612825, -0.20711137619221856, -0.2191012401568698, -0.2310581082806711,
+  -0.24298017990326387, -0.25486565960451457, -0.26671275747489837, -0.27851968938505306,
+  -0.29028467725446233, -0.3020059493192281, -0.3136817403988915, -0.3253102921622629,
+  -0.33688985339222005, -0.34841868024943456, -0.3598950365349881, -0.37131719395183754,
+  -0.3826834323650898, -0.3939920400610481, -0.40524131400498986, -0.41642956009763715,
+  -0.4275550934302821, -0.43861623853852766, -0.44961132965460654, -0.46053871095824,
+  -0.47139673682599764, -0.4821837720791227, -0.49289819222978404, -0.5035383837257176,
+  -0.5141027441932217, -0.524589682678469, -0.5349976198870972, -0.5453249884220465,
+  -0.5555702330196022, -0.5657318107836131, -0.5758081914178453, -0.5857978574564389,
+  -0.5956993044924334, -0.6055110414043255, -0.6152315905806268, -0.6248594881423863,
+  -0.6343932841636455, -0.6438315428897914, -0.6531728429537768, -0.6624157775901718,
+  -0.6715589548470183, -0.680600997795453, -0.6895405447370668, -0.6983762494089729,
+  -0.7071067811865475, -0.7157308252838186, -0.724247082951467, -0.7326542716724128,
+  -0.7409511253549591, -0.7491363945234594, -0.7572088465064846, -0.765167265622459,
+  -0.773010453362737, -0.7807372285720945, -0.7883464276266063, -0.7958369046088836,
+  -0.8032075314806449, -0.8104571982525948, -0.8175848131515837, -0.8245893027850253,
+  -0.8314696123025452, -0.8382247055548381, -0.8448535652497071, -0.8513551931052652,
+  -0.8577286100002721, -0.8639728561215868, -0.8700869911087115, -0.8760700941954066,
+  -0.881921264348355, -0.8876396204028539, -0.8932243011955153, -0.8986744656939538,
+  -0.9039892931234433, -0.9091679830905224, -0.9142097557035307, -0.9191138516900578,
+  -0.9238795325112867, -0.9285060804732156, -0.932992798834739, -0.937339011912575,
+  -0.9415440651830208, -0.9456073253805213, -0.9495281805930367, -0.9533060403541939,
+  -0.9569403357322088, -0.9604305194155658, -0.9637760657954398, -0.9669764710448521,
+  -0.970031253194544, -0.9729399522055602, -0.9757021300385286, -0.9783173707196277,
+  -0.9807852804032304, -0.9831054874312163, -0.9852776423889412, -0.9873014181578584,
+  -0.989176509964781, -0.99090263542778, -0.99247953459871, -0.9939069700023561,
+  -0.9951847266721969, -0.996312612182778, -0.9972904566786902, -0.9981181129001492,
+  -0.9987954562051724, -0.9993223845883495, -0.9996988186962042, -0.9999247018391445,
+  -1.0, -0.9999247018391445, -0.9996988186962042, -0.9993223845883495,
+  -0.9987954562051724, -0.9981181129001492, -0.9972904566786902, -0.996312612182778,
+  -0.9951847266721969, -0.9939069700023561, -0.99247953459871, -0.99090263542778,
+  -0.989176509964781, -0.9873014181578584, -0.9852776423889412, -0.9831054874312163,
+  -0.9807852804032304, -0.9783173707196277, -0.9757021300385286, -0.9729399522055602,
+  -0.970031253194544, -0.9669764710448521, -0.9637760657954398, -0.9604305194155658,
+  -0.9569403357322088, -0.9533060403541939, -0.9495281805930367, -0.9456073253805213,
+  -0.9415440651830208, -0.937339011912575, -0.932992798834739, -0.9285060804732156,
+  -0.9238795325112867, -0.9191138516900578, -0.9142097557035307, -0.9091679830905224,
+  -0.9039892931234433, -0.8986744656939538, -0.8932243011955153, -0.8876396204028539,
+  -0.881921264348355, -0.8760700941954066, -0.8700869911087115, -0.8639728561215868,
+  -0.8577286100002721, -0.8513551931052652, -0.8448535652497071, -0.8382247055548381,
+  -0.8314696123025452, -0.8245893027850253, -0.8175848131515837, -0.8104571982525948,
+  -0.8032075314806449, -0.7958369046088836, -0.7883464276266063, -0.7807372285720945,
+  -0.773010453362737, -0.765167265622459, -0.7572088465064846, -0.7491363945234594,
+  -0.7409511253549591, -0.7326542716724128, -0.724247082951467, -0.7157308252838186,
+  -0.7071067811865475, -0.6983762494089729, -0.6895405447370668, -0.680600997795453,
+  -0.6715589548470183, -0.6624157775901718, -0.6531728429537768, -0.6438315428897914,
+  -0.6343932841636455, -0.6248594881423863, -0.6152315905806268, -0.6055110414043255,
+  -0.5956993044924334, -0.5857978574564389, -0.5758081914178453, -0.5657318107836131,
+  -0.5555702330196022, -0.5453249884220465, -0.5349976198870972, -0.524589682678469,
+  -0.5141027441932217, -0.5035383837257176, -0.49289819222978404, -0.4821837720791227,
+  -0.47139673682599764, -0.46053871095824, -0.44961132965460654, -0.43861623853852766,
+  -0.4275550934302821, -0.41642956009763715, -0.40524131400498986, -0.3939920400610481,
+  -0.3826834323650898, -0.37131719395183754, -0.3598950365349881, -0.34841868024943456,
+  -0.33688985339222005, -0.3253102921622629, -0.3136817403988915, -0.3020059493192281,
+  -0.29028467725446233, -0.27851968938505306, -0.26671275747489837, -0.25486565960451457,
+  -0.24298017990326387, -0.2310581082806711, -0.2191012401568698, -0.20711137619221856,
+  -0.19509032201612825, -0.18303988795514095, -0.17096188876030122, -0.15885814333386145,
+  -0.14673047445536175, -0.13458070850712617, -0.1224106751992162, -0.11022220729388306,
+  -0.0980171403295606, -0.0857973123444399, -0.07356456359966743, -0.06132073630220858,
+  -0.049067674327418015, -0.03680722294135883, -0.024541228522912288, -0.012271538285719925,
+  0.0, 0.012271538285719925, 0.024541228522912288, 0.03680722294135883,
+  0.049067674327418015, 0.06132073630220858, 0.07356456359966743, 0.0857973123444399,
+  0.0980171403295606, 0.11022220729388306, 0.1224106751992162, 0.13458070850712617,
+  0.14673047445536175, 0.15885814333386145, 0.17096188876030122, 0.18303988795514095,
+  0.19509032201612825, 0.20711137619221856, 0.2191012401568698, 0.2310581082806711,
+  0.24298017990326387, 0.25486565960451457, 0.26671275747489837, 0.27851968938505306,
+  0.29028467725446233, 0.3020059493192281, 0.3136817403988915, 0.3253102921622629,
+  0.33688985339222005, 0.34841868024943456, 0.3598950365349881, 0.37131719395183754,
+  0.3826834323650898, 0.3939920400610481, 0.40524131400498986, 0.41642956009763715,
+  0.4275550934302821, 0.43861623853852766, 0.44961132965460654, 0.46053871095824,
+  0.47139673682599764, 0.4821837720791227, 0.49289819222978404, 0.5035383837257176,
+  0.5141027441932217, 0.524589682678469, 0.5349976198870972, 0.5453249884220465,
+  0.5555702330196022, 0.5657318107836131, 0.5758081914178453, 0.5857978574564389,
+  0.5956993044924334, 0.6055110414043255, 0.6152315905806268, 0.6248594881423863,
+  0.6343932841636455, 0.6438315428897914, 0.6531728429537768, 0.6624157775901718,
+  0.6715589548470183, 0.680600997795453, 0.6895405447370668, 0.6983762494089729,
+  0.7071067811865475, 0.7157308252838186, 0.724247082951467, 0.7326542716724128,
+  0.7409511253549591, 0.7491363945234594, 0.7572088465064846, 0.765167265622459,
+  0.773010453362737, 0.7807372285720945, 0.7883464276266063, 0.7958369046088836,
+  0.8032075314806449, 0.8104571982525948, 0.8175848131515837, 0.8245893027850253,
+  0.8314696123025452, 0.8382247055548381, 0.8448535652497071, 0.8513551931052652,
+  0.8577286100002721, 0.8639728561215868, 0.8700869911087115, 0.8760700941954066,
+  0.881921264348355, 0.8876396204028539, 0.8932243011955153, 0.8986744656939538,
+  0.9039892931234433, 0.9091679830905224, 0.9142097557035307, 0.9191138516900578,
+  0.9238795325112867, 0.9285060804732156, 0.932992798834739, 0.937339011912575,
+  0.9415440651830208, 0.9456073253805213, 0.9495281805930367, 0.9533060403541939,
+  0.9569403357322088, 0.9604305194155658, 0.9637760657954398, 0.9669764710448521,
+  0.970031253194544, 0.9729399522055602, 0.9757021300385286, 0.9783173707196277,
+  0.9807852804032304, 0.9831054874312163, 0.9852776423889412, 0.9873014181578584,
+  0.989176509964781, 0.99090263542778, 0.99247953459871, 0.9939069700023561,
+  0.9951847266721969, 0.996312612182778, 0.9972904566786902, 0.9981181129001492,
+  0.9987954562051724, 0.9993223845883495, 0.9996988186962042, 0.9999247018391445,
+  1.0,
+};
+
+static const unsigned int bitrev_512[512] =
+{
+  0, 256, 128, 384,
+  64, 320, 192, 448,
+  32, 288, 160, 416,
+  96, 352, 224, 480,
+  16, 272, 144, 400,
+  80, 336, 208, 464,
+  48, 304, 176, 432,
+  112, 368, 240, 496,
+  8, 264, 136, 392,
+  72, 328, 200, 456,
+  40, 296, 168, 424,
+  104, 360, 232, 488,
+  24, 280, 152, 408,
+  88, 344, 216, 472,
+  56, 312, 184, 440,
+  120, 376, 248, 504,
+  4, 260, 132, 388,
+  68, 324, 196, 452,
+  36, 292, 164, 420,
+  100, 356, 228, 484,
+  20, 276, 148, 404,
+  84, 340, 212, 468,
+  52, 308, 180, 436,
+  116, 372, 244, 500,
+  12, 268, 140, 396,
+  76, 332, 204, 460,
+  44, 300, 172, 428,
+  108, 364, 236, 492,
+  28, 284, 156, 412,
+  92, 348, 220, 476,
+  60, 316, 188, 444,
+  124, 380, 252, 508,
+  2, 258, 130, 386,
+  66, 322, 194, 450,
+  34, 290, 162, 418,
+  98, 354, 226, 482,
+  18, 274, 146, 402,
+  82, 338, 210, 466,
+  50, 306, 178, 434,
+  114, 370, 242, 498,
+  10, 266, 138, 394,
+  74, 330, 202, 458,
+  42, 298, 170, 426,
+  106, 362, 234, 490,
+  26, 282, 154, 410,
+  90, 346, 218, 474,
+  58, 314, 186, 442,
+  122, 378, 250, 506,
+  6, 262, 134, 390,
+  70, 326, 198, 454,
+  38, 294, 166, 422,
+  102, 358, 230, 486,
+  22, 278, 150, 406,
+  86, 342, 214, 470,
+  54, 310, 182, 438,
+  118, 374, 246, 502,
+  14, 270, 142, 398,
+  78, 334, 206, 462,
+  46, 302, 174, 430,
+  110, 366, 238, 494,
+  30, 286, 158, 414,
+  94, 350, 222, 478,
+  62, 318, 190, 446,
+  126, 382, 254, 510,
+  1, 257, 129, 385,
+  65, 321, 193, 449,
+  33, 289, 161, 417,
+  97, 353, 225, 481,
+  17, 273, 145, 401,
+  81, 337, 209, 465,
+  49, 305, 177, 433,
+  113, 369, 241, 497,
+  9, 265, 137, 393,
+  73, 329, 201, 457,
+  41, 297, 169, 425,
+  105, 361, 233, 489,
+  25, 281, 153, 409,
+  89, 345, 217, 473,
+  57, 313, 185, 441,
+  121, 377, 249, 505,
+  5, 261, 133, 389,
+  69, 325, 197, 453,
+  37, 293, 165, 421,
+  101, 357, 229, 485,
+  21, 277, 149, 405,
+  85, 341, 213, 469,
+  53, 309, 181, 437,
+  117, 373, 245, 501,
+  13, 269, 141, 397,
+  77, 333, 205, 461,
+  45, 301, 173, 429,
+  109, 365, 237, 493,
+  29, 285, 157, 413,
+  93, 349, 221, 477,
+  61, 317, 189, 445,
+  125, 381, 253, 509,
+  3, 259, 131, 387,
+  67, 323, 195, 451,
+  35, 291, 163, 419,
+  99, 355, 227, 483,
+  19, 275, 147, 403,
+  83, 339, 211, 467,
+  51, 307, 179, 435,
+  115, 371, 243, 499,
+  11, 267, 139, 395,
+  75, 331, 203, 459,
+  43, 299, 171, 427,
+  107, 363, 235, 491,
+  27, 283, 155, 411,
+  91, 347, 219, 475,
+  59, 315, 187, 443,
+  123, 379, 251, 507,
+  7, 263, 135, 391,
+  71, 327, 199, 455,
+  39, 295, 167, 423,
+  103, 359, 231, 487,
+  23, 279, 151, 407,
+  87, 343, 215, 471,
+  55, 311, 183, 439,
+  119, 375, 247, 503,
+  15, 271, 143, 399,
+  79, 335, 207, 463,
+  47, 303, 175, 431,
+  111, 367, 239, 495,
+  31, 287, 159, 415,
+  95, 351, 223, 479,
+  63, 319, 191, 447,
+  127, 383, 255, 511,
+};
+
+static const rta_tables_real_t sin_1024[1281] =
+{
+  0.0, 0.006135884649154475, 0.012271538285719925, 0.01840672990580482,
+  0.024541228522912288, 0.030674803176636626, 0.03680722294135883, 0.04293825693494082,
+  0.049067674327418015, 0.055195244349689934, 0.06132073630220858, 0.06744391956366405,
+  0.07356456359966743, 0.07968243797143013, 0.0857973123444399, 0.09190895649713272,
+  0.0980171403295606, 0.10412163387205459, 0.11022220729388306, 0.11631863091190475,
+  0.1224106751992162, 0.12849811079379317, 0.13458070850712617, 0.1406582393328492,
+  0.14673047445536175, 0.15279718525844344, 0.15885814333386145, 0.16491312048996992,
+  0.17096188876030122, 0.17700422041214875, 0.18303988795514095, 0.1890686641498062,
+  0.19509032201612825, 0.2011046348420919, 0.20711137619221856, 0.21311031991609136,
+  0.2191012401568698, 0.22508391135979283, 0.2310581082806711, 0.2370236059943672,
+  0.24298017990326387, 0.24892760574572015, 0.25486565960451457, 0.2607941179152755,
+  0.26671275747489837, 0.272621355449949, 0.27851968938505306, 0.2844075372112719,
+  0.29028467725446233, 0.2961508882436238, 0.3020059493192281, 0.30784964004153487,
+  0.3136817403988915, 0.3195020308160157, 0.3253102921622629, 0.33110630575987643,
+  0.33688985339222005, 0.3426607173119944, 0.34841868024943456, 0.35416352542049034,
+  0.3598950365349881, 0.36561299780477385, 0.37131719395183754, 0.37700741021641826,
+  0.3826834323650898, 0.38834504669882625, 0.3939920400610481, 0.3996241998456468,
+  0.40524131400498986, 0.4108431710579039, 0.41642956009763715, 0.4220002707997997,
+  0.4275550934302821, 0.43309381885315196, 0.43861623853852766, 0.4441221445704292,
+  0.44961132965460654, 0.45508358712634384, 0.46053871095824, 0.4659764957679662,
+  0.47139673682599764, 0.4767992300633221, 0.4821837720791227, 0.487550160148436,
+  0.49289819222978404, 0.49822766697278187, 0.5035383837257176, 0.508830142543107,
+  0.5141027441932217, 0.5193559901655896, 0.524589682678469, 0.5298036246862946,
+  0.5349976198870972, 0.5401714727298929, 0.5453249884220465, 0.5504579729366048,
+  0.5555702330196022, 0.560661576197336, 0.5657318107836131, 0.5707807458869673,
+  0.5758081914178453, 0.5808139580957645, 0.5857978574564389, 0.5907597018588742,
+  0.5956993044924334, 0.600616479383869, 0.6055110414043255, 0.6103828062763095,
+  0.6152315905806268, 0.6200572117632891, 0.6248594881423863, 0.629638238914927,
+  0.6343932841636455, 0.6391244448637757, 0.6438315428897914, 0.6485144010221124,
+  0.6531728429537768, 0.6578066932970786, 0.6624157775901718, 0.6669999223036375,
+  0.6715589548470183, 0.6760927035753159, 0.680600997795453, 0.6850836677727004,
+  0.6895405447370668, 0.693971460889654, 0.6983762494089729, 0.7027547444572253,
+  0.7071067811865475, 0.7114321957452164, 0.7157308252838186, 0.7200025079613817,
+  0.724247082951467, 0.7284643904482252, 0.7326542716724128, 0.7368165688773699,
+  0.7409511253549591, 0.7450577854414661, 0.7491363945234594, 0.7531867990436125,
+  0.7572088465064846, 0.7612023854842618, 0.765167265622459, 0.7691033376455797,
+  0.773010453362737, 0.7768884656732324, 0.7807372285720945, 0.7845565971555752,
+  0.7883464276266063, 0.7921065773002124, 0.7958369046088836, 0.799537269107905,
+  0.8032075314806449, 0.8068475535437993, 0.8104571982525948, 0.8140363297059484,
+  0.8175848131515837, 0.8211025149911046, 0.8245893027850253, 0.8280450452577558,
+  0.8314696123025452, 0.83486287498638, 0.8382247055548381, 0.8415549774368984,
+  0.8448535652497071, 0.8481203448032972, 0.8513551931052652, 0.8545579883654005,
+  0.8577286100002721, 0.8608669386377673, 0.8639728561215868, 0.8670462455156926,
+  0.8700869911087115, 0.8730949784182901, 0.8760700941954066, 0.8790122264286335,
+  0.881921264348355, 0.8847970984309378, 0.8876396204028539, 0.8904487232447579,
+  0.8932243011955153, 0.8959662497561852, 0.8986744656939538, 0.901348847046022,
+  0.9039892931234433, 0.9065957045149153, 0.9091679830905224, 0.9117060320054299,
+  0.9142097557035307, 0.9166790599210427, 0.9191138516900578, 0.921514039342042,
+  0.9238795325112867, 0.9262102421383114, 0.9285060804732156, 0.9307669610789837,
+  0.932992798834739, 0.9351835099389476, 0.937339011912575, 0.9394592236021899,
+  0.9415440651830208, 0.9435934581619604, 0.9456073253805213, 0.9475855910177411,
+  0.9495281805930367, 0.9514350209690083, 0.9533060403541939, 0.9551411683057708,
+  0.9569403357322088, 0.9587034748958716, 0.9604305194155658, 0.9621214042690416,
+  0.9637760657954398, 0.9653944416976894, 0.9669764710448521, 0.9685220942744174,
+  0.970031253194544, 0.9715038909862518, 0.9729399522055602, 0.9743393827855759,
+  0.9757021300385286, 0.9770281426577544, 0.9783173707196277, 0.9795697656854405,
+  0.9807852804032304, 0.9819638691095552, 0.9831054874312163, 0.984210092386929,
+  0.9852776423889412, 0.9863080972445987, 0.9873014181578584, 0.9882575677307495,
+  0.989176509964781, 0.9900582102622971, 0.99090263542778, 0.9917097536690995,
+  0.99247953459871, 0.9932119492347945, 0.9939069700023561, 0.9945645707342554,
+  0.9951847266721969, 0.9957674144676598, 0.996312612182778, 0.9968202992911657,
+  0.9972904566786902, 0.9977230666441916, 0.9981181129001492, 0.9984755805732948,
+  0.9987954562051724, 0.9990777277526454, 0.9993223845883495, 0.9995294175010931,
+  0.9996988186962042, 0.9998305817958234, 0.9999247018391445, 0.9999811752826011,
+  1.0, 0.9999811752826011, 0.9999247018391445, 0.9998305817958234,
+  0.9996988186962042, 0.9995294175010931, 0.9993223845883495, 0.9990777277526454,
+  0.9987954562051724, 0.9984755805732948, 0.9981181129001492, 0.9977230666441916,
+  0.9972904566786902, 0.9968202992911657, 0.996312612182778, 0.9957674144676598,
+  0.9951847266721969, 0.9945645707342554, 0.9939069700023561, 0.9932119492347945,
+  0.99247953459871, 0.9917097536690995, 0.99090263542778, 0.9900582102622971,
+  0.989176509964781, 0.9882575677307495, 0.9873014181578584, 0.9863080972445987,
+  0.9852776423889412, 0.984210092386929, 0.9831054874312163, 0.9819638691095552,
+  0.9807852804032304, 0.9795697656854405, 0.9783173707196277, 0.9770281426577544,
+  0.9757021300385286, 0.9743393827855759, 0.9729399522055602, 0.9715038909862518,
+  0.970031253194544, 0.9685220942744174, 0.9669764710448521, 0.9653944416976894,
+  0.9637760657954398, 0.9621214042690416, 0.9604305194155658, 0.9587034748958716,
+  0.9569403357322088, 0.9551411683057708, 0.9533060403541939, 0.9514350209690083,
+  0.9495281805930367, 0.9475855910177411, 0.9456073253805213, 0.9435934581619604,
+  0.9415440651830208, 0.9394592236021899, 0.937339011912575, 0.9351835099389476,
+  0.932992798834739, 0.9307669610789837, 0.9285060804732156, 0.9262102421383114,
+  0.9238795325112867, 0.921514039342042, 0.9191138516900578, 0.9166790599210427,
+  0.9142097557035307, 0.9117060320054299, 0.9091679830905224, 0.9065957045149153,
+  0.9039892931234433, 0.901348847046022, 0.8986744656939538, 0.8959662497561852,
+  0.8932243011955153, 0.8904487232447579, 0.8876396204028539, 0.8847970984309378,
+  0.881921264348355, 0.8790122264286335, 0.8760700941954066, 0.8730949784182901,
+  0.8700869911087115, 0.8670462455156926, 0.8639728561215868, 0.8608669386377673,
+  0.8577286100002721, 0.8545579883654005, 0.8513551931052652, 0.8481203448032972,
+  0.8448535652497071, 0.8415549774368984, 0.8382247055548381, 0.83486287498638,
+  0.8314696123025452, 0.8280450452577558, 0.8245893027850253, 0.8211025149911046,
+  0.8175848131515837, 0.8140363297059484, 0.8104571982525948, 0.8068475535437993,
+  0.8032075314806449, 0.799537269107905, 0.7958369046088836, 0.7921065773002124,
+  0.7883464276266063, 0.7845565971555752, 0.7807372285720945, 0.7768884656732324,
+  0.773010453362737, 0.7691033376455797, 0.765167265622459, 0.7612023854842618,
+  0.7572088465064846, 0.7531867990436125, 0.7491363945234594, 0.7450577854414661,
+  0.7409511253549591, 0.7368165688773699, 0.7326542716724128, 0.7284643904482252,
+  0.724247082951467, 0.7200025079613817, 0.7157308252838186, 0.7114321957452164,
+  0.7071067811865475, 0.7027547444572253, 0.6983762494089729, 0.693971460889654,
+  0.6895405447370668, 0.6850836677727004, 0.680600997795453, 0.6760927035753159,
+  0.6715589548470183, 0.6669999223036375, 0.6624157775901718, 0.6578066932970786,
+  0.6531728429537768, 0.6485144010221124, 0.6438315428897914, 0.6391244448637757,
+  0.6343932841636455, 0.629638238914927, 0.6248594881423863, 0.6200572117632891,
+  0.6152315905806268, 0.6103828062763095, 0.6055110414043255, 0.600616479383869,
+  0.5956993044924334, 0.5907597018588742, 0.5857978574564389, 0.5808139580957645,
+  0.5758081914178453, 0.5707807458869673, 0.5657318107836131, 0.560661576197336,
+  0.5555702330196022, 0.5504579729366048, 0.5453249884220465, 0.5401714727298929,
+  0.5349976198870972, 0.5298036246862946, 0.524589682678469, 0.5193559901655896,
+  0.5141027441932217, 0.508830142543107, 0.5035383837257176, 0.49822766697278187,
+  0.49289819222978404, 0.487550160148436, 0.4821837720791227, 0.4767992300633221,
+  0.47139673682599764, 0.4659764957679662, 0.46053871095824, 0.45508358712634384,
+  0.44961132965460654, 0.4441221445704292, 0.43861623853852766, 0.43309381885315196,
+  0.4275550934302821, 0.4220002707997997, 0.41642956009763715, 0.4108431710579039,
+  0.40524131400498986, 0.3996241998456468, 0.3939920400610481, 0.38834504669882625,
+  0.3826834323650898, 0.37700741021641826, 0.37131719395183754, 0.36561299780477385,
+  0.3598950365349881, 0.35416352542049034, 0.34841868024943456, 0.3426607173119944,
+  0.33688985339222005, 0.33110630575987643, 0.3253102921622629, 0.3195020308160157,
+  0.3136817403988915, 0.30784964004153487, 0.3020059493192281, 0.2961508882436238,
+  0.29028467725446233, 0.2844075372112719, 0.27851968938505306, 0.272621355449949,
+  0.26671275747489837, 0.2607941179152755, 0.25486565960451457, 0.24892760574572015,
+  0.24298017990326387, 0.2370236059943672, 0.2310581082806711, 0.22508391135979283,
+  0.2191012401568698, 0.21311031991609136, 0.20711137619221856, 0.2011046348420919,
+  0.19509032201612825, 0.1890686641498062, 0.18303988795514095, 0.17700422041214875,
+  0.17096188876030122, 0.16491312048996992, 0.15885814333386145, 0.15279718525844344,
+  0.14673047445536175, 0.1406582393328492, 0.13458070850712617, 0.12849811079379317,
+  0.1224106751992162, 0.11631863091190475, 0.11022220729388306, 0.10412163387205459,
+  0.0980171403295606, 0.09190895649713272, 0.0857973123444399, 0.07968243797143013,
+  0.07356456359966743, 0.06744391956366405, 0.06132073630220858, 0.055195244349689934,
+  0.049067674327418015, 0.04293825693494082, 0.03680722294135883, 0.030674803176636626,
+  0.024541228522912288, 0.01840672990580482, 0.012271538285719925, 0.006135884649154475,
+  0.0, -0.006135884649154475, -0.012271538285719925, -0.01840672990580482,
+  -0.024541228522912288, -0.030674803176636626, -0.03680722294135883, -0.04293825693494082,
+  -0.049067674327418015, -0.055195244349689934, -0.06132073630220858, -0.06744391956366405,
+  -0.07356456359966743, -0.07968243797143013, -0.0857973123444399, -0.09190895649713272,
+  -0.0980171403295606, -0.10412163387205459, -0.11022220729388306, -0.11631863091190475,
+  -0.1224106751992162, -0.12849811079379317, -0.13458070850712617, -0.1406582393328492,
+  -0.14673047445536175, -0.15279718525844344, -0.15885814333386145, -0.16491312048996992,
+  -0.17096188876030122, -0.17700422041214875, -0.18303988795514095, -0.1890686641498062,
+  -0.19509032201612825, -0.2011046348420919, -0.20711137619221856, -0.21311031991609136,
+  -0.2191012401568698, -0.22508391135979283, -0.2310581082806711, -0.2370236059943672,
+  -0.24298017990326387, -0.24892760574572015, -0.25486565960451457, -0.2607941179152755,
+  -0.26671275747489837, -0.272621355449949, -0.27851968938505306, -0.2844075372112719,
+  -0.29028467725446233, -0.2961508882436238, -0.3020059493192281, -0.30784964004153487,
+  -0.3136817403988915, -0.3195020308160157, -0.3253102921622629, -0.33110630575987643,
+  -0.33688985339222005, -0.3426607173119944, -0.34841868024943456, -0.35416352542049034,
+  -0.3598950365349881, -0.36561299780477385, -0.37131719395183754, -0.37700741021641826,
+  -0.3826834323650898, -0.38834504669882625, -0.3939920400610481, -0.3996241998456468,
+  -0.40524131400498986, -0.4108431710579039, -0.41642956009763715, -0.4220002707997997,
+  -0.4275550934302821, -0.43309381885315196, -0.43861623853852766, -0.4441221445704292,
+  -0.44961132965460654, -0.45508358712634384, -0.46053871095824, -0.4659764957679662,
+  -0.47139673682599764, -0.4767992300633221, -0.4821837720791227, -0.487550160148436,
+  -0.49289819222978404, -0.49822766697278187, -0.5035383837257176, -0.508830142543107,
+  -0.5141027441932217, -0.5193559901655896, -0.524589682678469, -0.5298036246862946,
+  -0.5349976198870972, -0.5401714727298929, -0.5453249884220465, -0.5504579729366048,
+  -0.5555702330196022, -0.560661576197336, -0.5657318107836131, -0.5707807458869673,
+  -0.5758081914178453, -0.5808139580957645, -0.5857978574564389, -0.5907597018588742,
+  -0.5956993044924334, -0.600616479383869, -0.6055110414043255, -0.6103828062763095,
+  -0.6152315905806268, -0.6200572117632891, -0.6248594881423863, -0.629638238914927,
+  -0.6343932841636455, -0.6391244448637757, -0.6438315428897914, -0.6485144010221124,
+  -0.6531728429537768, -0.6578066932970786, -0.6624157775901718, -0.6669999223036375,
+  -0.6715589548470183, -0.6760927035753159, -0.680600997795453, -0.6850836677727004,
+  -0.6895405447370668, -0.693971460889654, -0.6983762494089729, -0.7027547444572253,
+  -0.7071067811865475, -0.7114321957452164, -0.7157308252838186, -0.7200025079613817,
+  -0.724247082951467, -0.7284643904482252, -0.7326542716724128, -0.7368165688773699,
+  -0.7409511253549591, -0.7450577854414661, -0.7491363945234594, -0.7531867990436125,
+  -0.7572088465064846, -0.7612023854842618, -0.765167265622459, -0.7691033376455797,
+  -0.773010453362737, -0.7768884656732324, -0.7807372285720945, -0.7845565971555752,
+  -0.7883464276266063, -0.7921065773002124, -0.7958369046088836, -0.799537269107905,
+  -0.8032075314806449, -0.8068475535437993, -0.8104571982525948, -0.8140363297059484,
+  -0.8175848131515837, -0.8211025149911046, -0.8245893027850253, -0.8280450452577558,
+  -0.8314696123025452, -0.83486287498638, -0.8382247055548381, -0.8415549774368984,
+  -0.8448535652497071, -0.8481203448032972, -0.8513551931052652, -0.8545579883654005,
+  -0.8577286100002721, -0.8608669386377673, -0.8639728561215868, -0.8670462455156926,
+  -0.8700869911087115, -0.8730949784182901, -0.8760700941954066, -0.8790122264286335,
+  -0.881921264348355, -0.8847970984309378, -0.8876396204028539, -0.8904487232447579,
+  -0.8932243011955153, -0.8959662497561852, -0.8986744656939538, -0.901348847046022,
+  -0.9039892931234433, -0.9065957045149153, -0.9091679830905224, -0.9117060320054299,
+  -0.9142097557035307, -0.9166790599210427, -0.9191138516900578, -0.921514039342042,
+  -0.9238795325112867, -0.9262102421383114, -0.9285060804732156, -0.9307669610789837,
+  -0.932992798834739, -0.9351835099389476, -0.937339011912575, -0.9394592236021899,
+  -0.9415440651830208, -0.9435934581619604, -0.9456073253805213, -0.9475855910177411,
+  -0.9495281805930367, -0.9514350209690083, -0.9533060403541939, -0.9551411683057708,
+  -0.9569403357322088, -0.9587034748958716, -0.9604305194155658, -0.9621214042690416,
+  -0.9637760657954398, -0.9653944416976894, -0.9669764710448521, -0.9685220942744174,
+  -0.970031253194544, -0.9715038909862518, -0.9729399522055602, -0.9743393827855759,
+  -0.9757021300385286, -0.9770281426577544, -0.9783173707196277, -0.9795697656854405,
+  -0.9807852804032304, -0.9819638691095552, -0.9831054874312163, -0.984210092386929,
+  -0.9852776423889412, -0.9863080972445987, -0.9873014181578584, -0.9882575677307495,
+  -0.989176509964781, -0.9900582102622971, -0.99090263542778, -0.9917097536690995,
+  -0.99247953459871, -0.9932119492347945, -0.9939069700023561, -0.9945645707342554,
+  -0.9951847266721969, -0.9957674144676598, -0.996312612182778, -0.9968202992911657,
+  -0.9972904566786902, -0.9977230666441916, -0.9981181129001492, -0.9984755805732948,
+  -0.9987954562051724, -0.9990777277526454, -0.9993223845883495, -0.9995294175010931,
+  -0.9996988186962042, -0.9998305817958234, -0.9999247018391445, -0.9999811752826011,
+  -1.0, -0.9999811752826011, -0.9999247018391445, -0.9998305817958234,
+  -0.9996988186962042, -0.9995294175010931, -0.9993223845883495, -0.9990777277526454,
+  -0.9987954562051724, -0.9984755805732948, -0.9981181129001492, -0.9977230666441916,
+  -0.9972904566786902, -0.9968202992911657, -0.996312612182778, -0.9957674144676598,
+  -0.9951847266721969, -0.9945645707342554, -0.9939069700023561, -0.9932119492347945,
+  -0.99247953459871, -0.9917097536690995, -0.99090263542778, -0.9900582102622971,
+  -0.989176509964781, -0.9882575677307495, -0.9873014181578584, -0.9863080972445987,
+  -0.9852776423889412, -0.984210092386929, -0.9831054874312163, -0.9819638691095552,
+  -0.9807852804032304, -0.9795697656854405, -0.9783173707196277, -0.9770281426577544,
+  -0.9757021300385286, -0.9743393827855759, -0.9729399522055602, -0.9715038909862518,
+  -0.970031253194544, -0.9685220942744174, -0.9669764710448521, -0.9653944416976894,
+  -0.9637760657954398, -0.9621214042690416, -0.9604305194155658, -0.9587034748958716,
+  -0.9569403357322088, -0.9551411683057708, -0.9533060403541939, -0.9514350209690083,
+  -0.9495281805930367, -0.9475855910177411, -0.9456073253805213, -0.9435934581619604,
+  -0.9415440651830208, -0.9394592236021899, -0.937339011912575, -0.9351835099389476,
+  -0.932992798834739, -0.9307669610789837, -0.9285060804732156, -0.9262102421383114,
+  -0.9238795325112867, -0.921514039342042, -0.9191138516900578, -0.9166790599210427,
+  -0.9142097557035307, -0.9117060320054299, -0.9091679830905224, -0.9065957045149153,
+  -0.9039892931234433, -0.901348847046022, -0.8986744656939538, -0.8959662497561852,
+  -0.8932243011955153, -0.8904487232447579, -0.8876396204028539, -0.8847970984309378,
+  -0.881921264348355, -0.8790122264286335, -0.8760700941954066, -0.8730949784182901,
+  -0.8700869911087115, -0.8670462455156926, -0.8639728561215868, -0.8608669386377673,
+  -0.8577286100002721, -0.8545579883654005, -0.8513551931052652, -0.8481203448032972,
+  -0.8448535652497071, -0.8415549774368984, -0.8382247055548381, -0.83486287498638,
+  -0.8314696123025452, -0.8280450452577558, -0.8245893027850253, -0.8211025149911046,
+  -0.8175848131515837, -0.8140363297059484, -0.8104571982525948, -0.8068475535437993,
+  -0.8032075314806449, -0.799537269107905, -0.7958369046088836, -0.7921065773002124,
+  -0.7883464276266063, -0.7845565971555752, -0.7807372285720945, -0.7768884656732324,
+  -0.773010453362737, -0.7691033376455797, -0.765167265622459, -0.7612023854842618,
+  -0.7572088465064846, -0.7531867990436125, -0.7491363945234594, -0.7450577854414661,
+  -0.7409511253549591, -0.7368165688773699, -0.7326542716724128, -0.7284643904482252,
+  -0.724247082951467, -0.7200025079613817, -0.7157308252838186, -0.7114321957452164,
+  -0.7071067811865475, -0.7027547444572253, -0.6983762494089729, -0.693971460889654,
+  -0.6895405447370668, -0.6850836677727004, -0.680600997795453, -0.6760927035753159,
+  -0.6715589548470183, -0.6669999223036375, -0.6624157775901718, -0.6578066932970786,
+  -0.6531728429537768, -0.6485144010221124, -0.6438315428897914, -0.6391244448637757,
+  -0.6343932841636455, -0.629638238914927, -0.6248594881423863, -0.6200572117632891,
+  -0.6152315905806268, -0.6103828062763095, -0.6055110414043255, -0.600616479383869,
+  -0.5956993044924334, -0.5907597018588742, -0.5857978574564389, -0.5808139580957645,
+  -0.5758081914178453, -0.5707807458869673, -0.5657318107836131, -0.560661576197336,
+  -0.5555702330196022, -0.5504579729366048, -0.5453249884220465, -0.5401714727298929,
+  -0.5349976198870972, -0.5298036246862946, -0.524589682678469, -0.5193559901655896,
+  -0.5141027441932217, -0.508830142543107, -0.5035383837257176, -0.49822766697278187,
+  -0.49289819222978404, -0.487550160148436, -0.4821837720791227, -0.4767992300633221,
+  -0.47139673682599764, -0.4659764957679662, -0.46053871095824, -0.45508358712634384,
+  -0.44961132965460654, -0.4441221445704292, -0.43861623853852766, -0.43309381885315196,
+  -0.4275550934302821, -0.4220002707997997, -0.41642956009763715, -0.4108431710579039,
+  -0.40524131400498986, -0.3996241998456468, -0.3939920400610481, -0.38834504669882625,
+  -0.3826834323650898, -0.37700741021641826, -0.37131719395183754, -0.36561299780477385,
+  -0.3598950365349881, -0.35416352542049034, -0.34841868024943456, -0.3426607173119944,
+  -0.33688985339222005, -0.33110630575987643, -0.3253102921622629, -0.3195020308160157,
+  -0.3136817403988915, -0.30784964004153487, -0.3020059493192281, -0.2961508882436238,
+  -0.29028467725446233, -0.2844075372112719, -0.27851968938505306, -0.272621355449949,
+  -0.26671275747489837, -0.2607941179152755, -0.25486565960451457, -0.24892760574572015,
+  -0.24298017990326387, -0.2370236059943672, -0.2310581082806711, -0.22508391135979283,
+  -0.2191012401568698, -0.21311031991609136, -0.20711137619221856, -0.2011046348420919,
+  -0.19509032201612825, -0.1890686641498062, -0.18303988795514095, -0.17700422041214875,
+  -0.17096188876030122, -0.16491312048996992, -0.15885814333386145, -0.15279718525844344,
+  -0.14673047445536175, -0.1406582393328492, -0.13458070850712617, -0.12849811079379317,
+  -0.1224106751992162, -0.11631863091190475, -0.11022220729388306, -0.10412163387205459,
+  -0.0980171403295606, -0.09190895649713272, -0.0857973123444399, -0.07968243797143013,
+  -0.07356456359966743, -0.06744391956366405, -0.06132073630220858, -0.055195244349689934,
+  -0.049067674327418015, -0.04293825693494082, -0.03680722294135883, -0.030674803176636626,
+  -0.024541228522912288, -0.01840672990580482, -0.012271538285719925, -0.006135884649154475,
+  0.0, 0.006135884649154475, 0.012271538285719925, 0.01840672990580482,
+  0.024541228522912288, 0.030674803176636626, 0.03680722294135883, 0.04293825693494082,
+  0.049067674327418015, 0.055195244349689934, 0.06132073630220858, 0.06744391956366405,
+  0.07356456359966743, 0.07968243797143013, 0.0857973123444399, 0.09190895649713272,
+  0.0980171403295606, 0.10412163387205459, 0.11022220729388306, 0.11631863091190475,
+  0.1224106751992162, 0.12849811079379317, 0.13458070850712617, 0.1406582393328492,
+  0.14673047445536175, 0.15279718525844344, 0.15885814333386145, 0.16491312048996992,
+  0.17096188876030122, 0.17700422041214875, 0.18303988795514095, 0.1890686641498062,
+  0.19509032201612825, 0.2011046348420919, 0.20711137619221856, 0.21311031991609136,
+  0.2191012401568698, 0.22508391135979283, 0.2310581082806711, 0.2370236059943672,
+  0.24298017990326387, 0.24892760574572015, 0.25486565960451457, 0.2607941179152755,
+  0.26671275747489837, 0.272621355449949, 0.27851968938505306, 0.2844075372112719,
+  0.29028467725446233, 0.2961508882436238, 0.3020059493192281, 0.30784964004153487,
+  0.3136817403988915, 0.3195020308160157, 0.3253102921622629, 0.33110630575987643,
+  0.33688985339222005, 0.3426607173119944, 0.34841868024943456, 0.35416352542049034,
+  0.3598950365349881, 0.36561299780477385, 0.37131719395183754, 0.37700741021641826,
+  0.3826834323650898, 0.38834504669882625, 0.3939920400610481, 0.3996241998456468,
+  0.40524131400498986, 0.4108431710579039, 0.41642956009763715, 0.4220002707997997,
+  0.4275550934302821, 0.43309381885315196, 0.43861623853852766, 0.4441221445704292,
+  0.44961132965460654, 0.45508358712634384, 0.46053871095824, 0.4659764957679662,
+  0.47139673682599764, 0.4767992300633221, 0.4821837720791227, 0.487550160148436,
+  0.49289819222978404, 0.49822766697278187, 0.5035383837257176, 0.508830142543107,
+  0.5141027441932217, 0.5193559901655896, 0.524589682678469, 0.5298036246862946,
+  0.5349976198870972, 0.5401714727298929, 0.5453249884220465, 0.5504579729366048,
+  0.5555702330196022, 0.560661576197336, 0.5657318107836131, 0.5707807458869673,
+  0.5758081914178453, 0.5808139580957645, 0.5857978574564389, 0.5907597018588742,
+  0.5956993044924334, 0.600616479383869, 0.6055110414043255, 0.6103828062763095,
+  0.6152315905806268, 0.6200572117632891, 0.6248594881423863, 0.629638238914927,
+  0.6343932841636455, 0.6391244448637757, 0.6438315428897914, 0.6485144010221124,
+  0.6531728429537768, 0.6578066932970786, 0.6624157775901718, 0.6669999223036375,
+  0.6715589548470183, 0.6760927035753159, 0.680600997795453, 0.6850836677727004,
+  0.6895405447370668, 0.693971460889654, 0.6983762494089729, 0.7027547444572253,
+  0.7071067811865475, 0.7114321957452164, 0.7157308252838186, 0.7200025079613817,
+  0.724247082951467, 0.7284643904482252, 0.7326542716724128, 0.7368165688773699,
+  0.7409511253549591, 0.7450577854414661, 0.7491363945234594, 0.7531867990436125,
+  0.7572088465064846, 0.7612023854842618, 0.765167265622459, 0.7691033376455797,
+  0.773010453362737, 0.7768884656732324, 0.7807372285720945, 0.7845565971555752,
+  0.7883464276266063, 0.7921065773002124, 0.7958369046088836, 0.799537269107905,
+  0.8032075314806449, 0.8068475535437993, 0.8104571982525948, 0.8140363297059484,
+  0.8175848131515837, 0.8211025149911046, 0.8245893027850253, 0.8280450452577558,
+  0.8314696123025452, 0.83486287498638, 0.8382247055548381, 0.8415549774368984,
+  0.8448535652497071, 0.8481203448032972, 0.8513551931052652, 0.8545579883654005,
+  0.8577286100002721, 0.8608669386377673, 0.8639728561215868, 0.8670462455156926,
+  0.8700869911087115, 0.8730949784182901, 0.8760700941954066, 0.8790122264286335,
+  0.881921264348355, 0.8847970984309378, 0.8876396204028539, 0.8904487232447579,
+  0.8932243011955153, 0.8959662497561852, 0.8986744656939538, 0.901348847046022,
+  0.9039892931234433, 0.9065957045149153, 0.9091679830905224, 0.9117060320054299,
+  0.9142097557035307, 0.9166790599210427, 0.9191138516900578, 0.921514039342042,
+  0.9238795325112867, 0.9262102421383114, 0.9285060804732156, 0.9307669610789837,
+  0.932992798834739, 0.9351835099389476, 0.937339011912575, 0.9394592236021899,
+  0.9415440651830208, 0.9435934581619604, 0.9456073253805213, 0.9475855910177411,
+  0.9495281805930367, 0.9514350209690083, 0.9533060403541939, 0.9551411683057708,
+  0.9569403357322088, 0.9587034748958716, 0.9604305194155658, 0.9621214042690416,
+  0.9637760657954398, 0.9653944416976894, 0.9669764710448521, 0.9685220942744174,
+  0.970031253194544, 0.9715038909862518, 0.9729399522055602, 0.9743393827855759,
+  0.9757021300385286, 0.9770281426577544, 0.9783173707196277, 0.9795697656854405,
+  0.9807852804032304, 0.9819638691095552, 0.9831054874312163, 0.984210092386929,
+  0.9852776423889412, 0.9863080972445987, 0.9873014181578584, 0.9882575677307495,
+  0.989176509964781, 0.9900582102622971, 0.99090263542778, 0.9917097536690995,
+  0.99247953459871, 0.9932119492347945, 0.9939069700023561, 0.9945645707342554,
+  0.9951847266721969, 0.9957674144676598, 0.996312612182778, 0.9968202992911657,
+  0.9972904566786902, 0.9977230666441916, 0.9981181129001492, 0.9984755805732948,
+  0.9987954562051724, 0.9990777277526454, 0.9993223845883495, 0.9995294175010931,
+  0.9996988186962042, 0.9998305817958234, 0.9999247018391445, 0.9999811752826011,
+  1.0,
+};
+
+static const unsigned int bitrev_1024[1024] =
+{
+  0, 512, 256, 768,
+  128, 640, 384, 896,
+  64, 576, 320, 832,
+  192, 704, 448, 960,
+  32, 544, 288, 800,
+  160, 672, 416, 928,
+  96, 608, 352, 864,
+  224, 736, 480, 992,
+  16, 528, 272, 784,
+  144, 656, 400, 912,
+  80, 592, 336, 848,
+  208, 720, 464, 976,
+  48, 560, 304, 816,
+  176, 688, 432, 944,
+  112, 624, 368, 880,
+  240, 752, 496, 1008,
+  8, 520, 264, 776,
+  136, 648, 392, 904,
+  72, 584, 328, 840,
+  200, 712, 456, 968,
+  40, 552, 296, 808,
+  168, 680, 424, 936,
+  104, 616, 360, 872,
+  232, 744, 488, 1000,
+  24, 536, 280, 792,
+  152, 664, 408, 920,
+  88, 600, 344, 856,
+  216, 728, 472, 984,
+  56, 568, 312, 824,
+  184, 696, 440, 952,
+  120, 632, 376, 888,
+  248, 760, 504, 1016,
+  4, 516, 260, 772,
+  132, 644, 388, 900,
+  68, 580, 324, 836,
+  196, 708, 452, 964,
+  36, 548, 292, 804,
+  164, 676, 420, 932,
+  100, 612, 356, 868,
+  228, 740, 484, 996,
+  20, 532, 276, 788,
+  148, 660, 404, 916,
+  84, 596, 340, 852,
+  212, 724, 468, 980,
+  52, 564, 308, 820,
+  180, 692, 436, 948,
+  116, 628, 372, 884,
+  244, 756, 500, 1012,
+  12, 524, 268, 780,
+  140, 652, 396, 908,
+  76, 588, 332, 844,
+  204, 716, 460, 972,
+  44, 556, 300, 812,
+  172, 684, 428, 940,
+  108, 620, 364, 876,
+  236, 748, 492, 1004,
+  28, 540, 284, 796,
+  156, 668, 412, 924,
+  92, 604, 348, 860,
+  220, 732, 476, 988,
+  60, 572, 316, 828,
+  188, 700, 444, 956,
+  124, 636, 380, 892,
+  252, 764, 508, 1020,
+  2, 514, 258, 770,
+  130, 642, 386, 898,
+  66, 578, 322, 834,
+  194, 706, 450, 962,
+  34, 546, 290, 802,
+  162, 674, 418, 930,
+  98, 610, 354, 866,
+  226, 738, 482, 994,
+  18, 530, 274, 786,
+  146, 658, 402, 914,
+  82, 594, 338, 850,
+  210, 722, 466, 978,
+  50, 562, 306, 818,
+  178, 690, 434, 946,
+  114, 626, 370, 882,
+  242, 754, 498, 1010,
+  10, 522, 266, 778,
+  138, 650, 394, 906,
+  74, 586, 330, 842,
+  202, 714, 458, 970,
+  42, 554, 298, 810,
+  170, 682, 426, 938,
+  106, 618, 362, 874,
+  234, 746, 490, 1002,
+  26, 538, 282, 794,
+  154, 666, 410, 922,
+  90, 602, 346, 858,
+  218, 730, 474, 986,
+  58, 570, 314, 826,
+  186, 698, 442, 954,
+  122, 634, 378, 890,
+  250, 762, 506, 1018,
+  6, 518, 262, 774,
+  134, 646, 390, 902,
+  70, 582, 326, 838,
+  198, 710, 454, 966,
+  38, 550, 294, 806,
+  166, 678, 422, 934,
+  102, 614, 358, 870,
+  230, 742, 486, 998,
+  22, 534, 278, 790,
+  150, 662, 406, 918,
+  86, 598, 342, 854,
+  214, 726, 470, 982,
+  54, 566, 310, 822,
+  182, 694, 438, 950,
+  118, 630, 374, 886,
+  246, 758, 502, 1014,
+  14, 526, 270, 782,
+  142, 654, 398, 910,
+  78, 590, 334, 846,
+  206, 718, 462, 974,
+  46, 558, 302, 814,
+  174, 686, 430, 942,
+  110, 622, 366, 878,
+  238, 750, 494, 1006,
+  30, 542, 286, 798,
+  158, 670, 414, 926,
+  94, 606, 350, 862,
+  222, 734, 478, 990,
+  62, 574, 318, 830,
+  190, 702, 446, 958,
+  126, 638, 382, 894,
+  254, 766, 510, 1022,
+  1, 513, 257, 769,
+  129, 641, 385, 897,
+  65, 577, 321, 833,
+  193, 705, 449, 961,
+  33, 545, 289, 801,
+  161, 673, 417, 929,
+  97, 609, 353, 865,
+  225, 737, 481, 993,
+  17, 529, 273, 785,
+  145, 657, 401, 913,
+  81, 593, 337, 849,
+  209, 721, 465, 977,
+  49, 561, 305, 817,
+  177, 689, 433, 945,
+  113, 625, 369, 881,
+  241, 753, 497, 1009,
+  9, 521, 265, 777,
+  137, 649, 393, 905,
+  73, 585, 329, 841,
+  201, 713, 457, 969,
+  41, 553, 297, 809,
+  169, 681, 425, 937,
+  105, 617, 361, 873,
+  233, 745, 489, 1001,
+  25, 537, 281, 793,
+  153, 665, 409, 921,
+  89, 601, 345, 857,
+  217, 729, 473, 985,
+  57, 569, 313, 825,
+  185, 697, 441, 953,
+  121, 633, 377, 889,
+  249, 761, 505, 1017,
+  5, 517, 261, 773,
+  133, 645, 389, 901,
+  69, 581, 325, 837,
+  197, 709, 453, 965,
+  37, 549, 293, 805,
+  165, 677, 421, 933,
+  101, 613, 357, 869,
+  229, 741, 485, 997,
+  21, 533, 277, 789,
+  149, 661, 405, 917,
+  85, 597, 341, 853,
+  213, 725, 469, 981,
+  53, 565, 309, 821,
+  181, 693, 437, 949,
+  117, 629, 373, 885,
+  245, 757, 501, 1013,
+  13, 525, 269, 781,
+  141, 653, 397, 909,
+  77, 589, 333, 845,
+  205, 717, 461, 973,
+  45, 557, 301, 813,
+  173, 685, 429, 941,
+  109, 621, 365, 877,
+  237, 749, 493, 1005,
+  29, 541, 285, 797,
+  157, 669, 413, 925,
+  93, 605, 349, 861,
+  221, 733, 477, 989,
+  61, 573, 317, 829,
+  189, 701, 445, 957,
+  125, 637, 381, 893,
+  253, 765, 509, 1021,
+  3, 515, 259, 771,
+  131, 643, 387, 899,
+  67, 579, 323, 835,
+  195, 707, 451, 963,
+  35, 547, 291, 803,
+  163, 675, 419, 931,
+  99, 611, 355, 867,
+  227, 739, 483, 995,
+  19, 531, 275, 787,
+  147, 659, 403, 915,
+  83, 595, 339, 851,
+  211, 723, 467, 979,
+  51, 563, 307, 819,
+  179, 691, 435, 947,
+  115, 627, 371, 883,
+  243, 755, 499, 1011,
+  11, 523, 267, 779,
+  139, 651, 395, 907,
+  75, 587, 331, 843,
+  203, 715, 459, 971,
+  43, 555, 299, 811,
+  171, 683, 427, 939,
+  107, 619, 363, 875,
+  235, 747, 491, 1003,
+  27, 539, 283, 795,
+  155, 667, 411, 923,
+  91, 603, 347, 859,
+  219, 731, 475, 987,
+  59, 571, 315, 827,
+  187, 699, 443, 955,
+  123, 635, 379, 891,
+  251, 763, 507, 1019,
+  7, 519, 263, 775,
+  135, 647, 391, 903,
+  71, 583, 327, 839,
+  199, 711, 455, 967,
+  39, 551, 295, 807,
+  167, 679, 423, 935,
+  103, 615, 359, 871,
+  231, 743, 487, 999,
+  23, 535, 279, 791,
+  151, 663, 407, 919,
+  87, 599, 343, 855,
+  215, 727, 471, 983,
+  55, 567, 311, 823,
+  183, 695, 439, 951,
+  119, 631, 375, 887,
+  247, 759, 503, 1015,
+  15, 527, 271, 783,
+  143, 655, 399, 911,
+  79, 591, 335, 847,
+  207, 719, 463, 975,
+  47, 559, 303, 815,
+  175, 687, 431, 943,
+  111, 623, 367, 879,
+  239, 751, 495, 1007,
+  31, 543, 287, 799,
+  159, 671, 415, 927,
+  95, 607, 351, 863,
+  223, 735, 479, 991,
+  63, 575, 319, 831,
+  191, 703, 447, 959,
+  127, 639, 383, 895,
+  255, 767, 511, 1023,
+};
+
+static const rta_tables_real_t sin_2048[2561] =
+{
+  0.0, 0.003067956762965976, 0.006135884649154475, 0.00920375478205982,
+  0.012271538285719925, 0.0153392062849881, 0.01840672990580482, 0.021474080275469508,
+  0.024541228522912288, 0.02760814577896574, 0.030674803176636626, 0.03374117185137758,
+  0.03680722294135883, 0.03987292758773981, 0.04293825693494082, 0.04600318213091462,
+  0.049067674327418015, 0.052131704680283324, 0.055195244349689934, 0.05825826450043575,
+  0.06132073630220858, 0.06438263092985747, 0.06744391956366405, 0.07050457338961386,
+  0.07356456359966743, 0.07662386139203149, 0.07968243797143013, 0.08274026454937569,
+  0.0857973123444399, 0.0888535525825246, 0.09190895649713272, 0.09496349532963899,
+  0.0980171403295606, 0.10106986275482782, 0.10412163387205459, 0.10717242495680884,
+  0.11022220729388306, 0.11327095217756435, 0.11631863091190475, 0.11936521481099135,
+  0.1224106751992162, 0.12545498341154623, 0.12849811079379317, 0.13154002870288312,
+  0.13458070850712617, 0.13762012158648604, 0.1406582393328492, 0.14369503315029447,
+  0.14673047445536175, 0.1497645346773215, 0.15279718525844344, 0.15582839765426523,
+  0.15885814333386145, 0.16188639378011183, 0.16491312048996992, 0.16793829497473117,
+  0.17096188876030122, 0.17398387338746382, 0.17700422041214875, 0.18002290140569951,
+  0.18303988795514095, 0.18605515166344663, 0.1890686641498062, 0.19208039704989244,
+  0.19509032201612825, 0.19809841071795356, 0.2011046348420919, 0.20410896609281687,
+  0.20711137619221856, 0.2101118368804696, 0.21311031991609136, 0.21610679707621952,
+  0.2191012401568698, 0.2220936209732035, 0.22508391135979283, 0.22807208317088573,
+  0.2310581082806711, 0.23404195858354343, 0.2370236059943672, 0.2400030224487415,
+  0.24298017990326387, 0.2459550503357946, 0.24892760574572015, 0.25189781815421697,
+  0.25486565960451457, 0.257831102162159, 0.2607941179152755, 0.26375467897483135,
+  0.26671275747489837, 0.2696683255729151, 0.272621355449949, 0.27557181931095814,
+  0.27851968938505306, 0.28146493792575794, 0.2844075372112719, 0.2873474595447295,
+  0.29028467725446233, 0.29321916269425863, 0.2961508882436238, 0.2990798263080405,
+  0.3020059493192281, 0.3049292297354024, 0.30784964004153487, 0.3107671527496115,
+  0.3136817403988915, 0.31659337555616585, 0.3195020308160157, 0.32240767880106985,
+  0.3253102921622629, 0.3282098435790925, 0.33110630575987643, 0.3339996514420094,
+  0.33688985339222005, 0.33977688440682685, 0.3426607173119944, 0.3455413249639891,
+  0.34841868024943456, 0.3512927560855671, 0.35416352542049034, 0.35703096123343,
+  0.3598950365349881, 0.3627557243673972, 0.36561299780477385, 0.3684668299533723,
+  0.37131719395183754, 0.37416406297145793, 0.37700741021641826, 0.37984720892405116,
+  0.3826834323650898, 0.38551605384391885, 0.38834504669882625, 0.39117038430225387,
+  0.3939920400610481, 0.3968099874167103, 0.3996241998456468, 0.40243465085941843,
+  0.40524131400498986, 0.4080441628649787, 0.4108431710579039, 0.4136383122384345,
+  0.41642956009763715, 0.4192168883632239, 0.4220002707997997, 0.4247796812091088,
+  0.4275550934302821, 0.4303264813400826, 0.43309381885315196, 0.4358570799222555,
+  0.43861623853852766, 0.44137126873171667, 0.4441221445704292, 0.44686884016237416,
+  0.44961132965460654, 0.4523495872337709, 0.45508358712634384, 0.4578133035988772,
+  0.46053871095824, 0.46325978355186015, 0.4659764957679662, 0.4686888220358279,
+  0.47139673682599764, 0.47410021465054997, 0.4767992300633221, 0.479493757660153,
+  0.4821837720791227, 0.48486924800079106, 0.487550160148436, 0.49022648328829116,
+  0.49289819222978404, 0.49556526182577254, 0.49822766697278187, 0.5008853826112407,
+  0.5035383837257176, 0.5061866453451552, 0.508830142543107, 0.5114688504379703,
+  0.5141027441932217, 0.5167317990176499, 0.5193559901655896, 0.5219752929371544,
+  0.524589682678469, 0.5271991347819013, 0.5298036246862946, 0.5324031278771979,
+  0.5349976198870972, 0.5375870762956454, 0.5401714727298929, 0.5427507848645159,
+  0.5453249884220465, 0.5478940591731002, 0.5504579729366048, 0.5530167055800275,
+  0.5555702330196022, 0.5581185312205561, 0.560661576197336, 0.5631993440138341,
+  0.5657318107836131, 0.5682589526701315, 0.5707807458869673, 0.5732971666980422,
+  0.5758081914178453, 0.5783137964116556, 0.5808139580957645, 0.5833086529376983,
+  0.5857978574564389, 0.5882815482226452, 0.5907597018588742, 0.5932322950397998,
+  0.5956993044924334, 0.5981607069963423, 0.600616479383869, 0.6030665985403482,
+  0.6055110414043255, 0.6079497849677736, 0.6103828062763095, 0.6128100824294097,
+  0.6152315905806268, 0.6176473079378039, 0.6200572117632891, 0.62246127937415,
+  0.6248594881423863, 0.6272518154951441, 0.629638238914927, 0.6320187359398091,
+  0.6343932841636455, 0.6367618612362842, 0.6391244448637757, 0.6414810128085832,
+  0.6438315428897914, 0.6461760129833163, 0.6485144010221124, 0.6508466849963809,
+  0.6531728429537768, 0.6554928529996153, 0.6578066932970786, 0.6601143420674205,
+  0.6624157775901718, 0.6647109782033448, 0.6669999223036375, 0.669282588346636,
+  0.6715589548470183, 0.673829000378756, 0.6760927035753159, 0.6783500431298615,
+  0.680600997795453, 0.6828455463852481, 0.6850836677727004, 0.687315340891759,
+  0.6895405447370668, 0.6917592583641577, 0.693971460889654, 0.696177131491463,
+  0.6983762494089729, 0.7005687939432483, 0.7027547444572253, 0.7049340803759049,
+  0.7071067811865475, 0.7092728264388657, 0.7114321957452164, 0.7135848687807936,
+  0.7157308252838186, 0.7178700450557317, 0.7200025079613817, 0.7221281939292153,
+  0.724247082951467, 0.726359155084346, 0.7284643904482252, 0.7305627692278276,
+  0.7326542716724128, 0.7347388780959635, 0.7368165688773699, 0.7388873244606151,
+  0.7409511253549591, 0.7430079521351217, 0.7450577854414661, 0.7471006059801801,
+  0.7491363945234594, 0.7511651319096865, 0.7531867990436125, 0.7552013768965365,
+  0.7572088465064846, 0.7592091889783881, 0.7612023854842618, 0.7631884172633813,
+  0.765167265622459, 0.7671389119358204, 0.7691033376455797, 0.7710605242618138,
+  0.773010453362737, 0.7749531065948739, 0.7768884656732324, 0.778816512381476,
+  0.7807372285720945, 0.7826505961665757, 0.7845565971555752, 0.7864552135990858,
+  0.7883464276266063, 0.79023022143731, 0.7921065773002124, 0.7939754775543372,
+  0.7958369046088836, 0.7976908409433912, 0.799537269107905, 0.8013761717231402,
+  0.8032075314806449, 0.8050313311429637, 0.8068475535437993, 0.808656181588175,
+  0.8104571982525948, 0.8122505865852039, 0.8140363297059484, 0.8158144108067338,
+  0.8175848131515837, 0.8193475200767969, 0.8211025149911046, 0.8228497813758264,
+  0.8245893027850253, 0.8263210628456635, 0.8280450452577558, 0.829761233794523,
+  0.8314696123025452, 0.8331701647019132, 0.83486287498638, 0.836547727223512,
+  0.8382247055548381, 0.8398937941959995, 0.8415549774368984, 0.8432082396418454,
+  0.8448535652497071, 0.8464909387740521, 0.8481203448032972, 0.8497417680008525,
+  0.8513551931052652, 0.8529606049303636, 0.8545579883654005, 0.8561473283751945,
+  0.8577286100002721, 0.8593018183570085, 0.8608669386377673, 0.8624239561110406,
+  0.8639728561215868, 0.8655136240905691, 0.8670462455156926, 0.8685707059713409,
+  0.8700869911087115, 0.871595086655951, 0.8730949784182901, 0.8745866522781761,
+  0.8760700941954066, 0.8775452902072614, 0.8790122264286335, 0.8804708890521608,
+  0.881921264348355, 0.8833633386657316, 0.8847970984309378, 0.8862225301488806,
+  0.8876396204028539, 0.8890483558546646, 0.8904487232447579, 0.8918407093923427,
+  0.8932243011955153, 0.8945994856313827, 0.8959662497561852, 0.8973245807054183,
+  0.8986744656939538, 0.9000158920161603, 0.901348847046022, 0.9026733182372588,
+  0.9039892931234433, 0.9052967593181188, 0.9065957045149153, 0.9078861164876663,
+  0.9091679830905224, 0.9104412922580672, 0.9117060320054299, 0.9129621904283982,
+  0.9142097557035307, 0.9154487160882678, 0.9166790599210427, 0.9179007756213905,
+  0.9191138516900578, 0.9203182767091106, 0.921514039342042, 0.9227011283338786,
+  0.9238795325112867, 0.9250492407826776, 0.9262102421383114, 0.9273625256504011,
+  0.9285060804732156, 0.9296408958431813, 0.9307669610789837, 0.9318842655816681,
+  0.932992798834739, 0.934092550404259, 0.9351835099389476, 0.9362656671702783,
+  0.937339011912575, 0.9384035340631081, 0.9394592236021899, 0.9405060705932683,
+  0.9415440651830208, 0.9425731976014469, 0.9435934581619604, 0.9446048372614803,
+  0.9456073253805213, 0.9466009130832835, 0.9475855910177411, 0.9485613499157303,
+  0.9495281805930367, 0.9504860739494817, 0.9514350209690083, 0.9523750127197659,
+  0.9533060403541939, 0.9542280951091057, 0.9551411683057708, 0.9560452513499964,
+  0.9569403357322088, 0.9578264130275329, 0.9587034748958716, 0.9595715130819845,
+  0.9604305194155658, 0.9612804858113206, 0.9621214042690416, 0.9629532668736839,
+  0.9637760657954398, 0.9645897932898128, 0.9653944416976894, 0.9661900034454125,
+  0.9669764710448521, 0.9677538370934755, 0.9685220942744174, 0.9692812353565485,
+  0.970031253194544, 0.9707721407289504, 0.9715038909862518, 0.9722264970789363,
+  0.9729399522055602, 0.973644249650812, 0.9743393827855759, 0.9750253450669941,
+  0.9757021300385286, 0.9763697313300211, 0.9770281426577544, 0.9776773578245099,
+  0.9783173707196277, 0.9789481753190622, 0.9795697656854405, 0.9801821359681174,
+  0.9807852804032304, 0.9813791933137546, 0.9819638691095552, 0.9825393022874412,
+  0.9831054874312163, 0.9836624192117303, 0.984210092386929, 0.9847485018019042,
+  0.9852776423889412, 0.9857975091675675, 0.9863080972445987, 0.9868094018141855,
+  0.9873014181578584, 0.9877841416445722, 0.9882575677307495, 0.9887216919603238,
+  0.989176509964781, 0.9896220174632009, 0.9900582102622971, 0.9904850842564571,
+  0.99090263542778, 0.9913108598461154, 0.9917097536690995, 0.9920993131421918,
+  0.99247953459871, 0.9928504144598651, 0.9932119492347945, 0.9935641355205953,
+  0.9939069700023561, 0.9942404494531879, 0.9945645707342554, 0.9948793307948056,
+  0.9951847266721969, 0.9954807554919269, 0.9957674144676598, 0.996044700901252,
+  0.996312612182778, 0.9965711457905548, 0.9968202992911657, 0.997060070339483,
+  0.9972904566786902, 0.9975114561403035, 0.9977230666441916, 0.997925286198596,
+  0.9981181129001492, 0.9983015449338929, 0.9984755805732948, 0.9986402181802653,
+  0.9987954562051724, 0.9989412931868569, 0.9990777277526454, 0.9992047586183639,
+  0.9993223845883495, 0.9994306045554617, 0.9995294175010931, 0.9996188224951786,
+  0.9996988186962042, 0.9997694053512153, 0.9998305817958234, 0.9998823474542126,
+  0.9999247018391445, 0.9999576445519639, 0.9999811752826011, 0.9999952938095762,
+  1.0, 0.9999952938095762, 0.9999811752826011, 0.9999576445519639,
+  0.9999247018391445, 0.9998823474542126, 0.9998305817958234, 0.9997694053512153,
+  0.9996988186962042, 0.9996188224951786, 0.9995294175010931, 0.9994306045554617,
+  0.9993223845883495, 0.9992047586183639, 0.9990777277526454, 0.9989412931868569,
+  0.9987954562051724, 0.9986402181802653, 0.9984755805732948, 0.9983015449338929,
+  0.9981181129001492, 0.997925286198596, 0.9977230666441916, 0.9975114561403035,
+  0.9972904566786902, 0.997060070339483, 0.9968202992911657, 0.9965711457905548,
+  0.996312612182778, 0.996044700901252, 0.9957674144676598, 0.9954807554919269,
+  0.9951847266721969, 0.9948793307948056, 0.9945645707342554, 0.9942404494531879,
+  0.9939069700023561, 0.9935641355205953, 0.9932119492347945, 0.9928504144598651,
+  0.99247953459871, 0.9920993131421918, 0.9917097536690995, 0.9913108598461154,
+  0.99090263542778, 0.9904850842564571, 0.9900582102622971, 0.9896220174632009,
+  0.989176509964781, 0.9887216919603238, 0.9882575677307495, 0.9877841416445722,
+  0.9873014181578584, 0.9868094018141855, 0.9863080972445987, 0.9857975091675675,
+  0.9852776423889412, 0.9847485018019042, 0.984210092386929, 0.9836624192117303,
+  0.9831054874312163, 0.9825393022874412, 0.9819638691095552, 0.9813791933137546,
+  0.9807852804032304, 0.9801821359681174, 0.9795697656854405, 0.9789481753190622,
+  0.9783173707196277, 0.9776773578245099, 0.9770281426577544, 0.9763697313300211,
+  0.9757021300385286, 0.9750253450669941, 0.9743393827855759, 0.973644249650812,
+  0.9729399522055602, 0.9722264970789363, 0.9715038909862518, 0.9707721407289504,
+  0.970031253194544, 0.9692812353565485, 0.9685220942744174, 0.9677538370934755,
+  0.9669764710448521, 0.9661900034454125, 0.9653944416976894, 0.9645897932898128,
+  0.9637760657954398, 0.9629532668736839, 0.9621214042690416, 0.9612804858113206,
+  0.9604305194155658, 0.9595715130819845, 0.9587034748958716, 0.9578264130275329,
+  0.9569403357322088, 0.9560452513499964, 0.9551411683057708, 0.9542280951091057,
+  0.9533060403541939, 0.9523750127197659, 0.9514350209690083, 0.9504860739494817,
+  0.9495281805930367, 0.9485613499157303, 0.9475855910177411, 0.9466009130832835,
+  0.9456073253805213, 0.9446048372614803, 0.9435934581619604, 0.9425731976014469,
+  0.9415440651830208, 0.9405060705932683, 0.9394592236021899, 0.9384035340631081,
+  0.937339011912575, 0.9362656671702783, 0.9351835099389476, 0.934092550404259,
+  0.932992798834739, 0.9318842655816681, 0.9307669610789837, 0.9296408958431813,
+  0.9285060804732156, 0.9273625256504011, 0.9262102421383114, 0.9250492407826776,
+  0.9238795325112867, 0.9227011283338786, 0.921514039342042, 0.9203182767091106,
+  0.9191138516900578, 0.9179007756213905, 0.9166790599210427, 0.9154487160882678,
+  0.9142097557035307, 0.9129621904283982, 0.9117060320054299, 0.9104412922580672,
+  0.9091679830905224, 0.9078861164876663, 0.9065957045149153, 0.9052967593181188,
+  0.9039892931234433, 0.9026733182372588, 0.901348847046022, 0.9000158920161603,
+  0.8986744656939538, 0.8973245807054183, 0.8959662497561852, 0.8945994856313827,
+  0.8932243011955153, 0.8918407093923427, 0.8904487232447579, 0.8890483558546646,
+  0.8876396204028539, 0.8862225301488806, 0.8847970984309378, 0.8833633386657316,
+  0.881921264348355, 0.8804708890521608, 0.8790122264286335, 0.8775452902072614,
+  0.8760700941954066, 0.8745866522781761, 0.8730949784182901, 0.871595086655951,
+  0.8700869911087115, 0.8685707059713409, 0.8670462455156926, 0.8655136240905691,
+  0.8639728561215868, 0.8624239561110406, 0.8608669386377673, 0.8593018183570085,
+  0.8577286100002721, 0.8561473283751945, 0.8545579883654005, 0.8529606049303636,
+  0.8513551931052652, 0.8497417680008525, 0.8481203448032972, 0.8464909387740521,
+  0.8448535652497071, 0.8432082396418454, 0.8415549774368984, 0.8398937941959995,
+  0.8382247055548381, 0.836547727223512, 0.83486287498638, 0.8331701647019132,
+  0.8314696123025452, 0.829761233794523, 0.8280450452577558, 0.8263210628456635,
+  0.8245893027850253, 0.8228497813758264, 0.8211025149911046, 0.8193475200767969,
+  0.8175848131515837, 0.8158144108067338, 0.8140363297059484, 0.8122505865852039,
+  0.8104571982525948, 0.808656181588175, 0.8068475535437993, 0.8050313311429637,
+  0.8032075314806449, 0.8013761717231402, 0.799537269107905, 0.7976908409433912,
+  0.7958369046088836, 0.7939754775543372, 0.7921065773002124, 0.79023022143731,
+  0.7883464276266063, 0.7864552135990858, 0.7845565971555752, 0.7826505961665757,
+  0.7807372285720945, 0.778816512381476, 0.7768884656732324, 0.7749531065948739,
+  0.773010453362737, 0.7710605242618138, 0.7691033376455797, 0.7671389119358204,
+  0.765167265622459, 0.7631884172633813, 0.7612023854842618, 0.7592091889783881,
+  0.7572088465064846, 0.7552013768965365, 0.7531867990436125, 0.7511651319096865,
+  0.7491363945234594, 0.7471006059801801, 0.7450577854414661, 0.7430079521351217,
+  0.7409511253549591, 0.7388873244606151, 0.7368165688773699, 0.7347388780959635,
+  0.7326542716724128, 0.7305627692278276, 0.7284643904482252, 0.726359155084346,
+  0.724247082951467, 0.7221281939292153, 0.7200025079613817, 0.7178700450557317,
+  0.7157308252838186, 0.7135848687807936, 0.7114321957452164, 0.7092728264388657,
+  0.7071067811865475, 0.7049340803759049, 0.7027547444572253, 0.7005687939432483,
+  0.6983762494089729, 0.696177131491463, 0.693971460889654, 0.6917592583641577,
+  0.6895405447370668, 0.687315340891759, 0.6850836677727004, 0.6828455463852481,
+  0.680600997795453, 0.6783500431298615, 0.6760927035753159, 0.673829000378756,
+  0.6715589548470183, 0.669282588346636, 0.6669999223036375, 0.6647109782033448,
+  0.6624157775901718, 0.6601143420674205, 0.6578066932970786, 0.6554928529996153,
+  0.6531728429537768, 0.6508466849963809, 0.6485144010221124, 0.6461760129833163,
+  0.6438315428897914, 0.6414810128085832, 0.6391244448637757, 0.6367618612362842,
+  0.6343932841636455, 0.6320187359398091, 0.629638238914927, 0.6272518154951441,
+  0.6248594881423863, 0.62246127937415, 0.6200572117632891, 0.6176473079378039,
+  0.6152315905806268, 0.6128100824294097, 0.6103828062763095, 0.6079497849677736,
+  0.6055110414043255, 0.6030665985403482, 0.600616479383869, 0.5981607069963423,
+  0.5956993044924334, 0.5932322950397998, 0.5907597018588742, 0.5882815482226452,
+  0.5857978574564389, 0.5833086529376983, 0.5808139580957645, 0.5783137964116556,
+  0.5758081914178453, 0.5732971666980422, 0.5707807458869673, 0.5682589526701315,
+  0.5657318107836131, 0.5631993440138341, 0.560661576197336, 0.5581185312205561,
+  0.5555702330196022, 0.5530167055800275, 0.5504579729366048, 0.5478940591731002,
+  0.5453249884220465, 0.5427507848645159, 0.5401714727298929, 0.5375870762956454,
+  0.5349976198870972, 0.5324031278771979, 0.5298036246862946, 0.5271991347819013,
+  0.524589682678469, 0.5219752929371544, 0.5193559901655896, 0.5167317990176499,
+  0.5141027441932217, 0.5114688504379703, 0.508830142543107, 0.5061866453451552,
+  0.5035383837257176, 0.5008853826112407, 0.49822766697278187, 0.49556526182577254,
+  0.49289819222978404, 0.49022648328829116, 0.487550160148436, 0.48486924800079106,
+  0.4821837720791227, 0.479493757660153, 0.4767992300633221, 0.47410021465054997,
+  0.47139673682599764, 0.4686888220358279, 0.4659764957679662, 0.46325978355186015,
+  0.46053871095824, 0.4578133035988772, 0.45508358712634384, 0.4523495872337709,
+  0.44961132965460654, 0.44686884016237416, 0.4441221445704292, 0.44137126873171667,
+  0.43861623853852766, 0.4358570799222555, 0.43309381885315196, 0.4303264813400826,
+  0.4275550934302821, 0.4247796812091088, 0.4220002707997997, 0.4192168883632239,
+  0.41642956009763715, 0.4136383122384345, 0.4108431710579039, 0.4080441628649787,
+  0.40524131400498986, 0.40243465085941843, 0.3996241998456468, 0.3968099874167103,
+  0.3939920400610481, 0.39117038430225387, 0.38834504669882625, 0.38551605384391885,
+  0.3826834323650898, 0.37984720892405116, 0.37700741021641826, 0.37416406297145793,
+  0.37131719395183754, 0.3684668299533723, 0.36561299780477385, 0.3627557243673972,
+  0.3598950365349881, 0.35703096123343, 0.35416352542049034, 0.3512927560855671,
+  0.34841868024943456, 0.3455413249639891, 0.3426607173119944, 0.33977688440682685,
+  0.33688985339222005, 0.3339996514420094, 0.33110630575987643, 0.3282098435790925,
+  0.3253102921622629, 0.32240767880106985, 0.3195020308160157, 0.31659337555616585,
+  0.3136817403988915, 0.3107671527496115, 0.30784964004153487, 0.3049292297354024,
+  0.3020059493192281, 0.2990798263080405, 0.2961508882436238, 0.29321916269425863,
+  0.29028467725446233, 0.2873474595447295, 0.2844075372112719, 0.28146493792575794,
+  0.27851968938505306, 0.27557181931095814, 0.272621355449949, 0.2696683255729151,
+  0.26671275747489837, 0.26375467897483135, 0.2607941179152755, 0.257831102162159,
+  0.25486565960451457, 0.25189781815421697, 0.24892760574572015, 0.2459550503357946,
+  0.24298017990326387, 0.2400030224487415, 0.2370236059943672, 0.23404195858354343,
+  0.2310581082806711, 0.22807208317088573, 0.22508391135979283, 0.2220936209732035,
+  0.2191012401568698, 0.21610679707621952, 0.21311031991609136, 0.2101118368804696,
+  0.20711137619221856, 0.20410896609281687, 0.2011046348420919, 0.19809841071795356,
+  0.19509032201612825, 0.19208039704989244, 0.1890686641498062, 0.18605515166344663,
+  0.18303988795514095, 0.18002290140569951, 0.17700422041214875, 0.17398387338746382,
+  0.17096188876030122, 0.16793829497473117, 0.16491312048996992, 0.16188639378011183,
+  0.15885814333386145, 0.15582839765426523, 0.15279718525844344, 0.1497645346773215,
+  0.14673047445536175, 0.14369503315029447, 0.1406582393328492, 0.13762012158648604,
+  0.13458070850712617, 0.13154002870288312, 0.12849811079379317, 0.12545498341154623,
+  0.1224106751992162, 0.11936521481099135, 0.11631863091190475, 0.11327095217756435,
+  0.11022220729388306, 0.10717242495680884, 0.10412163387205459, 0.10106986275482782,
+  0.0980171403295606, 0.09496349532963899, 0.09190895649713272, 0.0888535525825246,
+  0.0857973123444399, 0.08274026454937569, 0.07968243797143013, 0.07662386139203149,
+  0.07356456359966743, 0.07050457338961386, 0.06744391956366405, 0.06438263092985747,
+  0.06132073630220858, 0.05825826450043575, 0.055195244349689934, 0.052131704680283324,
+  0.049067674327418015, 0.04600318213091462, 0.04293825693494082, 0.03987292758773981,
+  0.03680722294135883, 0.03374117185137758, 0.030674803176636626, 0.02760814577896574,
+  0.024541228522912288, 0.021474080275469508, 0.01840672990580482, 0.0153392062849881,
+  0.012271538285719925, 0.00920375478205982, 0.006135884649154475, 0.003067956762965976,
+  0.0, -0.003067956762965976, -0.006135884649154475, -0.00920375478205982,
+  -0.012271538285719925, -0.0153392062849881, -0.01840672990580482, -0.021474080275469508,
+  -0.024541228522912288, -0.02760814577896574, -0.030674803176636626, -0.03374117185137758,
+  -0.03680722294135883, -0.03987292758773981, -0.04293825693494082, -0.04600318213091462,
+  -0.049067674327418015, -0.052131704680283324, -0.055195244349689934, -0.05825826450043575,
+  -0.06132073630220858, -0.06438263092985747, -0.06744391956366405, -0.07050457338961386,
+  -0.07356456359966743, -0.07662386139203149, -0.07968243797143013, -0.08274026454937569,
+  -0.0857973123444399, -0.0888535525825246, -0.09190895649713272, -0.09496349532963899,
+  -0.0980171403295606, -0.10106986275482782, -0.10412163387205459, -0.10717242495680884,
+  -0.11022220729388306, -0.11327095217756435, -0.11631863091190475, -0.11936521481099135,
+  -0.1224106751992162, -0.12545498341154623, -0.12849811079379317, -0.13154002870288312,
+  -0.13458070850712617, -0.13762012158648604, -0.1406582393328492, -0.14369503315029447,
+  -0.14673047445536175, -0.1497645346773215, -0.15279718525844344, -0.15582839765426523,
+  -0.15885814333386145, -0.16188639378011183, -0.16491312048996992, -0.16793829497473117,
+  -0.17096188876030122, -0.17398387338746382, -0.17700422041214875, -0.18002290140569951,
+  -0.18303988795514095, -0.18605515166344663, -0.1890686641498062, -0.19208039704989244,
+  -0.19509032201612825, -0.19809841071795356, -0.2011046348420919, -0.20410896609281687,
+  -0.20711137619221856, -0.2101118368804696, -0.21311031991609136, -0.21610679707621952,
+  -0.2191012401568698, -0.2220936209732035, -0.22508391135979283, -0.22807208317088573,
+  -0.2310581082806711, -0.23404195858354343, -0.2370236059943672, -0.2400030224487415,
+  -0.24298017990326387, -0.2459550503357946, -0.24892760574572015, -0.25189781815421697,
+  -0.25486565960451457, -0.257831102162159, -0.2607941179152755, -0.26375467897483135,
+  -0.26671275747489837, -0.2696683255729151, -0.272621355449949, -0.27557181931095814,
+  -0.27851968938505306, -0.28146493792575794, -0.2844075372112719, -0.2873474595447295,
+  -0.29028467725446233, -0.29321916269425863, -0.2961508882436238, -0.2990798263080405,
+  -0.3020059493192281, -0.3049292297354024, -0.30784964004153487, -0.3107671527496115,
+  -0.3136817403988915, -0.31659337555616585, -0.3195020308160157, -0.32240767880106985,
+  -0.3253102921622629, -0.3282098435790925, -0.33110630575987643, -0.3339996514420094,
+  -0.33688985339222005, -0.33977688440682685, -0.3426607173119944, -0.3455413249639891,
+  -0.34841868024943456, -0.3512927560855671, -0.35416352542049034, -0.35703096123343,
+  -0.3598950365349881, -0.3627557243673972, -0.36561299780477385, -0.3684668299533723,
+  -0.37131719395183754, -0.37416406297145793, -0.37700741021641826, -0.37984720892405116,
+  -0.3826834323650898, -0.38551605384391885, -0.38834504669882625, -0.39117038430225387,
+  -0.3939920400610481, -0.3968099874167103, -0.3996241998456468, -0.40243465085941843,
+  -0.40524131400498986, -0.4080441628649787, -0.4108431710579039, -0.4136383122384345,
+  -0.41642956009763715, -0.4192168883632239, -0.4220002707997997, -0.4247796812091088,
+  -0.4275550934302821, -0.4303264813400826, -0.43309381885315196, -0.4358570799222555,
+  -0.43861623853852766, -0.44137126873171667, -0.4441221445704292, -0.44686884016237416,
+  -0.44961132965460654, -0.4523495872337709, -0.45508358712634384, -0.4578133035988772,
+  -0.46053871095824, -0.46325978355186015, -0.4659764957679662, -0.4686888220358279,
+  -0.47139673682599764, -0.47410021465054997, -0.4767992300633221, -0.479493757660153,
+  -0.4821837720791227, -0.48486924800079106, -0.487550160148436, -0.49022648328829116,
+  -0.49289819222978404, -0.49556526182577254, -0.49822766697278187, -0.5008853826112407,
+  -0.5035383837257176, -0.5061866453451552, -0.508830142543107, -0.5114688504379703,
+  -0.5141027441932217, -0.5167317990176499, -0.5193559901655896, -0.5219752929371544,
+  -0.524589682678469, -0.5271991347819013, -0.5298036246862946, -0.5324031278771979,
+  -0.5349976198870972, -0.5375870762956454, -0.5401714727298929, -0.5427507848645159,
+  -0.5453249884220465, -0.5478940591731002, -0.5504579729366048, -0.5530167055800275,
+  -0.5555702330196022, -0.5581185312205561, -0.560661576197336, -0.5631993440138341,
+  -0.5657318107836131, -0.5682589526701315, -0.5707807458869673, -0.5732971666980422,
+  -0.5758081914178453, -0.5783137964116556, -0.5808139580957645, -0.5833086529376983,
+  -0.5857978574564389, -0.5882815482226452, -0.5907597018588742, -0.5932322950397998,
+  -0.5956993044924334, -0.5981607069963423, -0.600616479383869, -0.6030665985403482,
+  -0.6055110414043255, -0.6079497849677736, -0.6103828062763095, -0.6128100824294097,
+  -0.6152315905806268, -0.6176473079378039, -0.6200572117632891, -0.62246127937415,
+  -0.6248594881423863, -0.6272518154951441, -0.629638238914927, -0.6320187359398091,
+  -0.6343932841636455, -0.6367618612362842, -0.6391244448637757, -0.6414810128085832,
+  -0.6438315428897914, -0.6461760129833163, -0.6485144010221124, -0.6508466849963809,
+  -0.6531728429537768, -0.6554928529996153, -0.6578066932970786, -0.6601143420674205,
+  -0.6624157775901718, -0.6647109782033448, -0.6669999223036375, -0.669282588346636,
+  -0.6715589548470183, -0.673829000378756, -0.6760927035753159, -0.6783500431298615,
+  -0.680600997795453, -0.6828455463852481, -0.6850836677727004, -0.687315340891759,
+  -0.6895405447370668, -0.6917592583641577, -0.693971460889654, -0.696177131491463,
+  -0.6983762494089729, -0.7005687939432483, -0.7027547444572253, -0.7049340803759049,
+  -0.7071067811865475, -0.7092728264388657, -0.7114321957452164, -0.7135848687807936,
+  -0.7157308252838186, -0.7178700450557317, -0.7200025079613817, -0.7221281939292153,
+  -0.724247082951467, -0.726359155084346, -0.7284643904482252, -0.7305627692278276,
+  -0.7326542716724128, -0.7347388780959635, -0.7368165688773699, -0.7388873244606151,
+  -0.7409511253549591, -0.7430079521351217, -0.7450577854414661, -0.7471006059801801,
+  -0.7491363945234594, -0.7511651319096865, -0.7531867990436125, -0.7552013768965365,
+  -0.7572088465064846, -0.7592091889783881, -0.7612023854842618, -0.7631884172633813,
+  -0.765167265622459, -0.7671389119358204, -0.7691033376455797, -0.7710605242618138,
+  -0.773010453362737, -0.7749531065948739, -0.7768884656732324, -0.778816512381476,
+  -0.7807372285720945, -0.7826505961665757, -0.7845565971555752, -0.7864552135990858,
+  -0.7883464276266063, -0.79023022143731, -0.7921065773002124, -0.7939754775543372,
+  -0.7958369046088836, -0.7976908409433912, -0.799537269107905, -0.8013761717231402,
+  -0.8032075314806449, -0.8050313311429637, -0.8068475535437993, -0.808656181588175,
+  -0.8104571982525948, -0.8122505865852039, -0.8140363297059484, -0.8158144108067338,
+  -0.8175848131515837, -0.8193475200767969, -0.8211025149911046, -0.8228497813758264,
+  -0.8245893027850253, -0.8263210628456635, -0.8280450452577558, -0.829761233794523,
+  -0.8314696123025452, -0.8331701647019132, -0.83486287498638, -0.836547727223512,
+  -0.8382247055548381, -0.8398937941959995, -0.8415549774368984, -0.8432082396418454,
+  -0.8448535652497071, -0.8464909387740521, -0.8481203448032972, -0.8497417680008525,
+  -0.8513551931052652, -0.8529606049303636, -0.8545579883654005, -0.8561473283751945,
+  -0.8577286100002721, -0.8593018183570085, -0.8608669386377673, -0.8624239561110406,
+  -0.8639728561215868, -0.8655136240905691, -0.8670462455156926, -0.8685707059713409,
+  -0.8700869911087115, -0.871595086655951, -0.8730949784182901, -0.8745866522781761,
+  -0.8760700941954066, -0.8775452902072614, -0.8790122264286335, -0.8804708890521608,
+  -0.881921264348355, -0.8833633386657316, -0.8847970984309378, -0.8862225301488806,
+  -0.8876396204028539, -0.8890483558546646, -0.8904487232447579, -0.8918407093923427,
+  -0.8932243011955153, -0.8945994856313827, -0.8959662497561852, -0.8973245807054183,
+  -0.8986744656939538, -0.9000158920161603, -0.901348847046022, -0.9026733182372588,
+  -0.9039892931234433, -0.9052967593181188, -0.9065957045149153, -0.9078861164876663,
+  -0.9091679830905224, -0.9104412922580672, -0.9117060320054299, -0.9129621904283982,
+  -0.9142097557035307, -0.9154487160882678, -0.9166790599210427, -0.9179007756213905,
+  -0.9191138516900578, -0.9203182767091106, -0.921514039342042, -0.9227011283338786,
+  -0.9238795325112867, -0.9250492407826776, -0.9262102421383114, -0.9273625256504011,
+  -0.9285060804732156, -0.9296408958431813, -0.9307669610789837, -0.9318842655816681,
+  -0.932992798834739, -0.934092550404259, -0.9351835099389476, -0.9362656671702783,
+  -0.937339011912575, -0.9384035340631081, -0.9394592236021899, -0.9405060705932683,
+  -0.9415440651830208, -0.9425731976014469, -0.9435934581619604, -0.9446048372614803,
+  -0.9456073253805213, -0.9466009130832835, -0.9475855910177411, -0.9485613499157303,
+  -0.9495281805930367, -0.9504860739494817, -0.9514350209690083, -0.9523750127197659,
+  -0.9533060403541939, -0.9542280951091057, -0.9551411683057708, -0.9560452513499964,
+  -0.9569403357322088, -0.9578264130275329, -0.9587034748958716, -0.9595715130819845,
+  -0.9604305194155658, -0.9612804858113206, -0.9621214042690416, -0.9629532668736839,
+  -0.9637760657954398, -0.9645897932898128, -0.9653944416976894, -0.9661900034454125,
+  -0.9669764710448521, -0.9677538370934755, -0.9685220942744174, -0.9692812353565485,
+  -0.970031253194544, -0.9707721407289504, -0.9715038909862518, -0.9722264970789363,
+  -0.9729399522055602, -0.973644249650812, -0.9743393827855759, -0.9750253450669941,
+  -0.9757021300385286, -0.9763697313300211, -0.9770281426577544, -0.9776773578245099,
+  -0.9783173707196277, -0.9789481753190622, -0.9795697656854405, -0.9801821359681174,
+  -0.9807852804032304, -0.9813791933137546, -0.9819638691095552, -0.9825393022874412,
+  -0.9831054874312163, -0.9836624192117303, -0.984210092386929, -0.9847485018019042,
+  -0.9852776423889412, -0.9857975091675675, -0.9863080972445987, -0.9868094018141855,
+  -0.9873014181578584, -0.9877841416445722, -0.9882575677307495, -0.9887216919603238,
+  -0.989176509964781, -0.9896220174632009, -0.9900582102622971, -0.9904850842564571,
+  -0.99090263542778, -0.9913108598461154, -0.9917097536690995, -0.9920993131421918,
+  -0.99247953459871, -0.9928504144598651, -0.9932119492347945, -0.9935641355205953,
+  -0.9939069700023561, -0.9942404494531879, -0.9945645707342554, -0.9948793307948056,
+  -0.9951847266721969, -0.9954807554919269, -0.9957674144676598, -0.996044700901252,
+  -0.996312612182778, -0.9965711457905548, -0.9968202992911657, -0.997060070339483,
+  -0.9972904566786902, -0.9975114561403035, -0.9977230666441916, -0.997925286198596,
+  -0.9981181129001492, -0.9983015449338929, -0.9984755805732948, -0.9986402181802653,
+  -0.9987954562051724, -0.9989412931868569, -0.9990777277526454, -0.9992047586183639,
+  -0.9993223845883495, -0.9994306045554617, -0.9995294175010931, -0.9996188224951786,
+  -0.9996988186962042, -0.9997694053512153, -0.9998305817958234, -0.9998823474542126,
+  -0.9999247018391445, -0.9999576445519639, -0.9999811752826011, -0.9999952938095762,
+  -1.0, -0.9999952938095762, -0.9999811752826011, -0.9999576445519639,
+  -0.9999247018391445, -0.9998823474542126, -0.9998305817958234, -0.9997694053512153,
+  -0.9996988186962042, -0.9996188224951786, -0.9995294175010931, -0.9994306045554617,
+  -0.9993223845883495, -0.9992047586183639, -0.9990777277526454, -0.9989412931868569,
+  -0.9987954562051724, -0.9986402181802653, -0.9984755805732948, -0.9983015449338929,
+  -0.9981181129001492, -0.997925286198596, -0.9977230666441916, -0.9975114561403035,
+  -0.9972904566786902, -0.997060070339483, -0.9968202992911657, -0.9965711457905548,
+  -0.996312612182778, -0.996044700901252, -0.9957674144676598, -0.9954807554919269,
+  -0.9951847266721969, -0.9948793307948056, -0.9945645707342554, -0.9942404494531879,
+  -0.9939069700023561, -0.9935641355205953, -0.9932119492347945, -0.9928504144598651,
+  -0.99247953459871, -0.9920993131421918, -0.9917097536690995, -0.9913108598461154,
+  -0.99090263542778, -0.9904850842564571, -0.9900582102622971, -0.9896220174632009,
+  -0.989176509964781, -0.9887216919603238, -0.9882575677307495, -0.9877841416445722,
+  -0.9873014181578584, -0.9868094018141855, -0.9863080972445987, -0.9857975091675675,
+  -0.9852776423889412, -0.9847485018019042, -0.984210092386929, -0.9836624192117303,
+  -0.9831054874312163, -0.9825393022874412, -0.9819638691095552, -0.9813791933137546,
+  -0.9807852804032304, -0.9801821359681174, -0.9795697656854405, -0.9789481753190622,
+  -0.9783173707196277, -0.9776773578245099, -0.9770281426577544, -0.9763697313300211,
+  -0.9757021300385286, -0.9750253450669941, -0.9743393827855759, -0.973644249650812,
+  -0.9729399522055602, -0.9722264970789363, -0.9715038909862518, -0.9707721407289504,
+  -0.970031253194544, -0.9692812353565485, -0.9685220942744174, -0.9677538370934755,
+  -0.9669764710448521, -0.9661900034454125, -0.9653944416976894, -0.9645897932898128,
+  -0.9637760657954398, -0.9629532668736839, -0.9621214042690416, -0.9612804858113206,
+  -0.9604305194155658, -0.9595715130819845, -0.9587034748958716, -0.9578264130275329,
+  -0.9569403357322088, -0.9560452513499964, -0.9551411683057708, -0.9542280951091057,
+  -0.9533060403541939, -0.9523750127197659, -0.9514350209690083, -0.9504860739494817,
+  -0.9495281805930367, -0.9485613499157303, -0.9475855910177411, -0.9466009130832835,
+  -0.9456073253805213, -0.9446048372614803, -0.9435934581619604, -0.9425731976014469,
+  -0.9415440651830208, -0.9405060705932683, -0.9394592236021899, -0.9384035340631081,
+  -0.937339011912575, -0.9362656671702783, -0.9351835099389476, -0.934092550404259,
+  -0.932992798834739, -0.9318842655816681, -0.9307669610789837, -0.9296408958431813,
+  -0.9285060804732156, -0.9273625256504011, -0.9262102421383114, -0.9250492407826776,
+  -0.9238795325112867, -0.9227011283338786, -0.921514039342042, -0.9203182767091106,
+  -0.9191138516900578, -0.9179007756213905, -0.9166790599210427, -0.9154487160882678,
+  -0.9142097557035307, -0.9129621904283982, -0.9117060320054299, -0.9104412922580672,
+  -0.9091679830905224, -0.9078861164876663, -0.9065957045149153, -0.9052967593181188,
+  -0.9039892931234433, -0.9026733182372588, -0.901348847046022, -0.9000158920161603,
+  -0.8986744656939538, -0.8973245807054183, -0.8959662497561852, -0.8945994856313827,
+  -0.8932243011955153, -0.8918407093923427, -0.8904487232447579, -0.8890483558546646,
+  -0.8876396204028539, -0.8862225301488806, -0.8847970984309378, -0.8833633386657316,
+  -0.881921264348355, -0.8804708890521608, -0.8790122264286335, -0.8775452902072614,
+  -0.8760700941954066, -0.8745866522781761, -0.8730949784182901, -0.871595086655951,
+  -0.8700869911087115, -0.8685707059713409, -0.8670462455156926, -0.8655136240905691,
+  -0.8639728561215868, -0.8624239561110406, -0.8608669386377673, -0.8593018183570085,
+  -0.8577286100002721, -0.8561473283751945, -0.8545579883654005, -0.8529606049303636,
+  -0.8513551931052652, -0.8497417680008525, -0.8481203448032972, -0.8464909387740521,
+  -0.8448535652497071, -0.8432082396418454, -0.8415549774368984, -0.8398937941959995,
+  -0.8382247055548381, -0.836547727223512, -0.83486287498638, -0.8331701647019132,
+  -0.8314696123025452, -0.829761233794523, -0.8280450452577558, -0.8263210628456635,
+  -0.8245893027850253, -0.8228497813758264, -0.8211025149911046, -0.8193475200767969,
+  -0.8175848131515837, -0.8158144108067338, -0.8140363297059484, -0.8122505865852039,
+  -0.8104571982525948, -0.808656181588175, -0.8068475535437993, -0.8050313311429637,
+  -0.8032075314806449, -0.8013761717231402, -0.799537269107905, -0.7976908409433912,
+  -0.7958369046088836, -0.7939754775543372, -0.7921065773002124, -0.79023022143731,
+  -0.7883464276266063, -0.7864552135990858, -0.7845565971555752, -0.7826505961665757,
+  -0.7807372285720945, -0.778816512381476, -0.7768884656732324, -0.7749531065948739,
+  -0.773010453362737, -0.7710605242618138, -0.7691033376455797, -0.7671389119358204,
+  -0.765167265622459, -0.7631884172633813, -0.7612023854842618, -0.7592091889783881,
+  -0.7572088465064846, -0.7552013768965365, -0.7531867990436125, -0.7511651319096865,
+  -0.7491363945234594, -0.7471006059801801, -0.7450577854414661, -0.7430079521351217,
+  -0.7409511253549591, -0.7388873244606151, -0.7368165688773699, -0.7347388780959635,
+  -0.7326542716724128, -0.7305627692278276, -0.7284643904482252, -0.726359155084346,
+  -0.724247082951467, -0.7221281939292153, -0.7200025079613817, -0.7178700450557317,
+  -0.7157308252838186, -0.7135848687807936, -0.7114321957452164, -0.7092728264388657,
+  -0.7071067811865475, -0.7049340803759049, -0.7027547444572253, -0.7005687939432483,
+  -0.6983762494089729, -0.696177131491463, -0.693971460889654, -0.6917592583641577,
+  -0.6895405447370668, -0.687315340891759, -0.6850836677727004, -0.6828455463852481,
+  -0.680600997795453, -0.6783500431298615, -0.6760927035753159, -0.673829000378756,
+  -0.6715589548470183, -0.669282588346636, -0.6669999223036375, -0.6647109782033448,
+  -0.6624157775901718, -0.6601143420674205, -0.6578066932970786, -0.6554928529996153,
+  -0.6531728429537768, -0.6508466849963809, -0.6485144010221124, -0.6461760129833163,
+  -0.6438315428897914, -0.6414810128085832, -0.6391244448637757, -0.6367618612362842,
+  -0.6343932841636455, -0.6320187359398091, -0.629638238914927, -0.6272518154951441,
+  -0.6248594881423863, -0.62246127937415, -0.6200572117632891, -0.6176473079378039,
+  -0.6152315905806268, -0.6128100824294097, -0.6103828062763095, -0.6079497849677736,
+  -0.6055110414043255, -0.6030665985403482, -0.600616479383869, -0.5981607069963423,
+  -0.5956993044924334, -0.5932322950397998, -0.5907597018588742, -0.5882815482226452,
+  -0.5857978574564389, -0.5833086529376983, -0.5808139580957645, -0.5783137964116556,
+  -0.5758081914178453, -0.5732971666980422, -0.5707807458869673, -0.5682589526701315,
+  -0.5657318107836131, -0.5631993440138341, -0.560661576197336, -0.5581185312205561,
+  -0.5555702330196022, -0.5530167055800275, -0.5504579729366048, -0.5478940591731002,
+  -0.5453249884220465, -0.5427507848645159, -0.5401714727298929, -0.5375870762956454,
+  -0.5349976198870972, -0.5324031278771979, -0.5298036246862946, -0.5271991347819013,
+  -0.524589682678469, -0.5219752929371544, -0.5193559901655896, -0.5167317990176499,
+  -0.5141027441932217, -0.5114688504379703, -0.508830142543107, -0.5061866453451552,
+  -0.5035383837257176, -0.5008853826112407, -0.49822766697278187, -0.49556526182577254,
+  -0.49289819222978404, -0.49022648328829116, -0.487550160148436, -0.48486924800079106,
+  -0.4821837720791227, -0.479493757660153, -0.4767992300633221, -0.47410021465054997,
+  -0.47139673682599764, -0.4686888220358279, -0.4659764957679662, -0.46325978355186015,
+  -0.46053871095824, -0.4578133035988772, -0.45508358712634384, -0.4523495872337709,
+  -0.44961132965460654, -0.44686884016237416, -0.4441221445704292, -0.44137126873171667,
+  -0.43861623853852766, -0.4358570799222555, -0.43309381885315196, -0.4303264813400826,
+  -0.4275550934302821, -0.4247796812091088, -0.4220002707997997, -0.4192168883632239,
+  -0.41642956009763715, -0.4136383122384345, -0.4108431710579039, -0.4080441628649787,
+  -0.40524131400498986, -0.40243465085941843, -0.3996241998456468, -0.3968099874167103,
+  -0.3939920400610481, -0.39117038430225387, -0.38834504669882625, -0.38551605384391885,
+  -0.3826834323650898, -0.37984720892405116, -0.37700741021641826, -0.37416406297145793,
+  -0.37131719395183754, -0.3684668299533723, -0.36561299780477385, -0.3627557243673972,
+  -0.3598950365349881, -0.35703096123343, -0.35416352542049034, -0.3512927560855671,
+  -0.34841868024943456, -0.3455413249639891, -0.3426607173119944, -0.33977688440682685,
+  -0.33688985339222005, -0.3339996514420094, -0.33110630575987643, -0.3282098435790925,
+  -0.3253102921622629, -0.32240767880106985, -0.3195020308160157, -0.31659337555616585,
+  -0.3136817403988915, -0.3107671527496115, -0.30784964004153487, -0.3049292297354024,
+  -0.3020059493192281, -0.2990798263080405, -0.2961508882436238, -0.29321916269425863,
+  -0.29028467725446233, -0.2873474595447295, -0.2844075372112719, -0.28146493792575794,
+  -0.27851968938505306, -0.27557181931095814, -0.272621355449949, -0.2696683255729151,
+  -0.26671275747489837, -0.26375467897483135, -0.2607941179152755, -0.257831102162159,
+  -0.25486565960451457, -0.25189781815421697, -0.24892760574572015, -0.2459550503357946,
+  -0.24298017990326387, -0.2400030224487415, -0.2370236059943672, -0.23404195858354343,
+  -0.2310581082806711, -0.22807208317088573, -0.22508391135979283, -0.2220936209732035,
+  -0.2191012401568698, -0.21610679707621952, -0.21311031991609136, -0.2101118368804696,
+  -0.20711137619221856, -0.20410896609281687, -0.2011046348420919, -0.19809841071795356,
+  -0.19509032201612825, -0.19208039704989244, -0.1890686641498062, -0.18605515166344663,
+  -0.18303988795514095, -0.18002290140569951, -0.17700422041214875, -0.17398387338746382,
+  -0.17096188876030122, -0.16793829497473117, -0.16491312048996992, -0.16188639378011183,
+  -0.15885814333386145, -0.15582839765426523, -0.15279718525844344, -0.1497645346773215,
+  -0.14673047445536175, -0.14369503315029447, -0.1406582393328492, -0.13762012158648604,
+  -0.13458070850712617, -0.13154002870288312, -0.12849811079379317, -0.12545498341154623,
+  -0.1224106751992162, -0.11936521481099135, -0.11631863091190475, -0.11327095217756435,
+  -0.11022220729388306, -0.10717242495680884, -0.10412163387205459, -0.10106986275482782,
+  -0.0980171403295606, -0.09496349532963899, -0.09190895649713272, -0.0888535525825246,
+  -0.0857973123444399, -0.08274026454937569, -0.07968243797143013, -0.07662386139203149,
+  -0.07356456359966743, -0.07050457338961386, -0.06744391956366405, -0.06438263092985747,
+  -0.06132073630220858, -0.05825826450043575, -0.055195244349689934, -0.052131704680283324,
+  -0.049067674327418015, -0.04600318213091462, -0.04293825693494082, -0.03987292758773981,
+  -0.03680722294135883, -0.03374117185137758, -0.030674803176636626, -0.02760814577896574,
+  -0.024541228522912288, -0.021474080275469508, -0.01840672990580482, -0.0153392062849881,
+  -0.012271538285719925, -0.00920375478205982, -0.006135884649154475, -0.003067956762965976,
+  0.0, 0.003067956762965976, 0.006135884649154475, 0.00920375478205982,
+  0.012271538285719925, 0.0153392062849881, 0.01840672990580482, 0.021474080275469508,
+  0.024541228522912288, 0.02760814577896574, 0.030674803176636626, 0.03374117185137758,
+  0.03680722294135883, 0.03987292758773981, 0.04293825693494082, 0.04600318213091462,
+  0.049067674327418015, 0.052131704680283324, 0.055195244349689934, 0.05825826450043575,
+  0.06132073630220858, 0.06438263092985747, 0.06744391956366405, 0.07050457338961386,
+  0.07356456359966743, 0.07662386139203149, 0.07968243797143013, 0.08274026454937569,
+  0.0857973123444399, 0.0888535525825246, 0.09190895649713272, 0.09496349532963899,
+  0.0980171403295606, 0.10106986275482782, 0.10412163387205459, 0.10717242495680884,
+  0.11022220729388306, 0.11327095217756435, 0.11631863091190475, 0.11936521481099135,
+  0.1224106751992162, 0.12545498341154623, 0.12849811079379317, 0.13154002870288312,
+  0.13458070850712617, 0.13762012158648604, 0.1406582393328492, 0.14369503315029447,
+  0.14673047445536175, 0.1497645346773215, 0.15279718525844344, 0.15582839765426523,
+  0.15885814333386145, 0.16188639378011183, 0.16491312048996992, 0.16793829497473117,
+  0.17096188876030122, 0.17398387338746382, 0.17700422041214875, 0.18002290140569951,
+  0.18303988795514095, 0.18605515166344663, 0.1890686641498062, 0.19208039704989244,
+  0.19509032201612825, 0.19809841071795356, 0.2011046348420919, 0.20410896609281687,
+  0.20711137619221856, 0.2101118368804696, 0.21311031991609136, 0.21610679707621952,
+  0.2191012401568698, 0.2220936209732035, 0.22508391135979283, 0.22807208317088573,
+  0.2310581082806711, 0.23404195858354343, 0.2370236059943672, 0.2400030224487415,
+  0.24298017990326387, 0.2459550503357946, 0.24892760574572015, 0.25189781815421697,
+  0.25486565960451457, 0.257831102162159, 0.2607941179152755, 0.26375467897483135,
+  0.26671275747489837, 0.2696683255729151, 0.272621355449949, 0.27557181931095814,
+  0.27851968938505306, 0.28146493792575794, 0.2844075372112719, 0.2873474595447295,
+  0.29028467725446233, 0.29321916269425863, 0.2961508882436238, 0.2990798263080405,
+  0.3020059493192281, 0.3049292297354024, 0.30784964004153487, 0.3107671527496115,
+  0.3136817403988915, 0.31659337555616585, 0.3195020308160157, 0.32240767880106985,
+  0.3253102921622629, 0.3282098435790925, 0.33110630575987643, 0.3339996514420094,
+  0.33688985339222005, 0.33977688440682685, 0.3426607173119944, 0.3455413249639891,
+  0.34841868024943456, 0.3512927560855671, 0.35416352542049034, 0.35703096123343,
+  0.3598950365349881, 0.3627557243673972, 0.36561299780477385, 0.3684668299533723,
+  0.37131719395183754, 0.37416406297145793, 0.37700741021641826, 0.37984720892405116,
+  0.3826834323650898, 0.38551605384391885, 0.38834504669882625, 0.39117038430225387,
+  0.3939920400610481, 0.3968099874167103, 0.3996241998456468, 0.40243465085941843,
+  0.40524131400498986, 0.4080441628649787, 0.4108431710579039, 0.4136383122384345,
+  0.41642956009763715, 0.4192168883632239, 0.4220002707997997, 0.4247796812091088,
+  0.4275550934302821, 0.4303264813400826, 0.43309381885315196, 0.4358570799222555,
+  0.43861623853852766, 0.44137126873171667, 0.4441221445704292, 0.44686884016237416,
+  0.44961132965460654, 0.4523495872337709, 0.45508358712634384, 0.4578133035988772,
+  0.46053871095824, 0.46325978355186015, 0.4659764957679662, 0.4686888220358279,
+  0.47139673682599764, 0.47410021465054997, 0.4767992300633221, 0.479493757660153,
+  0.4821837720791227, 0.48486924800079106, 0.487550160148436, 0.49022648328829116,
+  0.49289819222978404, 0.49556526182577254, 0.49822766697278187, 0.5008853826112407,
+  0.5035383837257176, 0.5061866453451552, 0.508830142543107, 0.5114688504379703,
+  0.5141027441932217, 0.5167317990176499, 0.5193559901655896, 0.5219752929371544,
+  0.524589682678469, 0.5271991347819013, 0.5298036246862946, 0.5324031278771979,
+  0.5349976198870972, 0.5375870762956454, 0.5401714727298929, 0.5427507848645159,
+  0.5453249884220465, 0.5478940591731002, 0.5504579729366048, 0.5530167055800275,
+  0.5555702330196022, 0.5581185312205561, 0.560661576197336, 0.5631993440138341,
+  0.5657318107836131, 0.5682589526701315, 0.5707807458869673, 0.5732971666980422,
+  0.5758081914178453, 0.5783137964116556, 0.5808139580957645, 0.5833086529376983,
+  0.5857978574564389, 0.5882815482226452, 0.5907597018588742, 0.5932322950397998,
+  0.5956993044924334, 0.5981607069963423, 0.600616479383869, 0.6030665985403482,
+  0.6055110414043255, 0.6079497849677736, 0.6103828062763095, 0.6128100824294097,
+  0.6152315905806268, 0.6176473079378039, 0.6200572117632891, 0.62246127937415,
+  0.6248594881423863, 0.6272518154951441, 0.629638238914927, 0.6320187359398091,
+  0.6343932841636455, 0.6367618612362842, 0.6391244448637757, 0.6414810128085832,
+  0.6438315428897914, 0.6461760129833163, 0.6485144010221124, 0.6508466849963809,
+  0.6531728429537768, 0.6554928529996153, 0.6578066932970786, 0.6601143420674205,
+  0.6624157775901718, 0.6647109782033448, 0.6669999223036375, 0.669282588346636,
+  0.6715589548470183, 0.673829000378756, 0.6760927035753159, 0.6783500431298615,
+  0.680600997795453, 0.6828455463852481, 0.6850836677727004, 0.687315340891759,
+  0.6895405447370668, 0.6917592583641577, 0.693971460889654, 0.696177131491463,
+  0.6983762494089729, 0.7005687939432483, 0.7027547444572253, 0.7049340803759049,
+  0.7071067811865475, 0.7092728264388657, 0.7114321957452164, 0.7135848687807936,
+  0.7157308252838186, 0.7178700450557317, 0.7200025079613817, 0.7221281939292153,
+  0.724247082951467, 0.726359155084346, 0.7284643904482252, 0.7305627692278276,
+  0.7326542716724128, 0.7347388780959635, 0.7368165688773699, 0.7388873244606151,
+  0.7409511253549591, 0.7430079521351217, 0.7450577854414661, 0.7471006059801801,
+  0.7491363945234594, 0.7511651319096865, 0.7531867990436125, 0.7552013768965365,
+  0.7572088465064846, 0.7592091889783881, 0.7612023854842618, 0.7631884172633813,
+  0.765167265622459, 0.7671389119358204, 0.7691033376455797, 0.7710605242618138,
+  0.773010453362737, 0.7749531065948739, 0.7768884656732324, 0.778816512381476,
+  0.7807372285720945, 0.7826505961665757, 0.7845565971555752, 0.7864552135990858,
+  0.7883464276266063, 0.79023022143731, 0.7921065773002124, 0.7939754775543372,
+  0.7958369046088836, 0.7976908409433912, 0.799537269107905, 0.8013761717231402,
+  0.8032075314806449, 0.8050313311429637, 0.8068475535437993, 0.808656181588175,
+  0.8104571982525948, 0.8122505865852039, 0.8140363297059484, 0.8158144108067338,
+  0.8175848131515837, 0.8193475200767969, 0.8211025149911046, 0.8228497813758264,
+  0.8245893027850253, 0.8263210628456635, 0.8280450452577558, 0.829761233794523,
+  0.8314696123025452, 0.8331701647019132, 0.83486287498638, 0.836547727223512,
+  0.8382247055548381, 0.8398937941959995, 0.8415549774368984, 0.8432082396418454,
+  0.8448535652497071, 0.8464909387740521, 0.8481203448032972, 0.8497417680008525,
+  0.8513551931052652, 0.8529606049303636, 0.8545579883654005, 0.8561473283751945,
+  0.8577286100002721, 0.8593018183570085, 0.8608669386377673, 0.8624239561110406,
+  0.8639728561215868, 0.8655136240905691, 0.8670462455156926, 0.8685707059713409,
+  0.8700869911087115, 0.871595086655951, 0.8730949784182901, 0.8745866522781761,
+  0.8760700941954066, 0.8775452902072614, 0.8790122264286335, 0.8804708890521608,
+  0.881921264348355, 0.8833633386657316, 0.8847970984309378, 0.8862225301488806,
+  0.8876396204028539, 0.8890483558546646, 0.8904487232447579, 0.8918407093923427,
+  0.8932243011955153, 0.8945994856313827, 0.8959662497561852, 0.8973245807054183,
+  0.8986744656939538, 0.9000158920161603, 0.901348847046022, 0.9026733182372588,
+  0.9039892931234433, 0.9052967593181188, 0.9065957045149153, 0.9078861164876663,
+  0.9091679830905224, 0.9104412922580672, 0.9117060320054299, 0.9129621904283982,
+  0.9142097557035307, 0.9154487160882678, 0.9166790599210427, 0.9179007756213905,
+  0.9191138516900578, 0.9203182767091106, 0.921514039342042, 0.9227011283338786,
+  0.9238795325112867, 0.9250492407826776, 0.9262102421383114, 0.9273625256504011,
+  0.9285060804732156, 0.9296408958431813, 0.9307669610789837, 0.9318842655816681,
+  0.932992798834739, 0.934092550404259, 0.9351835099389476, 0.9362656671702783,
+  0.937339011912575, 0.9384035340631081, 0.9394592236021899, 0.9405060705932683,
+  0.9415440651830208, 0.9425731976014469, 0.9435934581619604, 0.9446048372614803,
+  0.9456073253805213, 0.9466009130832835, 0.9475855910177411, 0.9485613499157303,
+  0.9495281805930367, 0.9504860739494817, 0.9514350209690083, 0.9523750127197659,
+  0.9533060403541939, 0.9542280951091057, 0.9551411683057708, 0.9560452513499964,
+  0.9569403357322088, 0.9578264130275329, 0.9587034748958716, 0.9595715130819845,
+  0.9604305194155658, 0.9612804858113206, 0.9621214042690416, 0.9629532668736839,
+  0.9637760657954398, 0.9645897932898128, 0.9653944416976894, 0.9661900034454125,
+  0.9669764710448521, 0.9677538370934755, 0.9685220942744174, 0.9692812353565485,
+  0.970031253194544, 0.9707721407289504, 0.9715038909862518, 0.9722264970789363,
+  0.9729399522055602, 0.973644249650812, 0.9743393827855759, 0.9750253450669941,
+  0.9757021300385286, 0.9763697313300211, 0.9770281426577544, 0.9776773578245099,
+  0.9783173707196277, 0.9789481753190622, 0.9795697656854405, 0.9801821359681174,
+  0.9807852804032304, 0.9813791933137546, 0.9819638691095552, 0.9825393022874412,
+  0.9831054874312163, 0.9836624192117303, 0.984210092386929, 0.9847485018019042,
+  0.9852776423889412, 0.9857975091675675, 0.9863080972445987, 0.9868094018141855,
+  0.9873014181578584, 0.9877841416445722, 0.9882575677307495, 0.9887216919603238,
+  0.989176509964781, 0.9896220174632009, 0.9900582102622971, 0.9904850842564571,
+  0.99090263542778, 0.9913108598461154, 0.9917097536690995, 0.9920993131421918,
+  0.99247953459871, 0.9928504144598651, 0.9932119492347945, 0.9935641355205953,
+  0.9939069700023561, 0.9942404494531879, 0.9945645707342554, 0.9948793307948056,
+  0.9951847266721969, 0.9954807554919269, 0.9957674144676598, 0.996044700901252,
+  0.996312612182778, 0.9965711457905548, 0.9968202992911657, 0.997060070339483,
+  0.9972904566786902, 0.9975114561403035, 0.9977230666441916, 0.997925286198596,
+  0.9981181129001492, 0.9983015449338929, 0.9984755805732948, 0.9986402181802653,
+  0.9987954562051724, 0.9989412931868569, 0.9990777277526454, 0.9992047586183639,
+  0.9993223845883495, 0.9994306045554617, 0.9995294175010931, 0.9996188224951786,
+  0.9996988186962042, 0.9997694053512153, 0.9998305817958234, 0.9998823474542126,
+  0.9999247018391445, 0.9999576445519639, 0.9999811752826011, 0.9999952938095762,
+  1.0,
+};
+
+static const unsigned int bitrev_2048[2048] =
+{
+  0, 1024, 512, 1536,
+  256, 1280, 768, 1792,
+  128, 1152, 640, 1664,
+  384, 1408, 896, 1920,
+  64, 1088, 576, 1600,
+  320, 1344, 832, 1856,
+  192, 1216, 704, 1728,
+  448, 1472, 960, 1984,
+  32, 1056, 544, 1568,
+  288, 1312, 800, 1824,
+  160, 1184, 672, 1696,
+  416, 1440, 928, 1952,
+  96, 1120, 608, 1632,
+  352, 1376, 864, 1888,
+  224, 1248, 736, 1760,
+  480, 1504, 992, 2016,
+  16, 1040, 528, 1552,
+  272, 1296, 784, 1808,
+  144, 1168, 656, 1680,
+  400, 1424, 912, 1936,
+  80, 1104, 592, 1616,
+  336, 1360, 848, 1872,
+  208, 1232, 720, 1744,
+  464, 1488, 976, 2000,
+  48, 1072, 560, 1584,
+  304, 1328, 816, 1840,
+  176, 1200, 688, 1712,
+  432, 1456, 944, 1968,
+  112, 1136, 624, 1648,
+  368, 1392, 880, 1904,
+  240, 1264, 752, 1776,
+  496, 1520, 1008, 2032,
+  8, 1032, 520, 1544,
+  264, 1288, 776, 1800,
+  136, 1160, 648, 1672,
+  392, 1416, 904, 1928,
+  72, 1096, 584, 1608,
+  328, 1352, 840, 1864,
+  200, 1224, 712, 1736,
+  456, 1480, 968, 1992,
+  40, 1064, 552, 1576,
+  296, 1320, 808, 1832,
+  168, 1192, 680, 1704,
+  424, 1448, 936, 1960,
+  104, 1128, 616, 1640,
+  360, 1384, 872, 1896,
+  232, 1256, 744, 1768,
+  488, 1512, 1000, 2024,
+  24, 1048, 536, 1560,
+  280, 1304, 792, 1816,
+  152, 1176, 664, 1688,
+  408, 1432, 920, 1944,
+  88, 1112, 600, 1624,
+  344, 1368, 856, 1880,
+  216, 1240, 728, 1752,
+  472, 1496, 984, 2008,
+  56, 1080, 568, 1592,
+  312, 1336, 824, 1848,
+  184, 1208, 696, 1720,
+  440, 1464, 952, 1976,
+  120, 1144, 632, 1656,
+  376, 1400, 888, 1912,
+  248, 1272, 760, 1784,
+  504, 1528, 1016, 2040,
+  4, 1028, 516, 1540,
+  260, 1284, 772, 1796,
+  132, 1156, 644, 1668,
+  388, 1412, 900, 1924,
+  68, 1092, 580, 1604,
+  324, 1348, 836, 1860,
+  196, 1220, 708, 1732,
+  452, 1476, 964, 1988,
+  36, 1060, 548, 1572,
+  292, 1316, 804, 1828,
+  164, 1188, 676, 1700,
+  420, 1444, 932, 1956,
+  100, 1124, 612, 1636,
+  356, 1380, 868, 1892,
+  228, 1252, 740, 1764,
+  484, 1508, 996, 2020,
+  20, 1044, 532, 1556,
+  276, 1300, 788, 1812,
+  148, 1172, 660, 1684,
+  404, 1428, 916, 1940,
+  84, 1108, 596, 1620,
+  340, 1364, 852, 1876,
+  212, 1236, 724, 1748,
+  468, 1492, 980, 2004,
+  52, 1076, 564, 1588,
+  308, 1332, 820, 1844,
+  180, 1204, 692, 1716,
+  436, 1460, 948, 1972,
+  116, 1140, 628, 1652,
+  372, 1396, 884, 1908,
+  244, 1268, 756, 1780,
+  500, 1524, 1012, 2036,
+  12, 1036, 524, 1548,
+  268, 1292, 780, 1804,
+  140, 1164, 652, 1676,
+  396, 1420, 908, 1932,
+  76, 1100, 588, 1612,
+  332, 1356, 844, 1868,
+  204, 1228, 716, 1740,
+  460, 1484, 972, 1996,
+  44, 1068, 556, 1580,
+  300, 1324, 812, 1836,
+  172, 1196, 684, 1708,
+  428, 1452, 940, 1964,
+  108, 1132, 620, 1644,
+  364, 1388, 876, 1900,
+  236, 1260, 748, 1772,
+  492, 1516, 1004, 2028,
+  28, 1052, 540, 1564,
+  284, 1308, 796, 1820,
+  156, 1180, 668, 1692,
+  412, 1436, 924, 1948,
+  92, 1116, 604, 1628,
+  348, 1372, 860, 1884,
+  220, 1244, 732, 1756,
+  476, 1500, 988, 2012,
+  60, 1084, 572, 1596,
+  316, 1340, 828, 1852,
+  188, 1212, 700, 1724,
+  444, 1468, 956, 1980,
+  124, 1148, 636, 1660,
+  380, 1404, 892, 1916,
+  252, 1276, 764, 1788,
+  508, 1532, 1020, 2044,
+  2, 1026, 514, 1538,
+  258, 1282, 770, 1794,
+  130, 1154, 642, 1666,
+  386, 1410, 898, 1922,
+  66, 1090, 578, 1602,
+  322, 1346, 834, 1858,
+  194, 1218, 706, 1730,
+  450, 1474, 962, 1986,
+  34, 1058, 546, 1570,
+  290, 1314, 802, 1826,
+  162, 1186, 674, 1698,
+  418, 1442, 930, 1954,
+  98, 1122, 610, 1634,
+  354, 1378, 866, 1890,
+  226, 1250, 738, 1762,
+  482, 1506, 994, 2018,
+  18, 1042, 530, 1554,
+  274, 1298, 786, 1810,
+  146, 1170, 658, 1682,
+  402, 1426, 914, 1938,
+  82, 1106, 594, 1618,
+  338, 1362, 850, 1874,
+  210, 1234, 722, 1746,
+  466, 1490, 978, 2002,
+  50, 1074, 562, 1586,
+  306, 1330, 818, 1842,
+  178, 1202, 690, 1714,
+  434, 1458, 946, 1970,
+  114, 1138, 626, 1650,
+  370, 1394, 882, 1906,
+  242, 1266, 754, 1778,
+  498, 1522, 1010, 2034,
+  10, 1034, 522, 1546,
+  266, 1290, 778, 1802,
+  138, 1162, 650, 1674,
+  394, 1418, 906, 1930,
+  74, 1098, 586, 1610,
+  330, 1354, 842, 1866,
+  202, 1226, 714, 1738,
+  458, 1482, 970, 1994,
+  42, 1066, 554, 1578,
+  298, 1322, 810, 1834,
+  170, 1194, 682, 1706,
+  426, 1450, 938, 1962,
+  106, 1130, 618, 1642,
+  362, 1386, 874, 1898,
+  234, 1258, 746, 1770,
+  490, 1514, 1002, 2026,
+  26, 1050, 538, 1562,
+  282, 1306, 794, 1818,
+  154, 1178, 666, 1690,
+  410, 1434, 922, 1946,
+  90, 1114, 602, 1626,
+  346, 1370, 858, 1882,
+  218, 1242, 730, 1754,
+  474, 1498, 986, 2010,
+  58, 1082, 570, 1594,
+  314, 1338, 826, 1850,
+  186, 1210, 698, 1722,
+  442, 1466, 954, 1978,
+  122, 1146, 634, 1658,
+  378, 1402, 890, 1914,
+  250, 1274, 762, 1786,
+  506, 1530, 1018, 2042,
+  6, 1030, 518, 1542,
+  262, 1286, 774, 1798,
+  134, 1158, 646, 1670,
+  390, 1414, 902, 1926,
+  70, 1094, 582, 1606,
+  326, 1350, 838, 1862,
+  198, 1222, 710, 1734,
+  454, 1478, 966, 1990,
+  38, 1062, 550, 1574,
+  294, 1318, 806, 1830,
+  166, 1190, 678, 1702,
+  422, 1446, 934, 1958,
+  102, 1126, 614, 1638,
+  358, 1382, 870, 1894,
+  230, 1254, 742, 1766,
+  486, 1510, 998, 2022,
+  22, 1046, 534, 1558,
+  278, 1302, 790, 1814,
+  150, 1174, 662, 1686,
+  406, 1430, 918, 1942,
+  86, 1110, 598, 1622,
+  342, 1366, 854, 1878,
+  214, 1238, 726, 1750,
+  470, 1494, 982, 2006,
+  54, 1078, 566, 1590,
+  310, 1334, 822, 1846,
+  182, 1206, 694, 1718,
+  438, 1462, 950, 1974,
+  118, 1142, 630, 1654,
+  374, 1398, 886, 1910,
+  246, 1270, 758, 1782,
+  502, 1526, 1014, 2038,
+  14, 1038, 526, 1550,
+  270, 1294, 782, 1806,
+  142, 1166, 654, 1678,
+  398, 1422, 910, 1934,
+  78, 1102, 590, 1614,
+  334, 1358, 846, 1870,
+  206, 1230, 718, 1742,
+  462, 1486, 974, 1998,
+  46, 1070, 558, 1582,
+  302, 1326, 814, 1838,
+  174, 1198, 686, 1710,
+  430, 1454, 942, 1966,
+  110, 1134, 622, 1646,
+  366, 1390, 878, 1902,
+  238, 1262, 750, 1774,
+  494, 1518, 1006, 2030,
+  30, 1054, 542, 1566,
+  286, 1310, 798, 1822,
+  158, 1182, 670, 1694,
+  414, 1438, 926, 1950,
+  94, 1118, 606, 1630,
+  350, 1374, 862, 1886,
+  222, 1246, 734, 1758,
+  478, 1502, 990, 2014,
+  62, 1086, 574, 1598,
+  318, 1342, 830, 1854,
+  190, 1214, 702, 1726,
+  446, 1470, 958, 1982,
+  126, 1150, 638, 1662,
+  382, 1406, 894, 1918,
+  254, 1278, 766, 1790,
+  510, 1534, 1022, 2046,
+  1, 1025, 513, 1537,
+  257, 1281, 769, 1793,
+  129, 1153, 641, 1665,
+  385, 1409, 897, 1921,
+  65, 1089, 577, 1601,
+  321, 1345, 833, 1857,
+  193, 1217, 705, 1729,
+  449, 1473, 961, 1985,
+  33, 1057, 545, 1569,
+  289, 1313, 801, 1825,
+  161, 1185, 673, 1697,
+  417, 1441, 929, 1953,
+  97, 1121, 609, 1633,
+  353, 1377, 865, 1889,
+  225, 1249, 737, 1761,
+  481, 1505, 993, 2017,
+  17, 1041, 529, 1553,
+  273, 1297, 785, 1809,
+  145, 1169, 657, 1681,
+  401, 1425, 913, 1937,
+  81, 1105, 593, 1617,
+  337, 1361, 849, 1873,
+  209, 1233, 721, 1745,
+  465, 1489, 977, 2001,
+  49, 1073, 561, 1585,
+  305, 1329, 817, 1841,
+  177, 1201, 689, 1713,
+  433, 1457, 945, 1969,
+  113, 1137, 625, 1649,
+  369, 1393, 881, 1905,
+  241, 1265, 753, 1777,
+  497, 1521, 1009, 2033,
+  9, 1033, 521, 1545,
+  265, 1289, 777, 1801,
+  137, 1161, 649, 1673,
+  393, 1417, 905, 1929,
+  73, 1097, 585, 1609,
+  329, 1353, 841, 1865,
+  201, 1225, 713, 1737,
+  457, 1481, 969, 1993,
+  41, 1065, 553, 1577,
+  297, 1321, 809, 1833,
+  169, 1193, 681, 1705,
+  425, 1449, 937, 1961,
+  105, 1129, 617, 1641,
+  361, 1385, 873, 1897,
+  233, 1257, 745, 1769,
+  489, 1513, 1001, 2025,
+  25, 1049, 537, 1561,
+  281, 1305, 793, 1817,
+  153, 1177, 665, 1689,
+  409, 1433, 921, 1945,
+  89, 1113, 601, 1625,
+  345, 1369, 857, 1881,
+  217, 1241, 729, 1753,
+  473, 1497, 985, 2009,
+  57, 1081, 569, 1593,
+  313, 1337, 825, 1849,
+  185, 1209, 697, 1721,
+  441, 1465, 953, 1977,
+  121, 1145, 633, 1657,
+  377, 1401, 889, 1913,
+  249, 1273, 761, 1785,
+  505, 1529, 1017, 2041,
+  5, 1029, 517, 1541,
+  261, 1285, 773, 1797,
+  133, 1157, 645, 1669,
+  389, 1413, 901, 1925,
+  69, 1093, 581, 1605,
+  325, 1349, 837, 1861,
+  197, 1221, 709, 1733,
+  453, 1477, 965, 1989,
+  37, 1061, 549, 1573,
+  293, 1317, 805, 1829,
+  165, 1189, 677, 1701,
+  421, 1445, 933, 1957,
+  101, 1125, 613, 1637,
+  357, 1381, 869, 1893,
+  229, 1253, 741, 1765,
+  485, 1509, 997, 2021,
+  21, 1045, 533, 1557,
+  277, 1301, 789, 1813,
+  149, 1173, 661, 1685,
+  405, 1429, 917, 1941,
+  85, 1109, 597, 1621,
+  341, 1365, 853, 1877,
+  213, 1237, 725, 1749,
+  469, 1493, 981, 2005,
+  53, 1077, 565, 1589,
+  309, 1333, 821, 1845,
+  181, 1205, 693, 1717,
+  437, 1461, 949, 1973,
+  117, 1141, 629, 1653,
+  373, 1397, 885, 1909,
+  245, 1269, 757, 1781,
+  501, 1525, 1013, 2037,
+  13, 1037, 525, 1549,
+  269, 1293, 781, 1805,
+  141, 1165, 653, 1677,
+  397, 1421, 909, 1933,
+  77, 1101, 589, 1613,
+  333, 1357, 845, 1869,
+  205, 1229, 717, 1741,
+  461, 1485, 973, 1997,
+  45, 1069, 557, 1581,
+  301, 1325, 813, 1837,
+  173, 1197, 685, 1709,
+  429, 1453, 941, 1965,
+  109, 1133, 621, 1645,
+  365, 1389, 877, 1901,
+  237, 1261, 749, 1773,
+  493, 1517, 1005, 2029,
+  29, 1053, 541, 1565,
+  285, 1309, 797, 1821,
+  157, 1181, 669, 1693,
+  413, 1437, 925, 1949,
+  93, 1117, 605, 1629,
+  349, 1373, 861, 1885,
+  221, 1245, 733, 1757,
+  477, 1501, 989, 2013,
+  61, 1085, 573, 1597,
+  317, 1341, 829, 1853,
+  189, 1213, 701, 1725,
+  445, 1469, 957, 1981,
+  125, 1149, 637, 1661,
+  381, 1405, 893, 1917,
+  253, 1277, 765, 1789,
+  509, 1533, 1021, 2045,
+  3, 1027, 515, 1539,
+  259, 1283, 771, 1795,
+  131, 1155, 643, 1667,
+  387, 1411, 899, 1923,
+  67, 1091, 579, 1603,
+  323, 1347, 835, 1859,
+  195, 1219, 707, 1731,
+  451, 1475, 963, 1987,
+  35, 1059, 547, 1571,
+  291, 1315, 803, 1827,
+  163, 1187, 675, 1699,
+  419, 1443, 931, 1955,
+  99, 1123, 611, 1635,
+  355, 1379, 867, 1891,
+  227, 1251, 739, 1763,
+  483, 1507, 995, 2019,
+  19, 1043, 531, 1555,
+  275, 1299, 787, 1811,
+  147, 1171, 659, 1683,
+  403, 1427, 915, 1939,
+  83, 1107, 595, 1619,
+  339, 1363, 851, 1875,
+  211, 1235, 723, 1747,
+  467, 1491, 979, 2003,
+  51, 1075, 563, 1587,
+  307, 1331, 819, 1843,
+  179, 1203, 691, 1715,
+  435, 1459, 947, 1971,
+  115, 1139, 627, 1651,
+  371, 1395, 883, 1907,
+  243, 1267, 755, 1779,
+  499, 1523, 1011, 2035,
+  11, 1035, 523, 1547,
+  267, 1291, 779, 1803,
+  139, 1163, 651, 1675,
+  395, 1419, 907, 1931,
+  75, 1099, 587, 1611,
+  331, 1355, 843, 1867,
+  203, 1227, 715, 1739,
+  459, 1483, 971, 1995,
+  43, 1067, 555, 1579,
+  299, 1323, 811, 1835,
+  171, 1195, 683, 1707,
+  427, 1451, 939, 1963,
+  107, 1131, 619, 1643,
+  363, 1387, 875, 1899,
+  235, 1259, 747, 1771,
+  491, 1515, 1003, 2027,
+  27, 1051, 539, 1563,
+  283, 1307, 795, 1819,
+  155, 1179, 667, 1691,
+  411, 1435, 923, 1947,
+  91, 1115, 603, 1627,
+  347, 1371, 859, 1883,
+  219, 1243, 731, 1755,
+  475, 1499, 987, 2011,
+  59, 1083, 571, 1595,
+  315, 1339, 827, 1851,
+  187, 1211, 699, 1723,
+  443, 1467, 955, 1979,
+  123, 1147, 635, 1659,
+  379, 1403, 891, 1915,
+  251, 1275, 763, 1787,
+  507, 1531, 1019, 2043,
+  7, 1031, 519, 1543,
+  263, 1287, 775, 1799,
+  135, 1159, 647, 1671,
+  391, 1415, 903, 1927,
+  71, 1095, 583, 1607,
+  327, 1351, 839, 1863,
+  199, 1223, 711, 1735,
+  455, 1479, 967, 1991,
+  39, 1063, 551, 1575,
+  295, 1319, 807, 1831,
+  167, 1191, 679, 1703,
+  423, 1447, 935, 1959,
+  103, 1127, 615, 1639,
+  359, 1383, 871, 1895,
+  231, 1255, 743, 1767,
+  487, 1511, 999, 2023,
+  23, 1047, 535, 1559,
+  279, 1303, 791, 1815,
+  151, 1175, 663, 1687,
+  407, 1431, 919, 1943,
+  87, 1111, 599, 1623,
+  343, 1367, 855, 1879,
+  215, 1239, 727, 1751,
+  471, 1495, 983, 2007,
+  55, 1079, 567, 1591,
+  311, 1335, 823, 1847,
+  183, 1207, 695, 1719,
+  439, 1463, 951, 1975,
+  119, 1143, 631, 1655,
+  375, 1399, 887, 1911,
+  247, 1271, 759, 1783,
+  503, 1527, 1015, 2039,
+  15, 1039, 527, 1551,
+  271, 1295, 783, 1807,
+  143, 1167, 655, 1679,
+  399, 1423, 911, 1935,
+  79, 1103, 591, 1615,
+  335, 1359, 847, 1871,
+  207, 1231, 719, 1743,
+  463, 1487, 975, 1999,
+  47, 1071, 559, 1583,
+  303, 1327, 815, 1839,
+  175, 1199, 687, 1711,
+  431, 1455, 943, 1967,
+  111, 1135, 623, 1647,
+  367, 1391, 879, 1903,
+  239, 1263, 751, 1775,
+  495, 1519, 1007, 2031,
+  31, 1055, 543, 1567,
+  287, 1311, 799, 1823,
+  159, 1183, 671, 1695,
+  415, 1439, 927, 1951,
+  95, 1119, 607, 1631,
+  351, 1375, 863, 1887,
+  223, 1247, 735, 1759,
+  479, 1503, 991, 2015,
+  63, 1087, 575, 1599,
+  319, 1343, 831, 1855,
+  191, 1215, 703, 1727,
+  447, 1471, 959, 1983,
+  127, 1151, 639, 1663,
+  383, 1407, 895, 1919,
+  255, 1279, 767, 1791,
+  511, 1535, 1023, 2047,
+};
+
+static const rta_tables_real_t sin_4096[5121] =
+{
+  0.0, 0.0015339801862847655, 0.003067956762965976, 0.0046019261204485705,
+  0.006135884649154475, 0.007669828739531097, 0.00920375478205982, 0.01073765916726449,
+  0.012271538285719925, 0.01380538852806039, 0.0153392062849881, 0.01687298794728171,
+  0.01840672990580482, 0.01994042855151444, 0.021474080275469508, 0.02300768146883937,
+  0.024541228522912288, 0.0260747178291039, 0.02760814577896574, 0.029141508764193722,
+  0.030674803176636626, 0.032208025408304586, 0.03374117185137758, 0.03527423889821395,
+  0.03680722294135883, 0.038340120373552694, 0.03987292758773981, 0.04140564097707674,
+  0.04293825693494082, 0.04447077185493867, 0.04600318213091462, 0.0475354841569593,
+  0.049067674327418015, 0.05059974903689928, 0.052131704680283324, 0.05366353765273052,
+  0.055195244349689934, 0.05672682116690775, 0.05825826450043575, 0.05978957074663987,
+  0.06132073630220858, 0.0628517575641614, 0.06438263092985747, 0.0659133527970038,
+  0.06744391956366405, 0.06897432762826675, 0.07050457338961386, 0.07203465324688933,
+  0.07356456359966743, 0.0750943008479213, 0.07662386139203149, 0.07815324163279423,
+  0.07968243797143013, 0.08121144680959244, 0.08274026454937569, 0.08426888759332407,
+  0.0857973123444399, 0.08732553520619206, 0.0888535525825246, 0.09038136087786498,
+  0.09190895649713272, 0.09343633584574779, 0.09496349532963899, 0.09649043135525259,
+  0.0980171403295606, 0.09954361866006932, 0.10106986275482782, 0.10259586902243628,
+  0.10412163387205459, 0.10564715371341062, 0.10717242495680884, 0.10869744401313872,
+  0.11022220729388306, 0.11174671121112659, 0.11327095217756435, 0.11479492660651008,
+  0.11631863091190475, 0.11784206150832498, 0.11936521481099135, 0.12088808723577708,
+  0.1224106751992162, 0.12393297511851216, 0.12545498341154623, 0.12697669649688587,
+  0.12849811079379317, 0.13001922272223335, 0.13154002870288312, 0.13306052515713906,
+  0.13458070850712617, 0.1361005751757062, 0.13762012158648604, 0.1391393441638262,
+  0.1406582393328492, 0.14217680351944803, 0.14369503315029447, 0.14521292465284746,
+  0.14673047445536175, 0.14824767898689603, 0.1497645346773215, 0.15128103795733022,
+  0.15279718525844344, 0.1543129730130201, 0.15582839765426523, 0.15734345561623825,
+  0.15885814333386145, 0.16037245724292828, 0.16188639378011183, 0.16339994938297323,
+  0.16491312048996992, 0.1664259035404641, 0.16793829497473117, 0.16945029123396796,
+  0.17096188876030122, 0.17247308399679595, 0.17398387338746382, 0.17549425337727143,
+  0.17700422041214875, 0.1785137709389975, 0.18002290140569951, 0.18153160826112497,
+  0.18303988795514095, 0.18454773693861962, 0.18605515166344663, 0.1875621285825296,
+  0.1890686641498062, 0.19057475482025274, 0.19208039704989244, 0.1935855872958036,
+  0.19509032201612825, 0.19659459767008022, 0.19809841071795356, 0.19960175762113097,
+  0.2011046348420919, 0.20260703884442113, 0.20410896609281687, 0.20561041305309924,
+  0.20711137619221856, 0.20861185197826349, 0.2101118368804696, 0.21161132736922755,
+  0.21311031991609136, 0.21460881099378676, 0.21610679707621952, 0.21760427463848364,
+  0.2191012401568698, 0.2205976901088735, 0.2220936209732035, 0.22358902922979,
+  0.22508391135979283, 0.22657826384561, 0.22807208317088573, 0.22956536582051887,
+  0.2310581082806711, 0.23255030703877524, 0.23404195858354343, 0.2355330594049755,
+  0.2370236059943672, 0.23851359484431842, 0.2400030224487415, 0.24149188530286933,
+  0.24298017990326387, 0.24446790274782415, 0.2459550503357946, 0.24744161916777327,
+  0.24892760574572015, 0.2504130065729652, 0.25189781815421697, 0.25338203699557016,
+  0.25486565960451457, 0.2563486824899429, 0.257831102162159, 0.25931291513288623,
+  0.2607941179152755, 0.2622747070239136, 0.26375467897483135, 0.2652340302855118,
+  0.26671275747489837, 0.2681908570634032, 0.2696683255729151, 0.271145159526808,
+  0.272621355449949, 0.2740969098687064, 0.27557181931095814, 0.2770460803060999,
+  0.27851968938505306, 0.2799926430802732, 0.28146493792575794, 0.2829365704570554,
+  0.2844075372112719, 0.2858778347270806, 0.2873474595447295, 0.2888164082060495,
+  0.29028467725446233, 0.29175226323498926, 0.29321916269425863, 0.2946853721805143,
+  0.2961508882436238, 0.2976157074350862, 0.2990798263080405, 0.30054324141727345,
+  0.3020059493192281, 0.3034679465720113, 0.3049292297354024, 0.3063897953708609,
+  0.30784964004153487, 0.3093087603122687, 0.3107671527496115, 0.3122248139218249,
+  0.3136817403988915, 0.31513792875252244, 0.31659337555616585, 0.31804807738501495,
+  0.3195020308160157, 0.3209552324278752, 0.32240767880106985, 0.32385936651785285,
+  0.3253102921622629, 0.32676045232013173, 0.3282098435790925, 0.3296584625285875,
+  0.33110630575987643, 0.3325533698660442, 0.3339996514420094, 0.3354451470845316,
+  0.33688985339222005, 0.3383337669655411, 0.33977688440682685, 0.34121920232028236,
+  0.3426607173119944, 0.3441014259899388, 0.3455413249639891, 0.3469804108459237,
+  0.34841868024943456, 0.3498561297901349, 0.3512927560855671, 0.3527285557552107,
+  0.35416352542049034, 0.35559766170478385, 0.35703096123343, 0.35846342063373654,
+  0.3598950365349881, 0.3613258055684543, 0.3627557243673972, 0.3641847895670799,
+  0.36561299780477385, 0.3670403457197672, 0.3684668299533723, 0.3698924471489341,
+  0.37131719395183754, 0.37274106700951576, 0.37416406297145793, 0.3755861784892172,
+  0.37700741021641826, 0.37842775480876556, 0.37984720892405116, 0.3812657692221624,
+  0.3826834323650898, 0.38410019501693504, 0.38551605384391885, 0.3869310055143886,
+  0.38834504669882625, 0.3897581740698564, 0.39117038430225387, 0.39258167407295147,
+  0.3939920400610481, 0.39540147894781635, 0.3968099874167103, 0.39821756215337356,
+  0.3996241998456468, 0.4010298971835756, 0.40243465085941843, 0.4038384575676541,
+  0.40524131400498986, 0.40664321687036903, 0.4080441628649787, 0.4094441486922576,
+  0.4108431710579039, 0.4122412266698829, 0.4136383122384345, 0.41503442447608163,
+  0.41642956009763715, 0.41782371582021227, 0.4192168883632239, 0.4206090744484025,
+  0.4220002707997997, 0.42339047414379605, 0.4247796812091088, 0.4261678887267996,
+  0.4275550934302821, 0.4289412920553295, 0.4303264813400826, 0.43171065802505726,
+  0.43309381885315196, 0.43447596056965565, 0.4358570799222555, 0.4372371736610441,
+  0.43861623853852766, 0.43999427130963326, 0.44137126873171667, 0.44274722756457,
+  0.4441221445704292, 0.44549601651398174, 0.44686884016237416, 0.4482406122852199,
+  0.44961132965460654, 0.45098098904510386, 0.4523495872337709, 0.45371712100016387,
+  0.45508358712634384, 0.4564489823968839, 0.4578133035988772, 0.4591765475219441,
+  0.46053871095824, 0.46189979070246273, 0.46325978355186015, 0.4646186863062378,
+  0.4659764957679662, 0.4673332087419884, 0.4686888220358279, 0.4700433324595956,
+  0.47139673682599764, 0.4727490319503428, 0.47410021465054997, 0.47545028174715587,
+  0.4767992300633221, 0.478147056424843, 0.479493757660153, 0.48083933060033396,
+  0.4821837720791227, 0.48352707893291874, 0.48486924800079106, 0.4862102761244864,
+  0.487550160148436, 0.48888889691976317, 0.49022648328829116, 0.4915629161065499,
+  0.49289819222978404, 0.4942323085159597, 0.49556526182577254, 0.49689704902265447,
+  0.49822766697278187, 0.49955711254508184, 0.5008853826112407, 0.5022124740457108,
+  0.5035383837257176, 0.5048631085312676, 0.5061866453451552, 0.5075089910529709,
+  0.508830142543107, 0.5101500967067668, 0.5114688504379703, 0.512786400633563,
+  0.5141027441932217, 0.5154178780194629, 0.5167317990176499, 0.5180445040959993,
+  0.5193559901655896, 0.5206662541403672, 0.5219752929371544, 0.5232831034756564,
+  0.524589682678469, 0.5258950274710846, 0.5271991347819013, 0.5285020015422285,
+  0.5298036246862946, 0.531104001151255, 0.5324031278771979, 0.533701001807153,
+  0.5349976198870972, 0.5362929790659632, 0.5375870762956454, 0.5388799085310084,
+  0.5401714727298929, 0.5414617658531234, 0.5427507848645159, 0.5440385267308838,
+  0.5453249884220465, 0.5466101669108349, 0.5478940591731002, 0.5491766621877197,
+  0.5504579729366048, 0.5517379884047073, 0.5530167055800275, 0.55429412145362,
+  0.5555702330196022, 0.5568450372751601, 0.5581185312205561, 0.5593907118591361,
+  0.560661576197336, 0.5619311212446895, 0.5631993440138341, 0.5644662415205195,
+  0.5657318107836131, 0.5669960488251087, 0.5682589526701315, 0.5695205193469471,
+  0.5707807458869673, 0.572039629324757, 0.5732971666980422, 0.5745533550477158,
+  0.5758081914178453, 0.5770616728556794, 0.5783137964116556, 0.5795645591394056,
+  0.5808139580957645, 0.5820619903407754, 0.5833086529376983, 0.5845539429530153,
+  0.5857978574564389, 0.587040393520918, 0.5882815482226452, 0.5895213186410639,
+  0.5907597018588742, 0.591996694962041, 0.5932322950397998, 0.5944664991846644,
+  0.5956993044924334, 0.5969307080621965, 0.5981607069963423, 0.5993892984005645,
+  0.600616479383869, 0.60184224705858, 0.6030665985403482, 0.604289530948156,
+  0.6055110414043255, 0.6067311270345245, 0.6079497849677736, 0.6091670123364532,
+  0.6103828062763095, 0.6115971639264619, 0.6128100824294097, 0.6140215589310384,
+  0.6152315905806268, 0.6164401745308536, 0.6176473079378039, 0.6188529879609763,
+  0.6200572117632891, 0.6212599765110876, 0.62246127937415, 0.6236611175256945,
+  0.6248594881423863, 0.6260563884043435, 0.6272518154951441, 0.6284457666018327,
+  0.629638238914927, 0.6308292296284245, 0.6320187359398091, 0.6332067550500572,
+  0.6343932841636455, 0.6355783204885561, 0.6367618612362842, 0.637943903621844,
+  0.6391244448637757, 0.6403034821841517, 0.6414810128085832, 0.6426570339662269,
+  0.6438315428897914, 0.6450045368155439, 0.6461760129833163, 0.6473459686365121,
+  0.6485144010221124, 0.6496813073906832, 0.6508466849963809, 0.6520105310969595,
+  0.6531728429537768, 0.6543336178318004, 0.6554928529996153, 0.6566505457294289,
+  0.6578066932970786, 0.6589612929820373, 0.6601143420674205, 0.6612658378399923,
+  0.6624157775901718, 0.6635641586120398, 0.6647109782033448, 0.6658562336655097,
+  0.6669999223036375, 0.6681420414265185, 0.669282588346636, 0.6704215603801731,
+  0.6715589548470183, 0.6726947690707729, 0.673829000378756, 0.6749616461020119,
+  0.6760927035753159, 0.6772221701371803, 0.6783500431298615, 0.679476319899365,
+  0.680600997795453, 0.6817240741716497, 0.6828455463852481, 0.6839654117973154,
+  0.6850836677727004, 0.6862003116800386, 0.687315340891759, 0.6884287527840904,
+  0.6895405447370668, 0.6906507141345346, 0.6917592583641577, 0.6928661748174246,
+  0.693971460889654, 0.6950751139800009, 0.696177131491463, 0.6972775108308865,
+  0.6983762494089729, 0.6994733446402838, 0.7005687939432483, 0.7016625947401685,
+  0.7027547444572253, 0.7038452405244849, 0.7049340803759049, 0.7060212614493397,
+  0.7071067811865475, 0.7081906370331954, 0.7092728264388657, 0.7103533468570624,
+  0.7114321957452164, 0.7125093705646923, 0.7135848687807936, 0.7146586878627691,
+  0.7157308252838186, 0.7168012785210995, 0.7178700450557317, 0.7189371223728045,
+  0.7200025079613817, 0.7210661993145081, 0.7221281939292153, 0.7231884893065275,
+  0.724247082951467, 0.7253039723730608, 0.726359155084346, 0.7274126286023758,
+  0.7284643904482252, 0.729514438146997, 0.7305627692278276, 0.7316093812238926,
+  0.7326542716724128, 0.7336974381146604, 0.7347388780959635, 0.7357785891657136,
+  0.7368165688773699, 0.737852814788466, 0.7388873244606151, 0.7399200954595162,
+  0.7409511253549591, 0.7419804117208311, 0.7430079521351217, 0.7440337441799293,
+  0.7450577854414661, 0.7460800735100638, 0.7471006059801801, 0.7481193804504036,
+  0.7491363945234594, 0.7501516458062151, 0.7511651319096865, 0.7521768504490428,
+  0.7531867990436125, 0.7541949753168892, 0.7552013768965365, 0.7562060014143945,
+  0.7572088465064846, 0.7582099098130153, 0.7592091889783881, 0.7602066816512024,
+  0.7612023854842618, 0.7621962981345789, 0.7631884172633813, 0.7641787405361167,
+  0.765167265622459, 0.7661539901963129, 0.7671389119358204, 0.7681220285233654,
+  0.7691033376455797, 0.7700828369933479, 0.7710605242618138, 0.7720363971503845,
+  0.773010453362737, 0.7739826906068229, 0.7749531065948739, 0.7759216990434077,
+  0.7768884656732324, 0.7778534042094531, 0.778816512381476, 0.7797777879230146,
+  0.7807372285720945, 0.7816948320710594, 0.7826505961665757, 0.7836045186096382,
+  0.7845565971555752, 0.7855068295640539, 0.7864552135990858, 0.7874017470290314,
+  0.7883464276266063, 0.7892892531688857, 0.79023022143731, 0.7911693302176902,
+  0.7921065773002124, 0.7930419604794436, 0.7939754775543372, 0.794907126328237,
+  0.7958369046088836, 0.7967648102084188, 0.7976908409433912, 0.7986149946347608,
+  0.799537269107905, 0.8004576621926228, 0.8013761717231402, 0.8022927955381157,
+  0.8032075314806449, 0.8041203773982658, 0.8050313311429637, 0.8059403905711763,
+  0.8068475535437993, 0.8077528179261904, 0.808656181588175, 0.8095576424040513,
+  0.8104571982525948, 0.8113548470170637, 0.8122505865852039, 0.8131444148492536,
+  0.8140363297059484, 0.8149263290565266, 0.8158144108067338, 0.8167005728668278,
+  0.8175848131515837, 0.8184671295802987, 0.8193475200767969, 0.8202259825694347,
+  0.8211025149911046, 0.8219771152792416, 0.8228497813758264, 0.8237205112273914,
+  0.8245893027850253, 0.8254561540043776, 0.8263210628456635, 0.8271840272736691,
+  0.8280450452577558, 0.8289041147718649, 0.829761233794523, 0.8306164003088463,
+  0.8314696123025452, 0.8323208677679297, 0.8331701647019132, 0.8340175011060181,
+  0.83486287498638, 0.8357062843537526, 0.836547727223512, 0.8373872016156619,
+  0.8382247055548381, 0.8390602370703127, 0.8398937941959995, 0.8407253749704581,
+  0.8415549774368984, 0.8423825996431858, 0.8432082396418454, 0.8440318954900664,
+  0.8448535652497071, 0.8456732469872991, 0.8464909387740521, 0.8473066386858583,
+  0.8481203448032972, 0.8489320552116396, 0.8497417680008525, 0.8505494812656035,
+  0.8513551931052652, 0.8521589016239198, 0.8529606049303636, 0.8537603011381114,
+  0.8545579883654005, 0.855353664735196, 0.8561473283751945, 0.8569389774178288,
+  0.8577286100002721, 0.8585162242644427, 0.8593018183570085, 0.8600853904293901,
+  0.8608669386377673, 0.8616464611430813, 0.8624239561110406, 0.8631994217121242,
+  0.8639728561215868, 0.8647442575194624, 0.8655136240905691, 0.866280954024513,
+  0.8670462455156926, 0.8678094967633033, 0.8685707059713409, 0.8693298713486068,
+  0.8700869911087115, 0.870842063470079, 0.871595086655951, 0.8723460588943915,
+  0.8730949784182901, 0.8738418434653669, 0.8745866522781761, 0.8753294031041109,
+  0.8760700941954066, 0.8768087238091457, 0.8775452902072614, 0.8782797916565416,
+  0.8790122264286335, 0.8797425928000474, 0.8804708890521608, 0.8811971134712221,
+  0.881921264348355, 0.8826433399795628, 0.8833633386657316, 0.884081258712635,
+  0.8847970984309378, 0.8855108561362, 0.8862225301488806, 0.8869321187943422,
+  0.8876396204028539, 0.8883450333095964, 0.8890483558546646, 0.8897495863830728,
+  0.8904487232447579, 0.8911457647945832, 0.8918407093923427, 0.8925335554027646,
+  0.8932243011955153, 0.8939129451452033, 0.8945994856313827, 0.8952839210385576,
+  0.8959662497561852, 0.8966464701786802, 0.8973245807054183, 0.8980005797407399,
+  0.8986744656939538, 0.8993462369793416, 0.9000158920161603, 0.900683429228647,
+  0.901348847046022, 0.9020121439024932, 0.9026733182372588, 0.9033323684945118,
+  0.9039892931234433, 0.9046440905782462, 0.9052967593181188, 0.9059472978072685,
+  0.9065957045149153, 0.9072419779152958, 0.9078861164876663, 0.9085281187163061,
+  0.9091679830905224, 0.9098057081046522, 0.9104412922580672, 0.9110747340551764,
+  0.9117060320054299, 0.9123351846233227, 0.9129621904283982, 0.9135870479452508,
+  0.9142097557035307, 0.9148303122379462, 0.9154487160882678, 0.9160649657993317,
+  0.9166790599210427, 0.9172909970083779, 0.9179007756213905, 0.9185083943252123,
+  0.9191138516900578, 0.9197171462912274, 0.9203182767091106, 0.9209172415291895,
+  0.921514039342042, 0.9221086687433452, 0.9227011283338786, 0.9232914167195276,
+  0.9238795325112867, 0.9244654743252626, 0.9250492407826776, 0.9256308305098727,
+  0.9262102421383114, 0.9267874743045817, 0.9273625256504011, 0.9279353948226179,
+  0.9285060804732156, 0.9290745812593159, 0.9296408958431813, 0.9302050228922191,
+  0.9307669610789837, 0.9313267090811804, 0.9318842655816681, 0.9324396292684624,
+  0.932992798834739, 0.9335437729788362, 0.934092550404259, 0.9346391298196808,
+  0.9351835099389476, 0.9357256894810804, 0.9362656671702783, 0.9368034417359216,
+  0.937339011912575, 0.9378723764399899, 0.9384035340631081, 0.9389324835320646,
+  0.9394592236021899, 0.939983753034014, 0.9405060705932683, 0.9410261750508893,
+  0.9415440651830208, 0.9420597397710173, 0.9425731976014469, 0.9430844374660935,
+  0.9435934581619604, 0.9441002584912727, 0.9446048372614803, 0.9451071932852606,
+  0.9456073253805213, 0.9461052323704034, 0.9466009130832835, 0.9470943663527772,
+  0.9475855910177411, 0.9480745859222762, 0.9485613499157303, 0.9490458818527006,
+  0.9495281805930367, 0.950008245001843, 0.9504860739494817, 0.9509616663115751,
+  0.9514350209690083, 0.9519061368079323, 0.9523750127197659, 0.9528416476011987,
+  0.9533060403541939, 0.9537681898859903, 0.9542280951091057, 0.9546857549413383,
+  0.9551411683057708, 0.9555943341307711, 0.9560452513499964, 0.9564939189023951,
+  0.9569403357322088, 0.9573845007889759, 0.9578264130275329, 0.9582660714080177,
+  0.9587034748958716, 0.9591386224618419, 0.9595715130819845, 0.960002145737666,
+  0.9604305194155658, 0.9608566331076797, 0.9612804858113206, 0.9617020765291225,
+  0.9621214042690416, 0.9625384680443592, 0.9629532668736839, 0.963365799780954,
+  0.9637760657954398, 0.9641840639517458, 0.9645897932898128, 0.9649932528549203,
+  0.9653944416976894, 0.9657933588740837, 0.9661900034454125, 0.9665843744783331,
+  0.9669764710448521, 0.9673662922223285, 0.9677538370934755, 0.9681391047463624,
+  0.9685220942744174, 0.9689028047764289, 0.9692812353565485, 0.9696573851242924,
+  0.970031253194544, 0.9704028386875555, 0.9707721407289504, 0.9711391584497251,
+  0.9715038909862518, 0.9718663374802794, 0.9722264970789363, 0.9725843689347322,
+  0.9729399522055602, 0.9732932460546982, 0.973644249650812, 0.9739929621679558,
+  0.9743393827855759, 0.9746835106885107, 0.9750253450669941, 0.975364885116657,
+  0.9757021300385286, 0.976037079039039, 0.9763697313300211, 0.9767000861287118,
+  0.9770281426577544, 0.9773539001452, 0.9776773578245099, 0.9779985149345571,
+  0.9783173707196277, 0.9786339244294232, 0.9789481753190622, 0.979260122649082,
+  0.9795697656854405, 0.9798771036995176, 0.9801821359681174, 0.9804848617734694,
+  0.9807852804032304, 0.9810833911504867, 0.9813791933137546, 0.9816726861969831,
+  0.9819638691095552, 0.9822527413662894, 0.9825393022874412, 0.9828235511987052,
+  0.9831054874312163, 0.9833851103215512, 0.9836624192117303, 0.9839374134492189,
+  0.984210092386929, 0.9844804553832209, 0.9847485018019042, 0.9850142310122398,
+  0.9852776423889412, 0.9855387353121761, 0.9857975091675675, 0.9860539633461954,
+  0.9863080972445987, 0.9865599102647754, 0.9868094018141855, 0.987056571305751,
+  0.9873014181578584, 0.9875439417943592, 0.9877841416445722, 0.9880220171432835,
+  0.9882575677307495, 0.9884907928526966, 0.9887216919603238, 0.988950264510303,
+  0.989176509964781, 0.9894004277913804, 0.9896220174632009, 0.9898412784588205,
+  0.9900582102622971, 0.9902728123631691, 0.9904850842564571, 0.9906950254426646,
+  0.99090263542778, 0.9911079137232769, 0.9913108598461154, 0.9915114733187439,
+  0.9917097536690995, 0.9919057004306093, 0.9920993131421918, 0.9922905913482574,
+  0.99247953459871, 0.992666142448948, 0.9928504144598651, 0.9930323501978514,
+  0.9932119492347945, 0.9933892111480807, 0.9935641355205953, 0.9937367219407246,
+  0.9939069700023561, 0.9940748793048794, 0.9942404494531879, 0.9944036800576791,
+  0.9945645707342554, 0.9947231211043257, 0.9948793307948056, 0.9950331994381186,
+  0.9951847266721969, 0.9953339121404823, 0.9954807554919269, 0.9956252563809943,
+  0.9957674144676598, 0.9959072294174117, 0.996044700901252, 0.996179828595697,
+  0.996312612182778, 0.9964430513500426, 0.9965711457905548, 0.9966968952028961,
+  0.9968202992911657, 0.9969413577649822, 0.997060070339483, 0.9971764367353262,
+  0.9972904566786902, 0.9974021299012753, 0.9975114561403035, 0.9976184351385196,
+  0.9977230666441916, 0.9978253504111116, 0.997925286198596, 0.9980228737714862,
+  0.9981181129001492, 0.9982110033604782, 0.9983015449338929, 0.9983897374073402,
+  0.9984755805732948, 0.9985590742297593, 0.9986402181802653, 0.9987190122338729,
+  0.9987954562051724, 0.9988695499142836, 0.9989412931868569, 0.9990106858540734,
+  0.9990777277526454, 0.9991424187248169, 0.9992047586183639, 0.9992647472865944,
+  0.9993223845883495, 0.9993776703880028, 0.9994306045554617, 0.999481186966167,
+  0.9995294175010931, 0.9995752960467492, 0.9996188224951786, 0.9996599967439592,
+  0.9996988186962042, 0.9997352882605617, 0.9997694053512153, 0.9998011698878843,
+  0.9998305817958234, 0.9998576410058239, 0.9998823474542126, 0.9999047010828529,
+  0.9999247018391445, 0.9999423496760239, 0.9999576445519639, 0.9999705864309741,
+  0.9999811752826011, 0.9999894110819284, 0.9999952938095762, 0.9999988234517019,
+  1.0, 0.9999988234517019, 0.9999952938095762, 0.9999894110819284,
+  0.9999811752826011, 0.9999705864309741, 0.9999576445519639, 0.9999423496760239,
+  0.9999247018391445, 0.9999047010828529, 0.9998823474542126, 0.9998576410058239,
+  0.9998305817958234, 0.9998011698878843, 0.9997694053512153, 0.9997352882605617,
+  0.9996988186962042, 0.9996599967439592, 0.9996188224951786, 0.9995752960467492,
+  0.9995294175010931, 0.999481186966167, 0.9994306045554617, 0.9993776703880028,
+  0.9993223845883495, 0.9992647472865944, 0.9992047586183639, 0.9991424187248169,
+  0.9990777277526454, 0.9990106858540734, 0.9989412931868569, 0.9988695499142836,
+  0.9987954562051724, 0.9987190122338729, 0.9986402181802653, 0.9985590742297593,
+  0.9984755805732948, 0.9983897374073402, 0.9983015449338929, 0.9982110033604782,
+  0.9981181129001492, 0.9980228737714862, 0.997925286198596, 0.9978253504111116,
+  0.9977230666441916, 0.9976184351385196, 0.9975114561403035, 0.9974021299012753,
+  0.9972904566786902, 0.9971764367353262, 0.997060070339483, 0.9969413577649822,
+  0.9968202992911657, 0.9966968952028961, 0.9965711457905548, 0.9964430513500426,
+  0.996312612182778, 0.996179828595697, 0.996044700901252, 0.9959072294174117,
+  0.9957674144676598, 0.9956252563809943, 0.9954807554919269, 0.9953339121404823,
+  0.9951847266721969, 0.9950331994381186, 0.9948793307948056, 0.9947231211043257,
+  0.9945645707342554, 0.9944036800576791, 0.9942404494531879, 0.9940748793048794,
+  0.9939069700023561, 0.9937367219407246, 0.9935641355205953, 0.9933892111480807,
+  0.9932119492347945, 0.9930323501978514, 0.9928504144598651, 0.992666142448948,
+  0.99247953459871, 0.9922905913482574, 0.9920993131421918, 0.9919057004306093,
+  0.9917097536690995, 0.9915114733187439, 0.9913108598461154, 0.9911079137232769,
+  0.99090263542778, 0.9906950254426646, 0.9904850842564571, 0.9902728123631691,
+  0.9900582102622971, 0.9898412784588205, 0.9896220174632009, 0.9894004277913804,
+  0.989176509964781, 0.988950264510303, 0.9887216919603238, 0.9884907928526966,
+  0.9882575677307495, 0.9880220171432835, 0.9877841416445722, 0.9875439417943592,
+  0.9873014181578584, 0.987056571305751, 0.9868094018141855, 0.9865599102647754,
+  0.9863080972445987, 0.9860539633461954, 0.9857975091675675, 0.9855387353121761,
+  0.9852776423889412, 0.9850142310122398, 0.9847485018019042, 0.9844804553832209,
+  0.984210092386929, 0.9839374134492189, 0.9836624192117303, 0.9833851103215512,
+  0.9831054874312163, 0.9828235511987052, 0.9825393022874412, 0.9822527413662894,
+  0.9819638691095552, 0.9816726861969831, 0.9813791933137546, 0.9810833911504867,
+  0.9807852804032304, 0.9804848617734694, 0.9801821359681174, 0.9798771036995176,
+  0.9795697656854405, 0.979260122649082, 0.9789481753190622, 0.9786339244294232,
+  0.9783173707196277, 0.9779985149345571, 0.9776773578245099, 0.9773539001452,
+  0.9770281426577544, 0.9767000861287118, 0.9763697313300211, 0.976037079039039,
+  0.9757021300385286, 0.975364885116657, 0.9750253450669941, 0.9746835106885107,
+  0.9743393827855759, 0.9739929621679558, 0.973644249650812, 0.9732932460546982,
+  0.9729399522055602, 0.9725843689347322, 0.9722264970789363, 0.9718663374802794,
+  0.9715038909862518, 0.9711391584497251, 0.9707721407289504, 0.9704028386875555,
+  0.970031253194544, 0.9696573851242924, 0.9692812353565485, 0.9689028047764289,
+  0.9685220942744174, 0.9681391047463624, 0.9677538370934755, 0.9673662922223285,
+  0.9669764710448521, 0.9665843744783331, 0.9661900034454125, 0.9657933588740837,
+  0.9653944416976894, 0.9649932528549203, 0.9645897932898128, 0.9641840639517458,
+  0.9637760657954398, 0.963365799780954, 0.9629532668736839, 0.9625384680443592,
+  0.9621214042690416, 0.9617020765291225, 0.9612804858113206, 0.9608566331076797,
+  0.9604305194155658, 0.960002145737666, 0.9595715130819845, 0.9591386224618419,
+  0.9587034748958716, 0.9582660714080177, 0.9578264130275329, 0.9573845007889759,
+  0.9569403357322088, 0.9564939189023951, 0.9560452513499964, 0.9555943341307711,
+  0.9551411683057708, 0.9546857549413383, 0.9542280951091057, 0.9537681898859903,
+  0.9533060403541939, 0.9528416476011987, 0.9523750127197659, 0.9519061368079323,
+  0.9514350209690083, 0.9509616663115751, 0.9504860739494817, 0.950008245001843,
+  0.9495281805930367, 0.9490458818527006, 0.9485613499157303, 0.9480745859222762,
+  0.9475855910177411, 0.9470943663527772, 0.9466009130832835, 0.9461052323704034,
+  0.9456073253805213, 0.9451071932852606, 0.9446048372614803, 0.9441002584912727,
+  0.9435934581619604, 0.9430844374660935, 0.9425731976014469, 0.9420597397710173,
+  0.9415440651830208, 0.9410261750508893, 0.9405060705932683, 0.939983753034014,
+  0.9394592236021899, 0.9389324835320646, 0.9384035340631081, 0.9378723764399899,
+  0.937339011912575, 0.9368034417359216, 0.9362656671702783, 0.9357256894810804,
+  0.9351835099389476, 0.9346391298196808, 0.934092550404259, 0.9335437729788362,
+  0.932992798834739, 0.9324396292684624, 0.9318842655816681, 0.9313267090811804,
+  0.9307669610789837, 0.9302050228922191, 0.9296408958431813, 0.9290745812593159,
+  0.9285060804732156, 0.9279353948226179, 0.9273625256504011, 0.9267874743045817,
+  0.9262102421383114, 0.9256308305098727, 0.9250492407826776, 0.9244654743252626,
+  0.9238795325112867, 0.9232914167195276, 0.9227011283338786, 0.9221086687433452,
+  0.921514039342042, 0.9209172415291895, 0.9203182767091106, 0.9197171462912274,
+  0.9191138516900578, 0.9185083943252123, 0.9179007756213905, 0.9172909970083779,
+  0.9166790599210427, 0.9160649657993317, 0.9154487160882678, 0.9148303122379462,
+  0.9142097557035307, 0.9135870479452508, 0.9129621904283982, 0.9123351846233227,
+  0.9117060320054299, 0.9110747340551764, 0.9104412922580672, 0.9098057081046522,
+  0.9091679830905224, 0.9085281187163061, 0.9078861164876663, 0.9072419779152958,
+  0.9065957045149153, 0.9059472978072685, 0.9052967593181188, 0.9046440905782462,
+  0.9039892931234433, 0.9033323684945118, 0.9026733182372588, 0.9020121439024932,
+  0.901348847046022, 0.900683429228647, 0.9000158920161603, 0.8993462369793416,
+  0.8986744656939538, 0.8980005797407399, 0.8973245807054183, 0.8966464701786802,
+  0.8959662497561852, 0.8952839210385576, 0.8945994856313827, 0.8939129451452033,
+  0.8932243011955153, 0.8925335554027646, 0.8918407093923427, 0.8911457647945832,
+  0.8904487232447579, 0.8897495863830728, 0.8890483558546646, 0.8883450333095964,
+  0.8876396204028539, 0.8869321187943422, 0.8862225301488806, 0.8855108561362,
+  0.8847970984309378, 0.884081258712635, 0.8833633386657316, 0.8826433399795628,
+  0.881921264348355, 0.8811971134712221, 0.8804708890521608, 0.8797425928000474,
+  0.8790122264286335, 0.8782797916565416, 0.8775452902072614, 0.8768087238091457,
+  0.8760700941954066, 0.8753294031041109, 0.8745866522781761, 0.8738418434653669,
+  0.8730949784182901, 0.8723460588943915, 0.871595086655951, 0.870842063470079,
+  0.8700869911087115, 0.8693298713486068, 0.8685707059713409, 0.8678094967633033,
+  0.8670462455156926, 0.866280954024513, 0.8655136240905691, 0.8647442575194624,
+  0.8639728561215868, 0.8631994217121242, 0.8624239561110406, 0.8616464611430813,
+  0.8608669386377673, 0.8600853904293901, 0.8593018183570085, 0.8585162242644427,
+  0.8577286100002721, 0.8569389774178288, 0.8561473283751945, 0.855353664735196,
+  0.8545579883654005, 0.8537603011381114, 0.8529606049303636, 0.8521589016239198,
+  0.8513551931052652, 0.8505494812656035, 0.8497417680008525, 0.8489320552116396,
+  0.8481203448032972, 0.8473066386858583, 0.8464909387740521, 0.8456732469872991,
+  0.8448535652497071, 0.8440318954900664, 0.8432082396418454, 0.8423825996431858,
+  0.8415549774368984, 0.8407253749704581, 0.8398937941959995, 0.8390602370703127,
+  0.8382247055548381, 0.8373872016156619, 0.836547727223512, 0.8357062843537526,
+  0.83486287498638, 0.8340175011060181, 0.8331701647019132, 0.8323208677679297,
+  0.8314696123025452, 0.8306164003088463, 0.829761233794523, 0.8289041147718649,
+  0.8280450452577558, 0.8271840272736691, 0.8263210628456635, 0.8254561540043776,
+  0.8245893027850253, 0.8237205112273914, 0.8228497813758264, 0.8219771152792416,
+  0.8211025149911046, 0.8202259825694347, 0.8193475200767969, 0.8184671295802987,
+  0.8175848131515837, 0.8167005728668278, 0.8158144108067338, 0.8149263290565266,
+  0.8140363297059484, 0.8131444148492536, 0.8122505865852039, 0.8113548470170637,
+  0.8104571982525948, 0.8095576424040513, 0.808656181588175, 0.8077528179261904,
+  0.8068475535437993, 0.8059403905711763, 0.8050313311429637, 0.8041203773982658,
+  0.8032075314806449, 0.8022927955381157, 0.8013761717231402, 0.8004576621926228,
+  0.799537269107905, 0.7986149946347608, 0.7976908409433912, 0.7967648102084188,
+  0.7958369046088836, 0.794907126328237, 0.7939754775543372, 0.7930419604794436,
+  0.7921065773002124, 0.7911693302176902, 0.79023022143731, 0.7892892531688857,
+  0.7883464276266063, 0.7874017470290314, 0.7864552135990858, 0.7855068295640539,
+  0.7845565971555752, 0.7836045186096382, 0.7826505961665757, 0.7816948320710594,
+  0.7807372285720945, 0.7797777879230146, 0.778816512381476, 0.7778534042094531,
+  0.7768884656732324, 0.7759216990434077, 0.7749531065948739, 0.7739826906068229,
+  0.773010453362737, 0.7720363971503845, 0.7710605242618138, 0.7700828369933479,
+  0.7691033376455797, 0.7681220285233654, 0.7671389119358204, 0.7661539901963129,
+  0.765167265622459, 0.7641787405361167, 0.7631884172633813, 0.7621962981345789,
+  0.7612023854842618, 0.7602066816512024, 0.7592091889783881, 0.7582099098130153,
+  0.7572088465064846, 0.7562060014143945, 0.7552013768965365, 0.7541949753168892,
+  0.7531867990436125, 0.7521768504490428, 0.7511651319096865, 0.7501516458062151,
+  0.7491363945234594, 0.7481193804504036, 0.7471006059801801, 0.7460800735100638,
+  0.7450577854414661, 0.7440337441799293, 0.7430079521351217, 0.7419804117208311,
+  0.7409511253549591, 0.7399200954595162, 0.7388873244606151, 0.737852814788466,
+  0.7368165688773699, 0.7357785891657136, 0.7347388780959635, 0.7336974381146604,
+  0.7326542716724128, 0.7316093812238926, 0.7305627692278276, 0.729514438146997,
+  0.7284643904482252, 0.7274126286023758, 0.726359155084346, 0.7253039723730608,
+  0.724247082951467, 0.7231884893065275, 0.7221281939292153, 0.7210661993145081,
+  0.7200025079613817, 0.7189371223728045, 0.7178700450557317, 0.7168012785210995,
+  0.7157308252838186, 0.7146586878627691, 0.7135848687807936, 0.7125093705646923,
+  0.7114321957452164, 0.7103533468570624, 0.7092728264388657, 0.7081906370331954,
+  0.7071067811865475, 0.7060212614493397, 0.7049340803759049, 0.7038452405244849,
+  0.7027547444572253, 0.7016625947401685, 0.7005687939432483, 0.6994733446402838,
+  0.6983762494089729, 0.6972775108308865, 0.696177131491463, 0.6950751139800009,
+  0.693971460889654, 0.6928661748174246, 0.6917592583641577, 0.6906507141345346,
+  0.6895405447370668, 0.6884287527840904, 0.687315340891759, 0.6862003116800386,
+  0.6850836677727004, 0.6839654117973154, 0.6828455463852481, 0.6817240741716497,
+  0.680600997795453, 0.679476319899365, 0.6783500431298615, 0.6772221701371803,
+  0.6760927035753159, 0.6749616461020119, 0.673829000378756, 0.6726947690707729,
+  0.6715589548470183, 0.6704215603801731, 0.669282588346636, 0.6681420414265185,
+  0.6669999223036375, 0.6658562336655097, 0.6647109782033448, 0.6635641586120398,
+  0.6624157775901718, 0.6612658378399923, 0.6601143420674205, 0.6589612929820373,
+  0.6578066932970786, 0.6566505457294289, 0.6554928529996153, 0.6543336178318004,
+  0.6531728429537768, 0.6520105310969595, 0.6508466849963809, 0.6496813073906832,
+  0.6485144010221124, 0.6473459686365121, 0.6461760129833163, 0.6450045368155439,
+  0.6438315428897914, 0.6426570339662269, 0.6414810128085832, 0.6403034821841517,
+  0.6391244448637757, 0.637943903621844, 0.6367618612362842, 0.6355783204885561,
+  0.6343932841636455, 0.6332067550500572, 0.6320187359398091, 0.6308292296284245,
+  0.629638238914927, 0.6284457666018327, 0.6272518154951441, 0.6260563884043435,
+  0.6248594881423863, 0.6236611175256945, 0.62246127937415, 0.6212599765110876,
+  0.6200572117632891, 0.6188529879609763, 0.6176473079378039, 0.6164401745308536,
+  0.6152315905806268, 0.6140215589310384, 0.6128100824294097, 0.6115971639264619,
+  0.6103828062763095, 0.6091670123364532, 0.6079497849677736, 0.6067311270345245,
+  0.6055110414043255, 0.604289530948156, 0.6030665985403482, 0.60184224705858,
+  0.600616479383869, 0.5993892984005645, 0.5981607069963423, 0.5969307080621965,
+  0.5956993044924334, 0.5944664991846644, 0.5932322950397998, 0.591996694962041,
+  0.5907597018588742, 0.5895213186410639, 0.5882815482226452, 0.587040393520918,
+  0.5857978574564389, 0.5845539429530153, 0.5833086529376983, 0.5820619903407754,
+  0.5808139580957645, 0.5795645591394056, 0.5783137964116556, 0.5770616728556794,
+  0.5758081914178453, 0.5745533550477158, 0.5732971666980422, 0.572039629324757,
+  0.5707807458869673, 0.5695205193469471, 0.5682589526701315, 0.5669960488251087,
+  0.5657318107836131, 0.5644662415205195, 0.5631993440138341, 0.5619311212446895,
+  0.560661576197336, 0.5593907118591361, 0.5581185312205561, 0.5568450372751601,
+  0.5555702330196022, 0.55429412145362, 0.5530167055800275, 0.5517379884047073,
+  0.5504579729366048, 0.5491766621877197, 0.5478940591731002, 0.5466101669108349,
+  0.5453249884220465, 0.5440385267308838, 0.5427507848645159, 0.5414617658531234,
+  0.5401714727298929, 0.5388799085310084, 0.5375870762956454, 0.5362929790659632,
+  0.5349976198870972, 0.533701001807153, 0.5324031278771979, 0.531104001151255,
+  0.5298036246862946, 0.5285020015422285, 0.5271991347819013, 0.5258950274710846,
+  0.524589682678469, 0.5232831034756564, 0.5219752929371544, 0.5206662541403672,
+  0.5193559901655896, 0.5180445040959993, 0.5167317990176499, 0.5154178780194629,
+  0.5141027441932217, 0.512786400633563, 0.5114688504379703, 0.5101500967067668,
+  0.508830142543107, 0.5075089910529709, 0.5061866453451552, 0.5048631085312676,
+  0.5035383837257176, 0.5022124740457108, 0.5008853826112407, 0.49955711254508184,
+  0.49822766697278187, 0.49689704902265447, 0.49556526182577254, 0.4942323085159597,
+  0.49289819222978404, 0.4915629161065499, 0.49022648328829116, 0.48888889691976317,
+  0.487550160148436, 0.4862102761244864, 0.48486924800079106, 0.48352707893291874,
+  0.4821837720791227, 0.48083933060033396, 0.479493757660153, 0.478147056424843,
+  0.4767992300633221, 0.47545028174715587, 0.47410021465054997, 0.4727490319503428,
+  0.47139673682599764, 0.4700433324595956, 0.4686888220358279, 0.4673332087419884,
+  0.4659764957679662, 0.4646186863062378, 0.46325978355186015, 0.46189979070246273,
+  0.46053871095824, 0.4591765475219441, 0.4578133035988772, 0.4564489823968839,
+  0.45508358712634384, 0.45371712100016387, 0.4523495872337709, 0.45098098904510386,
+  0.44961132965460654, 0.4482406122852199, 0.44686884016237416, 0.44549601651398174,
+  0.4441221445704292, 0.44274722756457, 0.44137126873171667, 0.43999427130963326,
+  0.43861623853852766, 0.4372371736610441, 0.4358570799222555, 0.43447596056965565,
+  0.43309381885315196, 0.43171065802505726, 0.4303264813400826, 0.4289412920553295,
+  0.4275550934302821, 0.4261678887267996, 0.4247796812091088, 0.42339047414379605,
+  0.4220002707997997, 0.4206090744484025, 0.4192168883632239, 0.41782371582021227,
+  0.41642956009763715, 0.41503442447608163, 0.4136383122384345, 0.4122412266698829,
+  0.4108431710579039, 0.4094441486922576, 0.4080441628649787, 0.40664321687036903,
+  0.40524131400498986, 0.4038384575676541, 0.40243465085941843, 0.4010298971835756,
+  0.3996241998456468, 0.39821756215337356, 0.3968099874167103, 0.39540147894781635,
+  0.3939920400610481, 0.39258167407295147, 0.39117038430225387, 0.3897581740698564,
+  0.38834504669882625, 0.3869310055143886, 0.38551605384391885, 0.38410019501693504,
+  0.3826834323650898, 0.3812657692221624, 0.37984720892405116, 0.37842775480876556,
+  0.37700741021641826, 0.3755861784892172, 0.37416406297145793, 0.37274106700951576,
+  0.37131719395183754, 0.3698924471489341, 0.3684668299533723, 0.3670403457197672,
+  0.36561299780477385, 0.3641847895670799, 0.3627557243673972, 0.3613258055684543,
+  0.3598950365349881, 0.35846342063373654, 0.35703096123343, 0.35559766170478385,
+  0.35416352542049034, 0.3527285557552107, 0.3512927560855671, 0.3498561297901349,
+  0.34841868024943456, 0.3469804108459237, 0.3455413249639891, 0.3441014259899388,
+  0.3426607173119944, 0.34121920232028236, 0.33977688440682685, 0.3383337669655411,
+  0.33688985339222005, 0.3354451470845316, 0.3339996514420094, 0.3325533698660442,
+  0.33110630575987643, 0.3296584625285875, 0.3282098435790925, 0.32676045232013173,
+  0.3253102921622629, 0.32385936651785285, 0.32240767880106985, 0.3209552324278752,
+  0.3195020308160157, 0.31804807738501495, 0.31659337555616585, 0.31513792875252244,
+  0.3136817403988915, 0.3122248139218249, 0.3107671527496115, 0.3093087603122687,
+  0.30784964004153487, 0.3063897953708609, 0.3049292297354024, 0.3034679465720113,
+  0.3020059493192281, 0.30054324141727345, 0.2990798263080405, 0.2976157074350862,
+  0.2961508882436238, 0.2946853721805143, 0.29321916269425863, 0.29175226323498926,
+  0.29028467725446233, 0.2888164082060495, 0.2873474595447295, 0.2858778347270806,
+  0.2844075372112719, 0.2829365704570554, 0.28146493792575794, 0.2799926430802732,
+  0.27851968938505306, 0.2770460803060999, 0.27557181931095814, 0.2740969098687064,
+  0.272621355449949, 0.271145159526808, 0.2696683255729151, 0.2681908570634032,
+  0.26671275747489837, 0.2652340302855118, 0.26375467897483135, 0.2622747070239136,
+  0.2607941179152755, 0.25931291513288623, 0.257831102162159, 0.2563486824899429,
+  0.25486565960451457, 0.25338203699557016, 0.25189781815421697, 0.2504130065729652,
+  0.24892760574572015, 0.24744161916777327, 0.2459550503357946, 0.24446790274782415,
+  0.24298017990326387, 0.24149188530286933, 0.2400030224487415, 0.23851359484431842,
+  0.2370236059943672, 0.2355330594049755, 0.23404195858354343, 0.23255030703877524,
+  0.2310581082806711, 0.22956536582051887, 0.22807208317088573, 0.22657826384561,
+  0.22508391135979283, 0.22358902922979, 0.2220936209732035, 0.2205976901088735,
+  0.2191012401568698, 0.21760427463848364, 0.21610679707621952, 0.21460881099378676,
+  0.21311031991609136, 0.21161132736922755, 0.2101118368804696, 0.20861185197826349,
+  0.20711137619221856, 0.20561041305309924, 0.20410896609281687, 0.20260703884442113,
+  0.2011046348420919, 0.19960175762113097, 0.19809841071795356, 0.19659459767008022,
+  0.19509032201612825, 0.1935855872958036, 0.19208039704989244, 0.19057475482025274,
+  0.1890686641498062, 0.1875621285825296, 0.18605515166344663, 0.18454773693861962,
+  0.18303988795514095, 0.18153160826112497, 0.18002290140569951, 0.1785137709389975,
+  0.17700422041214875, 0.17549425337727143, 0.17398387338746382, 0.17247308399679595,
+  0.17096188876030122, 0.16945029123396796, 0.16793829497473117, 0.1664259035404641,
+  0.16491312048996992, 0.16339994938297323, 0.16188639378011183, 0.16037245724292828,
+  0.15885814333386145, 0.15734345561623825, 0.15582839765426523, 0.1543129730130201,
+  0.15279718525844344, 0.15128103795733022, 0.1497645346773215, 0.14824767898689603,
+  0.14673047445536175, 0.14521292465284746, 0.14369503315029447, 0.14217680351944803,
+  0.1406582393328492, 0.1391393441638262, 0.13762012158648604, 0.1361005751757062,
+  0.13458070850712617, 0.13306052515713906, 0.13154002870288312, 0.13001922272223335,
+  0.12849811079379317, 0.12697669649688587, 0.12545498341154623, 0.12393297511851216,
+  0.1224106751992162, 0.12088808723577708, 0.11936521481099135, 0.11784206150832498,
+  0.11631863091190475, 0.11479492660651008, 0.11327095217756435, 0.11174671121112659,
+  0.11022220729388306, 0.10869744401313872, 0.10717242495680884, 0.10564715371341062,
+  0.10412163387205459, 0.10259586902243628, 0.10106986275482782, 0.09954361866006932,
+  0.0980171403295606, 0.09649043135525259, 0.09496349532963899, 0.09343633584574779,
+  0.09190895649713272, 0.09038136087786498, 0.0888535525825246, 0.08732553520619206,
+  0.0857973123444399, 0.08426888759332407, 0.08274026454937569, 0.08121144680959244,
+  0.07968243797143013, 0.07815324163279423, 0.07662386139203149, 0.0750943008479213,
+  0.07356456359966743, 0.07203465324688933, 0.07050457338961386, 0.06897432762826675,
+  0.06744391956366405, 0.0659133527970038, 0.06438263092985747, 0.0628517575641614,
+  0.06132073630220858, 0.05978957074663987, 0.05825826450043575, 0.05672682116690775,
+  0.055195244349689934, 0.05366353765273052, 0.052131704680283324, 0.05059974903689928,
+  0.049067674327418015, 0.0475354841569593, 0.04600318213091462, 0.04447077185493867,
+  0.04293825693494082, 0.04140564097707674, 0.03987292758773981, 0.038340120373552694,
+  0.03680722294135883, 0.03527423889821395, 0.03374117185137758, 0.032208025408304586,
+  0.030674803176636626, 0.029141508764193722, 0.02760814577896574, 0.0260747178291039,
+  0.024541228522912288, 0.02300768146883937, 0.021474080275469508, 0.01994042855151444,
+  0.01840672990580482, 0.01687298794728171, 0.0153392062849881, 0.01380538852806039,
+  0.012271538285719925, 0.01073765916726449, 0.00920375478205982, 0.007669828739531097,
+  0.006135884649154475, 0.0046019261204485705, 0.003067956762965976, 0.0015339801862847655,
+  0.0, -0.0015339801862847655, -0.003067956762965976, -0.0046019261204485705,
+  -0.006135884649154475, -0.007669828739531097, -0.00920375478205982, -0.01073765916726449,
+  -0.012271538285719925, -0.01380538852806039, -0.0153392062849881, -0.01687298794728171,
+  -0.01840672990580482, -0.01994042855151444, -0.021474080275469508, -0.02300768146883937,
+  -0.024541228522912288, -0.0260747178291039, -0.02760814577896574, -0.029141508764193722,
+  -0.030674803176636626, -0.032208025408304586, -0.03374117185137758, -0.03527423889821395,
+  -0.03680722294135883, -0.038340120373552694, -0.03987292758773981, -0.04140564097707674,
+  -0.04293825693494082, -0.04447077185493867, -0.04600318213091462, -0.0475354841569593,
+  -0.049067674327418015, -0.05059974903689928, -0.052131704680283324, -0.05366353765273052,
+  -0.055195244349689934, -0.05672682116690775, -0.05825826450043575, -0.05978957074663987,
+  -0.06132073630220858, -0.0628517575641614, -0.06438263092985747, -0.0659133527970038,
+  -0.06744391956366405, -0.06897432762826675, -0.07050457338961386, -0.07203465324688933,
+  -0.07356456359966743, -0.0750943008479213, -0.07662386139203149, -0.07815324163279423,
+  -0.07968243797143013, -0.08121144680959244, -0.08274026454937569, -0.08426888759332407,
+  -0.0857973123444399, -0.08732553520619206, -0.0888535525825246, -0.09038136087786498,
+  -0.09190895649713272, -0.09343633584574779, -0.09496349532963899, -0.09649043135525259,
+  -0.0980171403295606, -0.09954361866006932, -0.10106986275482782, -0.10259586902243628,
+  -0.10412163387205459, -0.10564715371341062, -0.10717242495680884, -0.10869744401313872,
+  -0.11022220729388306, -0.11174671121112659, -0.11327095217756435, -0.11479492660651008,
+  -0.11631863091190475, -0.11784206150832498, -0.11936521481099135, -0.12088808723577708,
+  -0.1224106751992162, -0.12393297511851216, -0.12545498341154623, -0.12697669649688587,
+  -0.12849811079379317, -0.13001922272223335, -0.13154002870288312, -0.13306052515713906,
+  -0.13458070850712617, -0.1361005751757062, -0.13762012158648604, -0.1391393441638262,
+  -0.1406582393328492, -0.14217680351944803, -0.14369503315029447, -0.14521292465284746,
+  -0.14673047445536175, -0.14824767898689603, -0.1497645346773215, -0.15128103795733022,
+  -0.15279718525844344, -0.1543129730130201, -0.15582839765426523, -0.15734345561623825,
+  -0.15885814333386145, -0.16037245724292828, -0.16188639378011183, -0.16339994938297323,
+  -0.16491312048996992, -0.1664259035404641, -0.16793829497473117, -0.16945029123396796,
+  -0.17096188876030122, -0.17247308399679595, -0.17398387338746382, -0.17549425337727143,
+  -0.17700422041214875, -0.1785137709389975, -0.18002290140569951, -0.18153160826112497,
+  -0.18303988795514095, -0.18454773693861962, -0.18605515166344663, -0.1875621285825296,
+  -0.1890686641498062, -0.19057475482025274, -0.19208039704989244, -0.1935855872958036,
+  -0.19509032201612825, -0.19659459767008022, -0.19809841071795356, -0.19960175762113097,
+  -0.2011046348420919, -0.20260703884442113, -0.20410896609281687, -0.20561041305309924,
+  -0.20711137619221856, -0.20861185197826349, -0.2101118368804696, -0.21161132736922755,
+  -0.21311031991609136, -0.21460881099378676, -0.21610679707621952, -0.21760427463848364,
+  -0.2191012401568698, -0.2205976901088735, -0.2220936209732035, -0.22358902922979,
+  -0.22508391135979283, -0.22657826384561, -0.22807208317088573, -0.22956536582051887,
+  -0.2310581082806711, -0.23255030703877524, -0.23404195858354343, -0.2355330594049755,
+  -0.2370236059943672, -0.23851359484431842, -0.2400030224487415, -0.24149188530286933,
+  -0.24298017990326387, -0.24446790274782415, -0.2459550503357946, -0.24744161916777327,
+  -0.24892760574572015, -0.2504130065729652, -0.25189781815421697, -0.25338203699557016,
+  -0.25486565960451457, -0.2563486824899429, -0.257831102162159, -0.25931291513288623,
+  -0.2607941179152755, -0.2622747070239136, -0.26375467897483135, -0.2652340302855118,
+  -0.26671275747489837, -0.2681908570634032, -0.2696683255729151, -0.271145159526808,
+  -0.272621355449949, -0.2740969098687064, -0.27557181931095814, -0.2770460803060999,
+  -0.27851968938505306, -0.2799926430802732, -0.28146493792575794, -0.2829365704570554,
+  -0.2844075372112719, -0.2858778347270806, -0.2873474595447295, -0.2888164082060495,
+  -0.29028467725446233, -0.29175226323498926, -0.29321916269425863, -0.2946853721805143,
+  -0.2961508882436238, -0.2976157074350862, -0.2990798263080405, -0.30054324141727345,
+  -0.3020059493192281, -0.3034679465720113, -0.3049292297354024, -0.3063897953708609,
+  -0.30784964004153487, -0.3093087603122687, -0.3107671527496115, -0.3122248139218249,
+  -0.3136817403988915, -0.31513792875252244, -0.31659337555616585, -0.31804807738501495,
+  -0.3195020308160157, -0.3209552324278752, -0.32240767880106985, -0.32385936651785285,
+  -0.3253102921622629, -0.32676045232013173, -0.3282098435790925, -0.3296584625285875,
+  -0.33110630575987643, -0.3325533698660442, -0.3339996514420094, -0.3354451470845316,
+  -0.33688985339222005, -0.3383337669655411, -0.33977688440682685, -0.34121920232028236,
+  -0.3426607173119944, -0.3441014259899388, -0.3455413249639891, -0.3469804108459237,
+  -0.34841868024943456, -0.3498561297901349, -0.3512927560855671, -0.3527285557552107,
+  -0.35416352542049034, -0.35559766170478385, -0.35703096123343, -0.35846342063373654,
+  -0.3598950365349881, -0.3613258055684543, -0.3627557243673972, -0.3641847895670799,
+  -0.36561299780477385, -0.3670403457197672, -0.3684668299533723, -0.3698924471489341,
+  -0.37131719395183754, -0.37274106700951576, -0.37416406297145793, -0.3755861784892172,
+  -0.37700741021641826, -0.37842775480876556, -0.37984720892405116, -0.3812657692221624,
+  -0.3826834323650898, -0.38410019501693504, -0.38551605384391885, -0.3869310055143886,
+  -0.38834504669882625, -0.3897581740698564, -0.39117038430225387, -0.39258167407295147,
+  -0.3939920400610481, -0.39540147894781635, -0.3968099874167103, -0.39821756215337356,
+  -0.3996241998456468, -0.4010298971835756, -0.40243465085941843, -0.4038384575676541,
+  -0.40524131400498986, -0.40664321687036903, -0.4080441628649787, -0.4094441486922576,
+  -0.4108431710579039, -0.4122412266698829, -0.4136383122384345, -0.41503442447608163,
+  -0.41642956009763715, -0.41782371582021227, -0.4192168883632239, -0.4206090744484025,
+  -0.4220002707997997, -0.42339047414379605, -0.4247796812091088, -0.4261678887267996,
+  -0.4275550934302821, -0.4289412920553295, -0.4303264813400826, -0.43171065802505726,
+  -0.43309381885315196, -0.43447596056965565, -0.4358570799222555, -0.4372371736610441,
+  -0.43861623853852766, -0.43999427130963326, -0.44137126873171667, -0.44274722756457,
+  -0.4441221445704292, -0.44549601651398174, -0.44686884016237416, -0.4482406122852199,
+  -0.44961132965460654, -0.45098098904510386, -0.4523495872337709, -0.45371712100016387,
+  -0.45508358712634384, -0.4564489823968839, -0.4578133035988772, -0.4591765475219441,
+  -0.46053871095824, -0.46189979070246273, -0.46325978355186015, -0.4646186863062378,
+  -0.4659764957679662, -0.4673332087419884, -0.4686888220358279, -0.4700433324595956,
+  -0.47139673682599764, -0.4727490319503428, -0.47410021465054997, -0.47545028174715587,
+  -0.4767992300633221, -0.478147056424843, -0.479493757660153, -0.48083933060033396,
+  -0.4821837720791227, -0.48352707893291874, -0.48486924800079106, -0.4862102761244864,
+  -0.487550160148436, -0.48888889691976317, -0.49022648328829116, -0.4915629161065499,
+  -0.49289819222978404, -0.4942323085159597, -0.49556526182577254, -0.49689704902265447,
+  -0.49822766697278187, -0.49955711254508184, -0.5008853826112407, -0.5022124740457108,
+  -0.5035383837257176, -0.5048631085312676, -0.5061866453451552, -0.5075089910529709,
+  -0.508830142543107, -0.5101500967067668, -0.5114688504379703, -0.512786400633563,
+  -0.5141027441932217, -0.5154178780194629, -0.5167317990176499, -0.5180445040959993,
+  -0.5193559901655896, -0.5206662541403672, -0.5219752929371544, -0.5232831034756564,
+  -0.524589682678469, -0.5258950274710846, -0.5271991347819013, -0.5285020015422285,
+  -0.5298036246862946, -0.531104001151255, -0.5324031278771979, -0.533701001807153,
+  -0.5349976198870972, -0.5362929790659632, -0.5375870762956454, -0.5388799085310084,
+  -0.5401714727298929, -0.5414617658531234, -0.5427507848645159, -0.5440385267308838,
+  -0.5453249884220465, -0.5466101669108349, -0.5478940591731002, -0.5491766621877197,
+  -0.5504579729366048, -0.5517379884047073, -0.5530167055800275, -0.55429412145362,
+  -0.5555702330196022, -0.5568450372751601, -0.5581185312205561, -0.5593907118591361,
+  -0.560661576197336, -0.5619311212446895, -0.5631993440138341, -0.5644662415205195,
+  -0.5657318107836131, -0.5669960488251087, -0.5682589526701315, -0.5695205193469471,
+  -0.5707807458869673, -0.572039629324757, -0.5732971666980422, -0.5745533550477158,
+  -0.5758081914178453, -0.5770616728556794, -0.5783137964116556, -0.5795645591394056,
+  -0.5808139580957645, -0.5820619903407754, -0.5833086529376983, -0.5845539429530153,
+  -0.5857978574564389, -0.587040393520918, -0.5882815482226452, -0.5895213186410639,
+  -0.5907597018588742, -0.591996694962041, -0.5932322950397998, -0.5944664991846644,
+  -0.5956993044924334, -0.5969307080621965, -0.5981607069963423, -0.5993892984005645,
+  -0.600616479383869, -0.60184224705858, -0.6030665985403482, -0.604289530948156,
+  -0.6055110414043255, -0.6067311270345245, -0.6079497849677736, -0.6091670123364532,
+  -0.6103828062763095, -0.6115971639264619, -0.6128100824294097, -0.6140215589310384,
+  -0.6152315905806268, -0.6164401745308536, -0.6176473079378039, -0.6188529879609763,
+  -0.6200572117632891, -0.6212599765110876, -0.62246127937415, -0.6236611175256945,
+  -0.6248594881423863, -0.6260563884043435, -0.6272518154951441, -0.6284457666018327,
+  -0.629638238914927, -0.6308292296284245, -0.6320187359398091, -0.6332067550500572,
+  -0.6343932841636455, -0.6355783204885561, -0.6367618612362842, -0.637943903621844,
+  -0.6391244448637757, -0.6403034821841517, -0.6414810128085832, -0.6426570339662269,
+  -0.6438315428897914, -0.6450045368155439, -0.6461760129833163, -0.6473459686365121,
+  -0.6485144010221124, -0.6496813073906832, -0.6508466849963809, -0.6520105310969595,
+  -0.6531728429537768, -0.6543336178318004, -0.6554928529996153, -0.6566505457294289,
+  -0.6578066932970786, -0.6589612929820373, -0.6601143420674205, -0.6612658378399923,
+  -0.6624157775901718, -0.6635641586120398, -0.6647109782033448, -0.6658562336655097,
+  -0.6669999223036375, -0.6681420414265185, -0.669282588346636, -0.6704215603801731,
+  -0.6715589548470183, -0.6726947690707729, -0.673829000378756, -0.6749616461020119,
+  -0.6760927035753159, -0.6772221701371803, -0.6783500431298615, -0.679476319899365,
+  -0.680600997795453, -0.6817240741716497, -0.6828455463852481, -0.6839654117973154,
+  -0.6850836677727004, -0.6862003116800386, -0.687315340891759, -0.6884287527840904,
+  -0.6895405447370668, -0.6906507141345346, -0.6917592583641577, -0.6928661748174246,
+  -0.693971460889654, -0.6950751139800009, -0.696177131491463, -0.6972775108308865,
+  -0.6983762494089729, -0.6994733446402838, -0.7005687939432483, -0.7016625947401685,
+  -0.7027547444572253, -0.7038452405244849, -0.7049340803759049, -0.7060212614493397,
+  -0.7071067811865475, -0.7081906370331954, -0.7092728264388657, -0.7103533468570624,
+  -0.7114321957452164, -0.7125093705646923, -0.7135848687807936, -0.7146586878627691,
+  -0.7157308252838186, -0.7168012785210995, -0.7178700450557317, -0.7189371223728045,
+  -0.7200025079613817, -0.7210661993145081, -0.7221281939292153, -0.7231884893065275,
+  -0.724247082951467, -0.7253039723730608, -0.726359155084346, -0.7274126286023758,
+  -0.7284643904482252, -0.729514438146997, -0.7305627692278276, -0.7316093812238926,
+  -0.7326542716724128, -0.7336974381146604, -0.7347388780959635, -0.7357785891657136,
+  -0.7368165688773699, -0.737852814788466, -0.7388873244606151, -0.7399200954595162,
+  -0.7409511253549591, -0.7419804117208311, -0.7430079521351217, -0.7440337441799293,
+  -0.7450577854414661, -0.7460800735100638, -0.7471006059801801, -0.7481193804504036,
+  -0.7491363945234594, -0.7501516458062151, -0.7511651319096865, -0.7521768504490428,
+  -0.7531867990436125, -0.7541949753168892, -0.7552013768965365, -0.7562060014143945,
+  -0.7572088465064846, -0.7582099098130153, -0.7592091889783881, -0.7602066816512024,
+  -0.7612023854842618, -0.7621962981345789, -0.7631884172633813, -0.7641787405361167,
+  -0.765167265622459, -0.7661539901963129, -0.7671389119358204, -0.7681220285233654,
+  -0.7691033376455797, -0.7700828369933479, -0.7710605242618138, -0.7720363971503845,
+  -0.773010453362737, -0.7739826906068229, -0.7749531065948739, -0.7759216990434077,
+  -0.7768884656732324, -0.7778534042094531, -0.778816512381476, -0.7797777879230146,
+  -0.7807372285720945, -0.7816948320710594, -0.7826505961665757, -0.7836045186096382,
+  -0.7845565971555752, -0.7855068295640539, -0.7864552135990858, -0.7874017470290314,
+  -0.7883464276266063, -0.7892892531688857, -0.79023022143731, -0.7911693302176902,
+  -0.7921065773002124, -0.7930419604794436, -0.7939754775543372, -0.794907126328237,
+  -0.7958369046088836, -0.7967648102084188, -0.7976908409433912, -0.7986149946347608,
+  -0.799537269107905, -0.8004576621926228, -0.8013761717231402, -0.8022927955381157,
+  -0.8032075314806449, -0.8041203773982658, -0.8050313311429637, -0.8059403905711763,
+  -0.8068475535437993, -0.8077528179261904, -0.808656181588175, -0.8095576424040513,
+  -0.8104571982525948, -0.8113548470170637, -0.8122505865852039, -0.8131444148492536,
+  -0.8140363297059484, -0.8149263290565266, -0.8158144108067338, -0.8167005728668278,
+  -0.8175848131515837, -0.8184671295802987, -0.8193475200767969, -0.8202259825694347,
+  -0.8211025149911046, -0.8219771152792416, -0.8228497813758264, -0.8237205112273914,
+  -0.8245893027850253, -0.8254561540043776, -0.8263210628456635, -0.8271840272736691,
+  -0.8280450452577558, -0.8289041147718649, -0.829761233794523, -0.8306164003088463,
+  -0.8314696123025452, -0.8323208677679297, -0.8331701647019132, -0.8340175011060181,
+  -0.83486287498638, -0.8357062843537526, -0.836547727223512, -0.8373872016156619,
+  -0.8382247055548381, -0.8390602370703127, -0.8398937941959995, -0.8407253749704581,
+  -0.8415549774368984, -0.8423825996431858, -0.8432082396418454, -0.8440318954900664,
+  -0.8448535652497071, -0.8456732469872991, -0.8464909387740521, -0.8473066386858583,
+  -0.8481203448032972, -0.8489320552116396, -0.8497417680008525, -0.8505494812656035,
+  -0.8513551931052652, -0.8521589016239198, -0.8529606049303636, -0.8537603011381114,
+  -0.8545579883654005, -0.855353664735196, -0.8561473283751945, -0.8569389774178288,
+  -0.8577286100002721, -0.8585162242644427, -0.8593018183570085, -0.8600853904293901,
+  -0.8608669386377673, -0.8616464611430813, -0.8624239561110406, -0.8631994217121242,
+  -0.8639728561215868, -0.8647442575194624, -0.8655136240905691, -0.866280954024513,
+  -0.8670462455156926, -0.8678094967633033, -0.8685707059713409, -0.8693298713486068,
+  -0.8700869911087115, -0.870842063470079, -0.871595086655951, -0.8723460588943915,
+  -0.8730949784182901, -0.8738418434653669, -0.8745866522781761, -0.8753294031041109,
+  -0.8760700941954066, -0.8768087238091457, -0.8775452902072614, -0.8782797916565416,
+  -0.8790122264286335, -0.8797425928000474, -0.8804708890521608, -0.8811971134712221,
+  -0.881921264348355, -0.8826433399795628, -0.8833633386657316, -0.884081258712635,
+  -0.8847970984309378, -0.8855108561362, -0.8862225301488806, -0.8869321187943422,
+  -0.8876396204028539, -0.8883450333095964, -0.8890483558546646, -0.8897495863830728,
+  -0.8904487232447579, -0.8911457647945832, -0.8918407093923427, -0.8925335554027646,
+  -0.8932243011955153, -0.8939129451452033, -0.8945994856313827, -0.8952839210385576,
+  -0.8959662497561852, -0.8966464701786802, -0.8973245807054183, -0.8980005797407399,
+  -0.8986744656939538, -0.8993462369793416, -0.9000158920161603, -0.900683429228647,
+  -0.901348847046022, -0.9020121439024932, -0.9026733182372588, -0.9033323684945118,
+  -0.9039892931234433, -0.9046440905782462, -0.9052967593181188, -0.9059472978072685,
+  -0.9065957045149153, -0.9072419779152958, -0.9078861164876663, -0.9085281187163061,
+  -0.9091679830905224, -0.9098057081046522, -0.9104412922580672, -0.9110747340551764,
+  -0.9117060320054299, -0.9123351846233227, -0.9129621904283982, -0.9135870479452508,
+  -0.9142097557035307, -0.9148303122379462, -0.9154487160882678, -0.9160649657993317,
+  -0.9166790599210427, -0.9172909970083779, -0.9179007756213905, -0.9185083943252123,
+  -0.9191138516900578, -0.9197171462912274, -0.9203182767091106, -0.9209172415291895,
+  -0.921514039342042, -0.9221086687433452, -0.9227011283338786, -0.9232914167195276,
+  -0.9238795325112867, -0.9244654743252626, -0.9250492407826776, -0.9256308305098727,
+  -0.9262102421383114, -0.9267874743045817, -0.9273625256504011, -0.9279353948226179,
+  -0.9285060804732156, -0.9290745812593159, -0.9296408958431813, -0.9302050228922191,
+  -0.9307669610789837, -0.9313267090811804, -0.9318842655816681, -0.9324396292684624,
+  -0.932992798834739, -0.9335437729788362, -0.934092550404259, -0.9346391298196808,
+  -0.9351835099389476, -0.9357256894810804, -0.9362656671702783, -0.9368034417359216,
+  -0.937339011912575, -0.9378723764399899, -0.9384035340631081, -0.9389324835320646,
+  -0.9394592236021899, -0.939983753034014, -0.9405060705932683, -0.9410261750508893,
+  -0.9415440651830208, -0.9420597397710173, -0.9425731976014469, -0.9430844374660935,
+  -0.9435934581619604, -0.9441002584912727, -0.9446048372614803, -0.9451071932852606,
+  -0.9456073253805213, -0.9461052323704034, -0.9466009130832835, -0.9470943663527772,
+  -0.9475855910177411, -0.9480745859222762, -0.9485613499157303, -0.9490458818527006,
+  -0.9495281805930367, -0.950008245001843, -0.9504860739494817, -0.9509616663115751,
+  -0.9514350209690083, -0.9519061368079323, -0.9523750127197659, -0.9528416476011987,
+  -0.9533060403541939, -0.9537681898859903, -0.9542280951091057, -0.9546857549413383,
+  -0.9551411683057708, -0.9555943341307711, -0.9560452513499964, -0.9564939189023951,
+  -0.9569403357322088, -0.9573845007889759, -0.9578264130275329, -0.9582660714080177,
+  -0.9587034748958716, -0.9591386224618419, -0.9595715130819845, -0.960002145737666,
+  -0.9604305194155658, -0.9608566331076797, -0.9612804858113206, -0.9617020765291225,
+  -0.9621214042690416, -0.9625384680443592, -0.9629532668736839, -0.963365799780954,
+  -0.9637760657954398, -0.9641840639517458, -0.9645897932898128, -0.9649932528549203,
+  -0.9653944416976894, -0.9657933588740837, -0.9661900034454125, -0.9665843744783331,
+  -0.9669764710448521, -0.9673662922223285, -0.9677538370934755, -0.9681391047463624,
+  -0.9685220942744174, -0.9689028047764289, -0.9692812353565485, -0.9696573851242924,
+  -0.970031253194544, -0.9704028386875555, -0.9707721407289504, -0.9711391584497251,
+  -0.9715038909862518, -0.9718663374802794, -0.9722264970789363, -0.9725843689347322,
+  -0.9729399522055602, -0.9732932460546982, -0.973644249650812, -0.9739929621679558,
+  -0.9743393827855759, -0.9746835106885107, -0.9750253450669941, -0.975364885116657,
+  -0.9757021300385286, -0.976037079039039, -0.9763697313300211, -0.9767000861287118,
+  -0.9770281426577544, -0.9773539001452, -0.9776773578245099, -0.9779985149345571,
+  -0.9783173707196277, -0.9786339244294232, -0.9789481753190622, -0.979260122649082,
+  -0.9795697656854405, -0.9798771036995176, -0.9801821359681174, -0.9804848617734694,
+  -0.9807852804032304, -0.9810833911504867, -0.9813791933137546, -0.9816726861969831,
+  -0.9819638691095552, -0.9822527413662894, -0.9825393022874412, -0.9828235511987052,
+  -0.9831054874312163, -0.9833851103215512, -0.9836624192117303, -0.9839374134492189,
+  -0.984210092386929, -0.9844804553832209, -0.9847485018019042, -0.9850142310122398,
+  -0.9852776423889412, -0.9855387353121761, -0.9857975091675675, -0.9860539633461954,
+  -0.9863080972445987, -0.9865599102647754, -0.9868094018141855, -0.987056571305751,
+  -0.9873014181578584, -0.9875439417943592, -0.9877841416445722, -0.9880220171432835,
+  -0.9882575677307495, -0.9884907928526966, -0.9887216919603238, -0.988950264510303,
+  -0.989176509964781, -0.9894004277913804, -0.9896220174632009, -0.9898412784588205,
+  -0.9900582102622971, -0.9902728123631691, -0.9904850842564571, -0.9906950254426646,
+  -0.99090263542778, -0.9911079137232769, -0.9913108598461154, -0.9915114733187439,
+  -0.9917097536690995, -0.9919057004306093, -0.9920993131421918, -0.9922905913482574,
+  -0.99247953459871, -0.992666142448948, -0.9928504144598651, -0.9930323501978514,
+  -0.9932119492347945, -0.9933892111480807, -0.9935641355205953, -0.9937367219407246,
+  -0.9939069700023561, -0.9940748793048794, -0.9942404494531879, -0.9944036800576791,
+  -0.9945645707342554, -0.9947231211043257, -0.9948793307948056, -0.9950331994381186,
+  -0.9951847266721969, -0.9953339121404823, -0.9954807554919269, -0.9956252563809943,
+  -0.9957674144676598, -0.9959072294174117, -0.996044700901252, -0.996179828595697,
+  -0.996312612182778, -0.9964430513500426, -0.9965711457905548, -0.9966968952028961,
+  -0.9968202992911657, -0.9969413577649822, -0.997060070339483, -0.9971764367353262,
+  -0.9972904566786902, -0.9974021299012753, -0.9975114561403035, -0.9976184351385196,
+  -0.9977230666441916, -0.9978253504111116, -0.997925286198596, -0.9980228737714862,
+  -0.9981181129001492, -0.9982110033604782, -0.9983015449338929, -0.9983897374073402,
+  -0.9984755805732948, -0.9985590742297593, -0.9986402181802653, -0.9987190122338729,
+  -0.9987954562051724, -0.9988695499142836, -0.9989412931868569, -0.9990106858540734,
+  -0.9990777277526454, -0.9991424187248169, -0.9992047586183639, -0.9992647472865944,
+  -0.9993223845883495, -0.9993776703880028, -0.9994306045554617, -0.999481186966167,
+  -0.9995294175010931, -0.9995752960467492, -0.9996188224951786, -0.9996599967439592,
+  -0.9996988186962042, -0.9997352882605617, -0.9997694053512153, -0.9998011698878843,
+  -0.9998305817958234, -0.9998576410058239, -0.9998823474542126, -0.9999047010828529,
+  -0.9999247018391445, -0.9999423496760239, -0.9999576445519639, -0.9999705864309741,
+  -0.9999811752826011, -0.9999894110819284, -0.9999952938095762, -0.9999988234517019,
+  -1.0, -0.9999988234517019, -0.9999952938095762, -0.9999894110819284,
+  -0.9999811752826011, -0.9999705864309741, -0.9999576445519639, -0.9999423496760239,
+  -0.9999247018391445, -0.9999047010828529, -0.9998823474542126, -0.9998576410058239,
+  -0.9998305817958234, -0.9998011698878843, -0.9997694053512153, -0.9997352882605617,
+  -0.9996988186962042, -0.9996599967439592, -0.9996188224951786, -0.9995752960467492,
+  -0.9995294175010931, -0.999481186966167, -0.9994306045554617, -0.9993776703880028,
+  -0.9993223845883495, -0.9992647472865944, -0.9992047586183639, -0.9991424187248169,
+  -0.9990777277526454, -0.9990106858540734, -0.9989412931868569, -0.9988695499142836,
+  -0.9987954562051724, -0.9987190122338729, -0.9986402181802653, -0.9985590742297593,
+  -0.9984755805732948, -0.9983897374073402, -0.9983015449338929, -0.9982110033604782,
+  -0.9981181129001492, -0.9980228737714862, -0.997925286198596, -0.9978253504111116,
+  -0.9977230666441916, -0.9976184351385196, -0.9975114561403035, -0.9974021299012753,
+  -0.9972904566786902, -0.9971764367353262, -0.997060070339483, -0.9969413577649822,
+  -0.9968202992911657, -0.9966968952028961, -0.9965711457905548, -0.9964430513500426,
+  -0.996312612182778, -0.996179828595697, -0.996044700901252, -0.9959072294174117,
+  -0.9957674144676598, -0.9956252563809943, -0.9954807554919269, -0.9953339121404823,
+  -0.9951847266721969, -0.9950331994381186, -0.9948793307948056, -0.9947231211043257,
+  -0.9945645707342554, -0.9944036800576791, -0.9942404494531879, -0.9940748793048794,
+  -0.9939069700023561, -0.9937367219407246, -0.9935641355205953, -0.9933892111480807,
+  -0.9932119492347945, -0.9930323501978514, -0.9928504144598651, -0.992666142448948,
+  -0.99247953459871, -0.9922905913482574, -0.9920993131421918, -0.9919057004306093,
+  -0.9917097536690995, -0.9915114733187439, -0.9913108598461154, -0.9911079137232769,
+  -0.99090263542778, -0.9906950254426646, -0.9904850842564571, -0.9902728123631691,
+  -0.9900582102622971, -0.9898412784588205, -0.9896220174632009, -0.9894004277913804,
+  -0.989176509964781, -0.988950264510303, -0.9887216919603238, -0.9884907928526966,
+  -0.9882575677307495, -0.9880220171432835, -0.9877841416445722, -0.9875439417943592,
+  -0.9873014181578584, -0.987056571305751, -0.9868094018141855, -0.9865599102647754,
+  -0.9863080972445987, -0.9860539633461954, -0.9857975091675675, -0.9855387353121761,
+  -0.9852776423889412, -0.9850142310122398, -0.9847485018019042, -0.9844804553832209,
+  -0.984210092386929, -0.9839374134492189, -0.9836624192117303, -0.9833851103215512,
+  -0.9831054874312163, -0.9828235511987052, -0.9825393022874412, -0.9822527413662894,
+  -0.9819638691095552, -0.9816726861969831, -0.9813791933137546, -0.9810833911504867,
+  -0.9807852804032304, -0.9804848617734694, -0.9801821359681174, -0.9798771036995176,
+  -0.9795697656854405, -0.979260122649082, -0.9789481753190622, -0.9786339244294232,
+  -0.9783173707196277, -0.9779985149345571, -0.9776773578245099, -0.9773539001452,
+  -0.9770281426577544, -0.9767000861287118, -0.9763697313300211, -0.976037079039039,
+  -0.9757021300385286, -0.975364885116657, -0.9750253450669941, -0.9746835106885107,
+  -0.9743393827855759, -0.9739929621679558, -0.973644249650812, -0.9732932460546982,
+  -0.9729399522055602, -0.9725843689347322, -0.9722264970789363, -0.9718663374802794,
+  -0.9715038909862518, -0.9711391584497251, -0.9707721407289504, -0.9704028386875555,
+  -0.970031253194544, -0.9696573851242924, -0.9692812353565485, -0.9689028047764289,
+  -0.9685220942744174, -0.9681391047463624, -0.9677538370934755, -0.9673662922223285,
+  -0.9669764710448521, -0.9665843744783331, -0.9661900034454125, -0.9657933588740837,
+  -0.9653944416976894, -0.9649932528549203, -0.9645897932898128, -0.9641840639517458,
+  -0.9637760657954398, -0.963365799780954, -0.9629532668736839, -0.9625384680443592,
+  -0.9621214042690416, -0.9617020765291225, -0.9612804858113206, -0.9608566331076797,
+  -0.9604305194155658, -0.960002145737666, -0.9595715130819845, -0.9591386224618419,
+  -0.9587034748958716, -0.9582660714080177, -0.9578264130275329, -0.9573845007889759,
+  -0.9569403357322088, -0.9564939189023951, -0.9560452513499964, -0.9555943341307711,
+  -0.9551411683057708, -0.9546857549413383, -0.9542280951091057, -0.9537681898859903,
+  -0.9533060403541939, -0.9528416476011987, -0.9523750127197659, -0.9519061368079323,
+  -0.9514350209690083, -0.9509616663115751, -0.9504860739494817, -0.950008245001843,
+  -0.9495281805930367, -0.9490458818527006, -0.9485613499157303, -0.9480745859222762,
+  -0.9475855910177411, -0.9470943663527772, -0.9466009130832835, -0.9461052323704034,
+  -0.9456073253805213, -0.9451071932852606, -0.9446048372614803, -0.9441002584912727,
+  -0.9435934581619604, -0.9430844374660935, -0.9425731976014469, -0.9420597397710173,
+  -0.9415440651830208, -0.9410261750508893, -0.9405060705932683, -0.939983753034014,
+  -0.9394592236021899, -0.9389324835320646, -0.9384035340631081, -0.9378723764399899,
+  -0.937339011912575, -0.9368034417359216, -0.9362656671702783, -0.9357256894810804,
+  -0.9351835099389476, -0.9346391298196808, -0.934092550404259, -0.9335437729788362,
+  -0.932992798834739, -0.9324396292684624, -0.9318842655816681, -0.9313267090811804,
+  -0.9307669610789837, -0.9302050228922191, -0.9296408958431813, -0.9290745812593159,
+  -0.9285060804732156, -0.9279353948226179, -0.9273625256504011, -0.9267874743045817,
+  -0.9262102421383114, -0.9256308305098727, -0.9250492407826776, -0.9244654743252626,
+  -0.9238795325112867, -0.9232914167195276, -0.9227011283338786, -0.9221086687433452,
+  -0.921514039342042, -0.9209172415291895, -0.9203182767091106, -0.9197171462912274,
+  -0.9191138516900578, -0.9185083943252123, -0.9179007756213905, -0.9172909970083779,
+  -0.9166790599210427, -0.9160649657993317, -0.9154487160882678, -0.9148303122379462,
+  -0.9142097557035307, -0.9135870479452508, -0.9129621904283982, -0.9123351846233227,
+  -0.9117060320054299, -0.9110747340551764, -0.9104412922580672, -0.9098057081046522,
+  -0.9091679830905224, -0.9085281187163061, -0.9078861164876663, -0.9072419779152958,
+  -0.9065957045149153, -0.9059472978072685, -0.9052967593181188, -0.9046440905782462,
+  -0.9039892931234433, -0.9033323684945118, -0.9026733182372588, -0.9020121439024932,
+  -0.901348847046022, -0.900683429228647, -0.9000158920161603, -0.8993462369793416,
+  -0.8986744656939538, -0.8980005797407399, -0.8973245807054183, -0.8966464701786802,
+  -0.8959662497561852, -0.8952839210385576, -0.8945994856313827, -0.8939129451452033,
+  -0.8932243011955153, -0.8925335554027646, -0.8918407093923427, -0.8911457647945832,
+  -0.8904487232447579, -0.8897495863830728, -0.8890483558546646, -0.8883450333095964,
+  -0.8876396204028539, -0.8869321187943422, -0.8862225301488806, -0.8855108561362,
+  -0.8847970984309378, -0.884081258712635, -0.8833633386657316, -0.8826433399795628,
+  -0.881921264348355, -0.8811971134712221, -0.8804708890521608, -0.8797425928000474,
+  -0.8790122264286335, -0.8782797916565416, -0.8775452902072614, -0.8768087238091457,
+  -0.8760700941954066, -0.8753294031041109, -0.8745866522781761, -0.8738418434653669,
+  -0.8730949784182901, -0.8723460588943915, -0.871595086655951, -0.870842063470079,
+  -0.8700869911087115, -0.8693298713486068, -0.8685707059713409, -0.8678094967633033,
+  -0.8670462455156926, -0.866280954024513, -0.8655136240905691, -0.8647442575194624,
+  -0.8639728561215868, -0.8631994217121242, -0.8624239561110406, -0.8616464611430813,
+  -0.8608669386377673, -0.8600853904293901, -0.8593018183570085, -0.8585162242644427,
+  -0.8577286100002721, -0.8569389774178288, -0.8561473283751945, -0.855353664735196,
+  -0.8545579883654005, -0.8537603011381114, -0.8529606049303636, -0.8521589016239198,
+  -0.8513551931052652, -0.8505494812656035, -0.8497417680008525, -0.8489320552116396,
+  -0.8481203448032972, -0.8473066386858583, -0.8464909387740521, -0.8456732469872991,
+  -0.8448535652497071, -0.8440318954900664, -0.8432082396418454, -0.8423825996431858,
+  -0.8415549774368984, -0.8407253749704581, -0.8398937941959995, -0.8390602370703127,
+  -0.8382247055548381, -0.8373872016156619, -0.836547727223512, -0.8357062843537526,
+  -0.83486287498638, -0.8340175011060181, -0.8331701647019132, -0.8323208677679297,
+  -0.8314696123025452, -0.8306164003088463, -0.829761233794523, -0.8289041147718649,
+  -0.8280450452577558, -0.8271840272736691, -0.8263210628456635, -0.8254561540043776,
+  -0.8245893027850253, -0.8237205112273914, -0.8228497813758264, -0.8219771152792416,
+  -0.8211025149911046, -0.8202259825694347, -0.8193475200767969, -0.8184671295802987,
+  -0.8175848131515837, -0.8167005728668278, -0.8158144108067338, -0.8149263290565266,
+  -0.8140363297059484, -0.8131444148492536, -0.8122505865852039, -0.8113548470170637,
+  -0.8104571982525948, -0.8095576424040513, -0.808656181588175, -0.8077528179261904,
+  -0.8068475535437993, -0.8059403905711763, -0.8050313311429637, -0.8041203773982658,
+  -0.8032075314806449, -0.8022927955381157, -0.8013761717231402, -0.8004576621926228,
+  -0.799537269107905, -0.7986149946347608, -0.7976908409433912, -0.7967648102084188,
+  -0.7958369046088836, -0.794907126328237, -0.7939754775543372, -0.7930419604794436,
+  -0.7921065773002124, -0.7911693302176902, -0.79023022143731, -0.7892892531688857,
+  -0.7883464276266063, -0.7874017470290314, -0.7864552135990858, -0.7855068295640539,
+  -0.7845565971555752, -0.7836045186096382, -0.7826505961665757, -0.7816948320710594,
+  -0.7807372285720945, -0.7797777879230146, -0.778816512381476, -0.7778534042094531,
+  -0.7768884656732324, -0.7759216990434077, -0.7749531065948739, -0.7739826906068229,
+  -0.773010453362737, -0.7720363971503845, -0.7710605242618138, -0.7700828369933479,
+  -0.7691033376455797, -0.7681220285233654, -0.7671389119358204, -0.7661539901963129,
+  -0.765167265622459, -0.7641787405361167, -0.7631884172633813, -0.7621962981345789,
+  -0.7612023854842618, -0.7602066816512024, -0.7592091889783881, -0.7582099098130153,
+  -0.7572088465064846, -0.7562060014143945, -0.7552013768965365, -0.7541949753168892,
+  -0.7531867990436125, -0.7521768504490428, -0.7511651319096865, -0.7501516458062151,
+  -0.7491363945234594, -0.7481193804504036, -0.7471006059801801, -0.7460800735100638,
+  -0.7450577854414661, -0.7440337441799293, -0.7430079521351217, -0.7419804117208311,
+  -0.7409511253549591, -0.7399200954595162, -0.7388873244606151, -0.737852814788466,
+  -0.7368165688773699, -0.7357785891657136, -0.7347388780959635, -0.7336974381146604,
+  -0.7326542716724128, -0.7316093812238926, -0.7305627692278276, -0.729514438146997,
+  -0.7284643904482252, -0.7274126286023758, -0.726359155084346, -0.7253039723730608,
+  -0.724247082951467, -0.7231884893065275, -0.7221281939292153, -0.7210661993145081,
+  -0.7200025079613817, -0.7189371223728045, -0.7178700450557317, -0.7168012785210995,
+  -0.7157308252838186, -0.7146586878627691, -0.7135848687807936, -0.7125093705646923,
+  -0.7114321957452164, -0.7103533468570624, -0.7092728264388657, -0.7081906370331954,
+  -0.7071067811865475, -0.7060212614493397, -0.7049340803759049, -0.7038452405244849,
+  -0.7027547444572253, -0.7016625947401685, -0.7005687939432483, -0.6994733446402838,
+  -0.6983762494089729, -0.6972775108308865, -0.696177131491463, -0.6950751139800009,
+  -0.693971460889654, -0.6928661748174246, -0.6917592583641577, -0.6906507141345346,
+  -0.6895405447370668, -0.6884287527840904, -0.687315340891759, -0.6862003116800386,
+  -0.6850836677727004, -0.6839654117973154, -0.6828455463852481, -0.6817240741716497,
+  -0.680600997795453, -0.679476319899365, -0.6783500431298615, -0.6772221701371803,
+  -0.6760927035753159, -0.6749616461020119, -0.673829000378756, -0.6726947690707729,
+  -0.6715589548470183, -0.6704215603801731, -0.669282588346636, -0.6681420414265185,
+  -0.6669999223036375, -0.6658562336655097, -0.6647109782033448, -0.6635641586120398,
+  -0.6624157775901718, -0.6612658378399923, -0.6601143420674205, -0.6589612929820373,
+  -0.6578066932970786, -0.6566505457294289, -0.6554928529996153, -0.6543336178318004,
+  -0.6531728429537768, -0.6520105310969595, -0.6508466849963809, -0.6496813073906832,
+  -0.6485144010221124, -0.6473459686365121, -0.6461760129833163, -0.6450045368155439,
+  -0.6438315428897914, -0.6426570339662269, -0.6414810128085832, -0.6403034821841517,
+  -0.6391244448637757, -0.637943903621844, -0.6367618612362842, -0.6355783204885561,
+  -0.6343932841636455, -0.6332067550500572, -0.6320187359398091, -0.6308292296284245,
+  -0.629638238914927, -0.6284457666018327, -0.6272518154951441, -0.6260563884043435,
+  -0.6248594881423863, -0.6236611175256945, -0.62246127937415, -0.6212599765110876,
+  -0.6200572117632891, -0.6188529879609763, -0.6176473079378039, -0.6164401745308536,
+  -0.6152315905806268, -0.6140215589310384, -0.6128100824294097, -0.6115971639264619,
+  -0.6103828062763095, -0.6091670123364532, -0.6079497849677736, -0.6067311270345245,
+  -0.6055110414043255, -0.604289530948156, -0.6030665985403482, -0.60184224705858,
+  -0.600616479383869, -0.5993892984005645, -0.5981607069963423, -0.5969307080621965,
+  -0.5956993044924334, -0.5944664991846644, -0.5932322950397998, -0.591996694962041,
+  -0.5907597018588742, -0.5895213186410639, -0.5882815482226452, -0.587040393520918,
+  -0.5857978574564389, -0.5845539429530153, -0.5833086529376983, -0.5820619903407754,
+  -0.5808139580957645, -0.5795645591394056, -0.5783137964116556, -0.5770616728556794,
+  -0.5758081914178453, -0.5745533550477158, -0.5732971666980422, -0.572039629324757,
+  -0.5707807458869673, -0.5695205193469471, -0.5682589526701315, -0.5669960488251087,
+  -0.5657318107836131, -0.5644662415205195, -0.5631993440138341, -0.5619311212446895,
+  -0.560661576197336, -0.5593907118591361, -0.5581185312205561, -0.5568450372751601,
+  -0.5555702330196022, -0.55429412145362, -0.5530167055800275, -0.5517379884047073,
+  -0.5504579729366048, -0.5491766621877197, -0.5478940591731002, -0.5466101669108349,
+  -0.5453249884220465, -0.5440385267308838, -0.5427507848645159, -0.5414617658531234,
+  -0.5401714727298929, -0.5388799085310084, -0.5375870762956454, -0.5362929790659632,
+  -0.5349976198870972, -0.533701001807153, -0.5324031278771979, -0.531104001151255,
+  -0.5298036246862946, -0.5285020015422285, -0.5271991347819013, -0.5258950274710846,
+  -0.524589682678469, -0.5232831034756564, -0.5219752929371544, -0.5206662541403672,
+  -0.5193559901655896, -0.5180445040959993, -0.5167317990176499, -0.5154178780194629,
+  -0.5141027441932217, -0.512786400633563, -0.5114688504379703, -0.5101500967067668,
+  -0.508830142543107, -0.5075089910529709, -0.5061866453451552, -0.5048631085312676,
+  -0.5035383837257176, -0.5022124740457108, -0.5008853826112407, -0.49955711254508184,
+  -0.49822766697278187, -0.49689704902265447, -0.49556526182577254, -0.4942323085159597,
+  -0.49289819222978404, -0.4915629161065499, -0.49022648328829116, -0.48888889691976317,
+  -0.487550160148436, -0.4862102761244864, -0.48486924800079106, -0.48352707893291874,
+  -0.4821837720791227, -0.48083933060033396, -0.479493757660153, -0.478147056424843,
+  -0.4767992300633221, -0.47545028174715587, -0.47410021465054997, -0.4727490319503428,
+  -0.47139673682599764, -0.4700433324595956, -0.4686888220358279, -0.4673332087419884,
+  -0.4659764957679662, -0.4646186863062378, -0.46325978355186015, -0.46189979070246273,
+  -0.46053871095824, -0.4591765475219441, -0.4578133035988772, -0.4564489823968839,
+  -0.45508358712634384, -0.45371712100016387, -0.4523495872337709, -0.45098098904510386,
+  -0.44961132965460654, -0.4482406122852199, -0.44686884016237416, -0.44549601651398174,
+  -0.4441221445704292, -0.44274722756457, -0.44137126873171667, -0.43999427130963326,
+  -0.43861623853852766, -0.4372371736610441, -0.4358570799222555, -0.43447596056965565,
+  -0.43309381885315196, -0.43171065802505726, -0.4303264813400826, -0.4289412920553295,
+  -0.4275550934302821, -0.4261678887267996, -0.4247796812091088, -0.42339047414379605,
+  -0.4220002707997997, -0.4206090744484025, -0.4192168883632239, -0.41782371582021227,
+  -0.41642956009763715, -0.41503442447608163, -0.4136383122384345, -0.4122412266698829,
+  -0.4108431710579039, -0.4094441486922576, -0.4080441628649787, -0.40664321687036903,
+  -0.40524131400498986, -0.4038384575676541, -0.40243465085941843, -0.4010298971835756,
+  -0.3996241998456468, -0.39821756215337356, -0.3968099874167103, -0.39540147894781635,
+  -0.3939920400610481, -0.39258167407295147, -0.39117038430225387, -0.3897581740698564,
+  -0.38834504669882625, -0.3869310055143886, -0.38551605384391885, -0.38410019501693504,
+  -0.3826834323650898, -0.3812657692221624, -0.37984720892405116, -0.37842775480876556,
+  -0.37700741021641826, -0.3755861784892172, -0.37416406297145793, -0.37274106700951576,
+  -0.37131719395183754, -0.3698924471489341, -0.3684668299533723, -0.3670403457197672,
+  -0.36561299780477385, -0.3641847895670799, -0.3627557243673972, -0.3613258055684543,
+  -0.3598950365349881, -0.35846342063373654, -0.35703096123343, -0.35559766170478385,
+  -0.35416352542049034, -0.3527285557552107, -0.3512927560855671, -0.3498561297901349,
+  -0.34841868024943456, -0.3469804108459237, -0.3455413249639891, -0.3441014259899388,
+  -0.3426607173119944, -0.34121920232028236, -0.33977688440682685, -0.3383337669655411,
+  -0.33688985339222005, -0.3354451470845316, -0.3339996514420094, -0.3325533698660442,
+  -0.33110630575987643, -0.3296584625285875, -0.3282098435790925, -0.32676045232013173,
+  -0.3253102921622629, -0.32385936651785285, -0.32240767880106985, -0.3209552324278752,
+  -0.3195020308160157, -0.31804807738501495, -0.31659337555616585, -0.31513792875252244,
+  -0.3136817403988915, -0.3122248139218249, -0.3107671527496115, -0.3093087603122687,
+  -0.30784964004153487, -0.3063897953708609, -0.3049292297354024, -0.3034679465720113,
+  -0.3020059493192281, -0.30054324141727345, -0.2990798263080405, -0.2976157074350862,
+  -0.2961508882436238, -0.2946853721805143, -0.29321916269425863, -0.29175226323498926,
+  -0.29028467725446233, -0.2888164082060495, -0.2873474595447295, -0.2858778347270806,
+  -0.2844075372112719, -0.2829365704570554, -0.28146493792575794, -0.2799926430802732,
+  -0.27851968938505306, -0.2770460803060999, -0.27557181931095814, -0.2740969098687064,
+  -0.272621355449949, -0.271145159526808, -0.2696683255729151, -0.2681908570634032,
+  -0.26671275747489837, -0.2652340302855118, -0.26375467897483135, -0.2622747070239136,
+  -0.2607941179152755, -0.25931291513288623, -0.257831102162159, -0.2563486824899429,
+  -0.25486565960451457, -0.25338203699557016, -0.25189781815421697, -0.2504130065729652,
+  -0.24892760574572015, -0.24744161916777327, -0.2459550503357946, -0.24446790274782415,
+  -0.24298017990326387, -0.24149188530286933, -0.2400030224487415, -0.23851359484431842,
+  -0.2370236059943672, -0.2355330594049755, -0.23404195858354343, -0.23255030703877524,
+  -0.2310581082806711, -0.22956536582051887, -0.22807208317088573, -0.22657826384561,
+  -0.22508391135979283, -0.22358902922979, -0.2220936209732035, -0.2205976901088735,
+  -0.2191012401568698, -0.21760427463848364, -0.21610679707621952, -0.21460881099378676,
+  -0.21311031991609136, -0.21161132736922755, -0.2101118368804696, -0.20861185197826349,
+  -0.20711137619221856, -0.20561041305309924, -0.20410896609281687, -0.20260703884442113,
+  -0.2011046348420919, -0.19960175762113097, -0.19809841071795356, -0.19659459767008022,
+  -0.19509032201612825, -0.1935855872958036, -0.19208039704989244, -0.19057475482025274,
+  -0.1890686641498062, -0.1875621285825296, -0.18605515166344663, -0.18454773693861962,
+  -0.18303988795514095, -0.18153160826112497, -0.18002290140569951, -0.1785137709389975,
+  -0.17700422041214875, -0.17549425337727143, -0.17398387338746382, -0.17247308399679595,
+  -0.17096188876030122, -0.16945029123396796, -0.16793829497473117, -0.1664259035404641,
+  -0.16491312048996992, -0.16339994938297323, -0.16188639378011183, -0.16037245724292828,
+  -0.15885814333386145, -0.15734345561623825, -0.15582839765426523, -0.1543129730130201,
+  -0.15279718525844344, -0.15128103795733022, -0.1497645346773215, -0.14824767898689603,
+  -0.14673047445536175, -0.14521292465284746, -0.14369503315029447, -0.14217680351944803,
+  -0.1406582393328492, -0.1391393441638262, -0.13762012158648604, -0.1361005751757062,
+  -0.13458070850712617, -0.13306052515713906, -0.13154002870288312, -0.13001922272223335,
+  -0.12849811079379317, -0.12697669649688587, -0.12545498341154623, -0.12393297511851216,
+  -0.1224106751992162, -0.12088808723577708, -0.11936521481099135, -0.11784206150832498,
+  -0.11631863091190475, -0.11479492660651008, -0.11327095217756435, -0.11174671121112659,
+  -0.11022220729388306, -0.10869744401313872, -0.10717242495680884, -0.10564715371341062,
+  -0.10412163387205459, -0.10259586902243628, -0.10106986275482782, -0.09954361866006932,
+  -0.0980171403295606, -0.09649043135525259, -0.09496349532963899, -0.09343633584574779,
+  -0.09190895649713272, -0.09038136087786498, -0.0888535525825246, -0.08732553520619206,
+  -0.0857973123444399, -0.08426888759332407, -0.08274026454937569, -0.08121144680959244,
+  -0.07968243797143013, -0.07815324163279423, -0.07662386139203149, -0.0750943008479213,
+  -0.07356456359966743, -0.07203465324688933, -0.07050457338961386, -0.06897432762826675,
+  -0.06744391956366405, -0.0659133527970038, -0.06438263092985747, -0.0628517575641614,
+  -0.06132073630220858, -0.05978957074663987, -0.05825826450043575, -0.05672682116690775,
+  -0.055195244349689934, -0.05366353765273052, -0.052131704680283324, -0.05059974903689928,
+  -0.049067674327418015, -0.0475354841569593, -0.04600318213091462, -0.04447077185493867,
+  -0.04293825693494082, -0.04140564097707674, -0.03987292758773981, -0.038340120373552694,
+  -0.03680722294135883, -0.03527423889821395, -0.03374117185137758, -0.032208025408304586,
+  -0.030674803176636626, -0.029141508764193722, -0.02760814577896574, -0.0260747178291039,
+  -0.024541228522912288, -0.02300768146883937, -0.021474080275469508, -0.01994042855151444,
+  -0.01840672990580482, -0.01687298794728171, -0.0153392062849881, -0.01380538852806039,
+  -0.012271538285719925, -0.01073765916726449, -0.00920375478205982, -0.007669828739531097,
+  -0.006135884649154475, -0.0046019261204485705, -0.003067956762965976, -0.0015339801862847655,
+  0.0, 0.0015339801862847655, 0.003067956762965976, 0.0046019261204485705,
+  0.006135884649154475, 0.007669828739531097, 0.00920375478205982, 0.01073765916726449,
+  0.012271538285719925, 0.01380538852806039, 0.0153392062849881, 0.01687298794728171,
+  0.01840672990580482, 0.01994042855151444, 0.021474080275469508, 0.02300768146883937,
+  0.024541228522912288, 0.0260747178291039, 0.02760814577896574, 0.029141508764193722,
+  0.030674803176636626, 0.032208025408304586, 0.03374117185137758, 0.03527423889821395,
+  0.03680722294135883, 0.038340120373552694, 0.03987292758773981, 0.04140564097707674,
+  0.04293825693494082, 0.04447077185493867, 0.04600318213091462, 0.0475354841569593,
+  0.049067674327418015, 0.05059974903689928, 0.052131704680283324, 0.05366353765273052,
+  0.055195244349689934, 0.05672682116690775, 0.05825826450043575, 0.05978957074663987,
+  0.06132073630220858, 0.0628517575641614, 0.06438263092985747, 0.0659133527970038,
+  0.06744391956366405, 0.06897432762826675, 0.07050457338961386, 0.07203465324688933,
+  0.07356456359966743, 0.0750943008479213, 0.07662386139203149, 0.07815324163279423,
+  0.07968243797143013, 0.08121144680959244, 0.08274026454937569, 0.08426888759332407,
+  0.0857973123444399, 0.08732553520619206, 0.0888535525825246, 0.09038136087786498,
+  0.09190895649713272, 0.09343633584574779, 0.09496349532963899, 0.09649043135525259,
+  0.0980171403295606, 0.09954361866006932, 0.10106986275482782, 0.10259586902243628,
+  0.10412163387205459, 0.10564715371341062, 0.10717242495680884, 0.10869744401313872,
+  0.11022220729388306, 0.11174671121112659, 0.11327095217756435, 0.11479492660651008,
+  0.11631863091190475, 0.11784206150832498, 0.11936521481099135, 0.12088808723577708,
+  0.1224106751992162, 0.12393297511851216, 0.12545498341154623, 0.12697669649688587,
+  0.12849811079379317, 0.13001922272223335, 0.13154002870288312, 0.13306052515713906,
+  0.13458070850712617, 0.1361005751757062, 0.13762012158648604, 0.1391393441638262,
+  0.1406582393328492, 0.14217680351944803, 0.14369503315029447, 0.14521292465284746,
+  0.14673047445536175, 0.14824767898689603, 0.1497645346773215, 0.15128103795733022,
+  0.15279718525844344, 0.1543129730130201, 0.15582839765426523, 0.15734345561623825,
+  0.15885814333386145, 0.16037245724292828, 0.16188639378011183, 0.16339994938297323,
+  0.16491312048996992, 0.1664259035404641, 0.16793829497473117, 0.16945029123396796,
+  0.17096188876030122, 0.17247308399679595, 0.17398387338746382, 0.17549425337727143,
+  0.17700422041214875, 0.1785137709389975, 0.18002290140569951, 0.18153160826112497,
+  0.18303988795514095, 0.18454773693861962, 0.18605515166344663, 0.1875621285825296,
+  0.1890686641498062, 0.19057475482025274, 0.19208039704989244, 0.1935855872958036,
+  0.19509032201612825, 0.19659459767008022, 0.19809841071795356, 0.19960175762113097,
+  0.2011046348420919, 0.20260703884442113, 0.20410896609281687, 0.20561041305309924,
+  0.20711137619221856, 0.20861185197826349, 0.2101118368804696, 0.21161132736922755,
+  0.21311031991609136, 0.21460881099378676, 0.21610679707621952, 0.21760427463848364,
+  0.2191012401568698, 0.2205976901088735, 0.2220936209732035, 0.22358902922979,
+  0.22508391135979283, 0.22657826384561, 0.22807208317088573, 0.22956536582051887,
+  0.2310581082806711, 0.23255030703877524, 0.23404195858354343, 0.2355330594049755,
+  0.2370236059943672, 0.23851359484431842, 0.2400030224487415, 0.24149188530286933,
+  0.24298017990326387, 0.24446790274782415, 0.2459550503357946, 0.24744161916777327,
+  0.24892760574572015, 0.2504130065729652, 0.25189781815421697, 0.25338203699557016,
+  0.25486565960451457, 0.2563486824899429, 0.257831102162159, 0.25931291513288623,
+  0.2607941179152755, 0.2622747070239136, 0.26375467897483135, 0.2652340302855118,
+  0.26671275747489837, 0.2681908570634032, 0.2696683255729151, 0.271145159526808,
+  0.272621355449949, 0.2740969098687064, 0.27557181931095814, 0.2770460803060999,
+  0.27851968938505306, 0.2799926430802732, 0.28146493792575794, 0.2829365704570554,
+  0.2844075372112719, 0.2858778347270806, 0.2873474595447295, 0.2888164082060495,
+  0.29028467725446233, 0.29175226323498926, 0.29321916269425863, 0.2946853721805143,
+  0.2961508882436238, 0.2976157074350862, 0.2990798263080405, 0.30054324141727345,
+  0.3020059493192281, 0.3034679465720113, 0.3049292297354024, 0.3063897953708609,
+  0.30784964004153487, 0.3093087603122687, 0.3107671527496115, 0.3122248139218249,
+  0.3136817403988915, 0.31513792875252244, 0.31659337555616585, 0.31804807738501495,
+  0.3195020308160157, 0.3209552324278752, 0.32240767880106985, 0.32385936651785285,
+  0.3253102921622629, 0.32676045232013173, 0.3282098435790925, 0.3296584625285875,
+  0.33110630575987643, 0.3325533698660442, 0.3339996514420094, 0.3354451470845316,
+  0.33688985339222005, 0.3383337669655411, 0.33977688440682685, 0.34121920232028236,
+  0.3426607173119944, 0.3441014259899388, 0.3455413249639891, 0.3469804108459237,
+  0.34841868024943456, 0.3498561297901349, 0.3512927560855671, 0.3527285557552107,
+  0.35416352542049034, 0.35559766170478385, 0.35703096123343, 0.35846342063373654,
+  0.3598950365349881, 0.3613258055684543, 0.3627557243673972, 0.3641847895670799,
+  0.36561299780477385, 0.3670403457197672, 0.3684668299533723, 0.3698924471489341,
+  0.37131719395183754, 0.37274106700951576, 0.37416406297145793, 0.3755861784892172,
+  0.37700741021641826, 0.37842775480876556, 0.37984720892405116, 0.3812657692221624,
+  0.3826834323650898, 0.38410019501693504, 0.38551605384391885, 0.3869310055143886,
+  0.38834504669882625, 0.3897581740698564, 0.39117038430225387, 0.39258167407295147,
+  0.3939920400610481, 0.39540147894781635, 0.3968099874167103, 0.39821756215337356,
+  0.3996241998456468, 0.4010298971835756, 0.40243465085941843, 0.4038384575676541,
+  0.40524131400498986, 0.40664321687036903, 0.4080441628649787, 0.4094441486922576,
+  0.4108431710579039, 0.4122412266698829, 0.4136383122384345, 0.41503442447608163,
+  0.41642956009763715, 0.41782371582021227, 0.4192168883632239, 0.4206090744484025,
+  0.4220002707997997, 0.42339047414379605, 0.4247796812091088, 0.4261678887267996,
+  0.4275550934302821, 0.4289412920553295, 0.4303264813400826, 0.43171065802505726,
+  0.43309381885315196, 0.43447596056965565, 0.4358570799222555, 0.4372371736610441,
+  0.43861623853852766, 0.43999427130963326, 0.44137126873171667, 0.44274722756457,
+  0.4441221445704292, 0.44549601651398174, 0.44686884016237416, 0.4482406122852199,
+  0.44961132965460654, 0.45098098904510386, 0.4523495872337709, 0.45371712100016387,
+  0.45508358712634384, 0.4564489823968839, 0.4578133035988772, 0.4591765475219441,
+  0.46053871095824, 0.46189979070246273, 0.46325978355186015, 0.4646186863062378,
+  0.4659764957679662, 0.4673332087419884, 0.4686888220358279, 0.4700433324595956,
+  0.47139673682599764, 0.4727490319503428, 0.47410021465054997, 0.47545028174715587,
+  0.4767992300633221, 0.478147056424843, 0.479493757660153, 0.48083933060033396,
+  0.4821837720791227, 0.48352707893291874, 0.48486924800079106, 0.4862102761244864,
+  0.487550160148436, 0.48888889691976317, 0.49022648328829116, 0.4915629161065499,
+  0.49289819222978404, 0.4942323085159597, 0.49556526182577254, 0.49689704902265447,
+  0.49822766697278187, 0.49955711254508184, 0.5008853826112407, 0.5022124740457108,
+  0.5035383837257176, 0.5048631085312676, 0.5061866453451552, 0.5075089910529709,
+  0.508830142543107, 0.5101500967067668, 0.5114688504379703, 0.512786400633563,
+  0.5141027441932217, 0.5154178780194629, 0.5167317990176499, 0.5180445040959993,
+  0.5193559901655896, 0.5206662541403672, 0.5219752929371544, 0.5232831034756564,
+  0.524589682678469, 0.5258950274710846, 0.5271991347819013, 0.5285020015422285,
+  0.5298036246862946, 0.531104001151255, 0.5324031278771979, 0.533701001807153,
+  0.5349976198870972, 0.5362929790659632, 0.5375870762956454, 0.5388799085310084,
+  0.5401714727298929, 0.5414617658531234, 0.5427507848645159, 0.5440385267308838,
+  0.5453249884220465, 0.5466101669108349, 0.5478940591731002, 0.5491766621877197,
+  0.5504579729366048, 0.5517379884047073, 0.5530167055800275, 0.55429412145362,
+  0.5555702330196022, 0.5568450372751601, 0.5581185312205561, 0.5593907118591361,
+  0.560661576197336, 0.5619311212446895, 0.5631993440138341, 0.5644662415205195,
+  0.5657318107836131, 0.5669960488251087, 0.5682589526701315, 0.5695205193469471,
+  0.5707807458869673, 0.572039629324757, 0.5732971666980422, 0.5745533550477158,
+  0.5758081914178453, 0.5770616728556794, 0.5783137964116556, 0.5795645591394056,
+  0.5808139580957645, 0.5820619903407754, 0.5833086529376983, 0.5845539429530153,
+  0.5857978574564389, 0.587040393520918, 0.5882815482226452, 0.5895213186410639,
+  0.5907597018588742, 0.591996694962041, 0.5932322950397998, 0.5944664991846644,
+  0.5956993044924334, 0.5969307080621965, 0.5981607069963423, 0.5993892984005645,
+  0.600616479383869, 0.60184224705858, 0.6030665985403482, 0.604289530948156,
+  0.6055110414043255, 0.6067311270345245, 0.6079497849677736, 0.6091670123364532,
+  0.6103828062763095, 0.6115971639264619, 0.6128100824294097, 0.6140215589310384,
+  0.6152315905806268, 0.6164401745308536, 0.6176473079378039, 0.6188529879609763,
+  0.6200572117632891, 0.6212599765110876, 0.62246127937415, 0.6236611175256945,
+  0.6248594881423863, 0.6260563884043435, 0.6272518154951441, 0.6284457666018327,
+  0.629638238914927, 0.6308292296284245, 0.6320187359398091, 0.6332067550500572,
+  0.6343932841636455, 0.6355783204885561, 0.6367618612362842, 0.637943903621844,
+  0.6391244448637757, 0.6403034821841517, 0.6414810128085832, 0.6426570339662269,
+  0.6438315428897914, 0.6450045368155439, 0.6461760129833163, 0.6473459686365121,
+  0.6485144010221124, 0.6496813073906832, 0.6508466849963809, 0.6520105310969595,
+  0.6531728429537768, 0.6543336178318004, 0.6554928529996153, 0.6566505457294289,
+  0.6578066932970786, 0.6589612929820373, 0.6601143420674205, 0.6612658378399923,
+  0.6624157775901718, 0.6635641586120398, 0.6647109782033448, 0.6658562336655097,
+  0.6669999223036375, 0.6681420414265185, 0.669282588346636, 0.6704215603801731,
+  0.6715589548470183, 0.6726947690707729, 0.673829000378756, 0.6749616461020119,
+  0.6760927035753159, 0.6772221701371803, 0.6783500431298615, 0.679476319899365,
+  0.680600997795453, 0.6817240741716497, 0.6828455463852481, 0.6839654117973154,
+  0.6850836677727004, 0.6862003116800386, 0.687315340891759, 0.6884287527840904,
+  0.6895405447370668, 0.6906507141345346, 0.6917592583641577, 0.6928661748174246,
+  0.693971460889654, 0.6950751139800009, 0.696177131491463, 0.6972775108308865,
+  0.6983762494089729, 0.6994733446402838, 0.7005687939432483, 0.7016625947401685,
+  0.7027547444572253, 0.7038452405244849, 0.7049340803759049, 0.7060212614493397,
+  0.7071067811865475, 0.7081906370331954, 0.7092728264388657, 0.7103533468570624,
+  0.7114321957452164, 0.7125093705646923, 0.7135848687807936, 0.7146586878627691,
+  0.7157308252838186, 0.7168012785210995, 0.7178700450557317, 0.7189371223728045,
+  0.7200025079613817, 0.7210661993145081, 0.7221281939292153, 0.7231884893065275,
+  0.724247082951467, 0.7253039723730608, 0.726359155084346, 0.7274126286023758,
+  0.7284643904482252, 0.729514438146997, 0.7305627692278276, 0.7316093812238926,
+  0.7326542716724128, 0.7336974381146604, 0.7347388780959635, 0.7357785891657136,
+  0.7368165688773699, 0.737852814788466, 0.7388873244606151, 0.7399200954595162,
+  0.7409511253549591, 0.7419804117208311, 0.7430079521351217, 0.7440337441799293,
+  0.7450577854414661, 0.7460800735100638, 0.7471006059801801, 0.7481193804504036,
+  0.7491363945234594, 0.7501516458062151, 0.7511651319096865, 0.7521768504490428,
+  0.7531867990436125, 0.7541949753168892, 0.7552013768965365, 0.7562060014143945,
+  0.7572088465064846, 0.7582099098130153, 0.7592091889783881, 0.7602066816512024,
+  0.7612023854842618, 0.7621962981345789, 0.7631884172633813, 0.7641787405361167,
+  0.765167265622459, 0.7661539901963129, 0.7671389119358204, 0.7681220285233654,
+  0.7691033376455797, 0.7700828369933479, 0.7710605242618138, 0.7720363971503845,
+  0.773010453362737, 0.7739826906068229, 0.7749531065948739, 0.7759216990434077,
+  0.7768884656732324, 0.7778534042094531, 0.778816512381476, 0.7797777879230146,
+  0.7807372285720945, 0.7816948320710594, 0.7826505961665757, 0.7836045186096382,
+  0.7845565971555752, 0.7855068295640539, 0.7864552135990858, 0.7874017470290314,
+  0.7883464276266063, 0.7892892531688857, 0.79023022143731, 0.7911693302176902,
+  0.7921065773002124, 0.7930419604794436, 0.7939754775543372, 0.794907126328237,
+  0.7958369046088836, 0.7967648102084188, 0.7976908409433912, 0.7986149946347608,
+  0.799537269107905, 0.8004576621926228, 0.8013761717231402, 0.8022927955381157,
+  0.8032075314806449, 0.8041203773982658, 0.8050313311429637, 0.8059403905711763,
+  0.8068475535437993, 0.8077528179261904, 0.808656181588175, 0.8095576424040513,
+  0.8104571982525948, 0.8113548470170637, 0.8122505865852039, 0.8131444148492536,
+  0.8140363297059484, 0.8149263290565266, 0.8158144108067338, 0.8167005728668278,
+  0.8175848131515837, 0.8184671295802987, 0.8193475200767969, 0.8202259825694347,
+  0.8211025149911046, 0.8219771152792416, 0.8228497813758264, 0.8237205112273914,
+  0.8245893027850253, 0.8254561540043776, 0.8263210628456635, 0.8271840272736691,
+  0.8280450452577558, 0.8289041147718649, 0.829761233794523, 0.8306164003088463,
+  0.8314696123025452, 0.8323208677679297, 0.8331701647019132, 0.8340175011060181,
+  0.83486287498638, 0.8357062843537526, 0.836547727223512, 0.8373872016156619,
+  0.8382247055548381, 0.8390602370703127, 0.8398937941959995, 0.8407253749704581,
+  0.8415549774368984, 0.8423825996431858, 0.8432082396418454, 0.8440318954900664,
+  0.8448535652497071, 0.8456732469872991, 0.8464909387740521, 0.8473066386858583,
+  0.8481203448032972, 0.8489320552116396, 0.8497417680008525, 0.8505494812656035,
+  0.8513551931052652, 0.8521589016239198, 0.8529606049303636, 0.8537603011381114,
+  0.8545579883654005, 0.855353664735196, 0.8561473283751945, 0.8569389774178288,
+  0.8577286100002721, 0.8585162242644427, 0.8593018183570085, 0.8600853904293901,
+  0.8608669386377673, 0.8616464611430813, 0.8624239561110406, 0.8631994217121242,
+  0.8639728561215868, 0.8647442575194624, 0.8655136240905691, 0.866280954024513,
+  0.8670462455156926, 0.8678094967633033, 0.8685707059713409, 0.8693298713486068,
+  0.8700869911087115, 0.870842063470079, 0.871595086655951, 0.8723460588943915,
+  0.8730949784182901, 0.8738418434653669, 0.8745866522781761, 0.8753294031041109,
+  0.8760700941954066, 0.8768087238091457, 0.8775452902072614, 0.8782797916565416,
+  0.8790122264286335, 0.8797425928000474, 0.8804708890521608, 0.8811971134712221,
+  0.881921264348355, 0.8826433399795628, 0.8833633386657316, 0.884081258712635,
+  0.8847970984309378, 0.8855108561362, 0.8862225301488806, 0.8869321187943422,
+  0.8876396204028539, 0.8883450333095964, 0.8890483558546646, 0.8897495863830728,
+  0.8904487232447579, 0.8911457647945832, 0.8918407093923427, 0.8925335554027646,
+  0.8932243011955153, 0.8939129451452033, 0.8945994856313827, 0.8952839210385576,
+  0.8959662497561852, 0.8966464701786802, 0.8973245807054183, 0.8980005797407399,
+  0.8986744656939538, 0.8993462369793416, 0.9000158920161603, 0.900683429228647,
+  0.901348847046022, 0.9020121439024932, 0.9026733182372588, 0.9033323684945118,
+  0.9039892931234433, 0.9046440905782462, 0.9052967593181188, 0.9059472978072685,
+  0.9065957045149153, 0.9072419779152958, 0.9078861164876663, 0.9085281187163061,
+  0.9091679830905224, 0.9098057081046522, 0.9104412922580672, 0.9110747340551764,
+  0.9117060320054299, 0.9123351846233227, 0.9129621904283982, 0.9135870479452508,
+  0.9142097557035307, 0.9148303122379462, 0.9154487160882678, 0.9160649657993317,
+  0.9166790599210427, 0.9172909970083779, 0.9179007756213905, 0.9185083943252123,
+  0.9191138516900578, 0.9197171462912274, 0.9203182767091106, 0.9209172415291895,
+  0.921514039342042, 0.9221086687433452, 0.9227011283338786, 0.9232914167195276,
+  0.9238795325112867, 0.9244654743252626, 0.9250492407826776, 0.9256308305098727,
+  0.9262102421383114, 0.9267874743045817, 0.9273625256504011, 0.9279353948226179,
+  0.9285060804732156, 0.9290745812593159, 0.9296408958431813, 0.9302050228922191,
+  0.9307669610789837, 0.9313267090811804, 0.9318842655816681, 0.9324396292684624,
+  0.932992798834739, 0.9335437729788362, 0.934092550404259, 0.9346391298196808,
+  0.9351835099389476, 0.9357256894810804, 0.9362656671702783, 0.9368034417359216,
+  0.937339011912575, 0.9378723764399899, 0.9384035340631081, 0.9389324835320646,
+  0.9394592236021899, 0.939983753034014, 0.9405060705932683, 0.9410261750508893,
+  0.9415440651830208, 0.9420597397710173, 0.9425731976014469, 0.9430844374660935,
+  0.9435934581619604, 0.9441002584912727, 0.9446048372614803, 0.9451071932852606,
+  0.9456073253805213, 0.9461052323704034, 0.9466009130832835, 0.9470943663527772,
+  0.9475855910177411, 0.9480745859222762, 0.9485613499157303, 0.9490458818527006,
+  0.9495281805930367, 0.950008245001843, 0.9504860739494817, 0.9509616663115751,
+  0.9514350209690083, 0.9519061368079323, 0.9523750127197659, 0.9528416476011987,
+  0.9533060403541939, 0.9537681898859903, 0.9542280951091057, 0.9546857549413383,
+  0.9551411683057708, 0.9555943341307711, 0.9560452513499964, 0.9564939189023951,
+  0.9569403357322088, 0.9573845007889759, 0.9578264130275329, 0.9582660714080177,
+  0.9587034748958716, 0.9591386224618419, 0.9595715130819845, 0.960002145737666,
+  0.9604305194155658, 0.9608566331076797, 0.9612804858113206, 0.9617020765291225,
+  0.9621214042690416, 0.9625384680443592, 0.9629532668736839, 0.963365799780954,
+  0.9637760657954398, 0.9641840639517458, 0.9645897932898128, 0.9649932528549203,
+  0.9653944416976894, 0.9657933588740837, 0.9661900034454125, 0.9665843744783331,
+  0.9669764710448521, 0.9673662922223285, 0.9677538370934755, 0.9681391047463624,
+  0.9685220942744174, 0.9689028047764289, 0.9692812353565485, 0.9696573851242924,
+  0.970031253194544, 0.9704028386875555, 0.9707721407289504, 0.9711391584497251,
+  0.9715038909862518, 0.9718663374802794, 0.9722264970789363, 0.9725843689347322,
+  0.9729399522055602, 0.9732932460546982, 0.973644249650812, 0.9739929621679558,
+  0.9743393827855759, 0.9746835106885107, 0.9750253450669941, 0.975364885116657,
+  0.9757021300385286, 0.976037079039039, 0.9763697313300211, 0.9767000861287118,
+  0.9770281426577544, 0.9773539001452, 0.9776773578245099, 0.9779985149345571,
+  0.9783173707196277, 0.9786339244294232, 0.9789481753190622, 0.979260122649082,
+  0.9795697656854405, 0.9798771036995176, 0.9801821359681174, 0.9804848617734694,
+  0.9807852804032304, 0.9810833911504867, 0.9813791933137546, 0.9816726861969831,
+  0.9819638691095552, 0.9822527413662894, 0.9825393022874412, 0.9828235511987052,
+  0.9831054874312163, 0.9833851103215512, 0.9836624192117303, 0.9839374134492189,
+  0.984210092386929, 0.9844804553832209, 0.9847485018019042, 0.9850142310122398,
+  0.9852776423889412, 0.9855387353121761, 0.9857975091675675, 0.9860539633461954,
+  0.9863080972445987, 0.9865599102647754, 0.9868094018141855, 0.987056571305751,
+  0.9873014181578584, 0.9875439417943592, 0.9877841416445722, 0.9880220171432835,
+  0.9882575677307495, 0.9884907928526966, 0.9887216919603238, 0.988950264510303,
+  0.989176509964781, 0.9894004277913804, 0.9896220174632009, 0.9898412784588205,
+  0.9900582102622971, 0.9902728123631691, 0.9904850842564571, 0.9906950254426646,
+  0.99090263542778, 0.9911079137232769, 0.9913108598461154, 0.9915114733187439,
+  0.9917097536690995, 0.9919057004306093, 0.9920993131421918, 0.9922905913482574,
+  0.99247953459871, 0.992666142448948, 0.9928504144598651, 0.9930323501978514,
+  0.9932119492347945, 0.9933892111480807, 0.9935641355205953, 0.9937367219407246,
+  0.9939069700023561, 0.9940748793048794, 0.9942404494531879, 0.9944036800576791,
+  0.9945645707342554, 0.9947231211043257, 0.9948793307948056, 0.9950331994381186,
+  0.9951847266721969, 0.9953339121404823, 0.9954807554919269, 0.9956252563809943,
+  0.9957674144676598, 0.9959072294174117, 0.996044700901252, 0.996179828595697,
+  0.996312612182778, 0.9964430513500426, 0.9965711457905548, 0.9966968952028961,
+  0.9968202992911657, 0.9969413577649822, 0.997060070339483, 0.9971764367353262,
+  0.9972904566786902, 0.9974021299012753, 0.9975114561403035, 0.9976184351385196,
+  0.9977230666441916, 0.9978253504111116, 0.997925286198596, 0.9980228737714862,
+  0.9981181129001492, 0.9982110033604782, 0.9983015449338929, 0.9983897374073402,
+  0.9984755805732948, 0.9985590742297593, 0.9986402181802653, 0.9987190122338729,
+  0.9987954562051724, 0.9988695499142836, 0.9989412931868569, 0.9990106858540734,
+  0.9990777277526454, 0.9991424187248169, 0.9992047586183639, 0.9992647472865944,
+  0.9993223845883495, 0.9993776703880028, 0.9994306045554617, 0.999481186966167,
+  0.9995294175010931, 0.9995752960467492, 0.9996188224951786, 0.9996599967439592,
+  0.9996988186962042, 0.9997352882605617, 0.9997694053512153, 0.9998011698878843,
+  0.9998305817958234, 0.9998576410058239, 0.9998823474542126, 0.9999047010828529,
+  0.9999247018391445, 0.9999423496760239, 0.9999576445519639, 0.9999705864309741,
+  0.9999811752826011, 0.9999894110819284, 0.9999952938095762, 0.9999988234517019,
+  1.0,
+};
+
+static const unsigned int bitrev_4096[4096] =
+{
+  0, 2048, 1024, 3072,
+  512, 2560, 1536, 3584,
+  256, 2304, 1280, 3328,
+  768, 2816, 1792, 3840,
+  128, 2176, 1152, 3200,
+  640, 2688, 1664, 3712,
+  384, 2432, 1408, 3456,
+  896, 2944, 1920, 3968,
+  64, 2112, 1088, 3136,
+  576, 2624, 1600, 3648,
+  320, 2368, 1344, 3392,
+  832, 2880, 1856, 3904,
+  192, 2240, 1216, 3264,
+  704, 2752, 1728, 3776,
+  448, 2496, 1472, 3520,
+  960, 3008, 1984, 4032,
+  32, 2080, 1056, 3104,
+  544, 2592, 1568, 3616,
+  288, 2336, 1312, 3360,
+  800, 2848, 1824, 3872,
+  160, 2208, 1184, 3232,
+  672, 2720, 1696, 3744,
+  416, 2464, 1440, 3488,
+  928, 2976, 1952, 4000,
+  96, 2144, 1120, 3168,
+  608, 2656, 1632, 3680,
+  352, 2400, 1376, 3424,
+  864, 2912, 1888, 3936,
+  224, 2272, 1248, 3296,
+  736, 2784, 1760, 3808,
+  480, 2528, 1504, 3552,
+  992, 3040, 2016, 4064,
+  16, 2064, 1040, 3088,
+  528, 2576, 1552, 3600,
+  272, 2320, 1296, 3344,
+  784, 2832, 1808, 3856,
+  144, 2192, 1168, 3216,
+  656, 2704, 1680, 3728,
+  400, 2448, 1424, 3472,
+  912, 2960, 1936, 3984,
+  80, 2128, 1104, 3152,
+  592, 2640, 1616, 3664,
+  336, 2384, 1360, 3408,
+  848, 2896, 1872, 3920,
+  208, 2256, 1232, 3280,
+  720, 2768, 1744, 3792,
+  464, 2512, 1488, 3536,
+  976, 3024, 2000, 4048,
+  48, 2096, 1072, 3120,
+  560, 2608, 1584, 3632,
+  304, 2352, 1328, 3376,
+  816, 2864, 1840, 3888,
+  176, 2224, 1200, 3248,
+  688, 2736, 1712, 3760,
+  432, 2480, 1456, 3504,
+  944, 2992, 1968, 4016,
+  112, 2160, 1136, 3184,
+  624, 2672, 1648, 3696,
+  368, 2416, 1392, 3440,
+  880, 2928, 1904, 3952,
+  240, 2288, 1264, 3312,
+  752, 2800, 1776, 3824,
+  496, 2544, 1520, 3568,
+  1008, 3056, 2032, 4080,
+  8, 2056, 1032, 3080,
+  520, 2568, 1544, 3592,
+  264, 2312, 1288, 3336,
+  776, 2824, 1800, 3848,
+  136, 2184, 1160, 3208,
+  648, 2696, 1672, 3720,
+  392, 2440, 1416, 3464,
+  904, 2952, 1928, 3976,
+  72, 2120, 1096, 3144,
+  584, 2632, 1608, 3656,
+  328, 2376, 1352, 3400,
+  840, 2888, 1864, 3912,
+  200, 2248, 1224, 3272,
+  712, 2760, 1736, 3784,
+  456, 2504, 1480, 3528,
+  968, 3016, 1992, 4040,
+  40, 2088, 1064, 3112,
+  552, 2600, 1576, 3624,
+  296, 2344, 1320, 3368,
+  808, 2856, 1832, 3880,
+  168, 2216, 1192, 3240,
+  680, 2728, 1704, 3752,
+  424, 2472, 1448, 3496,
+  936, 2984, 1960, 4008,
+  104, 2152, 1128, 3176,
+  616, 2664, 1640, 3688,
+  360, 2408, 1384, 3432,
+  872, 2920, 1896, 3944,
+  232, 2280, 1256, 3304,
+  744, 2792, 1768, 3816,
+  488, 2536, 1512, 3560,
+  1000, 3048, 2024, 4072,
+  24, 2072, 1048, 3096,
+  536, 2584, 1560, 3608,
+  280, 2328, 1304, 3352,
+  792, 2840, 1816, 3864,
+  152, 2200, 1176, 3224,
+  664, 2712, 1688, 3736,
+  408, 2456, 1432, 3480,
+  920, 2968, 1944, 3992,
+  88, 2136, 1112, 3160,
+  600, 2648, 1624, 3672,
+  344, 2392, 1368, 3416,
+  856, 2904, 1880, 3928,
+  216, 2264, 1240, 3288,
+  728, 2776, 1752, 3800,
+  472, 2520, 1496, 3544,
+  984, 3032, 2008, 4056,
+  56, 2104, 1080, 3128,
+  568, 2616, 1592, 3640,
+  312, 2360, 1336, 3384,
+  824, 2872, 1848, 3896,
+  184, 2232, 1208, 3256,
+  696, 2744, 1720, 3768,
+  440, 2488, 1464, 3512,
+  952, 3000, 1976, 4024,
+  120, 2168, 1144, 3192,
+  632, 2680, 1656, 3704,
+  376, 2424, 1400, 3448,
+  888, 2936, 1912, 3960,
+  248, 2296, 1272, 3320,
+  760, 2808, 1784, 3832,
+  504, 2552, 1528, 3576,
+  1016, 3064, 2040, 4088,
+  4, 2052, 1028, 3076,
+  516, 2564, 1540, 3588,
+  260, 2308, 1284, 3332,
+  772, 2820, 1796, 3844,
+  132, 2180, 1156, 3204,
+  644, 2692, 1668, 3716,
+  388, 2436, 1412, 3460,
+  900, 2948, 1924, 3972,
+  68, 2116, 1092, 3140,
+  580, 2628, 1604, 3652,
+  324, 2372, 1348, 3396,
+  836, 2884, 1860, 3908,
+  196, 2244, 1220, 3268,
+  708, 2756, 1732, 3780,
+  452, 2500, 1476, 3524,
+  964, 3012, 1988, 4036,
+  36, 2084, 1060, 3108,
+  548, 2596, 1572, 3620,
+  292, 2340, 1316, 3364,
+  804, 2852, 1828, 3876,
+  164, 2212, 1188, 3236,
+  676, 2724, 1700, 3748,
+  420, 2468, 1444, 3492,
+  932, 2980, 1956, 4004,
+  100, 2148, 1124, 3172,
+  612, 2660, 1636, 3684,
+  356, 2404, 1380, 3428,
+  868, 2916, 1892, 3940,
+  228, 2276, 1252, 3300,
+  740, 2788, 1764, 3812,
+  484, 2532, 1508, 3556,
+  996, 3044, 2020, 4068,
+  20, 2068, 1044, 3092,
+  532, 2580, 1556, 3604,
+  276, 2324, 1300, 3348,
+  788, 2836, 1812, 3860,
+  148, 2196, 1172, 3220,
+  660, 2708, 1684, 3732,
+  404, 2452, 1428, 3476,
+  916, 2964, 1940, 3988,
+  84, 2132, 1108, 3156,
+  596, 2644, 1620, 3668,
+  340, 2388, 1364, 3412,
+  852, 2900, 1876, 3924,
+  212, 2260, 1236, 3284,
+  724, 2772, 1748, 3796,
+  468, 2516, 1492, 3540,
+  980, 3028, 2004, 4052,
+  52, 2100, 1076, 3124,
+  564, 2612, 1588, 3636,
+  308, 2356, 1332, 3380,
+  820, 2868, 1844, 3892,
+  180, 2228, 1204, 3252,
+  692, 2740, 1716, 3764,
+  436, 2484, 1460, 3508,
+  948, 2996, 1972, 4020,
+  116, 2164, 1140, 3188,
+  628, 2676, 1652, 3700,
+  372, 2420, 1396, 3444,
+  884, 2932, 1908, 3956,
+  244, 2292, 1268, 3316,
+  756, 2804, 1780, 3828,
+  500, 2548, 1524, 3572,
+  1012, 3060, 2036, 4084,
+  12, 2060, 1036, 3084,
+  524, 2572, 1548, 3596,
+  268, 2316, 1292, 3340,
+  780, 2828, 1804, 3852,
+  140, 2188, 1164, 3212,
+  652, 2700, 1676, 3724,
+  396, 2444, 1420, 3468,
+  908, 2956, 1932, 3980,
+  76, 2124, 1100, 3148,
+  588, 2636, 1612, 3660,
+  332, 2380, 1356, 3404,
+  844, 2892, 1868, 3916,
+  204, 2252, 1228, 3276,
+  716, 2764, 1740, 3788,
+  460, 2508, 1484, 3532,
+  972, 3020, 1996, 4044,
+  44, 2092, 1068, 3116,
+  556, 2604, 1580, 3628,
+  300, 2348, 1324, 3372,
+  812, 2860, 1836, 3884,
+  172, 2220, 1196, 3244,
+  684, 2732, 1708, 3756,
+  428, 2476, 1452, 3500,
+  940, 2988, 1964, 4012,
+  108, 2156, 1132, 3180,
+  620, 2668, 1644, 3692,
+  364, 2412, 1388, 3436,
+  876, 2924, 1900, 3948,
+  236, 2284, 1260, 3308,
+  748, 2796, 1772, 3820,
+  492, 2540, 1516, 3564,
+  1004, 3052, 2028, 4076,
+  28, 2076, 1052, 3100,
+  540, 2588, 1564, 3612,
+  284, 2332, 1308, 3356,
+  796, 2844, 1820, 3868,
+  156, 2204, 1180, 3228,
+  668, 2716, 1692, 3740,
+  412, 2460, 1436, 3484,
+  924, 2972, 1948, 3996,
+  92, 2140, 1116, 3164,
+  604, 2652, 1628, 3676,
+  348, 2396, 1372, 3420,
+  860, 2908, 1884, 3932,
+  220, 2268, 1244, 3292,
+  732, 2780, 1756, 3804,
+  476, 2524, 1500, 3548,
+  988, 3036, 2012, 4060,
+  60, 2108, 1084, 3132,
+  572, 2620, 1596, 3644,
+  316, 2364, 1340, 3388,
+  828, 2876, 1852, 3900,
+  188, 2236, 1212, 3260,
+  700, 2748, 1724, 3772,
+  444, 2492, 1468, 3516,
+  956, 3004, 1980, 4028,
+  124, 2172, 1148, 3196,
+  636, 2684, 1660, 3708,
+  380, 2428, 1404, 3452,
+  892, 2940, 1916, 3964,
+  252, 2300, 1276, 3324,
+  764, 2812, 1788, 3836,
+  508, 2556, 1532, 3580,
+  1020, 3068, 2044, 4092,
+  2, 2050, 1026, 3074,
+  514, 2562, 1538, 3586,
+  258, 2306, 1282, 3330,
+  770, 2818, 1794, 3842,
+  130, 2178, 1154, 3202,
+  642, 2690, 1666, 3714,
+  386, 2434, 1410, 3458,
+  898, 2946, 1922, 3970,
+  66, 2114, 1090, 3138,
+  578, 2626, 1602, 3650,
+  322, 2370, 1346, 3394,
+  834, 2882, 1858, 3906,
+  194, 2242, 1218, 3266,
+  706, 2754, 1730, 3778,
+  450, 2498, 1474, 3522,
+  962, 3010, 1986, 4034,
+  34, 2082, 1058, 3106,
+  546, 2594, 1570, 3618,
+  290, 2338, 1314, 3362,
+  802, 2850, 1826, 3874,
+  162, 2210, 1186, 3234,
+  674, 2722, 1698, 3746,
+  418, 2466, 1442, 3490,
+  930, 2978, 1954, 4002,
+  98, 2146, 1122, 3170,
+  610, 2658, 1634, 3682,
+  354, 2402, 1378, 3426,
+  866, 2914, 1890, 3938,
+  226, 2274, 1250, 3298,
+  738, 2786, 1762, 3810,
+  482, 2530, 1506, 3554,
+  994, 3042, 2018, 4066,
+  18, 2066, 1042, 3090,
+  530, 2578, 1554, 3602,
+  274, 2322, 1298, 3346,
+  786, 2834, 1810, 3858,
+  146, 2194, 1170, 3218,
+  658, 2706, 1682, 3730,
+  402, 2450, 1426, 3474,
+  914, 2962, 1938, 3986,
+  82, 2130, 1106, 3154,
+  594, 2642, 1618, 3666,
+  338, 2386, 1362, 3410,
+  850, 2898, 1874, 3922,
+  210, 2258, 1234, 3282,
+  722, 2770, 1746, 3794,
+  466, 2514, 1490, 3538,
+  978, 3026, 2002, 4050,
+  50, 2098, 1074, 3122,
+  562, 2610, 1586, 3634,
+  306, 2354, 1330, 3378,
+  818, 2866, 1842, 3890,
+  178, 2226, 1202, 3250,
+  690, 2738, 1714, 3762,
+  434, 2482, 1458, 3506,
+  946, 2994, 1970, 4018,
+  114, 2162, 1138, 3186,
+  626, 2674, 1650, 3698,
+  370, 2418, 1394, 3442,
+  882, 2930, 1906, 3954,
+  242, 2290, 1266, 3314,
+  754, 2802, 1778, 3826,
+  498, 2546, 1522, 3570,
+  1010, 3058, 2034, 4082,
+  10, 2058, 1034, 3082,
+  522, 2570, 1546, 3594,
+  266, 2314, 1290, 3338,
+  778, 2826, 1802, 3850,
+  138, 2186, 1162, 3210,
+  650, 2698, 1674, 3722,
+  394, 2442, 1418, 3466,
+  906, 2954, 1930, 3978,
+  74, 2122, 1098, 3146,
+  586, 2634, 1610, 3658,
+  330, 2378, 1354, 3402,
+  842, 2890, 1866, 3914,
+  202, 2250, 1226, 3274,
+  714, 2762, 1738, 3786,
+  458, 2506, 1482, 3530,
+  970, 3018, 1994, 4042,
+  42, 2090, 1066, 3114,
+  554, 2602, 1578, 3626,
+  298, 2346, 1322, 3370,
+  810, 2858, 1834, 3882,
+  170, 2218, 1194, 3242,
+  682, 2730, 1706, 3754,
+  426, 2474, 1450, 3498,
+  938, 2986, 1962, 4010,
+  106, 2154, 1130, 3178,
+  618, 2666, 1642, 3690,
+  362, 2410, 1386, 3434,
+  874, 2922, 1898, 3946,
+  234, 2282, 1258, 3306,
+  746, 2794, 1770, 3818,
+  490, 2538, 1514, 3562,
+  1002, 3050, 2026, 4074,
+  26, 2074, 1050, 3098,
+  538, 2586, 1562, 3610,
+  282, 2330, 1306, 3354,
+  794, 2842, 1818, 3866,
+  154, 2202, 1178, 3226,
+  666, 2714, 1690, 3738,
+  410, 2458, 1434, 3482,
+  922, 2970, 1946, 3994,
+  90, 2138, 1114, 3162,
+  602, 2650, 1626, 3674,
+  346, 2394, 1370, 3418,
+  858, 2906, 1882, 3930,
+  218, 2266, 1242, 3290,
+  730, 2778, 1754, 3802,
+  474, 2522, 1498, 3546,
+  986, 3034, 2010, 4058,
+  58, 2106, 1082, 3130,
+  570, 2618, 1594, 3642,
+  314, 2362, 1338, 3386,
+  826, 2874, 1850, 3898,
+  186, 2234, 1210, 3258,
+  698, 2746, 1722, 3770,
+  442, 2490, 1466, 3514,
+  954, 3002, 1978, 4026,
+  122, 2170, 1146, 3194,
+  634, 2682, 1658, 3706,
+  378, 2426, 1402, 3450,
+  890, 2938, 1914, 3962,
+  250, 2298, 1274, 3322,
+  762, 2810, 1786, 3834,
+  506, 2554, 1530, 3578,
+  1018, 3066, 2042, 4090,
+  6, 2054, 1030, 3078,
+  518, 2566, 1542, 3590,
+  262, 2310, 1286, 3334,
+  774, 2822, 1798, 3846,
+  134, 2182, 1158, 3206,
+  646, 2694, 1670, 3718,
+  390, 2438, 1414, 3462,
+  902, 2950, 1926, 3974,
+  70, 2118, 1094, 3142,
+  582, 2630, 1606, 3654,
+  326, 2374, 1350, 3398,
+  838, 2886, 1862, 3910,
+  198, 2246, 1222, 3270,
+  710, 2758, 1734, 3782,
+  454, 2502, 1478, 3526,
+  966, 3014, 1990, 4038,
+  38, 2086, 1062, 3110,
+  550, 2598, 1574, 3622,
+  294, 2342, 1318, 3366,
+  806, 2854, 1830, 3878,
+  166, 2214, 1190, 3238,
+  678, 2726, 1702, 3750,
+  422, 2470, 1446, 3494,
+  934, 2982, 1958, 4006,
+  102, 2150, 1126, 3174,
+  614, 2662, 1638, 3686,
+  358, 2406, 1382, 3430,
+  870, 2918, 1894, 3942,
+  230, 2278, 1254, 3302,
+  742, 2790, 1766, 3814,
+  486, 2534, 1510, 3558,
+  998, 3046, 2022, 4070,
+  22, 2070, 1046, 3094,
+  534, 2582, 1558, 3606,
+  278, 2326, 1302, 3350,
+  790, 2838, 1814, 3862,
+  150, 2198, 1174, 3222,
+  662, 2710, 1686, 3734,
+  406, 2454, 1430, 3478,
+  918, 2966, 1942, 3990,
+  86, 2134, 1110, 3158,
+  598, 2646, 1622, 3670,
+  342, 2390, 1366, 3414,
+  854, 2902, 1878, 3926,
+  214, 2262, 1238, 3286,
+  726, 2774, 1750, 3798,
+  470, 2518, 1494, 3542,
+  982, 3030, 2006, 4054,
+  54, 2102, 1078, 3126,
+  566, 2614, 1590, 3638,
+  310, 2358, 1334, 3382,
+  822, 2870, 1846, 3894,
+  182, 2230, 1206, 3254,
+  694, 2742, 1718, 3766,
+  438, 2486, 1462, 3510,
+  950, 2998, 1974, 4022,
+  118, 2166, 1142, 3190,
+  630, 2678, 1654, 3702,
+  374, 2422, 1398, 3446,
+  886, 2934, 1910, 3958,
+  246, 2294, 1270, 3318,
+  758, 2806, 1782, 3830,
+  502, 2550, 1526, 3574,
+  1014, 3062, 2038, 4086,
+  14, 2062, 1038, 3086,
+  526, 2574, 1550, 3598,
+  270, 2318, 1294, 3342,
+  782, 2830, 1806, 3854,
+  142, 2190, 1166, 3214,
+  654, 2702, 1678, 3726,
+  398, 2446, 1422, 3470,
+  910, 2958, 1934, 3982,
+  78, 2126, 1102, 3150,
+  590, 2638, 1614, 3662,
+  334, 2382, 1358, 3406,
+  846, 2894, 1870, 3918,
+  206, 2254, 1230, 3278,
+  718, 2766, 1742, 3790,
+  462, 2510, 1486, 3534,
+  974, 3022, 1998, 4046,
+  46, 2094, 1070, 3118,
+  558, 2606, 1582, 3630,
+  302, 2350, 1326, 3374,
+  814, 2862, 1838, 3886,
+  174, 2222, 1198, 3246,
+  686, 2734, 1710, 3758,
+  430, 2478, 1454, 3502,
+  942, 2990, 1966, 4014,
+  110, 2158, 1134, 3182,
+  622, 2670, 1646, 3694,
+  366, 2414, 1390, 3438,
+  878, 2926, 1902, 3950,
+  238, 2286, 1262, 3310,
+  750, 2798, 1774, 3822,
+  494, 2542, 1518, 3566,
+  1006, 3054, 2030, 4078,
+  30, 2078, 1054, 3102,
+  542, 2590, 1566, 3614,
+  286, 2334, 1310, 3358,
+  798, 2846, 1822, 3870,
+  158, 2206, 1182, 3230,
+  670, 2718, 1694, 3742,
+  414, 2462, 1438, 3486,
+  926, 2974, 1950, 3998,
+  94, 2142, 1118, 3166,
+  606, 2654, 1630, 3678,
+  350, 2398, 1374, 3422,
+  862, 2910, 1886, 3934,
+  222, 2270, 1246, 3294,
+  734, 2782, 1758, 3806,
+  478, 2526, 1502, 3550,
+  990, 3038, 2014, 4062,
+  62, 2110, 1086, 3134,
+  574, 2622, 1598, 3646,
+  318, 2366, 1342, 3390,
+  830, 2878, 1854, 3902,
+  190, 2238, 1214, 3262,
+  702, 2750, 1726, 3774,
+  446, 2494, 1470, 3518,
+  958, 3006, 1982, 4030,
+  126, 2174, 1150, 3198,
+  638, 2686, 1662, 3710,
+  382, 2430, 1406, 3454,
+  894, 2942, 1918, 3966,
+  254, 2302, 1278, 3326,
+  766, 2814, 1790, 3838,
+  510, 2558, 1534, 3582,
+  1022, 3070, 2046, 4094,
+  1, 2049, 1025, 3073,
+  513, 2561, 1537, 3585,
+  257, 2305, 1281, 3329,
+  769, 2817, 1793, 3841,
+  129, 2177, 1153, 3201,
+  641, 2689, 1665, 3713,
+  385, 2433, 1409, 3457,
+  897, 2945, 1921, 3969,
+  65, 2113, 1089, 3137,
+  577, 2625, 1601, 3649,
+  321, 2369, 1345, 3393,
+  833, 2881, 1857, 3905,
+  193, 2241, 1217, 3265,
+  705, 2753, 1729, 3777,
+  449, 2497, 1473, 3521,
+  961, 3009, 1985, 4033,
+  33, 2081, 1057, 3105,
+  545, 2593, 1569, 3617,
+  289, 2337, 1313, 3361,
+  801, 2849, 1825, 3873,
+  161, 2209, 1185, 3233,
+  673, 2721, 1697, 3745,
+  417, 2465, 1441, 3489,
+  929, 2977, 1953, 4001,
+  97, 2145, 1121, 3169,
+  609, 2657, 1633, 3681,
+  353, 2401, 1377, 3425,
+  865, 2913, 1889, 3937,
+  225, 2273, 1249, 3297,
+  737, 2785, 1761, 3809,
+  481, 2529, 1505, 3553,
+  993, 3041, 2017, 4065,
+  17, 2065, 1041, 3089,
+  529, 2577, 1553, 3601,
+  273, 2321, 1297, 3345,
+  785, 2833, 1809, 3857,
+  145, 2193, 1169, 3217,
+  657, 2705, 1681, 3729,
+  401, 2449, 1425, 3473,
+  913, 2961, 1937, 3985,
+  81, 2129, 1105, 3153,
+  593, 2641, 1617, 3665,
+  337, 2385, 1361, 3409,
+  849, 2897, 1873, 3921,
+  209, 2257, 1233, 3281,
+  721, 2769, 1745, 3793,
+  465, 2513, 1489, 3537,
+  977, 3025, 2001, 4049,
+  49, 2097, 1073, 3121,
+  561, 2609, 1585, 3633,
+  305, 2353, 1329, 3377,
+  817, 2865, 1841, 3889,
+  177, 2225, 1201, 3249,
+  689, 2737, 1713, 3761,
+  433, 2481, 1457, 3505,
+  945, 2993, 1969, 4017,
+  113, 2161, 1137, 3185,
+  625, 2673, 1649, 3697,
+  369, 2417, 1393, 3441,
+  881, 2929, 1905, 3953,
+  241, 2289, 1265, 3313,
+  753, 2801, 1777, 3825,
+  497, 2545, 1521, 3569,
+  1009, 3057, 2033, 4081,
+  9, 2057, 1033, 3081,
+  521, 2569, 1545, 3593,
+  265, 2313, 1289, 3337,
+  777, 2825, 1801, 3849,
+  137, 2185, 1161, 3209,
+  649, 2697, 1673, 3721,
+  393, 2441, 1417, 3465,
+  905, 2953, 1929, 3977,
+  73, 2121, 1097, 3145,
+  585, 2633, 1609, 3657,
+  329, 2377, 1353, 3401,
+  841, 2889, 1865, 3913,
+  201, 2249, 1225, 3273,
+  713, 2761, 1737, 3785,
+  457, 2505, 1481, 3529,
+  969, 3017, 1993, 4041,
+  41, 2089, 1065, 3113,
+  553, 2601, 1577, 3625,
+  297, 2345, 1321, 3369,
+  809, 2857, 1833, 3881,
+  169, 2217, 1193, 3241,
+  681, 2729, 1705, 3753,
+  425, 2473, 1449, 3497,
+  937, 2985, 1961, 4009,
+  105, 2153, 1129, 3177,
+  617, 2665, 1641, 3689,
+  361, 2409, 1385, 3433,
+  873, 2921, 1897, 3945,
+  233, 2281, 1257, 3305,
+  745, 2793, 1769, 3817,
+  489, 2537, 1513, 3561,
+  1001, 3049, 2025, 4073,
+  25, 2073, 1049, 3097,
+  537, 2585, 1561, 3609,
+  281, 2329, 1305, 3353,
+  793, 2841, 1817, 3865,
+  153, 2201, 1177, 3225,
+  665, 2713, 1689, 3737,
+  409, 2457, 1433, 3481,
+  921, 2969, 1945, 3993,
+  89, 2137, 1113, 3161,
+  601, 2649, 1625, 3673,
+  345, 2393, 1369, 3417,
+  857, 2905, 1881, 3929,
+  217, 2265, 1241, 3289,
+  729, 2777, 1753, 3801,
+  473, 2521, 1497, 3545,
+  985, 3033, 2009, 4057,
+  57, 2105, 1081, 3129,
+  569, 2617, 1593, 3641,
+  313, 2361, 1337, 3385,
+  825, 2873, 1849, 3897,
+  185, 2233, 1209, 3257,
+  697, 2745, 1721, 3769,
+  441, 2489, 1465, 3513,
+  953, 3001, 1977, 4025,
+  121, 2169, 1145, 3193,
+  633, 2681, 1657, 3705,
+  377, 2425, 1401, 3449,
+  889, 2937, 1913, 3961,
+  249, 2297, 1273, 3321,
+  761, 2809, 1785, 3833,
+  505, 2553, 1529, 3577,
+  1017, 3065, 2041, 4089,
+  5, 2053, 1029, 3077,
+  517, 2565, 1541, 3589,
+  261, 2309, 1285, 3333,
+  773, 2821, 1797, 3845,
+  133, 2181, 1157, 3205,
+  645, 2693, 1669, 3717,
+  389, 2437, 1413, 3461,
+  901, 2949, 1925, 3973,
+  69, 2117, 1093, 3141,
+  581, 2629, 1605, 3653,
+  325, 2373, 1349, 3397,
+  837, 2885, 1861, 3909,
+  197, 2245, 1221, 3269,
+  709, 2757, 1733, 3781,
+  453, 2501, 1477, 3525,
+  965, 3013, 1989, 4037,
+  37, 2085, 1061, 3109,
+  549, 2597, 1573, 3621,
+  293, 2341, 1317, 3365,
+  805, 2853, 1829, 3877,
+  165, 2213, 1189, 3237,
+  677, 2725, 1701, 3749,
+  421, 2469, 1445, 3493,
+  933, 2981, 1957, 4005,
+  101, 2149, 1125, 3173,
+  613, 2661, 1637, 3685,
+  357, 2405, 1381, 3429,
+  869, 2917, 1893, 3941,
+  229, 2277, 1253, 3301,
+  741, 2789, 1765, 3813,
+  485, 2533, 1509, 3557,
+  997, 3045, 2021, 4069,
+  21, 2069, 1045, 3093,
+  533, 2581, 1557, 3605,
+  277, 2325, 1301, 3349,
+  789, 2837, 1813, 3861,
+  149, 2197, 1173, 3221,
+  661, 2709, 1685, 3733,
+  405, 2453, 1429, 3477,
+  917, 2965, 1941, 3989,
+  85, 2133, 1109, 3157,
+  597, 2645, 1621, 3669,
+  341, 2389, 1365, 3413,
+  853, 2901, 1877, 3925,
+  213, 2261, 1237, 3285,
+  725, 2773, 1749, 3797,
+  469, 2517, 1493, 3541,
+  981, 3029, 2005, 4053,
+  53, 2101, 1077, 3125,
+  565, 2613, 1589, 3637,
+  309, 2357, 1333, 3381,
+  821, 2869, 1845, 3893,
+  181, 2229, 1205, 3253,
+  693, 2741, 1717, 3765,
+  437, 2485, 1461, 3509,
+  949, 2997, 1973, 4021,
+  117, 2165, 1141, 3189,
+  629, 2677, 1653, 3701,
+  373, 2421, 1397, 3445,
+  885, 2933, 1909, 3957,
+  245, 2293, 1269, 3317,
+  757, 2805, 1781, 3829,
+  501, 2549, 1525, 3573,
+  1013, 3061, 2037, 4085,
+  13, 2061, 1037, 3085,
+  525, 2573, 1549, 3597,
+  269, 2317, 1293, 3341,
+  781, 2829, 1805, 3853,
+  141, 2189, 1165, 3213,
+  653, 2701, 1677, 3725,
+  397, 2445, 1421, 3469,
+  909, 2957, 1933, 3981,
+  77, 2125, 1101, 3149,
+  589, 2637, 1613, 3661,
+  333, 2381, 1357, 3405,
+  845, 2893, 1869, 3917,
+  205, 2253, 1229, 3277,
+  717, 2765, 1741, 3789,
+  461, 2509, 1485, 3533,
+  973, 3021, 1997, 4045,
+  45, 2093, 1069, 3117,
+  557, 2605, 1581, 3629,
+  301, 2349, 1325, 3373,
+  813, 2861, 1837, 3885,
+  173, 2221, 1197, 3245,
+  685, 2733, 1709, 3757,
+  429, 2477, 1453, 3501,
+  941, 2989, 1965, 4013,
+  109, 2157, 1133, 3181,
+  621, 2669, 1645, 3693,
+  365, 2413, 1389, 3437,
+  877, 2925, 1901, 3949,
+  237, 2285, 1261, 3309,
+  749, 2797, 1773, 3821,
+  493, 2541, 1517, 3565,
+  1005, 3053, 2029, 4077,
+  29, 2077, 1053, 3101,
+  541, 2589, 1565, 3613,
+  285, 2333, 1309, 3357,
+  797, 2845, 1821, 3869,
+  157, 2205, 1181, 3229,
+  669, 2717, 1693, 3741,
+  413, 2461, 1437, 3485,
+  925, 2973, 1949, 3997,
+  93, 2141, 1117, 3165,
+  605, 2653, 1629, 3677,
+  349, 2397, 1373, 3421,
+  861, 2909, 1885, 3933,
+  221, 2269, 1245, 3293,
+  733, 2781, 1757, 3805,
+  477, 2525, 1501, 3549,
+  989, 3037, 2013, 4061,
+  61, 2109, 1085, 3133,
+  573, 2621, 1597, 3645,
+  317, 2365, 1341, 3389,
+  829, 2877, 1853, 3901,
+  189, 2237, 1213, 3261,
+  701, 2749, 1725, 3773,
+  445, 2493, 1469, 3517,
+  957, 3005, 1981, 4029,
+  125, 2173, 1149, 3197,
+  637, 2685, 1661, 3709,
+  381, 2429, 1405, 3453,
+  893, 2941, 1917, 3965,
+  253, 2301, 1277, 3325,
+  765, 2813, 1789, 3837,
+  509, 2557, 1533, 3581,
+  1021, 3069, 2045, 4093,
+  3, 2051, 1027, 3075,
+  515, 2563, 1539, 3587,
+  259, 2307, 1283, 3331,
+  771, 2819, 1795, 3843,
+  131, 2179, 1155, 3203,
+  643, 2691, 1667, 3715,
+  387, 2435, 1411, 3459,
+  899, 2947, 1923, 3971,
+  67, 2115, 1091, 3139,
+  579, 2627, 1603, 3651,
+  323, 2371, 1347, 3395,
+  835, 2883, 1859, 3907,
+  195, 2243, 1219, 3267,
+  707, 2755, 1731, 3779,
+  451, 2499, 1475, 3523,
+  963, 3011, 1987, 4035,
+  35, 2083, 1059, 3107,
+  547, 2595, 1571, 3619,
+  291, 2339, 1315, 3363,
+  803, 2851, 1827, 3875,
+  163, 2211, 1187, 3235,
+  675, 2723, 1699, 3747,
+  419, 2467, 1443, 3491,
+  931, 2979, 1955, 4003,
+  99, 2147, 1123, 3171,
+  611, 2659, 1635, 3683,
+  355, 2403, 1379, 3427,
+  867, 2915, 1891, 3939,
+  227, 2275, 1251, 3299,
+  739, 2787, 1763, 3811,
+  483, 2531, 1507, 3555,
+  995, 3043, 2019, 4067,
+  19, 2067, 1043, 3091,
+  531, 2579, 1555, 3603,
+  275, 2323, 1299, 3347,
+  787, 2835, 1811, 3859,
+  147, 2195, 1171, 3219,
+  659, 2707, 1683, 3731,
+  403, 2451, 1427, 3475,
+  915, 2963, 1939, 3987,
+  83, 2131, 1107, 3155,
+  595, 2643, 1619, 3667,
+  339, 2387, 1363, 3411,
+  851, 2899, 1875, 3923,
+  211, 2259, 1235, 3283,
+  723, 2771, 1747, 3795,
+  467, 2515, 1491, 3539,
+  979, 3027, 2003, 4051,
+  51, 2099, 1075, 3123,
+  563, 2611, 1587, 3635,
+  307, 2355, 1331, 3379,
+  819, 2867, 1843, 3891,
+  179, 2227, 1203, 3251,
+  691, 2739, 1715, 3763,
+  435, 2483, 1459, 3507,
+  947, 2995, 1971, 4019,
+  115, 2163, 1139, 3187,
+  627, 2675, 1651, 3699,
+  371, 2419, 1395, 3443,
+  883, 2931, 1907, 3955,
+  243, 2291, 1267, 3315,
+  755, 2803, 1779, 3827,
+  499, 2547, 1523, 3571,
+  1011, 3059, 2035, 4083,
+  11, 2059, 1035, 3083,
+  523, 2571, 1547, 3595,
+  267, 2315, 1291, 3339,
+  779, 2827, 1803, 3851,
+  139, 2187, 1163, 3211,
+  651, 2699, 1675, 3723,
+  395, 2443, 1419, 3467,
+  907, 2955, 1931, 3979,
+  75, 2123, 1099, 3147,
+  587, 2635, 1611, 3659,
+  331, 2379, 1355, 3403,
+  843, 2891, 1867, 3915,
+  203, 2251, 1227, 3275,
+  715, 2763, 1739, 3787,
+  459, 2507, 1483, 3531,
+  971, 3019, 1995, 4043,
+  43, 2091, 1067, 3115,
+  555, 2603, 1579, 3627,
+  299, 2347, 1323, 3371,
+  811, 2859, 1835, 3883,
+  171, 2219, 1195, 3243,
+  683, 2731, 1707, 3755,
+  427, 2475, 1451, 3499,
+  939, 2987, 1963, 4011,
+  107, 2155, 1131, 3179,
+  619, 2667, 1643, 3691,
+  363, 2411, 1387, 3435,
+  875, 2923, 1899, 3947,
+  235, 2283, 1259, 3307,
+  747, 2795, 1771, 3819,
+  491, 2539, 1515, 3563,
+  1003, 3051, 2027, 4075,
+  27, 2075, 1051, 3099,
+  539, 2587, 1563, 3611,
+  283, 2331, 1307, 3355,
+  795, 2843, 1819, 3867,
+  155, 2203, 1179, 3227,
+  667, 2715, 1691, 3739,
+  411, 2459, 1435, 3483,
+  923, 2971, 1947, 3995,
+  91, 2139, 1115, 3163,
+  603, 2651, 1627, 3675,
+  347, 2395, 1371, 3419,
+  859, 2907, 1883, 3931,
+  219, 2267, 1243, 3291,
+  731, 2779, 1755, 3803,
+  475, 2523, 1499, 3547,
+  987, 3035, 2011, 4059,
+  59, 2107, 1083, 3131,
+  571, 2619, 1595, 3643,
+  315, 2363, 1339, 3387,
+  827, 2875, 1851, 3899,
+  187, 2235, 1211, 3259,
+  699, 2747, 1723, 3771,
+  443, 2491, 1467, 3515,
+  955, 3003, 1979, 4027,
+  123, 2171, 1147, 3195,
+  635, 2683, 1659, 3707,
+  379, 2427, 1403, 3451,
+  891, 2939, 1915, 3963,
+  251, 2299, 1275, 3323,
+  763, 2811, 1787, 3835,
+  507, 2555, 1531, 3579,
+  1019, 3067, 2043, 4091,
+  7, 2055, 1031, 3079,
+  519, 2567, 1543, 3591,
+  263, 2311, 1287, 3335,
+  775, 2823, 1799, 3847,
+  135, 2183, 1159, 3207,
+  647, 2695, 1671, 3719,
+  391, 2439, 1415, 3463,
+  903, 2951, 1927, 3975,
+  71, 2119, 1095, 3143,
+  583, 2631, 1607, 3655,
+  327, 2375, 1351, 3399,
+  839, 2887, 1863, 3911,
+  199, 2247, 1223, 3271,
+  711, 2759, 1735, 3783,
+  455, 2503, 1479, 3527,
+  967, 3015, 1991, 4039,
+  39, 2087, 1063, 3111,
+  551, 2599, 1575, 3623,
+  295, 2343, 1319, 3367,
+  807, 2855, 1831, 3879,
+  167, 2215, 1191, 3239,
+  679, 2727, 1703, 3751,
+  423, 2471, 1447, 3495,
+  935, 2983, 1959, 4007,
+  103, 2151, 1127, 3175,
+  615, 2663, 1639, 3687,
+  359, 2407, 1383, 3431,
+  871, 2919, 1895, 3943,
+  231, 2279, 1255, 3303,
+  743, 2791, 1767, 3815,
+  487, 2535, 1511, 3559,
+  999, 3047, 2023, 4071,
+  23, 2071, 1047, 3095,
+  535, 2583, 1559, 3607,
+  279, 2327, 1303, 3351,
+  791, 2839, 1815, 3863,
+  151, 2199, 1175, 3223,
+  663, 2711, 1687, 3735,
+  407, 2455, 1431, 3479,
+  919, 2967, 1943, 3991,
+  87, 2135, 1111, 3159,
+  599, 2647, 1623, 3671,
+  343, 2391, 1367, 3415,
+  855, 2903, 1879, 3927,
+  215, 2263, 1239, 3287,
+  727, 2775, 1751, 3799,
+  471, 2519, 1495, 3543,
+  983, 3031, 2007, 4055,
+  55, 2103, 1079, 3127,
+  567, 2615, 1591, 3639,
+  311, 2359, 1335, 3383,
+  823, 2871, 1847, 3895,
+  183, 2231, 1207, 3255,
+  695, 2743, 1719, 3767,
+  439, 2487, 1463, 3511,
+  951, 2999, 1975, 4023,
+  119, 2167, 1143, 3191,
+  631, 2679, 1655, 3703,
+  375, 2423, 1399, 3447,
+  887, 2935, 1911, 3959,
+  247, 2295, 1271, 3319,
+  759, 2807, 1783, 3831,
+  503, 2551, 1527, 3575,
+  1015, 3063, 2039, 4087,
+  15, 2063, 1039, 3087,
+  527, 2575, 1551, 3599,
+  271, 2319, 1295, 3343,
+  783, 2831, 1807, 3855,
+  143, 2191, 1167, 3215,
+  655, 2703, 1679, 3727,
+  399, 2447, 1423, 3471,
+  911, 2959, 1935, 3983,
+  79, 2127, 1103, 3151,
+  591, 2639, 1615, 3663,
+  335, 2383, 1359, 3407,
+  847, 2895, 1871, 3919,
+  207, 2255, 1231, 3279,
+  719, 2767, 1743, 3791,
+  463, 2511, 1487, 3535,
+  975, 3023, 1999, 4047,
+  47, 2095, 1071, 3119,
+  559, 2607, 1583, 3631,
+  303, 2351, 1327, 3375,
+  815, 2863, 1839, 3887,
+  175, 2223, 1199, 3247,
+  687, 2735, 1711, 3759,
+  431, 2479, 1455, 3503,
+  943, 2991, 1967, 4015,
+  111, 2159, 1135, 3183,
+  623, 2671, 1647, 3695,
+  367, 2415, 1391, 3439,
+  879, 2927, 1903, 3951,
+  239, 2287, 1263, 3311,
+  751, 2799, 1775, 3823,
+  495, 2543, 1519, 3567,
+  1007, 3055, 2031, 4079,
+  31, 2079, 1055, 3103,
+  543, 2591, 1567, 3615,
+  287, 2335, 1311, 3359,
+  799, 2847, 1823, 3871,
+  159, 2207, 1183, 3231,
+  671, 2719, 1695, 3743,
+  415, 2463, 1439, 3487,
+  927, 2975, 1951, 3999,
+  95, 2143, 1119, 3167,
+  607, 2655, 1631, 3679,
+  351, 2399, 1375, 3423,
+  863, 2911, 1887, 3935,
+  223, 2271, 1247, 3295,
+  735, 2783, 1759, 3807,
+  479, 2527, 1503, 3551,
+  991, 3039, 2015, 4063,
+  63, 2111, 1087, 3135,
+  575, 2623, 1599, 3647,
+  319, 2367, 1343, 3391,
+  831, 2879, 1855, 3903,
+  191, 2239, 1215, 3263,
+  703, 2751, 1727, 3775,
+  447, 2495, 1471, 3519,
+  959, 3007, 1983, 4031,
+  127, 2175, 1151, 3199,
+  639, 2687, 1663, 3711,
+  383, 2431, 1407, 3455,
+  895, 2943, 1919, 3967,
+  255, 2303, 1279, 3327,
+  767, 2815, 1791, 3839,
+  511, 2559, 1535, 3583,
+  1023, 3071, 2047, 4095,
+};
+
+static const rta_tables_real_t * const sin_tables[] =
+{
+  sin_16, sin_32, sin_64, sin_128,
+  sin_256, sin_512, sin_1024, sin_2048,
+  sin_4096,
+};
+
+static const unsigned int * const bitrev_tables[] =
+{
+  bitrev_16, bitrev_32, bitrev_64, bitrev_128,
+  bitrev_256, bitrev_512, bitrev_1024, bitrev_2048,
+  bitrev_4096,
+};
+
+/* index of the tables of size, or -1 */
+static int
+table_index(const unsigned int size)
+{
+  int log2_size;
+
+  for(log2_size = RTA_TABLES_MIN_LOG2; log2_size <= RTA_TABLES_MAX_LOG2; log2_size++)
+  {
+    if(size == 1u << log2_size)
+    {
+      return log2_size - RTA_TABLES_MIN_LOG2;
+    }
+  }
+
+  return -1;
+}
+
+const rta_tables_real_t *
+rta_tables_sin(const unsigned int size)
+{
+  const int index = table_index(size);
+
+  return (index >= 0 ? sin_tables[index] : NULL);
+}
+
+const unsigned int *
+rta_tables_bitrev(const unsigned int size)
+{
+  const int index = table_index(size);
+
+  return (index >= 0 ? bitrev_tables[index] : NULL);
+}
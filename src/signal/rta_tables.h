@@ -0,0 +1,105 @@
+/**
+ * @file   rta_tables.h
+ * @ingroup rta_signal
+ *
+ * @brief  Read-only sine and bit-reversal tables for common FFT sizes
+ *
+ * The tables are written to rta_tables.c by rta_tables.py, for the
+ * sizes 2^RTA_TABLES_MIN_LOG2 to 2^RTA_TABLES_MAX_LOG2, at the
+ * precision of rta_real_t. They are constant data of the binary: no
+ * initialisation at startup, pages shared by all the processes using
+ * the library, and no initialisation order to respect. (The values
+ * are written at double precision.) The FFT setups
+ * and the raised-cosine windows of these sizes use them instead of
+ * computing their own.
+ *
+ * To change the sizes or the precision, run
+ * python3 rta_tables.py [min_log2 max_log2] > rta_tables.c
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_TABLES_H_
+#define _RTA_TABLES_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** smallest tabulated size, as a power of 2 */
+#define RTA_TABLES_MIN_LOG2 4
+
+/** largest tabulated size, as a power of 2 */
+#define RTA_TABLES_MAX_LOG2 12
+
+/**
+ * Precision of the tables: the one of rta_real_t at the first
+ * inclusion of this header, also when rta_real_t is redefined later
+ * for a precision instance (see rta_precision_instance.h).
+ */
+typedef rta_real_t rta_tables_real_t;
+
+#if (RTA_REAL_TYPE == RTA_FLOAT_TYPE)
+#define RTA_TABLES_REAL_TYPE RTA_FLOAT_TYPE
+#elif (RTA_REAL_TYPE == RTA_DOUBLE_TYPE)
+#define RTA_TABLES_REAL_TYPE RTA_DOUBLE_TYPE
+#else
+#define RTA_TABLES_REAL_TYPE RTA_LONG_DOUBLE_TYPE
+#endif
+
+/**
+ * Sine table for a size
+ *
+ * @param size is a power of 2
+ *
+ * @return sin(2 * pi * i / size) for i in [0, size * 5/4], that is a
+ * period and a quarter (the cosine is the table shifted by size / 4),
+ * or NULL if size is not tabulated
+ */
+const rta_tables_real_t * rta_tables_sin(const unsigned int size);
+
+/**
+ * Bit-reversal table for a size
+ *
+ * @param size is a power of 2
+ *
+ * @return the bit-reversed index of i for i in [0, size - 1], or NULL
+ * if size is not tabulated
+ */
+const unsigned int * rta_tables_bitrev(const unsigned int size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_TABLES_H_ */
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#
+# Generate rta_tables.c: sine and bit-reversal tables for the FFT
+# sizes from 2^min_log2 to 2^max_log2 (see rta_tables.h).
+#
+# usage: python3 rta_tables.py [min_log2 max_log2] > rta_tables.c
+#
+# The bounds must match RTA_TABLES_MIN_LOG2 and RTA_TABLES_MAX_LOG2 of
+# rta_tables.h.
+#
+# Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+# All rights reserved.
+# License (BSD 3-clause), see rta_tables.h
+
+import math
+import sys
+
+min_log2, max_log2 = 4, 12
+if len(sys.argv) == 3:
+    min_log2, max_log2 = int(sys.argv[1]), int(sys.argv[2])
+
+PER_LINE = 4
+
+
+def sine(i, size):
+    """sin(2 pi i / size), exact at the multiples of a quarter period"""
+    quadrant, j = divmod(i % size, size // 4)
+    if j == 0:
+        return (0.0, 1.0, 0.0, -1.0)[quadrant]
+    if quadrant % 2 == 1:
+        j = size // 4 - j
+    value = math.sin(2 * math.pi * j / size) if 8 * j <= size \
+        else math.cos(2 * math.pi * (size // 4 - j) / size)
+    return value if quadrant < 2 else -value
+
+
+def bitrev(i, log2_size):
+    return int(format(i, '0%db' % log2_size)[::-1], 2) if log2_size > 0 else 0
+
+
+def write_values(values):
+    for start in range(0, len(values), PER_LINE):
+        print('  ' + ', '.join(values[start:start + PER_LINE]) + ',')
+
+
+print('''/**
+ * @file   rta_tables.c
+ * @ingroup rta_signal
+ *
+ * @brief  Read-only sine and bit-reversal tables for common FFT sizes
+ *
+ * Generated by rta_tables.py %d %d, do not edit.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause), see rta_tables.h
+ */
+
+#include "rta_tables.h"
+
+#if RTA_TABLES_MIN_LOG2 != %d || RTA_TABLES_MAX_LOG2 != %d
+#error "rta_tables.c does not match rta_tables.h: run rta_tables.py"
+#endif
+''' % (min_log2, max_log2, min_log2, max_log2))
+
+for log2_size in range(min_log2, max_log2 + 1):
+    size = 1 << log2_size
+
+    print('static const rta_tables_real_t sin_%d[%d] =\n{' % (size, size * 5 // 4 + 1))
+    write_values([repr(sine(i, size)) for i in range(size * 5 // 4 + 1)])
+    print('};\n')
+
+    print('static const unsigned int bitrev_%d[%d] =\n{' % (size, size))
+    write_values([str(bitrev(i, log2_size)) for i in range(size)])
+    print('};\n')
+
+print('static const rta_tables_real_t * const sin_tables[] =\n{')
+write_values(['sin_%d' % (1 << l) for l in range(min_log2, max_log2 + 1)])
+print('};\n')
+
+print('static const unsigned int * const bitrev_tables[] =\n{')
+write_values(['bitrev_%d' % (1 << l) for l in range(min_log2, max_log2 + 1)])
+print('};\n')
+
+print('''/* index of the tables of size, or -1 */
+static int
+table_index(const unsigned int size)
+{
+  int log2_size;
+
+  for(log2_size = RTA_TABLES_MIN_LOG2; log2_size <= RTA_TABLES_MAX_LOG2; log2_size++)
+  {
+    if(size == 1u << log2_size)
+    {
+      return log2_size - RTA_TABLES_MIN_LOG2;
+    }
+  }
+
+  return -1;
+}
+
+const rta_tables_real_t *
+rta_tables_sin(const unsigned int size)
+{
+  const int index = table_index(size);
+
+  return (index >= 0 ? sin_tables[index] : NULL);
+}
+
+const unsigned int *
+rta_tables_bitrev(const unsigned int size)
+{
+  const int index = table_index(size);
+
+  return (index >= 0 ? bitrev_tables[index] : NULL);
+}''')
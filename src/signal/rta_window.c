@@ -38,7 +38,20 @@
 
 #include "rta_window.h"
 #include "rta_math.h" /* M_PI, cos */
+#include "rta_tables.h" /* rta_tables_sin */
 
+/* cos(2 * pi * i / size) for i in [0, size - 1], when size is
+   tabulated at the current precision, or NULL */
+static const rta_tables_real_t * window_cos_table(const unsigned int size)
+{
+#if (RTA_REAL_TYPE == RTA_TABLES_REAL_TYPE)
+  const rta_tables_real_t * sin_table = rta_tables_sin(size);
+
+  return (sin_table != NULL ? sin_table + size / 4 : NULL);
+#else
+  return NULL;
+#endif
+}
 
 
 /* y = 0.5 - 0.5 * cos(2 * pi * x) */
@@ -48,10 +61,21 @@ int rta_window_hann_weights(rta_real_t * weights_vector,
   unsigned int i; 
   int ret = 1; /* return value */
   const rta_real_t step = 2. * M_PI / weights_size;
-
-  for(i=0; i<weights_size; i++)
-  { 
-    weights_vector[i] = 0.5 - 0.5 * rta_cos(i*step);
+  const rta_tables_real_t * cos_table = window_cos_table(weights_size);
+
+  if(cos_table != NULL)
+  {
+    for(i=0; i<weights_size; i++)
+    {
+      weights_vector[i] = 0.5 - 0.5 * cos_table[i];
+    }
+  }
+  else
+  {
+    for(i=0; i<weights_size; i++)
+    { 
+      weights_vector[i] = 0.5 - 0.5 * rta_cos(i*step);
+    }
   }
     
   return ret;
@@ -78,9 +102,21 @@ void rta_window_hann_apply_in_place(rta_real_t * input_vector,
 {
   unsigned int i;
   const rta_real_t step = 2. * M_PI / input_size;
-  for(i=0; i<input_size; i++)
-  { 
-    input_vector[i] *= 0.5 - 0.5 * rta_cos(i*step);
+  const rta_tables_real_t * cos_table = window_cos_table(input_size);
+
+  if(cos_table != NULL)
+  {
+    for(i=0; i<input_size; i++)
+    {
+      input_vector[i] *= 0.5 - 0.5 * cos_table[i];
+    }
+  }
+  else
+  {
+    for(i=0; i<input_size; i++)
+    { 
+      input_vector[i] *= 0.5 - 0.5 * rta_cos(i*step);
+    }
   }
     
   return;
@@ -110,10 +146,21 @@ int rta_window_hamming_weights(rta_real_t * weights_vector,
   int ret = 1; /* return value */
   const rta_real_t step = 2. * M_PI / weights_size;
   const rta_real_t scale = (1. - coef) * 0.5;
-
-  for(i=0; i<weights_size; i++)
-  { 
-    weights_vector[i] = coef + scale * (1. - rta_cos(i*step));
+  const rta_tables_real_t * cos_table = window_cos_table(weights_size);
+
+  if(cos_table != NULL)
+  {
+    for(i=0; i<weights_size; i++)
+    {
+      weights_vector[i] = coef + scale * (1. - cos_table[i]);
+    }
+  }
+  else
+  {
+    for(i=0; i<weights_size; i++)
+    { 
+      weights_vector[i] = coef + scale * (1. - rta_cos(i*step));
+    }
   }
     
   return ret;
@@ -144,10 +191,21 @@ void rta_window_hamming_apply_in_place(rta_real_t * input_vector,
   unsigned int i;
   const rta_real_t step = 2. * M_PI / input_size;
   const rta_real_t scale = (1. - coef) * 0.5;
-
-  for(i=0; i<input_size; i++)
-  { 
-    input_vector[i] *= coef + scale * (1. - rta_cos(i*step));
+  const rta_tables_real_t * cos_table = window_cos_table(input_size);
+
+  if(cos_table != NULL)
+  {
+    for(i=0; i<input_size; i++)
+    {
+      input_vector[i] *= coef + scale * (1. - cos_table[i]);
+    }
+  }
+  else
+  {
+    for(i=0; i<input_size; i++)
+    { 
+      input_vector[i] *= coef + scale * (1. - rta_cos(i*step));
+    }
   }
     
   return;
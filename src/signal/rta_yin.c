@@ -43,8 +43,9 @@
 
 #include "rta_yin.h"
 
-#include "rta_stdlib.h" /* rta_malloc, rta_free */
+#include "rta_alloc.h" /* rta_arena_new, rta_aligned_free */
 #include "rta_correlation.h" /* rta_correlation_fast */
+#include "rta_trace.h" /* RTA_TRACE_BEGIN, RTA_TRACE_END */
 
 /* private structure for yin minima search */
 typedef struct rta_yin_mins rta_yin_mins_t;
@@ -64,23 +65,22 @@ struct rta_yin_setup
 int rta_yin_setup_new(rta_yin_setup_t ** yin_setup, unsigned int max_mins)
 {
   int ret = 0;
-  *yin_setup = (rta_yin_setup_t *) rta_malloc(sizeof(rta_yin_setup_t));
+  rta_arena_t arena;
 
-  if(*yin_setup != NULL)
+  /* setup and minima in one aligned block */
+  if(rta_arena_new(&arena, rta_align_size(sizeof(rta_yin_setup_t)) +
+                   rta_align_size(sizeof(rta_yin_mins_t) * max_mins)))
   {
-    (*yin_setup)->mins = (rta_yin_mins_t *) rta_malloc(
-      sizeof(rta_yin_mins_t) * max_mins);
-
-    if((*yin_setup)->mins != NULL)
-    {
-      (*yin_setup)->max_mins = max_mins;
-      ret = 1;
-    }
-    else
-    {
-      rta_free(*yin_setup);
-      *yin_setup = NULL;
-    }
+    *yin_setup = (rta_yin_setup_t *) rta_arena_alloc(
+      &arena, sizeof(rta_yin_setup_t));
+    (*yin_setup)->mins = (rta_yin_mins_t *) rta_arena_alloc(
+      &arena, sizeof(rta_yin_mins_t) * max_mins);
+    (*yin_setup)->max_mins = max_mins;
+    ret = 1;
+  }
+  else
+  {
+    *yin_setup = NULL;
   }
 
   return ret;
@@ -88,14 +88,8 @@ int rta_yin_setup_new(rta_yin_setup_t ** yin_setup, unsigned int max_mins)
 
 void rta_yin_setup_delete(rta_yin_setup_t * yin_setup)
 {
-  if(yin_setup != NULL)
-  {
-    if(yin_setup->mins != NULL)
-    {
-      rta_free(yin_setup->mins);
-    }
-    rta_free(yin_setup);
-  }
+  /* minima are in the same block */
+  rta_aligned_free(yin_setup);
   return;
 }
 
@@ -126,6 +120,7 @@ rta_real_t rta_yin(
   rta_real_t diff_left, diff, diff_right, sum;
   unsigned int i;             /* input sample index */
   const unsigned int window_size = input_size - ac_size;
+  RTA_TRACE_BEGIN(rta_trace_yin);
 
   *abs_min = 1.;
     
@@ -202,6 +197,8 @@ rta_real_t rta_yin(
     *abs_min = 0.;
   }
 
+  RTA_TRACE_COUNT(rta_trace_yin, input_size);
+  RTA_TRACE_END(rta_trace_yin);
   return abs_lag;
 }
 
@@ -237,6 +234,7 @@ rta_real_t rta_yin_stride(
   int ac;            /* autocorrelation index */
   const unsigned int window_size = input_size - ac_size;
   const unsigned int window_size_stride = window_size * i_stride;
+  RTA_TRACE_BEGIN(rta_trace_yin);
 
   *abs_min = 1.;
     
@@ -317,5 +315,7 @@ rta_real_t rta_yin_stride(
     *abs_min = 0.;
   }
 
+  RTA_TRACE_COUNT(rta_trace_yin, input_size);
+  RTA_TRACE_END(rta_trace_yin);
   return abs_lag;
 }
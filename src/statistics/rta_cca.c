@@ -35,6 +35,7 @@
 
 #include <math.h>
 #include "rta_cca.h"
+#include "rta_stdlib.h" /* rta_malloc, rta_free */
 
 /*
  * Center Variables
@@ -81,8 +82,8 @@ center_variables(gsl_matrix * X, gsl_matrix * Y)
 	}
 
 
-	free(left_means);
-	free(right_means);
+	gsl_vector_free(left_means);
+	gsl_vector_free(right_means);
 
   return 1;
 }
@@ -140,7 +141,7 @@ sorted_QR_decomposition( gsl_matrix * M, gsl_matrix * Q, gsl_matrix * R, gsl_per
 
 	gsl_vector * Tau	= gsl_vector_alloc( min_mn);
 	gsl_vector * Norms	= gsl_vector_alloc( n);
-	int * Signs			= (int *)malloc( n * sizeof(int));
+	int * Signs			= (int *)rta_malloc( n * sizeof(int));
 
 
 	//QR decomposition with permutations in P
@@ -152,7 +153,7 @@ sorted_QR_decomposition( gsl_matrix * M, gsl_matrix * Q, gsl_matrix * R, gsl_per
 
 	gsl_vector_free(Tau);
 	gsl_vector_free(Norms);
-	free(Signs);
+	rta_free(Signs);
 
 }
 
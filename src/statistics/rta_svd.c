@@ -44,7 +44,7 @@
 #include "rta_math.h" /* rta_abs, rta_max, rta_min, rta_hypot, rta_pow */
 #include "rta_int.h" /* rta_imin, rta_imax */
 #include "rta_float.h" /* RTA_REAL_EPSILON */
-#include "rta_stdlib.h" /* NULL */
+#include "rta_alloc.h" /* rta_arena_new, rta_aligned_free */
 
 struct rta_svd_setup
 {
@@ -66,86 +66,41 @@ rta_svd_setup_new(rta_svd_setup_t ** svd_setup, const rta_svd_t svd_type,
                   rta_real_t * U, rta_real_t * S, rta_real_t *  V, 
                   rta_real_t * A, const unsigned int m, const unsigned int n)
 {
-  int ret = 1;
-  *svd_setup = (rta_svd_setup_t *) rta_malloc(sizeof(rta_svd_setup_t));
-  
-  if(*svd_setup == NULL)
+  const int copy_A = (svd_type == rta_svd_out_of_place || n > m);
+  const size_t A_size = (copy_A ? m * n * sizeof(rta_real_t) : 0);
+  const size_t e_size = rta_imin(m,n) * sizeof(rta_real_t);
+  const size_t work_size = rta_imax(m,n) * sizeof(rta_real_t);
+  rta_arena_t arena;
+
+  /* setup and workspaces in one aligned block */
+  if(rta_arena_new(&arena, rta_align_size(sizeof(rta_svd_setup_t))
+                   + rta_align_size(A_size)
+                   + rta_align_size(e_size)
+                   + rta_align_size(work_size)) == 0)
   {
-    ret = 0;
-  }
-  else
-  {
-    (*svd_setup)->svd_type = svd_type;
-    (*svd_setup)->m = m;
-    (*svd_setup)->n = n;
+    *svd_setup = NULL;
+    return 0;
   }
 
-  if(ret != 0)
-  {
-    if(svd_type == rta_svd_out_of_place || n > m)
-    {
-      (*svd_setup)->A = (float *)rta_malloc(m * n * sizeof(rta_real_t));
-      if((*svd_setup)->A == NULL)
-      {
-        ret = 0;
-      }
-    }
-    else
-    {
-      (*svd_setup)->A = NULL;
-    }
-  }
+  *svd_setup = (rta_svd_setup_t *) rta_arena_alloc(
+    &arena, sizeof(rta_svd_setup_t));
+  (*svd_setup)->svd_type = svd_type;
+  (*svd_setup)->m = m;
+  (*svd_setup)->n = n;
 
-  if(ret != 0)
-  {
-    (*svd_setup)->e = (rta_real_t *) rta_malloc(
-      rta_imin(m,n) * sizeof(rta_real_t));
-    if((*svd_setup)->e == NULL)
-    {
-      ret = 0;
-    }
-  }
-    
-  if(ret != 0)
-  {
-    (*svd_setup)-> work = (rta_real_t *) rta_malloc(
-      rta_imax(m,n) * sizeof(rta_real_t));
-    if((*svd_setup)->work == NULL)
-    {
-      ret = 0;
-    }
-  }
-  
-  if(ret == 0)
-  {
-    rta_svd_setup_delete(*svd_setup);
-  }
+  (*svd_setup)->A = (copy_A ?
+                     (rta_real_t *) rta_arena_alloc(&arena, A_size) : NULL);
+  (*svd_setup)->e = (rta_real_t *) rta_arena_alloc(&arena, e_size);
+  (*svd_setup)->work = (rta_real_t *) rta_arena_alloc(&arena, work_size);
 
-  return ret;
+  return 1;
 }
 
 void
 rta_svd_setup_delete(rta_svd_setup_t * svd_setup)
 {
-  if(svd_setup != NULL)
-  {
-    if((svd_setup)->A != NULL)
-    {
-      rta_free((svd_setup)->A);
-    }
-
-    if((svd_setup)->e != NULL)
-    {
-      rta_free((svd_setup)->e);
-    }
-
-    if((svd_setup)->work != NULL)
-    {
-      rta_free((svd_setup)->work);
-    }
-
-    rta_free(svd_setup);
-  }
+  /* workspaces are in the same block */
+  rta_aligned_free(svd_setup);
 
   return;
 }
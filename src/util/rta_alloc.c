@@ -0,0 +1,164 @@
+/**
+ * @file   rta_alloc.c
+ * @ingroup rta_util
+ *
+ * @brief  Aligned memory allocation and setup arenas.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_alloc.h"
+#include "rta_stdlib.h" /* rta_malloc, rta_free */
+
+#include <string.h> /* memset */
+
+/* default allocator: over-allocate with rta_malloc and keep the
+   original pointer just before the aligned block */
+static void *
+default_alloc(size_t size, size_t alignment, void * context)
+{
+  char * raw = (char *) rta_malloc(size + alignment + sizeof(void *));
+  char * aligned;
+
+  if(raw == NULL)
+  {
+    return NULL;
+  }
+
+  aligned = (char *) (((size_t) (raw + sizeof(void *)) + alignment - 1)
+                      & ~(alignment - 1));
+  ((void **) aligned)[-1] = raw;
+
+  return aligned;
+}
+
+static void
+default_free(void * ptr, void * context)
+{
+  rta_free(((void **) ptr)[-1]);
+}
+
+static rta_alloc_function_t rta_alloc_function = default_alloc;
+static rta_free_function_t rta_free_function = default_free;
+static void * rta_alloc_context = NULL;
+
+
+void
+rta_allocator_set(rta_alloc_function_t alloc_function,
+                  rta_free_function_t free_function,
+                  void * context)
+{
+  if(alloc_function != NULL && free_function != NULL)
+  {
+    rta_alloc_function = alloc_function;
+    rta_free_function = free_function;
+    rta_alloc_context = context;
+  }
+  else
+  {
+    rta_alloc_function = default_alloc;
+    rta_free_function = default_free;
+    rta_alloc_context = NULL;
+  }
+
+  return;
+}
+
+void *
+rta_aligned_malloc(const size_t size, const size_t alignment)
+{
+  const size_t a = (alignment > 0 ? alignment : RTA_ALIGNMENT);
+
+  /* alignment must be a power of 2 */
+  if((a & (a - 1)) != 0)
+  {
+    return NULL;
+  }
+
+  return rta_alloc_function(size, a, rta_alloc_context);
+}
+
+void
+rta_aligned_free(void * ptr)
+{
+  if(ptr != NULL)
+  {
+    rta_free_function(ptr, rta_alloc_context);
+  }
+
+  return;
+}
+
+
+int
+rta_arena_new(rta_arena_t * arena, const size_t size)
+{
+  arena->size = rta_align_size(size);
+  arena->used = 0;
+  arena->base = (char *) rta_aligned_malloc(arena->size, RTA_ALIGNMENT);
+
+  if(arena->base == NULL)
+  {
+    arena->size = 0;
+    return 0;
+  }
+
+  return 1;
+}
+
+void *
+rta_arena_alloc(rta_arena_t * arena, const size_t size)
+{
+  const size_t aligned_size = rta_align_size(size);
+  char * ptr;
+
+  if(arena->base == NULL || arena->used + aligned_size > arena->size)
+  {
+    return NULL;
+  }
+
+  ptr = arena->base + arena->used;
+  arena->used += aligned_size;
+  memset(ptr, 0, aligned_size);
+
+  return ptr;
+}
+
+void
+rta_arena_delete(rta_arena_t * arena)
+{
+  rta_aligned_free(arena->base);
+  arena->base = NULL;
+  arena->size = 0;
+  arena->used = 0;
+
+  return;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file   rta_alloc.h
+ * @ingroup rta_util
+ *
+ * @brief  Aligned memory allocation and setup arenas.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_ALLOC_H_
+#define _RTA_ALLOC_H_ 1
+
+#include "rta.h"
+#include <stddef.h> /* size_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** default alignment of setup memory: one cache line, enough for any
+ * SIMD register width */
+#define RTA_ALIGNMENT 64
+
+/** round up \p size to a multiple of RTA_ALIGNMENT */
+#define rta_align_size(size) \
+  (((size_t) (size) + RTA_ALIGNMENT - 1) & ~((size_t) RTA_ALIGNMENT - 1))
+
+
+/** allocation function: return \p size bytes aligned to \p alignment
+ * (a power of 2) or NULL on failure */
+typedef void * (*rta_alloc_function_t) (size_t size, size_t alignment,
+                                        void * context);
+
+/** deallocation function for memory returned by the matching
+ * rta_alloc_function_t */
+typedef void (*rta_free_function_t) (void * ptr, void * context);
+
+/**
+ * Set the allocator used by rta_aligned_malloc() and rta_aligned_free(),
+ * and therefore by all setup functions of the library.
+ *
+ * The default allocator over-allocates with rta_malloc() and aligns
+ * the returned pointer. Setting \p alloc_function or \p free_function
+ * to NULL restores the default allocator.
+ *
+ * The allocator must not be changed while setups allocated with the
+ * previous one still exist.
+ *
+ * @param alloc_function allocation function or NULL
+ * @param free_function deallocation function or NULL
+ * @param context user pointer passed to both functions
+ */
+void rta_allocator_set(rta_alloc_function_t alloc_function,
+                       rta_free_function_t free_function,
+                       void * context);
+
+/**
+ * Allocate \p size bytes aligned to \p alignment with the current
+ * allocator.
+ *
+ * @param size in bytes
+ * @param alignment power of 2, RTA_ALIGNMENT if 0
+ *
+ * @return pointer to aligned memory or NULL on failure
+ */
+void * rta_aligned_malloc(const size_t size, const size_t alignment);
+
+/**
+ * Free memory allocated by rta_aligned_malloc(). NULL is ignored.
+ */
+void rta_aligned_free(void * ptr);
+
+
+/**
+ * Arena: a single aligned block from which the buffers of a setup are
+ * carved contiguously, each at RTA_ALIGNMENT. The whole setup is freed
+ * at once with rta_aligned_free() of the block base.
+ *
+ * Usage: sum rta_align_size() of all buffers, rta_arena_new() with
+ * that total, then rta_arena_alloc() each buffer in turn. The setup
+ * structure itself is usually carved first, so that its address is
+ * the arena base.
+ */
+typedef struct rta_arena
+{
+  char * base; /**< aligned block */
+  size_t size; /**< total size in bytes */
+  size_t used; /**< bytes already carved */
+} rta_arena_t;
+
+/**
+ * Allocate an arena block of \p size bytes (rounded up to
+ * RTA_ALIGNMENT) with rta_aligned_malloc().
+ *
+ * @param arena to initialise
+ * @param size in bytes
+ *
+ * @return 1 on success 0 on fail
+ */
+int rta_arena_new(rta_arena_t * arena, const size_t size);
+
+/**
+ * Carve \p size bytes at RTA_ALIGNMENT from \p arena. The memory is
+ * zeroed.
+ *
+ * @return pointer into the arena or NULL if the arena is exhausted
+ */
+void * rta_arena_alloc(rta_arena_t * arena, const size_t size);
+
+/**
+ * Free the arena block. Equivalent to rta_aligned_free(arena->base).
+ */
+void rta_arena_delete(rta_arena_t * arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_ALLOC_H_ */
@@ -0,0 +1,297 @@
+/**
+ * @file   rta_cpu.c
+ * @ingroup rta_util
+ *
+ * @brief  Runtime CPU feature detection for SIMD kernel dispatch.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_cpu.h"
+#include "rta_thread.h" /* rta_atomic_load, rta_atomic_store */
+
+#include <stdlib.h> /* getenv */
+#include <string.h> /* strcmp */
+
+#if defined(RTA_CPU_X86)
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  else
+#    include <cpuid.h>
+#  endif
+#elif defined(RTA_CPU_ARM) && defined(__linux__) && !defined(__aarch64__)
+#  include <sys/auxv.h> /* getauxval */
+#  include <asm/hwcap.h> /* HWCAP_NEON */
+#endif
+
+static const char * level_names[rta_cpu_num_levels] =
+{
+  "generic", "sse2", "avx2", "avx512", "neon"
+};
+
+/* bit l set when level l is supported; 0 means not yet detected, as
+   generic is always supported */
+static int supported_levels = 0;
+
+/* dispatch level, -1 until published by the first init() */
+static int current_level = -1;
+
+#if defined(RTA_CPU_X86)
+static void
+cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER)
+  int r[4];
+  __cpuidex(r, (int) leaf, (int) subleaf);
+  regs[0] = r[0]; regs[1] = r[1]; regs[2] = r[2]; regs[3] = r[3];
+#else
+  regs[0] = regs[1] = regs[2] = regs[3] = 0;
+  __get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+  return;
+}
+
+/* register state enabled by the operating system */
+static unsigned long long
+xgetbv0(void)
+{
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  unsigned int eax, edx;
+  __asm__ volatile (".byte 0x0f, 0x01, 0xd0" /* xgetbv */
+                    : "=a" (eax), "=d" (edx) : "c" (0));
+  return ((unsigned long long) edx << 32) | eax;
+#endif
+}
+
+static void
+detect(int supported[])
+{
+  unsigned int regs[4];
+  unsigned int max_leaf;
+  unsigned long long xcr0 = 0;
+  int osxsave;
+
+  cpuid(0, 0, regs);
+  max_leaf = regs[0];
+
+  cpuid(1, 0, regs);
+  supported[rta_cpu_sse2] = (regs[3] >> 26) & 1;
+  osxsave = (regs[2] >> 27) & 1;
+
+  if(osxsave)
+  {
+    xcr0 = xgetbv0();
+  }
+
+  /* AVX2 needs FMA and OS support of the YMM state (XCR0 bits 1, 2) */
+  if(max_leaf >= 7 && (xcr0 & 0x6) == 0x6)
+  {
+    const int fma = (regs[2] >> 12) & 1;
+    cpuid(7, 0, regs);
+    supported[rta_cpu_avx2] = supported[rta_cpu_sse2] && fma
+      && ((regs[1] >> 5) & 1);
+
+    /* AVX-512F needs the opmask and ZMM states (XCR0 bits 5, 6, 7) */
+    supported[rta_cpu_avx512] = supported[rta_cpu_avx2]
+      && ((regs[1] >> 16) & 1) && (xcr0 & 0xe0) == 0xe0;
+  }
+
+  return;
+}
+
+#elif defined(RTA_CPU_ARM)
+static void
+detect(int supported[])
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+  /* Advanced SIMD is mandatory on ARMv8-A */
+  supported[rta_cpu_neon] = 1;
+#elif defined(__linux__) && defined(HWCAP_NEON)
+  supported[rta_cpu_neon] = (getauxval(AT_HWCAP) & HWCAP_NEON) != 0;
+#elif defined(__ARM_NEON)
+  supported[rta_cpu_neon] = 1;
+#endif
+  return;
+}
+
+#else
+static void
+detect(int supported[])
+{
+  return;
+}
+#endif
+
+/* best supported level at or below level, without crossing between
+   x86 and ARM levels */
+static int
+fall_back(const int supported, int level)
+{
+  if(level == rta_cpu_neon)
+  {
+    return ((supported >> rta_cpu_neon) & 1) ? rta_cpu_neon : rta_cpu_generic;
+  }
+
+  while(level > rta_cpu_generic && !((supported >> level) & 1))
+  {
+    level--;
+  }
+
+  return level;
+}
+
+/* forced level, or the best supported one */
+static int
+environment_level(const int supported)
+{
+  const char * env = getenv("RTA_CPU_LEVEL");
+  int l;
+
+  if(env != NULL)
+  {
+    for(l = 0; l < rta_cpu_num_levels; l++)
+    {
+      if(strcmp(env, level_names[l]) == 0)
+      {
+        return fall_back(supported, l);
+      }
+    }
+  }
+
+  for(l = rta_cpu_num_levels - 1; l > rta_cpu_generic; l--)
+  {
+    if((supported >> l) & 1)
+    {
+      break;
+    }
+  }
+
+  return l;
+}
+
+/* set current_level if it is still unset */
+static void
+publish_level(const int level)
+{
+#if defined(_MSC_VER)
+  _InterlockedCompareExchange((volatile long *) &current_level, level, -1);
+#else
+  int expected = -1;
+  __atomic_compare_exchange_n(&current_level, &expected, level, 0,
+                              __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+#endif
+}
+
+/* Detection runs in locals. Concurrent first calls store the same
+   supported levels, then the first of them publishes the dispatch
+   level, last, so that a thread seeing it also sees the supported
+   levels, and a level forced meanwhile by rta_cpu_set_level() is
+   kept. */
+static void
+init(void)
+{
+  int supported[rta_cpu_num_levels] = { 0 };
+  int mask = 0;
+  int l;
+
+  if(rta_atomic_load(&current_level) >= 0)
+  {
+    return;
+  }
+
+  supported[rta_cpu_generic] = 1;
+  detect(supported);
+
+  for(l = rta_cpu_generic; l < rta_cpu_num_levels; l++)
+  {
+    if(supported[l])
+    {
+      mask |= 1 << l;
+    }
+  }
+
+  rta_atomic_store(&supported_levels, mask);
+  publish_level(environment_level(mask));
+  return;
+}
+
+int
+rta_cpu_has(const rta_cpu_level_t level)
+{
+  init();
+  return (level >= 0 && level < rta_cpu_num_levels) ?
+    (rta_atomic_load(&supported_levels) >> level) & 1 : 0;
+}
+
+rta_cpu_level_t
+rta_cpu_get_level(void)
+{
+  int level = rta_atomic_load(&current_level);
+
+  if(level < 0)
+  {
+    init();
+    level = rta_atomic_load(&current_level);
+  }
+
+  return (rta_cpu_level_t) level;
+}
+
+rta_cpu_level_t
+rta_cpu_set_level(const rta_cpu_level_t level)
+{
+  int supported;
+  int effective;
+
+  init();
+  supported = rta_atomic_load(&supported_levels);
+
+  if(level >= 0 && level < rta_cpu_num_levels)
+  {
+    effective = fall_back(supported, level);
+  }
+  else
+  {
+    effective = environment_level(supported);
+  }
+
+  rta_atomic_store(&current_level, effective);
+  return (rta_cpu_level_t) effective;
+}
+
+const char *
+rta_cpu_level_name(const rta_cpu_level_t level)
+{
+  return (level >= 0 && level < rta_cpu_num_levels) ?
+    level_names[level] : "unknown";
+}
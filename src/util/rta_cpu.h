@@ -0,0 +1,117 @@
+/**
+ * @file   rta_cpu.h
+ * @ingroup rta_util
+ *
+ * @brief  Runtime CPU feature detection for SIMD kernel dispatch.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_CPU_H_
+#define _RTA_CPU_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* architecture */
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RTA_CPU_X86 1
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__) || defined(_M_ARM)
+#define RTA_CPU_ARM 1
+#endif
+
+/** compile a single function for an instruction set extension, so
+ * that variants for several levels can live in one binary */
+#if defined(__GNUC__) || defined(__clang__)
+#define RTA_CPU_TARGET(isa) __attribute__((target(isa)))
+#else
+#define RTA_CPU_TARGET(isa)
+#endif
+
+/**
+ * Instruction set levels, used as index into kernel function tables.
+ *
+ * x86 levels are cumulative: rta_cpu_avx2 implies rta_cpu_sse2, and
+ * rta_cpu_avx2 also requires FMA.
+ */
+typedef enum
+{
+  rta_cpu_generic = 0, /**< portable scalar code */
+  rta_cpu_sse2 = 1,    /**< x86 SSE2 */
+  rta_cpu_avx2 = 2,    /**< x86 AVX2 and FMA */
+  rta_cpu_avx512 = 3,  /**< x86 AVX-512F */
+  rta_cpu_neon = 4,    /**< ARM NEON (Advanced SIMD) */
+  rta_cpu_num_levels = 5
+} rta_cpu_level_t;
+
+/**
+ * Test support of \p level by the processor and the operating system.
+ * Detection runs once, on first call.
+ *
+ * @return 1 if supported, 0 otherwise
+ */
+int rta_cpu_has(const rta_cpu_level_t level);
+
+/**
+ * Get the level kernels should dispatch to: the best detected level,
+ * unless forced lower by the environment variable RTA_CPU_LEVEL (one
+ * of "generic", "sse2", "avx2", "avx512", "neon") or by
+ * rta_cpu_set_level(). A forced level that is not supported falls
+ * back to the best supported level below it.
+ *
+ * This is cheap to call for each kernel invocation, and safe to call
+ * from several threads, including the first calls.
+ */
+rta_cpu_level_t rta_cpu_get_level(void);
+
+/**
+ * Force the dispatch level for testing and benchmarking.
+ *
+ * @param level to force, or rta_cpu_num_levels to return to the
+ * detected (or environment) level
+ *
+ * @return the effective level
+ */
+rta_cpu_level_t rta_cpu_set_level(const rta_cpu_level_t level);
+
+/**
+ * Get the name of \p level, as accepted by RTA_CPU_LEVEL.
+ */
+const char * rta_cpu_level_name(const rta_cpu_level_t level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_CPU_H_ */
@@ -0,0 +1,408 @@
+/**
+ * @file   rta_executor.c
+ * @ingroup rta_util
+ *
+ * @brief  Offload of processing stages from a real-time thread to worker threads.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_executor.h"
+#include "rta_ringbuffer.h"
+#include "rta_thread.h"
+#include "rta_trace.h" /* rta_trace_thread_deinit */
+#include "rta_stdlib.h" /* rta_zalloc, rta_free */
+
+#include <string.h> /* memcpy, memset */
+#include <time.h> /* clock_gettime */
+
+/* records are queued after their submission time */
+#define HEADER_SIZE sizeof(double)
+
+typedef struct executor_stage
+{
+  rta_executor_function_t function;
+  void * context;
+  int worker;
+  unsigned int record_size;
+  double deadline_ns;
+  rta_ringbuffer_t queue;
+  char * submit_element;        /* producer side copy of header and record */
+  char * process_element;       /* consumer side */
+
+  /* written by the producer */
+  unsigned long submitted;
+  unsigned long dropped;
+
+  /* written by the worker */
+  unsigned long processed;
+  unsigned long late;
+  double total_latency_ns;
+  double max_latency_ns;
+  double total_process_ns;
+  double max_process_ns;
+} executor_stage_t;
+
+typedef struct executor_worker
+{
+  rta_executor_t * executor;
+  int index;
+  rta_thread_t thread;
+  rta_semaphore_t wakeup;
+} executor_worker_t;
+
+struct rta_executor
+{
+  int num_workers;
+  executor_worker_t * workers;
+  int max_stages;
+  int num_stages;
+  executor_stage_t * stages;
+  int running;
+};
+
+
+static double
+monotonic_ns(void)
+{
+  struct timespec ts;
+#if defined(_MSC_VER)
+  timespec_get(&ts, TIME_UTC);
+#else
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+  return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+/* process all queued records of the stages of a worker,
+   return number of records processed */
+static int
+worker_drain(executor_worker_t * worker)
+{
+  rta_executor_t * executor = worker->executor;
+  int count = 0;
+  int s;
+
+  for(s = 0; s < executor->num_stages; s++)
+  {
+    executor_stage_t * stage = &executor->stages[s];
+
+    if(stage->worker != worker->index)
+    {
+      continue;
+    }
+
+    while(rta_ringbuffer_pop(&stage->queue, stage->process_element, 1))
+    {
+      double submit_ns, start_ns, end_ns, latency_ns;
+
+      memcpy(&submit_ns, stage->process_element, sizeof(double));
+
+      start_ns = monotonic_ns();
+      stage->function(stage->context, stage->process_element + HEADER_SIZE);
+      end_ns = monotonic_ns();
+
+      latency_ns = end_ns - submit_ns;
+      stage->total_latency_ns += latency_ns;
+      stage->total_process_ns += end_ns - start_ns;
+      if(latency_ns > stage->max_latency_ns)
+      {
+        stage->max_latency_ns = latency_ns;
+      }
+      if(end_ns - start_ns > stage->max_process_ns)
+      {
+        stage->max_process_ns = end_ns - start_ns;
+      }
+      if(stage->deadline_ns > 0 && latency_ns > stage->deadline_ns)
+      {
+        stage->late++;
+      }
+      stage->processed++;
+      count++;
+    }
+  }
+
+  return count;
+}
+
+static void
+worker_main(void * arg)
+{
+  executor_worker_t * worker = (executor_worker_t *) arg;
+
+  while(1)
+  {
+    rta_semaphore_wait(&worker->wakeup);
+
+    if(rta_atomic_load(&worker->executor->running) == 0)
+    {
+      /* process the records submitted before the stop request */
+      while(worker_drain(worker) > 0)
+        ;
+      break;
+    }
+
+    worker_drain(worker);
+  }
+
+  rta_trace_thread_deinit();
+}
+
+
+int
+rta_executor_new(rta_executor_t ** executor, const int num_workers,
+                 const int max_stages)
+{
+  rta_executor_t * self = (rta_executor_t *) rta_zalloc(sizeof(rta_executor_t));
+  int w;
+
+  *executor = self;
+
+  if(self == NULL)
+  {
+    return 0;
+  }
+
+  self->num_workers = num_workers > 0 ? num_workers :
+    (rta_thread_num_processors() > 1 ? rta_thread_num_processors() - 1 : 1);
+  self->max_stages = max_stages;
+  self->workers = (executor_worker_t *)
+    rta_zalloc(self->num_workers * sizeof(executor_worker_t));
+  self->stages = (executor_stage_t *)
+    rta_zalloc(max_stages * sizeof(executor_stage_t));
+
+  if(self->workers == NULL || self->stages == NULL)
+  {
+    rta_free(self->workers);
+    rta_free(self->stages);
+    rta_free(self);
+    *executor = NULL;
+    return 0;
+  }
+
+  for(w = 0; w < self->num_workers; w++)
+  {
+    self->workers[w].executor = self;
+    self->workers[w].index = w;
+  }
+
+  return 1;
+}
+
+void
+rta_executor_delete(rta_executor_t * executor)
+{
+  int s;
+
+  if(executor == NULL)
+  {
+    return;
+  }
+
+  rta_executor_stop(executor);
+
+  for(s = 0; s < executor->num_stages; s++)
+  {
+    rta_ringbuffer_deinit(&executor->stages[s].queue);
+    rta_free(executor->stages[s].submit_element);
+    rta_free(executor->stages[s].process_element);
+  }
+
+  rta_free(executor->stages);
+  rta_free(executor->workers);
+  rta_free(executor);
+}
+
+int
+rta_executor_add_stage(rta_executor_t * executor,
+                       rta_executor_function_t function, void * context,
+                       const unsigned int record_size,
+                       const unsigned int capacity,
+                       const double deadline_ms)
+{
+  /* keep the records aligned for doubles in the queue */
+  const unsigned int element_size = (unsigned int) HEADER_SIZE +
+    ((record_size + sizeof(double) - 1) & ~(sizeof(double) - 1));
+  executor_stage_t * stage;
+
+  if(executor->running || executor->num_stages >= executor->max_stages)
+  {
+    return -1;
+  }
+
+  stage = &executor->stages[executor->num_stages];
+  memset(stage, 0, sizeof(executor_stage_t));
+  stage->function = function;
+  stage->context = context;
+  stage->worker = executor->num_stages % executor->num_workers;
+  stage->record_size = record_size;
+  stage->deadline_ns = deadline_ms * 1e6;
+  stage->submit_element = (char *) rta_zalloc(element_size);
+  stage->process_element = (char *) rta_zalloc(element_size);
+
+  if(stage->submit_element == NULL || stage->process_element == NULL ||
+     rta_ringbuffer_init(&stage->queue, capacity, element_size) == 0)
+  {
+    rta_free(stage->submit_element);
+    rta_free(stage->process_element);
+    return -1;
+  }
+
+  return executor->num_stages++;
+}
+
+int
+rta_executor_start(rta_executor_t * executor)
+{
+  int w;
+
+  if(executor->running)
+  {
+    return 1;
+  }
+
+  executor->running = 1;
+
+  for(w = 0; w < executor->num_workers; w++)
+  {
+    executor_worker_t * worker = &executor->workers[w];
+
+    if(rta_semaphore_init(&worker->wakeup, 0) == 0)
+    {
+      break;
+    }
+
+    if(rta_thread_create(&worker->thread, worker_main, worker) == 0)
+    {
+      rta_semaphore_deinit(&worker->wakeup);
+      break;
+    }
+  }
+
+  if(w < executor->num_workers)
+  {
+    /* stop the workers started so far */
+    const int started = w;
+
+    rta_atomic_store(&executor->running, 0);
+    for(w = 0; w < started; w++)
+    {
+      rta_semaphore_post(&executor->workers[w].wakeup);
+      rta_thread_join(executor->workers[w].thread);
+      rta_semaphore_deinit(&executor->workers[w].wakeup);
+    }
+
+    return 0;
+  }
+
+  return 1;
+}
+
+void
+rta_executor_stop(rta_executor_t * executor)
+{
+  int w;
+
+  if(executor->running == 0)
+  {
+    return;
+  }
+
+  rta_atomic_store(&executor->running, 0);
+
+  for(w = 0; w < executor->num_workers; w++)
+  {
+    rta_semaphore_post(&executor->workers[w].wakeup);
+  }
+
+  for(w = 0; w < executor->num_workers; w++)
+  {
+    rta_thread_join(executor->workers[w].thread);
+    rta_semaphore_deinit(&executor->workers[w].wakeup);
+  }
+}
+
+int
+rta_executor_submit(rta_executor_t * executor, const int stage_index,
+                    const void * record)
+{
+  executor_stage_t * stage = &executor->stages[stage_index];
+  const double now = monotonic_ns();
+
+  memcpy(stage->submit_element, &now, sizeof(double));
+  memcpy(stage->submit_element + HEADER_SIZE, record, stage->record_size);
+
+  if(rta_ringbuffer_push(&stage->queue, stage->submit_element, 1) == 0)
+  {
+    stage->dropped++;
+    return 0;
+  }
+
+  stage->submitted++;
+  rta_semaphore_post(&executor->workers[stage->worker].wakeup);
+
+  return 1;
+}
+
+void
+rta_executor_get_stats(rta_executor_t * executor, const int stage_index,
+                       rta_executor_stats_t * stats)
+{
+  const executor_stage_t * stage = &executor->stages[stage_index];
+  const unsigned long processed = stage->processed;
+
+  stats->submitted = stage->submitted;
+  stats->dropped = stage->dropped;
+  stats->processed = processed;
+  stats->late = stage->late;
+  stats->mean_latency_ms = processed > 0 ?
+    stage->total_latency_ns / processed * 1e-6 : 0;
+  stats->max_latency_ms = stage->max_latency_ns * 1e-6;
+  stats->mean_process_ms = processed > 0 ?
+    stage->total_process_ns / processed * 1e-6 : 0;
+  stats->max_process_ms = stage->max_process_ns * 1e-6;
+}
+
+void
+rta_executor_reset_stats(rta_executor_t * executor)
+{
+  int s;
+
+  for(s = 0; s < executor->num_stages; s++)
+  {
+    executor_stage_t * stage = &executor->stages[s];
+
+    stage->submitted = stage->dropped = 0;
+    stage->processed = stage->late = 0;
+    stage->total_latency_ns = stage->max_latency_ns = 0;
+    stage->total_process_ns = stage->max_process_ns = 0;
+  }
+}
@@ -0,0 +1,157 @@
+/**
+ * @file   rta_executor.h
+ * @ingroup rta_util
+ *
+ * @brief  Offload of processing stages from a real-time thread to worker threads.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_EXECUTOR_H_
+#define _RTA_EXECUTOR_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * An executor runs processing stages (psy analysis, kd-tree search,
+ * MFCC of a block...) on worker threads, fed from a real-time thread.
+ *
+ * Each stage has a function and a record size. The real-time thread
+ * submits records with rta_executor_submit(), which copies the record
+ * into the stage's wait-free ring buffer (see rta_ringbuffer.h) and
+ * wakes the stage's worker. Each stage runs on one worker, in
+ * submission order, so stage functions need not be reentrant. Results
+ * go back through the stage's context, typically into another
+ * rta_ringbuffer_t read by the real-time thread.
+ *
+ * For each stage the executor measures the latency from submission
+ * to the end of processing, and counts the records that exceed the
+ * stage's deadline or were dropped because its queue was full.
+ *
+ * Usage: rta_executor_new(), rta_executor_add_stage() for each stage,
+ * rta_executor_start(), then rta_executor_submit() from one producer
+ * thread per stage, and finally rta_executor_delete().
+ */
+typedef struct rta_executor rta_executor_t;
+
+/** stage function, called on a worker thread for each record */
+typedef void (*rta_executor_function_t) (void * context, void * record);
+
+/** statistics of a stage, read without synchronisation while running */
+typedef struct rta_executor_stats
+{
+  unsigned long submitted;  /**< records accepted by rta_executor_submit() */
+  unsigned long dropped;    /**< records refused, queue full */
+  unsigned long processed;  /**< records processed */
+  unsigned long late;       /**< records processed after the deadline */
+  double mean_latency_ms;   /**< from submission to end of processing */
+  double max_latency_ms;
+  double mean_process_ms;   /**< time spent in the stage function */
+  double max_process_ms;
+} rta_executor_stats_t;
+
+/**
+ * Allocate an executor. The worker threads start with
+ * rta_executor_start().
+ *
+ * @param executor is a pointer to the executor to allocate
+ * @param num_workers number of worker threads, 0 for one less than
+ * the number of processors (at least 1)
+ * @param max_stages maximum number of stages
+ *
+ * @return 1 on success 0 on fail
+ */
+int rta_executor_new(rta_executor_t ** executor, const int num_workers,
+                     const int max_stages);
+
+/** stop the executor if running and free it */
+void rta_executor_delete(rta_executor_t * executor);
+
+/**
+ * Add a stage, before rta_executor_start(). Stages are assigned to
+ * the workers in turn.
+ *
+ * @param executor
+ * @param function called for each record
+ * @param context passed to \p function
+ * @param record_size in bytes
+ * @param capacity number of records that can wait in the queue
+ * @param deadline_ms records processed later than this after their
+ * submission are counted as late, 0 for no deadline
+ *
+ * @return stage index, or -1 on fail
+ */
+int rta_executor_add_stage(rta_executor_t * executor,
+                           rta_executor_function_t function, void * context,
+                           const unsigned int record_size,
+                           const unsigned int capacity,
+                           const double deadline_ms);
+
+/**
+ * Start the worker threads.
+ *
+ * @return 1 on success 0 on fail
+ */
+int rta_executor_start(rta_executor_t * executor);
+
+/**
+ * Stop the worker threads, after they processed the records already
+ * submitted. There must be no concurrent rta_executor_submit().
+ */
+void rta_executor_stop(rta_executor_t * executor);
+
+/**
+ * Submit a copy of \p record to \p stage. This is wait-free and does
+ * not allocate: it can be called from a real-time thread, but from
+ * only one thread at a time per stage.
+ *
+ * @return 1 on success, 0 if the stage queue is full (the record is
+ * dropped and counted)
+ */
+int rta_executor_submit(rta_executor_t * executor, const int stage,
+                        const void * record);
+
+/** get the statistics of \p stage */
+void rta_executor_get_stats(rta_executor_t * executor, const int stage,
+                            rta_executor_stats_t * stats);
+
+/** clear the statistics of all stages, while no record is submitted */
+void rta_executor_reset_stats(rta_executor_t * executor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_EXECUTOR_H_ */
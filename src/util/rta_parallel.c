@@ -0,0 +1,533 @@
+/**
+ * @file   rta_parallel.c
+ * @ingroup rta_util
+ *
+ * @brief  Work-stealing thread pool with parallel-for and reduce for the batch functions.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_parallel.h"
+#include "rta_thread.h"
+#include "rta_trace.h" /* rta_trace_thread_deinit */
+#include "rta_stdlib.h" /* rta_malloc, rta_free */
+
+#include <stdint.h>
+#include <stdlib.h> /* getenv, atoi */
+#include <string.h> /* memcpy */
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#  define RTA_PARALLEL_THREAD __declspec(thread)
+#else
+#  define RTA_PARALLEL_THREAD __thread
+#endif
+
+/* chunk range [lo, hi[ of a thread, packed as lo << 32 | hi so that
+   owner and thieves update it with one compare and swap */
+typedef struct chunk_range
+{
+  volatile uint64_t bounds;
+  char pad[64 - sizeof(uint64_t)];
+} chunk_range_t;
+
+typedef struct parallel_loop
+{
+  int n;
+  int num_chunks;
+  int num_threads;
+  rta_parallel_function_t function;
+  rta_parallel_reduce_function_t reduce;
+  char * partials;
+  size_t partial_size;
+  const void * identity;
+  void * context;
+  chunk_range_t ranges[RTA_PARALLEL_MAX_THREADS];
+} parallel_loop_t;
+
+typedef struct parallel_worker
+{
+  int index;
+  rta_thread_t thread;
+  rta_semaphore_t wakeup;
+} parallel_worker_t;
+
+/* settings: -1 until initialised from RTA_NUM_THREADS */
+static int num_threads_setting = -1;
+static rta_parallel_host_t host_function = NULL;
+static void * host_context = NULL;
+static int host_num_threads = 1;
+
+/* library pool, resized on the next loop after a change of setting */
+static int pool_busy = 0;
+static int pool_shutdown = 0;
+static int pool_num_workers = 0;
+static parallel_worker_t pool_workers[RTA_PARALLEL_MAX_THREADS - 1];
+static rta_semaphore_t pool_done;
+static parallel_loop_t * pool_loop = NULL;
+
+/* partial results of a reduction up to this size live on the stack */
+#define PARTIALS_STACK_SIZE 4096
+
+/* set while a thread runs a chunk: nested loops run serially */
+static RTA_PARALLEL_THREAD int in_parallel = 0;
+
+
+static uint64_t
+range_load(chunk_range_t * range)
+{
+#if defined(_MSC_VER)
+  _ReadWriteBarrier();
+  return range->bounds;
+#else
+  return __atomic_load_n(&range->bounds, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static int
+range_cas(chunk_range_t * range, uint64_t expected, uint64_t desired)
+{
+#if defined(_MSC_VER)
+  return (uint64_t) _InterlockedCompareExchange64(
+    (volatile __int64 *) &range->bounds, desired, expected) == expected;
+#else
+  return __atomic_compare_exchange_n(&range->bounds, &expected, desired, 0,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+#define range_pack(lo, hi) (((uint64_t) (lo) << 32) | (uint64_t) (hi))
+#define range_lo(bounds) ((int) ((bounds) >> 32))
+#define range_hi(bounds) ((int) ((bounds) & 0xffffffffu))
+
+static void
+run_chunk(parallel_loop_t * loop, const int chunk)
+{
+  /* boundaries depend only on n and num_chunks */
+  const int begin = (int) ((int64_t) chunk * loop->n / loop->num_chunks);
+  const int end = (int) ((int64_t) (chunk + 1) * loop->n / loop->num_chunks);
+
+  if(loop->reduce != NULL)
+  {
+    void * partial = loop->partials + chunk * loop->partial_size;
+
+    memcpy(partial, loop->identity, loop->partial_size);
+    loop->reduce(loop->context, begin, end, partial);
+  }
+  else
+  {
+    loop->function(loop->context, begin, end);
+  }
+}
+
+/* take chunks from the front of own range, then steal from the back
+   of the other ranges until all are empty */
+static void
+run_task(void * arg, int thread)
+{
+  parallel_loop_t * loop = (parallel_loop_t *) arg;
+  const int previous = in_parallel;
+  int victim, t;
+
+  in_parallel = 1;
+
+  for(t = 0; t < loop->num_threads; t++)
+  {
+    chunk_range_t * range;
+
+    victim = (thread + t) % loop->num_threads;
+    range = &loop->ranges[victim];
+
+    while(1)
+    {
+      const uint64_t bounds = range_load(range);
+      const int lo = range_lo(bounds);
+      const int hi = range_hi(bounds);
+
+      if(lo >= hi)
+      {
+        break;
+      }
+
+      if(victim == thread)
+      {
+        if(range_cas(range, bounds, range_pack(lo + 1, hi)))
+        {
+          run_chunk(loop, lo);
+        }
+      }
+      else
+      {
+        if(range_cas(range, bounds, range_pack(lo, hi - 1)))
+        {
+          run_chunk(loop, hi - 1);
+        }
+      }
+    }
+  }
+
+  in_parallel = previous;
+}
+
+
+static void
+worker_main(void * arg)
+{
+  parallel_worker_t * worker = (parallel_worker_t *) arg;
+
+  while(1)
+  {
+    rta_semaphore_wait(&worker->wakeup);
+
+    if(rta_atomic_load(&pool_shutdown))
+    {
+      break;
+    }
+
+    run_task(pool_loop, worker->index + 1);
+    rta_semaphore_post(&pool_done);
+  }
+
+  rta_trace_thread_deinit();
+}
+
+/* stop all workers, pool_busy held */
+static void
+pool_stop(void)
+{
+  int w;
+
+  if(pool_num_workers == 0)
+  {
+    return;
+  }
+
+  rta_atomic_store(&pool_shutdown, 1);
+  for(w = 0; w < pool_num_workers; w++)
+  {
+    rta_semaphore_post(&pool_workers[w].wakeup);
+  }
+  for(w = 0; w < pool_num_workers; w++)
+  {
+    rta_thread_join(pool_workers[w].thread);
+    rta_semaphore_deinit(&pool_workers[w].wakeup);
+  }
+  rta_semaphore_deinit(&pool_done);
+
+  pool_num_workers = 0;
+  rta_atomic_store(&pool_shutdown, 0);
+}
+
+/* (re)start num_workers workers, pool_busy held,
+   return number of workers running */
+static int
+pool_start(const int num_workers)
+{
+  int w;
+
+  if(num_workers == pool_num_workers)
+  {
+    return pool_num_workers;
+  }
+
+  pool_stop();
+
+  if(num_workers == 0 || rta_semaphore_init(&pool_done, 0) == 0)
+  {
+    return 0;
+  }
+
+  for(w = 0; w < num_workers; w++)
+  {
+    parallel_worker_t * worker = &pool_workers[w];
+
+    worker->index = w;
+    if(rta_semaphore_init(&worker->wakeup, 0) == 0)
+    {
+      break;
+    }
+    if(rta_thread_create(&worker->thread, worker_main, worker) == 0)
+    {
+      rta_semaphore_deinit(&worker->wakeup);
+      break;
+    }
+    pool_num_workers = w + 1;
+  }
+
+  if(pool_num_workers == 0)
+  {
+    rta_semaphore_deinit(&pool_done);
+  }
+
+  return pool_num_workers;
+}
+
+static int
+pool_try_acquire(void)
+{
+#if defined(_MSC_VER)
+  return _InterlockedCompareExchange((volatile long *) &pool_busy, 1, 0) == 0;
+#else
+  int expected = 0;
+  return __atomic_compare_exchange_n(&pool_busy, &expected, 1, 0,
+                                     __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+#endif
+}
+
+static void
+pool_release(void)
+{
+  rta_atomic_store(&pool_busy, 0);
+}
+
+/* distribute the chunks of loop on the threads and run it */
+static void
+run_loop(parallel_loop_t * loop)
+{
+  int num_threads = 1;
+  int acquired = 0;
+  int t;
+
+  if(in_parallel == 0)
+  {
+    if(host_function != NULL)
+    {
+      num_threads = host_num_threads;
+    }
+    else if(rta_parallel_get_num_threads() > 1 && pool_try_acquire())
+    {
+      acquired = 1;
+      num_threads = 1 + pool_start(rta_parallel_get_num_threads() - 1);
+    }
+  }
+
+  if(num_threads > loop->num_chunks)
+  {
+    num_threads = loop->num_chunks;
+  }
+  loop->num_threads = num_threads;
+
+  for(t = 0; t < num_threads; t++)
+  {
+    loop->ranges[t].bounds = range_pack((int64_t) t * loop->num_chunks / num_threads,
+                                        (int64_t) (t + 1) * loop->num_chunks / num_threads);
+  }
+
+  if(num_threads == 1)
+  {
+    run_task(loop, 0);
+  }
+  else if(host_function != NULL)
+  {
+    host_function(host_context, num_threads, run_task, loop);
+  }
+  else
+  {
+    /* wake as many workers as there are ranges beyond the caller's */
+    pool_loop = loop;
+    for(t = 0; t < num_threads - 1; t++)
+    {
+      rta_semaphore_post(&pool_workers[t].wakeup);
+    }
+
+    run_task(loop, 0);
+
+    for(t = 0; t < num_threads - 1; t++)
+    {
+      rta_semaphore_wait(&pool_done);
+    }
+  }
+
+  if(acquired)
+  {
+    pool_release();
+  }
+}
+
+
+int
+rta_parallel_set_num_threads(const int num_threads)
+{
+  int n = num_threads > 0 ? num_threads : rta_thread_num_processors();
+
+  if(n > RTA_PARALLEL_MAX_THREADS)
+  {
+    n = RTA_PARALLEL_MAX_THREADS;
+  }
+
+  num_threads_setting = n;
+  return n;
+}
+
+int
+rta_parallel_get_num_threads(void)
+{
+  if(num_threads_setting < 0)
+  {
+    const char * env = getenv("RTA_NUM_THREADS");
+
+    rta_parallel_set_num_threads(env != NULL ? atoi(env) : 1);
+  }
+
+  return host_function != NULL ? host_num_threads : num_threads_setting;
+}
+
+void
+rta_parallel_set_host(rta_parallel_host_t host, void * context,
+                      const int num_threads)
+{
+  host_function = host;
+  host_context = context;
+  host_num_threads = num_threads < 1 ? 1 :
+    (num_threads > RTA_PARALLEL_MAX_THREADS ? RTA_PARALLEL_MAX_THREADS : num_threads);
+}
+
+void
+rta_parallel_shutdown(void)
+{
+  while(pool_try_acquire() == 0)
+  {
+    rta_thread_yield();
+  }
+
+  pool_stop();
+  pool_release();
+}
+
+void
+rta_parallel_for(const int n, const int grain,
+                 rta_parallel_function_t function, void * context)
+{
+  const int g = grain > 0 ? grain : 1;
+  parallel_loop_t loop;
+
+  if(n <= g || in_parallel || rta_parallel_get_num_threads() <= 1)
+  {
+    if(n > 0)
+    {
+      function(context, 0, n);
+    }
+    return;
+  }
+
+  loop.n = n;
+  loop.num_chunks = (n + g - 1) / g;
+  if(loop.num_chunks > RTA_PARALLEL_MAX_CHUNKS)
+  {
+    loop.num_chunks = RTA_PARALLEL_MAX_CHUNKS;
+  }
+  loop.function = function;
+  loop.reduce = NULL;
+  loop.partials = NULL;
+  loop.context = context;
+
+  run_loop(&loop);
+}
+
+int
+rta_parallel_reduce(const int n, const int grain, const size_t partial_size,
+                    const void * identity,
+                    rta_parallel_reduce_function_t reduce,
+                    rta_parallel_combine_function_t combine,
+                    void * context, void * result)
+{
+  const int g = grain > 0 ? grain : 1;
+  union
+  {
+    char bytes[PARTIALS_STACK_SIZE];
+    double align_double;
+    int64_t align_int;
+    void * align_pointer;
+  } stack;
+  parallel_loop_t loop;
+  size_t size;
+  int serial;
+  int c;
+
+  memcpy(result, identity, partial_size);
+
+  if(n <= 0)
+  {
+    return 1;
+  }
+
+  /* same chunks whatever the number of threads, for identical results */
+  loop.n = n;
+  loop.num_chunks = (n + g - 1) / g;
+  if(loop.num_chunks > RTA_PARALLEL_MAX_CHUNKS)
+  {
+    loop.num_chunks = RTA_PARALLEL_MAX_CHUNKS;
+  }
+  loop.function = NULL;
+  loop.reduce = reduce;
+  loop.partial_size = partial_size;
+  loop.identity = identity;
+  loop.context = context;
+
+  /* serially, one partial result is reused for all chunks, so that the
+     default single thread does not allocate */
+  serial = in_parallel || rta_parallel_get_num_threads() <= 1;
+  size = (serial ? 1 : loop.num_chunks) * partial_size;
+  loop.partials = size <= sizeof(stack) ? stack.bytes : (char *) rta_malloc(size);
+
+  if(loop.partials == NULL)
+  {
+    return 0;
+  }
+
+  if(serial)
+  {
+    for(c = 0; c < loop.num_chunks; c++)
+    {
+      /* same boundaries as run_chunk */
+      memcpy(loop.partials, identity, partial_size);
+      reduce(context, (int) ((int64_t) c * n / loop.num_chunks),
+             (int) ((int64_t) (c + 1) * n / loop.num_chunks), loop.partials);
+      combine(context, result, loop.partials);
+    }
+  }
+  else
+  {
+    run_loop(&loop);
+
+    for(c = 0; c < loop.num_chunks; c++)
+    {
+      combine(context, result, loop.partials + c * partial_size);
+    }
+  }
+
+  if(loop.partials != stack.bytes)
+  {
+    rta_free(loop.partials);
+  }
+
+  return 1;
+}
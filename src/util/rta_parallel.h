@@ -0,0 +1,175 @@
+/**
+ * @file   rta_parallel.h
+ * @ingroup rta_util
+ *
+ * @brief  Work-stealing thread pool with parallel-for and reduce for the batch functions.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_PARALLEL_H_
+#define _RTA_PARALLEL_H_ 1
+
+#include "rta.h"
+#include <stddef.h> /* size_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Parallel loops for the batch functions of the library (kd-tree
+ * build, Mahalanobis distances, DTW score matrix, mass updates of
+ * rta_msdr).
+ *
+ * A loop of n iterations is cut into chunks of at least \p grain
+ * iterations. The chunk boundaries depend only on n and grain, never
+ * on the number of threads, and reductions combine the chunk results
+ * in chunk order: results are identical with 1 or any number of
+ * threads.
+ *
+ * Each thread starts with a contiguous range of chunks, and steals
+ * chunks from the end of the ranges of the others when done.
+ *
+ * Parallelism is off by default, so that functions called on a
+ * real-time thread don't wake other threads: call
+ * rta_parallel_set_num_threads(), or set the environment variable
+ * RTA_NUM_THREADS, to enable it. Alternatively, a host with its own
+ * thread pool can run the tasks with rta_parallel_set_host().
+ *
+ * Parallel loops nested in a parallel loop, and loops started while
+ * the pool is busy with another thread's loop, run on the calling
+ * thread.
+ */
+
+/** loop body: process iterations [begin, end[ */
+typedef void (*rta_parallel_function_t) (void * context, int begin, int end);
+
+/** reduction body: accumulate iterations [begin, end[ into \p partial,
+    which is initialised to the identity */
+typedef void (*rta_parallel_reduce_function_t) (void * context, int begin, int end,
+                                                void * partial);
+
+/** combine \p partial into \p accumulator */
+typedef void (*rta_parallel_combine_function_t) (void * context, void * accumulator,
+                                                 const void * partial);
+
+/** task of a host thread pool */
+typedef void (*rta_parallel_task_t) (void * arg, int task_index);
+
+/**
+ * Host thread pool: run \p task(arg, i) for i in [0, num_tasks[, in
+ * any order and on any threads, and return when all are done. The
+ * tasks do not wait for each other.
+ */
+typedef void (*rta_parallel_host_t) (void * host_context, int num_tasks,
+                                     rta_parallel_task_t task, void * arg);
+
+/** maximum number of chunks of a loop */
+#define RTA_PARALLEL_MAX_CHUNKS 1024
+
+/** maximum number of threads, including the calling thread */
+#define RTA_PARALLEL_MAX_THREADS 64
+
+/** amount of work (roughly, multiply-adds) below which waking other
+    threads costs more than it gains */
+#define RTA_PARALLEL_MIN_WORK 16384
+
+/** grain for iterations of \p work multiply-adds each */
+#define rta_parallel_grain(work) \
+  ((work) > 0 && (work) < RTA_PARALLEL_MIN_WORK ? \
+   (int) (RTA_PARALLEL_MIN_WORK / (work)) : 1)
+
+/**
+ * Set the number of threads of parallel loops, including the calling
+ * thread. 1 runs all loops serially (default), 0 uses all processors.
+ * The worker threads are started on the next parallel loop.
+ *
+ * @return the effective number of threads
+ */
+int rta_parallel_set_num_threads(const int num_threads);
+
+/** @return the number of threads of parallel loops */
+int rta_parallel_get_num_threads(void);
+
+/**
+ * Run parallel loops on a host thread pool, with \p num_threads
+ * tasks per loop, instead of the library's threads.
+ *
+ * @param host run function, NULL to go back to the library's threads
+ * @param host_context passed to \p host
+ * @param num_threads number of tasks per loop (threads of the host
+ * pool), at most RTA_PARALLEL_MAX_THREADS
+ */
+void rta_parallel_set_host(rta_parallel_host_t host, void * host_context,
+                           const int num_threads);
+
+/** stop the library's worker threads, e.g. before unloading */
+void rta_parallel_shutdown(void);
+
+/**
+ * Run \p function over [0, \p n[ in chunks of at least \p grain
+ * iterations. Loops of \p grain iterations or less run directly on
+ * the calling thread.
+ */
+void rta_parallel_for(const int n, const int grain,
+                      rta_parallel_function_t function, void * context);
+
+/**
+ * Reduce over [0, \p n[ in chunks of at least \p grain iterations.
+ *
+ * @param n number of iterations
+ * @param grain minimum number of iterations per chunk
+ * @param partial_size size of a partial result in bytes
+ * @param identity initial value of each partial result, and of \p result
+ * @param reduce accumulates a chunk into a partial result
+ * @param combine accumulates partial results into \p result, in chunk order
+ * @param context passed to \p reduce and \p combine
+ * @param result out: combined result
+ *
+ * Partial results of up to 4 KB in all live on the stack, and a
+ * single thread reuses one partial result for all chunks: only large
+ * parallel reductions allocate.
+ *
+ * @return 1 on success, 0 if the partial results could not be
+ * allocated (\p result is then the identity)
+ */
+int rta_parallel_reduce(const int n, const int grain, const size_t partial_size,
+                        const void * identity,
+                        rta_parallel_reduce_function_t reduce,
+                        rta_parallel_combine_function_t combine,
+                        void * context, void * result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_PARALLEL_H_ */
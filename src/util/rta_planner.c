@@ -0,0 +1,338 @@
+/**
+ * @file   rta_planner.c
+ * @ingroup rta_util
+ *
+ * @brief  Measuring planner choosing between kernel variants, with wisdom files.
+ *
+ * @see rta_planner.h
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_planner.h"
+#include "rta_cpu.h" /* rta_cpu_get_level, rta_cpu_level_name */
+#include "rta_thread.h" /* rta_atomic_store, rta_thread_yield */
+#include "rta_trace.h" /* rta_trace_now */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h> /* getenv */
+#include <string.h> /* strcmp, strlen, memcpy */
+
+#define WISDOM_MAGIC "rta-wisdom"
+#define WISDOM_VERSION 1
+
+typedef struct wisdom
+{
+  char problem[RTA_PLANNER_NAME_SIZE];
+  unsigned int size;
+  int level;                   /**< rta_cpu_level_t */
+  unsigned int candidate;
+} wisdom_t;
+
+static int mode_setting = -1;
+
+static wisdom_t wisdom[RTA_PLANNER_MAX_WISDOM];
+static int wisdom_size = 0;
+static int wisdom_busy = 0;
+
+/* setup functions are not real-time: spin on the wisdom, yielding */
+static void
+wisdom_lock(void)
+{
+#if defined(_MSC_VER)
+  while(_InterlockedCompareExchange((volatile long *) &wisdom_busy, 1, 0) != 0)
+  {
+    rta_thread_yield();
+  }
+#else
+  int expected = 0;
+
+  while(! __atomic_compare_exchange_n(&wisdom_busy, &expected, 1, 0,
+                                      __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+  {
+    expected = 0;
+    rta_thread_yield();
+  }
+#endif
+}
+
+static void
+wisdom_unlock(void)
+{
+  rta_atomic_store(&wisdom_busy, 0);
+}
+
+/* index of a choice in the wisdom, or -1; the wisdom is locked */
+static int
+wisdom_index(const char * problem, const unsigned int size, const int level)
+{
+  int w;
+
+  for(w=0; w<wisdom_size; w++)
+  {
+    if(wisdom[w].size == size && wisdom[w].level == level
+       && strcmp(wisdom[w].problem, problem) == 0)
+    {
+      return w;
+    }
+  }
+
+  return -1;
+}
+
+/* add or replace a choice; the wisdom is locked. When it is full, the
+   choice is not kept, and will be made again. */
+static void
+wisdom_add(const char * problem, const unsigned int size, const int level,
+           const unsigned int candidate)
+{
+  const size_t length = strlen(problem);
+  int w = wisdom_index(problem, size, level);
+
+  if(w < 0)
+  {
+    if(wisdom_size == RTA_PLANNER_MAX_WISDOM || length >= RTA_PLANNER_NAME_SIZE)
+    {
+      return;
+    }
+
+    w = wisdom_size++;
+    memcpy(wisdom[w].problem, problem, length + 1);
+    wisdom[w].size = size;
+    wisdom[w].level = level;
+  }
+
+  wisdom[w].candidate = candidate;
+}
+
+/* fastest candidate: best time of each over the repeats, the
+   candidates interleaved so that a slow period hits them all */
+static unsigned int
+measure(const unsigned int num_candidates, rta_planner_run_t run, void * context)
+{
+  uint64_t best[RTA_PLANNER_MAX_CANDIDATES];
+  unsigned int c, r, fastest = 0;
+
+  for(c=0; c<num_candidates; c++)
+  {
+    run(context, c);
+    best[c] = UINT64_MAX;
+  }
+
+  for(r=0; r<RTA_PLANNER_REPEATS; r++)
+  {
+    for(c=0; c<num_candidates; c++)
+    {
+      const uint64_t start = rta_trace_now();
+      uint64_t elapsed;
+
+      run(context, c);
+      elapsed = rta_trace_now() - start;
+
+      if(elapsed < best[c])
+      {
+        best[c] = elapsed;
+      }
+    }
+  }
+
+  for(c=1; c<num_candidates; c++)
+  {
+    if(best[c] < best[fastest])
+    {
+      fastest = c;
+    }
+  }
+
+  return fastest;
+}
+
+void
+rta_planner_set_mode(const rta_planner_mode_t mode)
+{
+  rta_atomic_store(&mode_setting, (int) mode);
+}
+
+rta_planner_mode_t
+rta_planner_get_mode(void)
+{
+  int mode = rta_atomic_load(&mode_setting);
+
+  if(mode < 0)
+  {
+    const char * env = getenv("RTA_PLANNER");
+
+    mode = env != NULL && strcmp(env, "measure") == 0
+      ? rta_planner_measure : rta_planner_estimate;
+    rta_atomic_store(&mode_setting, mode);
+  }
+
+  return (rta_planner_mode_t) mode;
+}
+
+unsigned int
+rta_planner_choose(const char * problem, const unsigned int size,
+                   const unsigned int num_candidates,
+                   const unsigned int heuristic,
+                   rta_planner_run_t run, void * context)
+{
+  const unsigned int candidates = num_candidates < RTA_PLANNER_MAX_CANDIDATES
+    ? num_candidates : RTA_PLANNER_MAX_CANDIDATES;
+  const int level = (int) rta_cpu_get_level();
+  const int found = rta_planner_wisdom_find(problem, size);
+  unsigned int fastest;
+
+  if(found >= 0 && (unsigned int) found < candidates)
+  {
+    return (unsigned int) found;
+  }
+
+  if(candidates < 2 || run == NULL || rta_planner_get_mode() != rta_planner_measure)
+  {
+    return heuristic < candidates ? heuristic : 0;
+  }
+
+  /* not locked while measuring: another thread planning the same
+     problem measures it too, and one of the results is kept */
+  fastest = measure(candidates, run, context);
+
+  wisdom_lock();
+  wisdom_add(problem, size, level, fastest);
+  wisdom_unlock();
+
+  return fastest;
+}
+
+int
+rta_planner_wisdom_find(const char * problem, const unsigned int size)
+{
+  int w, candidate = -1;
+
+  wisdom_lock();
+  w = wisdom_index(problem, size, (int) rta_cpu_get_level());
+  if(w >= 0)
+  {
+    candidate = (int) wisdom[w].candidate;
+  }
+  wisdom_unlock();
+
+  return candidate;
+}
+
+void
+rta_planner_wisdom_add(const char * problem, const unsigned int size,
+                       const unsigned int candidate)
+{
+  wisdom_lock();
+  wisdom_add(problem, size, (int) rta_cpu_get_level(), candidate);
+  wisdom_unlock();
+}
+
+int
+rta_planner_wisdom_export(const char * path)
+{
+  FILE * file = fopen(path, "w");
+  int w, ok;
+
+  if(file == NULL)
+  {
+    return 0;
+  }
+
+  wisdom_lock();
+  ok = fprintf(file, "%s %d\n", WISDOM_MAGIC, WISDOM_VERSION) > 0;
+  for(w=0; w<wisdom_size && ok; w++)
+  {
+    ok = fprintf(file, "%s %u %s %u\n", wisdom[w].problem, wisdom[w].size,
+                 rta_cpu_level_name((rta_cpu_level_t) wisdom[w].level),
+                 wisdom[w].candidate) > 0;
+  }
+  wisdom_unlock();
+
+  return (fclose(file) == 0) && ok;
+}
+
+int
+rta_planner_wisdom_import(const char * path)
+{
+  FILE * file = fopen(path, "r");
+  char line[128], magic[16];
+  int version;
+
+  if(file == NULL)
+  {
+    return 0;
+  }
+
+  if(fgets(line, sizeof(line), file) == NULL
+     || sscanf(line, "%15s %d", magic, &version) != 2
+     || strcmp(magic, WISDOM_MAGIC) != 0 || version != WISDOM_VERSION)
+  {
+    fclose(file);
+    return 0;
+  }
+
+  wisdom_lock();
+  while(fgets(line, sizeof(line), file) != NULL)
+  {
+    char problem[RTA_PLANNER_NAME_SIZE], level_name[16];
+    unsigned int size, candidate;
+    int level;
+
+    if(sscanf(line, "%31s %u %15s %u", problem, &size, level_name, &candidate) != 4
+       || candidate >= RTA_PLANNER_MAX_CANDIDATES)
+    {
+      continue;
+    }
+
+    for(level=0; level<rta_cpu_num_levels; level++)
+    {
+      if(strcmp(level_name, rta_cpu_level_name((rta_cpu_level_t) level)) == 0)
+      {
+        wisdom_add(problem, size, level, candidate);
+        break;
+      }
+    }
+  }
+  wisdom_unlock();
+
+  fclose(file);
+  return 1;
+}
+
+void
+rta_planner_wisdom_forget(void)
+{
+  wisdom_lock();
+  wisdom_size = 0;
+  wisdom_unlock();
+}
@@ -0,0 +1,161 @@
+/**
+ * @file   rta_planner.h
+ * @ingroup rta_util
+ *
+ * @brief  Measuring planner choosing between kernel variants, with wisdom files.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_PLANNER_H_
+#define _RTA_PLANNER_H_ 1
+
+#include "rta.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Some setup functions have several implementations of the same
+ * transform, whose relative speed depends on the size and on the
+ * processor (rta_fft_setup_new and the other FFT setups choose
+ * between radix-2 and radix-4 passes). They ask the planner which
+ * candidate to use for a problem: a name and a size.
+ *
+ * The choice is taken, in order:
+ * - from the wisdom: the choices made before for the same problem at
+ *   the same dispatch level (rta_cpu.h), measured in this process or
+ *   imported from a wisdom file;
+ * - in rta_planner_measure mode, by timing each candidate once, at
+ *   setup time, and keeping the fastest one in the wisdom;
+ * - otherwise, by the heuristic of the setup function.
+ *
+ * Measuring is off by default, so that setups stay deterministic and
+ * quick: call rta_planner_set_mode(), or set the environment variable
+ * RTA_PLANNER to "measure", to enable it. The results do not depend
+ * on the choice, up to rounding errors.
+ *
+ * Wisdom files are text, one choice per line:
+ * "<problem> <size> <dispatch level name> <candidate>", after a
+ * "rta-wisdom <version>" line.
+ *
+ * All functions may be called from several threads, but not from a
+ * real-time thread: measuring runs the candidates, and the wisdom is
+ * locked.
+ */
+
+typedef enum
+{
+  rta_planner_estimate = 0, /**< wisdom, or heuristic */
+  rta_planner_measure = 1   /**< wisdom, or timing of the candidates */
+} rta_planner_mode_t;
+
+/** maximum number of choices in the wisdom */
+#define RTA_PLANNER_MAX_WISDOM 256
+
+/** maximum length of a problem name */
+#define RTA_PLANNER_NAME_SIZE 32
+
+/** maximum number of candidates of a problem */
+#define RTA_PLANNER_MAX_CANDIDATES 8
+
+/** timed runs of each candidate, after one to warm up */
+#define RTA_PLANNER_REPEATS 8
+
+/** run \p candidate once on the problem described by \p context */
+typedef void (*rta_planner_run_t) (void * context, const unsigned int candidate);
+
+/** set the mode of the following choices */
+void rta_planner_set_mode(const rta_planner_mode_t mode);
+
+/** @return the current mode, from RTA_PLANNER if not set */
+rta_planner_mode_t rta_planner_get_mode(void);
+
+/**
+ * Choose the candidate implementation for a problem
+ *
+ * @param problem names the transform and its variant, without spaces
+ * @param size of the problem
+ * @param num_candidates run by \p run, from 0, at most
+ * RTA_PLANNER_MAX_CANDIDATES
+ * @param heuristic is the candidate used when there is no wisdom and
+ * measuring is off
+ * @param run runs one candidate, on buffers that \p context owns (the
+ * setup's own buffers or scratch ones)
+ * @param context of \p run
+ *
+ * @return the candidate, < num_candidates
+ */
+unsigned int rta_planner_choose(const char * problem, const unsigned int size,
+                                const unsigned int num_candidates,
+                                const unsigned int heuristic,
+                                rta_planner_run_t run, void * context);
+
+/**
+ * Look a problem up in the wisdom, at the current dispatch level
+ *
+ * @return the candidate, or -1 if there is none
+ */
+int rta_planner_wisdom_find(const char * problem, const unsigned int size);
+
+/**
+ * Set the choice for a problem at the current dispatch level, as if it
+ * had been measured: to force a candidate, or to restore wisdom kept
+ * by a host in another form
+ */
+void rta_planner_wisdom_add(const char * problem, const unsigned int size,
+                            const unsigned int candidate);
+
+/**
+ * Write the wisdom to a file, to be imported by later runs on the
+ * same machine
+ *
+ * @return 1 on success, 0 on failure (file)
+ */
+int rta_planner_wisdom_export(const char * path);
+
+/**
+ * Add the choices of a wisdom file to the wisdom, replacing the ones
+ * for the same problems. Lines of unknown dispatch levels are skipped.
+ *
+ * @return 1 on success, 0 on failure (file, or not a wisdom file)
+ */
+int rta_planner_wisdom_import(const char * path);
+
+/** forget all the choices */
+void rta_planner_wisdom_forget(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_PLANNER_H_ */
@@ -0,0 +1,94 @@
+/**
+ * @file   rta_precision.h
+ * @ingroup rta_util
+ *
+ * @brief  Float and double instances of the precision-generic kernels, side by side.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_PRECISION_H_
+#define _RTA_PRECISION_H_ 1
+
+/**
+ * rta_real_t is fixed per build by RTA_REAL_TYPE. The kernels listed
+ * in rta_precision_prototypes.h are additionally compiled in float
+ * and in double precision, whatever RTA_REAL_TYPE is, with the
+ * suffixes _f and _d: for example rta_window_apply_f() takes float
+ * vectors and rta_svd_d() double matrices, next to rta_window_apply()
+ * and rta_svd() in rta_real_t.
+ *
+ * A real-time feature extraction can thus use float kernels while SVD
+ * and statistics run in double in the same process. The arguments and
+ * semantics are those of the rta_real_t functions.
+ *
+ * The instances are rta_signal_float.c, rta_signal_double.c,
+ * rta_statistics_float.c and rta_statistics_double.c, which compile
+ * the module sources after rta_precision_instance.h.
+ */
+
+#include "rta.h"
+#include "rta_window.h"
+#include "rta_tables.h" /* rta_tables_real_t */
+#include "rta_correlation.h"
+#include "rta_preemphasis.h"
+#include "rta_delta.h"
+#include "rta_dct.h" /* rta_dct_t */
+#include "rta_lpc.h"
+#include "rta_mean_variance.h"
+#include "rta_moments.h"
+#include "rta_svd.h" /* rta_svd_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** private SVD setups of each precision */
+typedef struct rta_svd_setup_f rta_svd_setup_f_t;
+typedef struct rta_svd_setup_d rta_svd_setup_d_t;
+
+#define RTA_PREC_REAL float
+#define RTA_PREC(name) name ## _f
+#include "rta_precision_prototypes.h"
+#undef RTA_PREC_REAL
+#undef RTA_PREC
+
+#define RTA_PREC_REAL double
+#define RTA_PREC(name) name ## _d
+#include "rta_precision_prototypes.h"
+#undef RTA_PREC_REAL
+#undef RTA_PREC
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_PRECISION_H_ */
@@ -0,0 +1,289 @@
+/**
+ * @file   rta_precision_instance.h
+ * @ingroup rta_util
+ *
+ * @brief  Rebinding of rta_real_t for the float and double kernel instances.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* No include guard: this file is included once, at the top of an
+   instance source (see rta_precision.h), after defining RTA_PRECISION
+   as RTA_FLOAT_TYPE or RTA_DOUBLE_TYPE. It is not to be included by
+   users of the library.
+
+   The module headers are included first at the build precision, so
+   that their include guards are set. Then rta_real_t, RTA_REAL_TYPE,
+   the rta_math.h functions and the rta_float.h limits are redefined
+   for RTA_PRECISION, and the public function names are mapped to
+   their suffixed names. The module sources included afterwards thus
+   compile to the suffixed functions, whose definitions are checked
+   against the prototypes of rta_precision.h. */
+
+#include "rta_precision.h"
+#include "rta_math.h"
+#include "rta_float.h"
+
+#undef RTA_REAL_TYPE
+#define RTA_REAL_TYPE RTA_PRECISION
+
+#undef rta_real_t
+
+#if (RTA_PRECISION == RTA_FLOAT_TYPE)
+#define rta_real_t float
+#define RTA_PREC(name) name ## _f
+#elif (RTA_PRECISION == RTA_DOUBLE_TYPE)
+#define rta_real_t double
+#define RTA_PREC(name) name ## _d
+#else
+#error "RTA_PRECISION must be RTA_FLOAT_TYPE or RTA_DOUBLE_TYPE"
+#endif
+
+
+/* rta_math.h (Windows uses the double functions for all types) */
+
+#ifndef WIN32
+
+#undef rta_max
+#undef rta_min
+#undef rta_abs
+#undef rta_floor
+#undef rta_ceil
+#undef rta_round
+#undef rta_lround
+#undef rta_llround
+#undef rta_sqrt
+#undef rta_pow
+#undef rta_log
+#undef rta_log2
+#undef rta_log10
+#undef rta_log1p
+#undef rta_exp
+#undef rta_exp2
+#undef rta_expm1
+#undef rta_cos
+#undef rta_sin
+#undef rta_hypot
+
+#if (RTA_PRECISION == RTA_FLOAT_TYPE)
+
+#define rta_max fmaxf
+#define rta_min fminf
+#define rta_abs fabsf
+#define rta_floor floorf
+#define rta_ceil ceilf
+#define rta_round roundf
+#define rta_lround lroundf
+#define rta_llround llroundf
+#define rta_sqrt sqrtf
+#define rta_pow powf
+#define rta_log logf
+#define rta_log2 log2f
+#define rta_log10 log10f
+#define rta_log1p log1pf
+#define rta_exp expf
+#define rta_exp2 exp2f
+#define rta_expm1 expm1f
+#define rta_cos cosf
+#define rta_sin sinf
+#define rta_hypot hypotf
+
+#else
+
+#define rta_max fmax
+#define rta_min fmin
+#define rta_abs fabs
+#define rta_floor floor
+#define rta_ceil ceil
+#define rta_round round
+#define rta_lround lround
+#define rta_llround llround
+#define rta_sqrt sqrt
+#define rta_pow pow
+#define rta_log log
+#define rta_log2 log2
+#define rta_log10 log10
+#define rta_log1p log1p
+#define rta_exp exp
+#define rta_exp2 exp2
+#define rta_expm1 expm1
+#define rta_cos cos
+#define rta_sin sin
+#define rta_hypot hypot
+
+#endif
+#endif /* WIN32 */
+
+
+/* rta_float.h */
+
+#undef RTA_REAL_DIG
+#undef RTA_REAL_EPSILON
+#undef RTA_REAL_MANT_DIG
+#undef RTA_REAL_MAX
+#undef RTA_REAL_MAX_10_EXP
+#undef RTA_REAL_MAX_EXP
+#undef RTA_REAL_MIN
+#undef RTA_REAL_MIN_10_EXP
+#undef RTA_REAL_MIN_EXP
+
+#if (RTA_PRECISION == RTA_FLOAT_TYPE)
+
+#define RTA_REAL_DIG FLT_DIG
+#define RTA_REAL_EPSILON FLT_EPSILON
+#define RTA_REAL_MANT_DIG FLT_MANT_DIG
+#define RTA_REAL_MAX FLT_MAX
+#define RTA_REAL_MAX_10_EXP FLT_MAX_10_EXP
+#define RTA_REAL_MAX_EXP FLT_MAX_EXP
+#define RTA_REAL_MIN FLT_MIN
+#define RTA_REAL_MIN_10_EXP FLT_MIN_10_EXP
+#define RTA_REAL_MIN_EXP FLT_MIN_EXP
+
+#else
+
+#define RTA_REAL_DIG DBL_DIG
+#define RTA_REAL_EPSILON DBL_EPSILON
+#define RTA_REAL_MANT_DIG DBL_MANT_DIG
+#define RTA_REAL_MAX DBL_MAX
+#define RTA_REAL_MAX_10_EXP DBL_MAX_10_EXP
+#define RTA_REAL_MAX_EXP DBL_MAX_EXP
+#define RTA_REAL_MIN DBL_MIN
+#define RTA_REAL_MIN_10_EXP DBL_MIN_10_EXP
+#define RTA_REAL_MIN_EXP DBL_MIN_EXP
+
+#endif
+
+
+/* public names, keep in sync with rta_precision_prototypes.h */
+
+/* rta_window.c */
+#define rta_window_hann_weights RTA_PREC(rta_window_hann_weights)
+#define rta_window_hann_weights_stride RTA_PREC(rta_window_hann_weights_stride)
+#define rta_window_hann_apply_in_place RTA_PREC(rta_window_hann_apply_in_place)
+#define rta_window_hann_apply_in_place_stride RTA_PREC(rta_window_hann_apply_in_place_stride)
+#define rta_window_hamming_weights RTA_PREC(rta_window_hamming_weights)
+#define rta_window_hamming_weights_stride RTA_PREC(rta_window_hamming_weights_stride)
+#define rta_window_hamming_apply_in_place RTA_PREC(rta_window_hamming_apply_in_place)
+#define rta_window_hamming_apply_in_place_stride RTA_PREC(rta_window_hamming_apply_in_place_stride)
+#define rta_window_apply RTA_PREC(rta_window_apply)
+#define rta_window_apply_stride RTA_PREC(rta_window_apply_stride)
+#define rta_window_apply_in_place RTA_PREC(rta_window_apply_in_place)
+#define rta_window_apply_in_place_stride RTA_PREC(rta_window_apply_in_place_stride)
+#define rta_window_rounded_apply RTA_PREC(rta_window_rounded_apply)
+#define rta_window_rounded_apply_stride RTA_PREC(rta_window_rounded_apply_stride)
+#define rta_window_rounded_apply_in_place RTA_PREC(rta_window_rounded_apply_in_place)
+#define rta_window_rounded_apply_in_place_stride RTA_PREC(rta_window_rounded_apply_in_place_stride)
+
+/* rta_correlation.c */
+#define rta_correlation_fast RTA_PREC(rta_correlation_fast)
+#define rta_correlation_fast_stride RTA_PREC(rta_correlation_fast_stride)
+#define rta_correlation_raw RTA_PREC(rta_correlation_raw)
+#define rta_correlation_raw_stride RTA_PREC(rta_correlation_raw_stride)
+#define rta_correlation_unbiased RTA_PREC(rta_correlation_unbiased)
+#define rta_correlation_unbiased_stride RTA_PREC(rta_correlation_unbiased_stride)
+#define rta_correlation_fast_normalization_factor RTA_PREC(rta_correlation_fast_normalization_factor)
+#define rta_correlation_raw_normalization_factor RTA_PREC(rta_correlation_raw_normalization_factor)
+#define rta_correlation_fast_scaled RTA_PREC(rta_correlation_fast_scaled)
+#define rta_correlation_fast_scaled_stride RTA_PREC(rta_correlation_fast_scaled_stride)
+#define rta_correlation_raw_scaled RTA_PREC(rta_correlation_raw_scaled)
+#define rta_correlation_raw_scaled_stride RTA_PREC(rta_correlation_raw_scaled_stride)
+
+/* rta_preemphasis.c */
+#define rta_preemphasis_signal RTA_PREC(rta_preemphasis_signal)
+#define rta_preemphasis_signal_stride RTA_PREC(rta_preemphasis_signal_stride)
+
+/* rta_delta.c */
+#define rta_delta_weights RTA_PREC(rta_delta_weights)
+#define rta_delta_weights_stride RTA_PREC(rta_delta_weights_stride)
+#define rta_delta_normalization_factor RTA_PREC(rta_delta_normalization_factor)
+#define rta_delta RTA_PREC(rta_delta)
+#define rta_delta_stride RTA_PREC(rta_delta_stride)
+#define rta_delta_vector RTA_PREC(rta_delta_vector)
+#define rta_delta_vector_stride RTA_PREC(rta_delta_vector_stride)
+
+/* rta_dct.c */
+#define rta_dct_weights RTA_PREC(rta_dct_weights)
+#define rta_dct_weights_stride RTA_PREC(rta_dct_weights_stride)
+#define rta_dct RTA_PREC(rta_dct)
+#define rta_dct_scaled RTA_PREC(rta_dct_scaled)
+#define rta_dct_stride RTA_PREC(rta_dct_stride)
+#define rta_dct_stride_scaled RTA_PREC(rta_dct_stride_scaled)
+
+/* rta_lpc.c */
+#define rta_lpc RTA_PREC(rta_lpc)
+#define rta_lpc_stride RTA_PREC(rta_lpc_stride)
+#define rta_levinson RTA_PREC(rta_levinson)
+#define rta_levinson_stride RTA_PREC(rta_levinson_stride)
+
+/* rta_mean_variance.c */
+#define rta_mean_variance RTA_PREC(rta_mean_variance)
+#define rta_mean_variance_stride RTA_PREC(rta_mean_variance_stride)
+#define rta_mean_variance_unbiased RTA_PREC(rta_mean_variance_unbiased)
+#define rta_mean_variance_unbiased_stride RTA_PREC(rta_mean_variance_unbiased_stride)
+#define rta_mean RTA_PREC(rta_mean)
+#define rta_mean_stride RTA_PREC(rta_mean_stride)
+#define rta_variance RTA_PREC(rta_variance)
+#define rta_variance_stride RTA_PREC(rta_variance_stride)
+#define rta_variance_unbiased RTA_PREC(rta_variance_unbiased)
+#define rta_variance_unbiased_stride RTA_PREC(rta_variance_unbiased_stride)
+
+/* rta_moments.c */
+#define rta_weighted_moment_1_indexes RTA_PREC(rta_weighted_moment_1_indexes)
+#define rta_weighted_moment_1_indexes_stride RTA_PREC(rta_weighted_moment_1_indexes_stride)
+#define rta_weighted_moment_2_indexes RTA_PREC(rta_weighted_moment_2_indexes)
+#define rta_weighted_moment_2_indexes_stride RTA_PREC(rta_weighted_moment_2_indexes_stride)
+#define rta_weighted_moment_3_indexes RTA_PREC(rta_weighted_moment_3_indexes)
+#define rta_weighted_moment_3_indexes_stride RTA_PREC(rta_weighted_moment_3_indexes_stride)
+#define rta_std_weighted_moment_3_indexes RTA_PREC(rta_std_weighted_moment_3_indexes)
+#define rta_std_weighted_moment_3_indexes_stride RTA_PREC(rta_std_weighted_moment_3_indexes_stride)
+#define rta_weighted_moment_4_indexes RTA_PREC(rta_weighted_moment_4_indexes)
+#define rta_weighted_moment_4_indexes_stride RTA_PREC(rta_weighted_moment_4_indexes_stride)
+#define rta_std_weighted_moment_4_indexes RTA_PREC(rta_std_weighted_moment_4_indexes)
+#define rta_std_weighted_moment_4_indexes_stride RTA_PREC(rta_std_weighted_moment_4_indexes_stride)
+#define rta_weighted_moment_indexes RTA_PREC(rta_weighted_moment_indexes)
+#define rta_weighted_moment_indexes_stride RTA_PREC(rta_weighted_moment_indexes_stride)
+#define rta_std_weighted_moment_indexes RTA_PREC(rta_std_weighted_moment_indexes)
+#define rta_std_weighted_moment_indexes_stride RTA_PREC(rta_std_weighted_moment_indexes_stride)
+
+/* rta_svd.c */
+#define rta_svd_setup_new RTA_PREC(rta_svd_setup_new)
+#define rta_svd_setup_delete RTA_PREC(rta_svd_setup_delete)
+#define rta_svd RTA_PREC(rta_svd)
+#define rta_svd_stride RTA_PREC(rta_svd_stride)
+
+/* private setup structure */
+#define rta_svd_setup RTA_PREC(rta_svd_setup)
+
+#if (RTA_PRECISION == RTA_FLOAT_TYPE)
+#define rta_svd_setup_t rta_svd_setup_f_t
+#else
+#define rta_svd_setup_t rta_svd_setup_d_t
+#endif
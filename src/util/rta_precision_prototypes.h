@@ -0,0 +1,447 @@
+/**
+ * @file   rta_precision_prototypes.h
+ * @ingroup rta_util
+ *
+ * @brief  Prototypes of the precision-generic kernels, included once per precision.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* No include guard: this file is included by rta_precision.h once
+   per precision, with RTA_PREC_REAL defined as the real type and
+   RTA_PREC(name) appending the precision suffix. Each prototype is
+   the one of the rta_real_t function in the given module header. */
+
+/* rta_window.h */
+int
+RTA_PREC(rta_window_hann_weights)(RTA_PREC_REAL * weights_vector,
+  const unsigned int weights_size);
+
+int
+RTA_PREC(rta_window_hann_weights_stride)(RTA_PREC_REAL * weights_vector,
+  const int w_stride, const unsigned int weights_size);
+
+void
+RTA_PREC(rta_window_hann_apply_in_place)(RTA_PREC_REAL * input_vector,
+  const unsigned int input_size);
+
+void
+RTA_PREC(rta_window_hann_apply_in_place_stride)(RTA_PREC_REAL * input_vector,
+  const int i_stride, const unsigned int input_size);
+
+int
+RTA_PREC(rta_window_hamming_weights)(RTA_PREC_REAL * weights_vector,
+  const unsigned int weights_size, const RTA_PREC_REAL coef);
+
+int
+RTA_PREC(rta_window_hamming_weights_stride)(RTA_PREC_REAL * weights_vector,
+  const int w_stride, const unsigned int weights_size,
+  const RTA_PREC_REAL coef);
+
+void
+RTA_PREC(rta_window_hamming_apply_in_place)(RTA_PREC_REAL * input_vector,
+  const unsigned int input_size, const RTA_PREC_REAL coef);
+
+void
+RTA_PREC(rta_window_hamming_apply_in_place_stride)(RTA_PREC_REAL * input_vector,
+  const int i_stride, const unsigned int input_size,
+  const RTA_PREC_REAL coef);
+
+void
+RTA_PREC(rta_window_apply)(RTA_PREC_REAL * output_vector,
+  const unsigned int output_size, const RTA_PREC_REAL * input_vector,
+  const RTA_PREC_REAL * weights_vector);
+
+void
+RTA_PREC(rta_window_apply_stride)(RTA_PREC_REAL * output_vector,
+  const int o_stride, const unsigned int output_size,
+  const RTA_PREC_REAL * input_vector, const int i_stride,
+  const RTA_PREC_REAL * weights_vector, const int w_stride);
+
+void
+RTA_PREC(rta_window_apply_in_place)(RTA_PREC_REAL * input_vector,
+  const unsigned int input_size, const RTA_PREC_REAL * weights_vector);
+
+void
+RTA_PREC(rta_window_apply_in_place_stride)(RTA_PREC_REAL * input_vector,
+  const int i_stride, const unsigned int input_size,
+  const RTA_PREC_REAL * weights_vector, const int w_stride);
+
+void
+RTA_PREC(rta_window_rounded_apply)(RTA_PREC_REAL * output_vector,
+  const unsigned int output_size, const RTA_PREC_REAL * input_vector,
+  const RTA_PREC_REAL * weights_vector, const unsigned int weights_size);
+
+void
+RTA_PREC(rta_window_rounded_apply_stride)(RTA_PREC_REAL * output_vector,
+  const int o_stride, const unsigned int output_size,
+  const RTA_PREC_REAL * input_vector, const int i_stride,
+  const RTA_PREC_REAL * weights_vector, const int w_stride,
+  const unsigned int weights_size);
+
+void
+RTA_PREC(rta_window_rounded_apply_in_place)(RTA_PREC_REAL * input_vector,
+  const unsigned int input_size, const RTA_PREC_REAL * weights_vector,
+  const unsigned int weights_size);
+
+void
+RTA_PREC(rta_window_rounded_apply_in_place_stride)(RTA_PREC_REAL * input_vector,
+  const int i_stride, const unsigned int input_size,
+  const RTA_PREC_REAL * weights_vector, const int w_stride,
+  const unsigned int weights_size);
+
+
+/* rta_correlation.h */
+void
+RTA_PREC(rta_correlation_fast)(RTA_PREC_REAL * correlation,
+  const unsigned int c_size, const RTA_PREC_REAL * input_vector_a,
+  const RTA_PREC_REAL * input_vector_b, const unsigned int filter_size);
+
+void
+RTA_PREC(rta_correlation_fast_stride)(RTA_PREC_REAL * correlation,
+  const int c_stride, const unsigned int c_size,
+  const RTA_PREC_REAL * input_vector_a, const int a_stride,
+  const RTA_PREC_REAL * input_vector_b, const int b_stride,
+  const unsigned int filter_size);
+
+void
+RTA_PREC(rta_correlation_raw)(RTA_PREC_REAL * correlation,
+  const unsigned int c_size, const RTA_PREC_REAL * input_vector_a,
+  const RTA_PREC_REAL * input_vector_b, const unsigned int max_filter_size);
+
+void
+RTA_PREC(rta_correlation_raw_stride)(RTA_PREC_REAL * correlation,
+  const int c_stride, const unsigned int c_size,
+  const RTA_PREC_REAL * input_vector_a, const int a_stride,
+  const RTA_PREC_REAL * input_vector_b, const int b_stride,
+  const unsigned int max_filter_size);
+
+void
+RTA_PREC(rta_correlation_unbiased)(RTA_PREC_REAL * correlation,
+  const unsigned int c_size, const RTA_PREC_REAL * input_vector_a,
+  const RTA_PREC_REAL * input_vector_b, const unsigned int max_filter_size);
+
+void
+RTA_PREC(rta_correlation_unbiased_stride)(RTA_PREC_REAL * correlation,
+  const int c_stride, const unsigned int c_size,
+  const RTA_PREC_REAL * input_vector_a, const int a_stride,
+  const RTA_PREC_REAL * input_vector_b, const int b_stride,
+  const unsigned int max_filter_size);
+
+RTA_PREC_REAL
+RTA_PREC(rta_correlation_fast_normalization_factor)(const unsigned int filter_size);
+
+RTA_PREC_REAL
+RTA_PREC(rta_correlation_raw_normalization_factor)(const unsigned int max_filter_size);
+
+void
+RTA_PREC(rta_correlation_fast_scaled)(RTA_PREC_REAL * correlation,
+  const unsigned int c_size, const RTA_PREC_REAL * input_vector_a,
+  const RTA_PREC_REAL * input_vector_b, const unsigned int filter_size,
+  const RTA_PREC_REAL scale);
+
+void
+RTA_PREC(rta_correlation_fast_scaled_stride)(RTA_PREC_REAL * correlation,
+  const int c_stride, const unsigned int c_size,
+  const RTA_PREC_REAL * input_vector_a, const int a_stride,
+  const RTA_PREC_REAL * input_vector_b, const int b_stride,
+  const unsigned int filter_size, const RTA_PREC_REAL scale);
+
+void
+RTA_PREC(rta_correlation_raw_scaled)(RTA_PREC_REAL * correlation,
+  const unsigned int c_size, const RTA_PREC_REAL * input_vector_a,
+  const RTA_PREC_REAL * input_vector_b, const unsigned int max_filter_size,
+  const RTA_PREC_REAL scale);
+
+void
+RTA_PREC(rta_correlation_raw_scaled_stride)(RTA_PREC_REAL * correlation,
+  const int c_stride, const unsigned int c_size,
+  const RTA_PREC_REAL * input_vector_a, const int a_stride,
+  const RTA_PREC_REAL * input_vector_b, const int b_stride,
+  const unsigned int max_filter_size, const RTA_PREC_REAL scale);
+
+
+/* rta_preemphasis.h */
+void
+RTA_PREC(rta_preemphasis_signal)(RTA_PREC_REAL * out_samples,
+  const RTA_PREC_REAL * in_samples, const unsigned int input_size,
+  RTA_PREC_REAL * previous_sample, const RTA_PREC_REAL factor);
+
+void
+RTA_PREC(rta_preemphasis_signal_stride)(RTA_PREC_REAL * out_samples,
+  const int o_stride, const RTA_PREC_REAL * in_samples, const int i_stride,
+  const unsigned int input_size, RTA_PREC_REAL * previous_sample,
+  const RTA_PREC_REAL factor);
+
+
+/* rta_delta.h */
+int
+RTA_PREC(rta_delta_weights)(RTA_PREC_REAL * weights_vector,
+  const unsigned int filter_size);
+
+int
+RTA_PREC(rta_delta_weights_stride)(RTA_PREC_REAL * weights_vector,
+  const int w_stride, const unsigned int filter_size);
+
+RTA_PREC_REAL
+RTA_PREC(rta_delta_normalization_factor)(const unsigned int filter_size);
+
+void
+RTA_PREC(rta_delta)(RTA_PREC_REAL * delta,
+  const RTA_PREC_REAL * input_vector, const RTA_PREC_REAL * weights_vector,
+  const unsigned int filter_size);
+
+void
+RTA_PREC(rta_delta_stride)(RTA_PREC_REAL * delta,
+  const RTA_PREC_REAL * input_vector, const int i_stride,
+  const RTA_PREC_REAL * weights_vector, const int w_stride,
+  const unsigned int filter_size);
+
+void
+RTA_PREC(rta_delta_vector)(RTA_PREC_REAL * delta,
+  const RTA_PREC_REAL * input_matrix, const unsigned int input_size,
+  const RTA_PREC_REAL * weights_vector, const unsigned int filter_size);
+
+void
+RTA_PREC(rta_delta_vector_stride)(RTA_PREC_REAL * delta, const int d_stride,
+  const RTA_PREC_REAL * input_matrix, const int i_stride,
+  const unsigned int input_size, const RTA_PREC_REAL * weights_vector,
+  const int w_stride, const unsigned int filter_size);
+
+
+/* rta_dct.h */
+int
+RTA_PREC(rta_dct_weights)(RTA_PREC_REAL * weights_matrix,
+  const unsigned int input_size, const unsigned int dct_order,
+  const rta_dct_t dct_type);
+
+int
+RTA_PREC(rta_dct_weights_stride)(RTA_PREC_REAL * weights_matrix,
+  const int w_stride, const unsigned int input_size,
+  const unsigned int dct_order, const rta_dct_t dct_type);
+
+void
+RTA_PREC(rta_dct)(RTA_PREC_REAL * dct, const RTA_PREC_REAL * input_vector,
+  const RTA_PREC_REAL * weights_matrix, const unsigned int input_size,
+  const unsigned int dct_order);
+
+void
+RTA_PREC(rta_dct_scaled)(RTA_PREC_REAL * dct,
+  const RTA_PREC_REAL * input_vector, const RTA_PREC_REAL * weights_matrix,
+  const unsigned int input_size, const unsigned int dct_order,
+  RTA_PREC_REAL scale);
+
+void
+RTA_PREC(rta_dct_stride)(RTA_PREC_REAL * dct, const int d_stride,
+  const RTA_PREC_REAL * input_vector, const int i_stride,
+  const RTA_PREC_REAL * weights_matrix, const int w_stride,
+  const unsigned int input_size, const unsigned int dct_order);
+
+void
+RTA_PREC(rta_dct_stride_scaled)(RTA_PREC_REAL * dct, const int d_stride,
+  const RTA_PREC_REAL * input_vector, const int i_stride,
+  const RTA_PREC_REAL * weights_matrix, const int w_stride,
+  const unsigned int input_size, const unsigned int dct_order,
+  RTA_PREC_REAL scale);
+
+
+/* rta_lpc.h */
+void
+RTA_PREC(rta_lpc)(RTA_PREC_REAL * lpc, const unsigned int lpc_size,
+  RTA_PREC_REAL * error, RTA_PREC_REAL * autocorrelation,
+  const RTA_PREC_REAL * input_vector, const unsigned int input_size);
+
+void
+RTA_PREC(rta_lpc_stride)(RTA_PREC_REAL * lpc, const int l_stride,
+  const unsigned int lpc_size, RTA_PREC_REAL * error,
+  RTA_PREC_REAL * autocorrelation, const int a_stride,
+  const RTA_PREC_REAL * input_vector, const int i_stride,
+  const unsigned int input_size);
+
+void
+RTA_PREC(rta_levinson)(RTA_PREC_REAL * levinson, const unsigned int l_size,
+  RTA_PREC_REAL * error, const RTA_PREC_REAL * autocorrelation);
+
+void
+RTA_PREC(rta_levinson_stride)(RTA_PREC_REAL * levinson, const int l_stride,
+  const unsigned int l_size, RTA_PREC_REAL * error,
+  const RTA_PREC_REAL * autocorrelation, const int a_stride);
+
+
+/* rta_mean_variance.h */
+void
+RTA_PREC(rta_mean_variance)(RTA_PREC_REAL * mean, RTA_PREC_REAL * variance,
+  RTA_PREC_REAL * input, const unsigned int i_size);
+
+void
+RTA_PREC(rta_mean_variance_stride)(RTA_PREC_REAL * mean,
+  RTA_PREC_REAL * variance, RTA_PREC_REAL * input, const int i_stride,
+  const unsigned int i_size);
+
+void
+RTA_PREC(rta_mean_variance_unbiased)(RTA_PREC_REAL * mean,
+  RTA_PREC_REAL * variance, RTA_PREC_REAL * input,
+  const unsigned int i_size);
+
+void
+RTA_PREC(rta_mean_variance_unbiased_stride)(RTA_PREC_REAL * mean,
+  RTA_PREC_REAL * variance, RTA_PREC_REAL * input, const int i_stride,
+  const unsigned int i_size);
+
+RTA_PREC_REAL
+RTA_PREC(rta_mean)(RTA_PREC_REAL * input, const unsigned int i_size);
+
+RTA_PREC_REAL
+RTA_PREC(rta_mean_stride)(RTA_PREC_REAL * input, const int i_stride,
+  const unsigned int i_size);
+
+RTA_PREC_REAL
+RTA_PREC(rta_variance)(RTA_PREC_REAL * input, const unsigned int i_size,
+  RTA_PREC_REAL mean);
+
+RTA_PREC_REAL
+RTA_PREC(rta_variance_stride)(RTA_PREC_REAL * input, const int i_stride,
+  const unsigned int i_size, RTA_PREC_REAL mean);
+
+RTA_PREC_REAL
+RTA_PREC(rta_variance_unbiased)(RTA_PREC_REAL * input,
+  const unsigned int i_size, RTA_PREC_REAL mean);
+
+RTA_PREC_REAL
+RTA_PREC(rta_variance_unbiased_stride)(RTA_PREC_REAL * input,
+  const int i_stride, const unsigned int i_size, RTA_PREC_REAL mean);
+
+
+/* rta_moments.h */
+RTA_PREC_REAL
+RTA_PREC(rta_weighted_moment_1_indexes)(RTA_PREC_REAL * input_sum,
+  const RTA_PREC_REAL * input, const unsigned int input_size);
+
+RTA_PREC_REAL
+RTA_PREC(rta_weighted_moment_1_indexes_stride)(RTA_PREC_REAL * input_sum,
+  const RTA_PREC_REAL * input, const int i_stride,
+  const unsigned int input_size);
+
+RTA_PREC_REAL
+RTA_PREC(rta_weighted_moment_2_indexes)(const RTA_PREC_REAL * input,
+  const unsigned int input_size, const RTA_PREC_REAL centroid,
+  const RTA_PREC_REAL input_sum);
+
+RTA_PREC_REAL
+RTA_PREC(rta_weighted_moment_2_indexes_stride)(const RTA_PREC_REAL * input,
+  const int i_stride, const unsigned int input_size,
+  const RTA_PREC_REAL centroid, const RTA_PREC_REAL input_sum);
+
+RTA_PREC_REAL
+RTA_PREC(rta_weighted_moment_3_indexes)(const RTA_PREC_REAL * input,
+  const unsigned int input_size, const RTA_PREC_REAL centroid,
+  const RTA_PREC_REAL input_sum);
+
+RTA_PREC_REAL
+RTA_PREC(rta_weighted_moment_3_indexes_stride)(const RTA_PREC_REAL * input,
+  const int i_stride, const unsigned int input_size,
+  const RTA_PREC_REAL centroid, const RTA_PREC_REAL input_sum);
+
+RTA_PREC_REAL
+RTA_PREC(rta_std_weighted_moment_3_indexes)(const RTA_PREC_REAL * input,
+  const unsigned int input_size, const RTA_PREC_REAL centroid,
+  const RTA_PREC_REAL input_sum, const RTA_PREC_REAL deviation);
+
+RTA_PREC_REAL
+RTA_PREC(rta_std_weighted_moment_3_indexes_stride)(const RTA_PREC_REAL * input,
+  const int i_stride, const unsigned int input_size,
+  const RTA_PREC_REAL centroid, const RTA_PREC_REAL input_sum,
+  const RTA_PREC_REAL deviation);
+
+RTA_PREC_REAL
+RTA_PREC(rta_weighted_moment_4_indexes)(const RTA_PREC_REAL * input,
+  const unsigned int input_size, const RTA_PREC_REAL centroid,
+  const RTA_PREC_REAL input_sum);
+
+RTA_PREC_REAL
+RTA_PREC(rta_weighted_moment_4_indexes_stride)(const RTA_PREC_REAL * input,
+  const int i_stride, const unsigned int input_size,
+  const RTA_PREC_REAL centroid, const RTA_PREC_REAL input_sum);
+
+RTA_PREC_REAL
+RTA_PREC(rta_std_weighted_moment_4_indexes)(const RTA_PREC_REAL * input,
+  const unsigned int input_size, const RTA_PREC_REAL centroid,
+  const RTA_PREC_REAL input_sum, const RTA_PREC_REAL deviation);
+
+RTA_PREC_REAL
+RTA_PREC(rta_std_weighted_moment_4_indexes_stride)(const RTA_PREC_REAL * input,
+  const int i_stride, const unsigned int input_size,
+  const RTA_PREC_REAL centroid, const RTA_PREC_REAL input_sum,
+  const RTA_PREC_REAL deviation);
+
+RTA_PREC_REAL
+RTA_PREC(rta_weighted_moment_indexes)(const RTA_PREC_REAL * input,
+  const unsigned int input_size, const RTA_PREC_REAL centroid,
+  const RTA_PREC_REAL input_sum, const RTA_PREC_REAL order);
+
+RTA_PREC_REAL
+RTA_PREC(rta_weighted_moment_indexes_stride)(const RTA_PREC_REAL * input,
+  const int i_stride, const unsigned int input_size,
+  const RTA_PREC_REAL centroid, const RTA_PREC_REAL input_sum,
+  const RTA_PREC_REAL order);
+
+RTA_PREC_REAL
+RTA_PREC(rta_std_weighted_moment_indexes)(const RTA_PREC_REAL * input,
+  const unsigned int input_size, const RTA_PREC_REAL centroid,
+  const RTA_PREC_REAL input_sum, const RTA_PREC_REAL deviation,
+  const RTA_PREC_REAL order);
+
+RTA_PREC_REAL
+RTA_PREC(rta_std_weighted_moment_indexes_stride)(const RTA_PREC_REAL * input,
+  const int i_stride, const unsigned int input_size,
+  const RTA_PREC_REAL centroid, const RTA_PREC_REAL input_sum,
+  const RTA_PREC_REAL deviation, const RTA_PREC_REAL order);
+
+
+/* rta_svd.h */
+int
+RTA_PREC(rta_svd_setup_new)(struct RTA_PREC(rta_svd_setup) ** svd_setup,
+  const rta_svd_t svd_type, RTA_PREC_REAL * U, RTA_PREC_REAL * S,
+  RTA_PREC_REAL * V, RTA_PREC_REAL * A, const unsigned int m,
+  const unsigned int n);
+
+void
+RTA_PREC(rta_svd_setup_delete)(struct RTA_PREC(rta_svd_setup) * svd_setup);
+
+void
+RTA_PREC(rta_svd)(RTA_PREC_REAL * U, RTA_PREC_REAL * S, RTA_PREC_REAL * V,
+  RTA_PREC_REAL * A, const struct RTA_PREC(rta_svd_setup) * svd_setup);
+
+void
+RTA_PREC(rta_svd_stride)(RTA_PREC_REAL * U, const int u_stride,
+  RTA_PREC_REAL * S, const int s_stride, RTA_PREC_REAL * V,
+  const int v_stride, RTA_PREC_REAL * A, const int a_stride,
+  const struct RTA_PREC(rta_svd_setup) * svd_setup);
@@ -0,0 +1,176 @@
+/**
+ * @file   rta_ringbuffer.c
+ * @ingroup rta_util
+ *
+ * @brief  Wait-free single-producer single-consumer ring buffers.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_ringbuffer.h"
+#include "rta_thread.h" /* rta_atomic_load, rta_atomic_store */
+
+#include <string.h> /* memcpy */
+
+/* copy n elements from ring position index, in up to two parts */
+static void
+copy_out(const rta_ringbuffer_t * ring, void * elements,
+         const unsigned int index, const unsigned int n)
+{
+  const unsigned int start = index & (ring->capacity - 1);
+  const unsigned int first = (n < ring->capacity - start) ? n : ring->capacity - start;
+  const size_t esize = ring->element_size;
+
+  memcpy(elements, ring->buffer + start * esize, first * esize);
+  memcpy((char *) elements + first * esize, ring->buffer, (n - first) * esize);
+}
+
+static void
+copy_in(rta_ringbuffer_t * ring, const void * elements,
+        const unsigned int index, const unsigned int n)
+{
+  const unsigned int start = index & (ring->capacity - 1);
+  const unsigned int first = (n < ring->capacity - start) ? n : ring->capacity - start;
+  const size_t esize = ring->element_size;
+
+  memcpy(ring->buffer + start * esize, elements, first * esize);
+  memcpy(ring->buffer, (const char *) elements + first * esize, (n - first) * esize);
+}
+
+
+int
+rta_ringbuffer_init(rta_ringbuffer_t * ring, const unsigned int capacity,
+                    const unsigned int element_size)
+{
+  unsigned int size = 1;
+
+  while(size < capacity && size < 0x80000000u)
+  {
+    size <<= 1;
+  }
+
+  ring->capacity = size;
+  ring->element_size = element_size;
+  ring->write_index = 0;
+  ring->read_index = 0;
+  ring->buffer = (char *) rta_aligned_malloc((size_t) size * element_size, 0);
+
+  return ring->buffer != NULL;
+}
+
+void
+rta_ringbuffer_deinit(rta_ringbuffer_t * ring)
+{
+  rta_aligned_free(ring->buffer);
+  ring->buffer = NULL;
+}
+
+void
+rta_ringbuffer_reset(rta_ringbuffer_t * ring)
+{
+  ring->write_index = 0;
+  ring->read_index = 0;
+}
+
+unsigned int
+rta_ringbuffer_read_available(const rta_ringbuffer_t * ring)
+{
+  return rta_atomic_load(&ring->write_index) - rta_atomic_load(&ring->read_index);
+}
+
+unsigned int
+rta_ringbuffer_write_available(const rta_ringbuffer_t * ring)
+{
+  return ring->capacity - rta_ringbuffer_read_available(ring);
+}
+
+unsigned int
+rta_ringbuffer_write(rta_ringbuffer_t * ring, const void * elements,
+                     const unsigned int n)
+{
+  /* only the producer writes write_index: no need to load it atomically */
+  const unsigned int index = ring->write_index;
+  const unsigned int room = ring->capacity - (index - rta_atomic_load(&ring->read_index));
+  const unsigned int count = n < room ? n : room;
+
+  copy_in(ring, elements, index, count);
+  rta_atomic_store(&ring->write_index, index + count);
+
+  return count;
+}
+
+unsigned int
+rta_ringbuffer_read(rta_ringbuffer_t * ring, void * elements,
+                    const unsigned int n)
+{
+  const unsigned int index = ring->read_index;
+  const unsigned int available = rta_atomic_load(&ring->write_index) - index;
+  const unsigned int count = n < available ? n : available;
+
+  copy_out(ring, elements, index, count);
+  rta_atomic_store(&ring->read_index, index + count);
+
+  return count;
+}
+
+int
+rta_ringbuffer_push(rta_ringbuffer_t * ring, const void * elements,
+                    const unsigned int n)
+{
+  const unsigned int index = ring->write_index;
+
+  if(ring->capacity - (index - rta_atomic_load(&ring->read_index)) < n)
+  {
+    return 0;
+  }
+
+  copy_in(ring, elements, index, n);
+  rta_atomic_store(&ring->write_index, index + n);
+
+  return 1;
+}
+
+int
+rta_ringbuffer_pop(rta_ringbuffer_t * ring, void * elements,
+                   const unsigned int n)
+{
+  const unsigned int index = ring->read_index;
+
+  if(rta_atomic_load(&ring->write_index) - index < n)
+  {
+    return 0;
+  }
+
+  copy_out(ring, elements, index, n);
+  rta_atomic_store(&ring->read_index, index + n);
+
+  return 1;
+}
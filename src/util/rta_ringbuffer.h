@@ -0,0 +1,136 @@
+/**
+ * @file   rta_ringbuffer.h
+ * @ingroup rta_util
+ *
+ * @brief  Wait-free single-producer single-consumer ring buffers.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_RINGBUFFER_H_
+#define _RTA_RINGBUFFER_H_ 1
+
+#include "rta.h"
+#include "rta_alloc.h" /* RTA_ALIGNMENT */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Ring buffer of fixed-size elements between exactly one producer
+ * thread and one consumer thread: sample frames (element size
+ * sizeof(rta_real_t) times the number of channels) or records.
+ *
+ * Reading and writing are wait-free: they never lock, allocate or
+ * loop on the other thread, so both sides can be real-time. Each
+ * side only writes its own index, and publishes it after copying the
+ * elements. The indices are on separate cache lines.
+ *
+ * The capacity is rounded up to a power of 2. Only the setup and
+ * rta_ringbuffer_reset() must not run concurrently with the other
+ * functions.
+ */
+typedef struct rta_ringbuffer
+{
+  char * buffer;                /**< capacity * element_size bytes */
+  unsigned int capacity;        /**< number of elements, power of 2 */
+  unsigned int element_size;    /**< in bytes */
+  char pad0[RTA_ALIGNMENT - sizeof(char *) - 2 * sizeof(unsigned int)];
+  unsigned int write_index;     /**< free running, written by the producer */
+  char pad1[RTA_ALIGNMENT - sizeof(unsigned int)];
+  unsigned int read_index;      /**< free running, written by the consumer */
+  char pad2[RTA_ALIGNMENT - sizeof(unsigned int)];
+} rta_ringbuffer_t;
+
+/**
+ * Allocate the elements of \p ring with rta_aligned_malloc().
+ *
+ * @param ring to initialise
+ * @param capacity minimum number of elements, rounded up to a power of 2
+ * @param element_size in bytes
+ *
+ * @return 1 on success 0 on fail
+ */
+int rta_ringbuffer_init(rta_ringbuffer_t * ring, const unsigned int capacity,
+                        const unsigned int element_size);
+
+/** free the elements of \p ring */
+void rta_ringbuffer_deinit(rta_ringbuffer_t * ring);
+
+/** empty \p ring, while neither side uses it */
+void rta_ringbuffer_reset(rta_ringbuffer_t * ring);
+
+/** @return number of elements that can be read (consumer side) */
+unsigned int rta_ringbuffer_read_available(const rta_ringbuffer_t * ring);
+
+/** @return number of elements that can be written (producer side) */
+unsigned int rta_ringbuffer_write_available(const rta_ringbuffer_t * ring);
+
+/**
+ * Write up to \p n elements (producer side).
+ *
+ * @return number of elements written, less than \p n if \p ring is full
+ */
+unsigned int rta_ringbuffer_write(rta_ringbuffer_t * ring, const void * elements,
+                                  const unsigned int n);
+
+/**
+ * Read up to \p n elements (consumer side).
+ *
+ * @return number of elements read, less than \p n if \p ring is empty
+ */
+unsigned int rta_ringbuffer_read(rta_ringbuffer_t * ring, void * elements,
+                                 const unsigned int n);
+
+/**
+ * Write exactly \p n elements, or nothing if there is not enough room
+ * (producer side). Use n = 1 to push a record.
+ *
+ * @return 1 if written, 0 if \p ring is too full
+ */
+int rta_ringbuffer_push(rta_ringbuffer_t * ring, const void * elements,
+                        const unsigned int n);
+
+/**
+ * Read exactly \p n elements, or nothing if there are not enough
+ * (consumer side). Use n = 1 to pop a record.
+ *
+ * @return 1 if read, 0 if \p ring holds less than \p n elements
+ */
+int rta_ringbuffer_pop(rta_ringbuffer_t * ring, void * elements,
+                       const unsigned int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_RINGBUFFER_H_ */
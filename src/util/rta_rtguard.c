@@ -0,0 +1,210 @@
+/**
+ * @file   rta_rtguard.c
+ * @ingroup rta_util
+ *
+ * @brief  Debug guard against memory allocation in real-time sections.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta.h" /* rta_post */
+#include "rta_rtguard.h"
+
+/* the guarded functions forward to the C library, whatever rta_malloc is */
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#  define RTA_RTGUARD_THREAD __declspec(thread)
+#else
+#  define RTA_RTGUARD_THREAD __thread
+#endif
+
+/* names of nested sections beyond this depth are not kept */
+#define SECTION_NAMES_SIZE 16
+
+static RTA_RTGUARD_THREAD int thread_depth = 0;
+static RTA_RTGUARD_THREAD const char *thread_sections[SECTION_NAMES_SIZE];
+static RTA_RTGUARD_THREAD unsigned long thread_count = 0;
+
+static volatile long total_count = 0;
+
+static const char * op_names[] =
+{
+  "rta_malloc",
+  "rta_realloc",
+  "rta_zalloc",
+  "rta_free",
+  "allocation"
+};
+
+
+static void
+default_handler(const rta_rtguard_event_t * event, void * context)
+{
+  rta_post("rta_rtguard: %s(%lu) in real-time section '%s' at %s:%d\n",
+           op_names[event->op], (unsigned long) event->size,
+           event->section, event->file, event->line);
+}
+
+static rta_rtguard_handler_t rtguard_handler = default_handler;
+static void * rtguard_context = NULL;
+
+
+void
+rta_rtguard_set_handler(rta_rtguard_handler_t handler, void * context)
+{
+  rtguard_handler = handler != NULL ? handler : default_handler;
+  rtguard_context = context;
+}
+
+void
+rta_rtguard_abort_handler(const rta_rtguard_event_t * event, void * context)
+{
+  default_handler(event, context);
+  abort();
+}
+
+void
+rta_rtguard_enter(const char * name)
+{
+  if(thread_depth < SECTION_NAMES_SIZE)
+  {
+    thread_sections[thread_depth] = name != NULL ? name : "";
+  }
+  thread_depth++;
+}
+
+void
+rta_rtguard_leave(void)
+{
+  if(thread_depth > 0)
+  {
+    thread_depth--;
+  }
+}
+
+int
+rta_rtguard_depth(void)
+{
+  return thread_depth;
+}
+
+unsigned long
+rta_rtguard_count(void)
+{
+  return (unsigned long) total_count;
+}
+
+unsigned long
+rta_rtguard_thread_count(void)
+{
+  return thread_count;
+}
+
+void
+rta_rtguard_reset(void)
+{
+  total_count = 0;
+  thread_count = 0;
+}
+
+int
+rta_rtguard_check(const rta_rtguard_op_t op, const size_t size,
+                  const char * file, const int line)
+{
+  const int depth = thread_depth;
+  rta_rtguard_event_t event;
+
+  if(depth == 0)
+  {
+    return 0;
+  }
+
+  thread_count++;
+#if defined(_MSC_VER)
+  _InterlockedIncrement(&total_count);
+#else
+  __atomic_add_fetch(&total_count, 1, __ATOMIC_RELAXED);
+#endif
+
+  event.op = op;
+  event.size = size;
+  event.file = file != NULL ? file : "?";
+  event.line = line;
+  event.section = thread_sections[depth < SECTION_NAMES_SIZE ?
+                                  depth - 1 : SECTION_NAMES_SIZE - 1];
+
+  /* the handler may allocate (printing does): don't report that */
+  thread_depth = 0;
+  rtguard_handler(&event, rtguard_context);
+  thread_depth = depth;
+
+  return 1;
+}
+
+int
+rta_rtguard_enabled(void)
+{
+  return RTA_RTGUARD;
+}
+
+void *
+rta_rtguard_malloc(size_t size, const char * file, int line)
+{
+  rta_rtguard_check(rta_rtguard_op_malloc, size, file, line);
+  return malloc(size);
+}
+
+void *
+rta_rtguard_realloc(void * ptr, size_t size, const char * file, int line)
+{
+  rta_rtguard_check(rta_rtguard_op_realloc, size, file, line);
+  return realloc(ptr, size);
+}
+
+void *
+rta_rtguard_zalloc(size_t size, const char * file, int line)
+{
+  rta_rtguard_check(rta_rtguard_op_zalloc, size, file, line);
+  return calloc(1, size);
+}
+
+void
+rta_rtguard_free(void * ptr, const char * file, int line)
+{
+  /* free(NULL) does nothing */
+  if(ptr != NULL)
+  {
+    rta_rtguard_check(rta_rtguard_op_free, 0, file, line);
+  }
+  free(ptr);
+}
@@ -0,0 +1,167 @@
+/**
+ * @file   rta_rtguard.h
+ * @ingroup rta_util
+ *
+ * @brief  Debug guard against memory allocation in real-time sections.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_RTGUARD_H_
+#define _RTA_RTGUARD_H_ 1
+
+#include <stddef.h> /* size_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Diagnostic mode to find allocations on real-time threads.
+ *
+ * When compiling with RTA_RTGUARD defined to 1 (in
+ * rta_configuration.h or with -DRTA_RTGUARD=1), rta_stdlib.h routes
+ * rta_malloc(), rta_realloc(), rta_zalloc() and rta_free() through
+ * the functions below, which record the source location. Any of them
+ * called while the calling thread is inside a real-time section,
+ * between rta_rtguard_enter() and rta_rtguard_leave(), is counted
+ * and reported to the handler. Outside of real-time sections they
+ * only forward to the C library.
+ *
+ * Sections are per thread and can be nested. The functions exist in
+ * all builds, so that the host can declare its sections
+ * unconditionally; without RTA_RTGUARD nothing is routed to them.
+ *
+ * Allocations that don't go through rta_malloc() (C++ containers,
+ * external libraries) can be checked by calling rta_rtguard_check()
+ * from a replacement allocator, e.g. a global operator new.
+ */
+#ifndef RTA_RTGUARD
+#define RTA_RTGUARD 0
+#endif
+
+/** memory operation */
+typedef enum
+{
+  rta_rtguard_op_malloc = 0,
+  rta_rtguard_op_realloc,
+  rta_rtguard_op_zalloc,
+  rta_rtguard_op_free,
+  rta_rtguard_op_other      /**< checked with rta_rtguard_check() */
+} rta_rtguard_op_t;
+
+/** allocation inside a real-time section */
+typedef struct rta_rtguard_event
+{
+  rta_rtguard_op_t op;
+  size_t size;              /**< requested size, 0 for free */
+  const char *file;         /**< source location of the call */
+  int line;
+  const char *section;      /**< name of the innermost section */
+} rta_rtguard_event_t;
+
+/**
+ * Handler called on each allocation inside a real-time section, on
+ * the offending thread. The default handler prints the event with
+ * rta_post().
+ */
+typedef void (*rta_rtguard_handler_t) (const rta_rtguard_event_t *event, void *context);
+
+/**
+ * Set the handler for allocations in real-time sections.
+ *
+ * @param handler function to call, NULL for the default handler
+ * @param context passed to \p handler
+ */
+void rta_rtguard_set_handler(rta_rtguard_handler_t handler, void *context);
+
+/** handler that aborts the program, after printing the event */
+void rta_rtguard_abort_handler(const rta_rtguard_event_t *event, void *context);
+
+/**
+ * Declare the calling thread as real-time until the matching
+ * rta_rtguard_leave().
+ *
+ * @param name section name, reported with the events (static string)
+ */
+void rta_rtguard_enter(const char *name);
+
+/** end the innermost real-time section of the calling thread */
+void rta_rtguard_leave(void);
+
+/** @return nesting depth of real-time sections of the calling thread */
+int rta_rtguard_depth(void);
+
+/** @return number of allocations in real-time sections, all threads */
+unsigned long rta_rtguard_count(void);
+
+/** @return number of allocations in real-time sections, calling thread */
+unsigned long rta_rtguard_thread_count(void);
+
+/** clear the counts of rta_rtguard_count() and the calling thread */
+void rta_rtguard_reset(void);
+
+/**
+ * Report an operation \p op of \p size bytes at \p file:\p line if
+ * the calling thread is in a real-time section.
+ *
+ * @return 1 if the operation was reported, 0 otherwise
+ */
+int rta_rtguard_check(const rta_rtguard_op_t op, const size_t size,
+                      const char *file, const int line);
+
+/** @return 1 if the library was compiled with RTA_RTGUARD, 0 otherwise */
+int rta_rtguard_enabled(void);
+
+/** guarded allocation functions, used through rta_malloc() and co. */
+void *rta_rtguard_malloc(size_t size, const char *file, int line);
+void *rta_rtguard_realloc(void *ptr, size_t size, const char *file, int line);
+void *rta_rtguard_zalloc(size_t size, const char *file, int line);
+void rta_rtguard_free(void *ptr, const char *file, int line);
+
+/**
+ * Scoped section macros, which expand to nothing without RTA_RTGUARD,
+ * for instrumenting code that should stay free of the guard's calls
+ * in release builds.
+ */
+#if RTA_RTGUARD
+#define RTA_RTGUARD_ENTER(name) rta_rtguard_enter(name)
+#define RTA_RTGUARD_LEAVE() rta_rtguard_leave()
+#else
+#define RTA_RTGUARD_ENTER(name)
+#define RTA_RTGUARD_LEAVE()
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_RTGUARD_H_ */
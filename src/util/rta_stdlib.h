@@ -43,6 +43,21 @@
 #ifndef _RTA_STDLIB_H_
 #define _RTA_STDLIB_H_ 1
 
+/** real-time allocation guard: route memory allocation through
+    rta_rtguard.c, which flags calls in real-time sections
+    @see rta_rtguard.h */
+#if defined(RTA_RTGUARD) && RTA_RTGUARD
+#include "rta_rtguard.h"
+#undef rta_malloc
+#define rta_malloc(size) rta_rtguard_malloc((size), __FILE__, __LINE__)
+#undef rta_realloc
+#define rta_realloc(ptr, size) rta_rtguard_realloc((ptr), (size), __FILE__, __LINE__)
+#undef rta_zalloc
+#define rta_zalloc(size) rta_rtguard_zalloc((size), __FILE__, __LINE__)
+#undef rta_free
+#define rta_free(ptr) rta_rtguard_free((ptr), __FILE__, __LINE__)
+#endif
+
 /** default define for memory allocation */
 #ifndef rta_malloc
 #define rta_malloc malloc
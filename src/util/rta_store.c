@@ -0,0 +1,629 @@
+/**
+ * @file   rta_store.c
+ * @ingroup rta_util
+ *
+ * @brief  Memory-mappable store of descriptor matrices.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_store.h"
+#include "rta_alloc.h" /* RTA_ALIGNMENT, rta_align_size */
+#include "rta_stdlib.h" /* rta_zalloc, rta_free */
+
+#include <math.h> /* sqrt */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h> /* memcmp, memcpy, strncpy */
+
+#if defined(WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define STORE_MAGIC "RTASTORE"
+#define STORE_BYTE_ORDER 0x01020304u
+#define STORE_STATISTICS 1u /* flags */
+#define STORE_NUM_STATISTICS 4
+
+typedef struct store_header
+{
+  char magic[8];
+  uint32_t byte_order;
+  uint32_t version;
+  uint32_t real_size;
+  uint32_t num_columns;
+  uint32_t num_blocks;
+  uint32_t flags;
+  uint64_t columns_offset;
+  uint64_t blocks_offset;
+  uint64_t statistics_offset;
+  uint64_t file_size;
+} store_header_t;
+
+typedef struct store_block
+{
+  uint64_t offset;
+  uint64_t rows;
+  char name[RTA_STORE_NAME_SIZE];
+} store_block_t;
+
+struct rta_store
+{
+  const char * base;
+  size_t size;
+  int mapped;
+  const store_header_t * header;
+  const store_block_t * table;
+  rta_real_t ** blocks;
+  int * block_rows;
+  int num_rows;
+};
+
+struct rta_store_writer
+{
+  FILE * file;
+  uint64_t offset;
+  int num_columns;
+  char * column_names;          /* num_columns * RTA_STORE_NAME_SIZE */
+  store_block_t * blocks;
+  int num_blocks;
+  int max_blocks;
+
+  /* statistics: running mean and sum of squared deviations */
+  uint64_t count;
+  double * mean;
+  double * m2;
+  double * min;
+  double * max;
+};
+
+
+/* ---------------------------------------------------------------------- */
+/* writer */
+
+static void
+copy_name(char * dest, const char * name)
+{
+  memset(dest, 0, RTA_STORE_NAME_SIZE);
+
+  if(name != NULL)
+  {
+    strncpy(dest, name, RTA_STORE_NAME_SIZE - 1);
+  }
+}
+
+static int
+write_at_alignment(rta_store_writer_t * writer, const void * data, const size_t size)
+{
+  static const char zeros[RTA_ALIGNMENT] = { 0 };
+  const size_t padding = rta_align_size(writer->offset) - writer->offset;
+
+  if((padding > 0 && fwrite(zeros, padding, 1, writer->file) != 1)
+     || (size > 0 && fwrite(data, size, 1, writer->file) != 1))
+  {
+    return 0;
+  }
+
+  writer->offset += padding + size;
+  return 1;
+}
+
+static void
+writer_free(rta_store_writer_t * writer)
+{
+  if(writer->file != NULL)
+  {
+    fclose(writer->file);
+  }
+
+  rta_free(writer->column_names);
+  rta_free(writer->blocks);
+  rta_free(writer->mean);
+  rta_free(writer);
+}
+
+int
+rta_store_writer_new(rta_store_writer_t ** writer, const char * path,
+                     const int num_columns, const char * const * column_names)
+{
+  rta_store_writer_t * w;
+  store_header_t header;
+  int c;
+
+  if(num_columns < 1)
+  {
+    return 0;
+  }
+
+  w = rta_zalloc(sizeof(rta_store_writer_t));
+  if(w == NULL)
+  {
+    return 0;
+  }
+
+  w->num_columns = num_columns;
+  w->column_names = rta_zalloc(num_columns * RTA_STORE_NAME_SIZE);
+  /* mean, m2, min, max */
+  w->mean = rta_zalloc(4 * num_columns * sizeof(double));
+  w->file = fopen(path, "wb");
+
+  if(w->column_names == NULL || w->mean == NULL || w->file == NULL)
+  {
+    writer_free(w);
+    return 0;
+  }
+
+  w->m2 = w->mean + num_columns;
+  w->min = w->m2 + num_columns;
+  w->max = w->min + num_columns;
+
+  for(c = 0; column_names != NULL && c < num_columns; c++)
+  {
+    copy_name(w->column_names + c * RTA_STORE_NAME_SIZE, column_names[c]);
+  }
+
+  /* placeholder, written again on close */
+  memset(&header, 0, sizeof(header));
+  if(! write_at_alignment(w, &header, sizeof(header)))
+  {
+    writer_free(w);
+    return 0;
+  }
+
+  *writer = w;
+  return 1;
+}
+
+int
+rta_store_writer_add_block(rta_store_writer_t * writer, const char * name,
+                           const rta_real_t * data, const int num_rows)
+{
+  const int num_columns = writer->num_columns;
+  store_block_t * block;
+  int r, c;
+
+  if(num_rows < 0)
+  {
+    return 0;
+  }
+
+  if(writer->num_blocks == writer->max_blocks)
+  {
+    int max_blocks = writer->max_blocks > 0 ? 2 * writer->max_blocks : 16;
+    store_block_t * blocks = rta_realloc(writer->blocks,
+                                         max_blocks * sizeof(store_block_t));
+
+    if(blocks == NULL)
+    {
+      return 0;
+    }
+
+    writer->blocks = blocks;
+    writer->max_blocks = max_blocks;
+  }
+
+  block = &writer->blocks[writer->num_blocks];
+  copy_name(block->name, name);
+  block->rows = num_rows;
+  block->offset = rta_align_size(writer->offset);
+
+  if(! write_at_alignment(writer, data,
+                          (size_t) num_rows * num_columns * sizeof(rta_real_t)))
+  {
+    return 0;
+  }
+
+  writer->num_blocks++;
+
+  /* Welford's running statistics */
+  for(r = 0; r < num_rows; r++)
+  {
+    const rta_real_t * row = data + (size_t) r * num_columns;
+
+    writer->count++;
+
+    for(c = 0; c < num_columns; c++)
+    {
+      const double x = row[c];
+      const double delta = x - writer->mean[c];
+
+      writer->mean[c] += delta / writer->count;
+      writer->m2[c] += delta * (x - writer->mean[c]);
+
+      if(writer->count == 1 || x < writer->min[c])
+      {
+        writer->min[c] = x;
+      }
+
+      if(writer->count == 1 || x > writer->max[c])
+      {
+        writer->max[c] = x;
+      }
+    }
+  }
+
+  return 1;
+}
+
+int
+rta_store_writer_close(rta_store_writer_t * writer, const int statistics)
+{
+  const int num_columns = writer->num_columns;
+  store_header_t header;
+  int ret, s, c;
+
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, STORE_MAGIC, sizeof(header.magic));
+  header.byte_order = STORE_BYTE_ORDER;
+  header.version = RTA_STORE_VERSION;
+  header.real_size = sizeof(rta_real_t);
+  header.num_columns = num_columns;
+  header.num_blocks = writer->num_blocks;
+
+  header.columns_offset = rta_align_size(writer->offset);
+  ret = write_at_alignment(writer, writer->column_names,
+                           num_columns * RTA_STORE_NAME_SIZE);
+
+  header.blocks_offset = rta_align_size(writer->offset);
+  ret = ret && write_at_alignment(writer, writer->blocks,
+                                  writer->num_blocks * sizeof(store_block_t));
+
+  if(statistics)
+  {
+    rta_real_t * vector = rta_malloc(num_columns * sizeof(rta_real_t));
+
+    header.flags |= STORE_STATISTICS;
+    header.statistics_offset = rta_align_size(writer->offset);
+    ret = ret && vector != NULL;
+
+    /* each vector aligned */
+    for(s = 0; ret && s < STORE_NUM_STATISTICS; s++)
+    {
+      for(c = 0; c < num_columns; c++)
+      {
+        switch(s)
+        {
+          case rta_store_min: vector[c] = writer->min[c]; break;
+          case rta_store_max: vector[c] = writer->max[c]; break;
+          case rta_store_mean: vector[c] = writer->mean[c]; break;
+          default:
+            vector[c] = writer->count > 0 ? sqrt(writer->m2[c] / writer->count) : 0.;
+        }
+      }
+
+      ret = write_at_alignment(writer, vector, num_columns * sizeof(rta_real_t));
+    }
+
+    rta_free(vector);
+  }
+
+  /* pad the end, so that the last table is whole in aligned memory */
+  ret = ret && write_at_alignment(writer, NULL, 0);
+  header.file_size = writer->offset;
+
+  ret = ret && fseek(writer->file, 0, SEEK_SET) == 0
+    && fwrite(&header, sizeof(header), 1, writer->file) == 1;
+
+  ret = fclose(writer->file) == 0 && ret;
+  writer->file = NULL;
+  writer_free(writer);
+
+  return ret;
+}
+
+
+/* ---------------------------------------------------------------------- */
+/* reader */
+
+/* offset + size within the store */
+static int
+in_store(const rta_store_t * store, const uint64_t offset, const uint64_t size)
+{
+  return offset <= store->size && size <= store->size - offset;
+}
+
+static int
+store_validate(rta_store_t * store)
+{
+  const store_header_t * header = (const store_header_t *) store->base;
+  const uint64_t row_size = (uint64_t) header->num_columns * sizeof(rta_real_t);
+  uint64_t num_rows = 0;
+  unsigned int b;
+
+  if(store->size < sizeof(store_header_t)
+     || memcmp(header->magic, STORE_MAGIC, sizeof(header->magic)) != 0
+     || header->byte_order != STORE_BYTE_ORDER
+     || header->version != RTA_STORE_VERSION
+     || header->real_size != sizeof(rta_real_t)
+     || header->num_columns < 1
+     || header->file_size > store->size
+     || ! in_store(store, header->columns_offset,
+                   (uint64_t) header->num_columns * RTA_STORE_NAME_SIZE)
+     || ! in_store(store, header->blocks_offset,
+                   (uint64_t) header->num_blocks * sizeof(store_block_t))
+     || header->blocks_offset % RTA_ALIGNMENT != 0
+     || ((header->flags & STORE_STATISTICS)
+         && (header->statistics_offset % RTA_ALIGNMENT != 0
+             || ! in_store(store, header->statistics_offset,
+                           STORE_NUM_STATISTICS * rta_align_size(row_size)))))
+  {
+    return 0;
+  }
+
+  store->header = header;
+  store->table = (const store_block_t *) (store->base + header->blocks_offset);
+
+  for(b = 0; b < header->num_blocks; b++)
+  {
+    const store_block_t * block = &store->table[b];
+
+    if(block->offset % RTA_ALIGNMENT != 0
+       || block->rows > INT32_MAX
+       || ! in_store(store, block->offset, block->rows * row_size)
+       || block->name[RTA_STORE_NAME_SIZE - 1] != '\0')
+    {
+      return 0;
+    }
+
+    num_rows += block->rows;
+  }
+
+  if(num_rows > INT32_MAX)
+  {
+    return 0;
+  }
+
+  for(b = 0; b < header->num_columns; b++)
+  {
+    if(store->base[header->columns_offset + (b + 1) * RTA_STORE_NAME_SIZE - 1] != '\0')
+    {
+      return 0;
+    }
+  }
+
+  store->num_rows = (int) num_rows;
+  return 1;
+}
+
+/* validate and set up the block arrays */
+static int
+store_init(rta_store_t * store)
+{
+  int b;
+
+  if(((uintptr_t) store->base) % RTA_ALIGNMENT != 0 || ! store_validate(store))
+  {
+    return 0;
+  }
+
+  /* block pointers, then rows */
+  store->blocks = rta_malloc(store->header->num_blocks
+                             * (sizeof(rta_real_t *) + sizeof(int)) + 1);
+  if(store->blocks == NULL)
+  {
+    return 0;
+  }
+
+  store->block_rows = (int *) (store->blocks + store->header->num_blocks);
+
+  for(b = 0; b < (int) store->header->num_blocks; b++)
+  {
+    store->blocks[b] = (rta_real_t *) (store->base + store->table[b].offset);
+    store->block_rows[b] = (int) store->table[b].rows;
+  }
+
+  return 1;
+}
+
+static void
+store_unmap(rta_store_t * store)
+{
+  if(store->mapped)
+  {
+#if defined(WIN32)
+    UnmapViewOfFile(store->base);
+#else
+    munmap((void *) store->base, store->size);
+#endif
+  }
+}
+
+int
+rta_store_open(rta_store_t ** store, const char * path)
+{
+  rta_store_t * s = rta_zalloc(sizeof(rta_store_t));
+#if defined(WIN32)
+  HANDLE handle, mapping;
+  LARGE_INTEGER size;
+#else
+  struct stat status;
+  int fd;
+#endif
+
+  if(s == NULL)
+  {
+    return 0;
+  }
+
+#if defined(WIN32)
+  handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if(handle != INVALID_HANDLE_VALUE)
+  {
+    GetFileSizeEx(handle, &size);
+    s->size = (size_t) size.QuadPart;
+    mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(handle);
+
+    if(mapping != NULL)
+    {
+      s->base = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      CloseHandle(mapping);
+    }
+  }
+#else
+  fd = open(path, O_RDONLY);
+  if(fd >= 0)
+  {
+    if(fstat(fd, &status) == 0 && status.st_size > 0)
+    {
+      void * map = mmap(NULL, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+      if(map != MAP_FAILED)
+      {
+        s->base = map;
+        s->size = status.st_size;
+      }
+    }
+
+    close(fd);
+  }
+#endif
+
+  s->mapped = s->base != NULL;
+
+  if(! s->mapped || ! store_init(s))
+  {
+    rta_store_close(s);
+    return 0;
+  }
+
+  *store = s;
+  return 1;
+}
+
+int
+rta_store_open_memory(rta_store_t ** store, const void * memory, const size_t size)
+{
+  rta_store_t * s = rta_zalloc(sizeof(rta_store_t));
+
+  if(s == NULL)
+  {
+    return 0;
+  }
+
+  s->base = memory;
+  s->size = size;
+
+  if(memory == NULL || ! store_init(s))
+  {
+    rta_store_close(s);
+    return 0;
+  }
+
+  *store = s;
+  return 1;
+}
+
+void
+rta_store_close(rta_store_t * store)
+{
+  store_unmap(store);
+  rta_free(store->blocks);
+  rta_free(store);
+}
+
+int
+rta_store_get_num_columns(const rta_store_t * store)
+{
+  return store->header->num_columns;
+}
+
+int
+rta_store_get_num_blocks(const rta_store_t * store)
+{
+  return store->header->num_blocks;
+}
+
+int
+rta_store_get_num_rows(const rta_store_t * store)
+{
+  return store->num_rows;
+}
+
+const char *
+rta_store_get_column_name(const rta_store_t * store, const int column)
+{
+  return store->base + store->header->columns_offset + column * RTA_STORE_NAME_SIZE;
+}
+
+int
+rta_store_find_column(const rta_store_t * store, const char * name)
+{
+  int c;
+
+  for(c = 0; c < (int) store->header->num_columns; c++)
+  {
+    if(strcmp(rta_store_get_column_name(store, c), name) == 0)
+    {
+      return c;
+    }
+  }
+
+  return -1;
+}
+
+const char *
+rta_store_get_block_name(const rta_store_t * store, const int block)
+{
+  return store->table[block].name;
+}
+
+rta_real_t **
+rta_store_get_blocks(const rta_store_t * store)
+{
+  return store->blocks;
+}
+
+int *
+rta_store_get_block_rows(const rta_store_t * store)
+{
+  return store->block_rows;
+}
+
+rta_real_t *
+rta_store_get_statistics(const rta_store_t * store,
+                         const rta_store_statistics_t statistics)
+{
+  if(! (store->header->flags & STORE_STATISTICS))
+  {
+    return NULL;
+  }
+
+  return (rta_real_t *) (store->base + store->header->statistics_offset
+                         + statistics * rta_align_size(store->header->num_columns
+                                                       * sizeof(rta_real_t)));
+}
@@ -0,0 +1,196 @@
+/**
+ * @file   rta_store.h
+ * @ingroup rta_util
+ *
+ * @brief  Memory-mappable store of descriptor matrices.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_STORE_H_
+#define _RTA_STORE_H_ 1
+
+#include "rta.h"
+#include <stddef.h> /* size_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A store is a binary file of descriptor matrices: blocks of rows of
+ * the same columns, with column names and optional per-column
+ * statistics. It is mapped into memory and its blocks are used in
+ * place, without parsing or copying: rta_store_get_blocks() and
+ * rta_store_get_block_rows() are the \p data and \p m arguments of
+ * rta_kdtree_set_data(), each block is an (rows, columns) matrix for
+ * rta_mahalanobis() or the statistics functions, and the standard
+ * deviations are a \p sigma vector.
+ *
+ * File layout, in the byte order and rta_real_t of the writer (a
+ * store of another byte order or precision is refused):
+ * - header: magic "RTASTORE", byte order mark, version, size of
+ *   rta_real_t, numbers of columns and blocks, flags, and the offsets
+ *   of the tables below and the file size;
+ * - block data, row-major rta_real_t matrices, as they were written;
+ * - column names, RTA_STORE_NAME_SIZE bytes each;
+ * - block table: offset, number of rows and name of each block;
+ * - statistics (optional): minimum, maximum, mean and standard
+ *   deviation vectors of rta_real_t over all rows.
+ * Blocks and tables start at multiples of RTA_ALIGNMENT.
+ *
+ * The mapped memory is read-only: the pointers returned by a store
+ * must not be written to.
+ */
+typedef struct rta_store rta_store_t;
+
+/** writes a store, block by block */
+typedef struct rta_store_writer rta_store_writer_t;
+
+/** maximum size of column and block names, including the final zero */
+#define RTA_STORE_NAME_SIZE 48
+
+/** current version of the file format */
+#define RTA_STORE_VERSION 1
+
+/** per-column statistics */
+typedef enum
+{
+  rta_store_min = 0,  /**< minimum */
+  rta_store_max = 1,  /**< maximum */
+  rta_store_mean = 2, /**< mean */
+  rta_store_std = 3   /**< standard deviation (biased) */
+} rta_store_statistics_t;
+
+/**
+ * Create a store file.
+ *
+ * @param writer is a pointer to the writer to allocate
+ * @param path of the file
+ * @param num_columns of all blocks
+ * @param column_names \p num_columns names, or NULL for no names
+ *
+ * @return 1 on success 0 on fail
+ */
+int rta_store_writer_new(rta_store_writer_t ** writer, const char * path,
+                         const int num_columns,
+                         const char * const * column_names);
+
+/**
+ * Append a block, written right away.
+ *
+ * @param writer
+ * @param name of the block (e.g. its source file), or NULL
+ * @param data (\p num_rows, num_columns) row-major matrix
+ * @param num_rows number of rows, may be 0
+ *
+ * @return 1 on success 0 on fail
+ */
+int rta_store_writer_add_block(rta_store_writer_t * writer, const char * name,
+                               const rta_real_t * data, const int num_rows);
+
+/**
+ * Write the tables, close the file and free the writer.
+ *
+ * @param writer
+ * @param statistics non-zero to store per-column statistics over all
+ * the rows
+ *
+ * @return 1 on success 0 on fail (the writer is freed in any case)
+ */
+int rta_store_writer_close(rta_store_writer_t * writer, const int statistics);
+
+/**
+ * Map a store file into memory.
+ *
+ * @param store is a pointer to the store to allocate
+ * @param path of the file
+ *
+ * @return 1 on success, 0 if the file can't be mapped or is not a
+ * valid store of this byte order and rta_real_t
+ */
+int rta_store_open(rta_store_t ** store, const char * path);
+
+/**
+ * Use a store already in memory, e.g. loaded by a host.
+ *
+ * @param store is a pointer to the store to allocate
+ * @param memory holding the store file, aligned to RTA_ALIGNMENT. It
+ * must stay valid until rta_store_close().
+ * @param size of \p memory in bytes
+ *
+ * @return 1 on success 0 on fail
+ */
+int rta_store_open_memory(rta_store_t ** store, const void * memory,
+                          const size_t size);
+
+/** unmap the store and free it */
+void rta_store_close(rta_store_t * store);
+
+/** @return number of columns */
+int rta_store_get_num_columns(const rta_store_t * store);
+
+/** @return number of blocks */
+int rta_store_get_num_blocks(const rta_store_t * store);
+
+/** @return total number of rows */
+int rta_store_get_num_rows(const rta_store_t * store);
+
+/** @return name of \p column, empty if unnamed */
+const char * rta_store_get_column_name(const rta_store_t * store, const int column);
+
+/** @return index of the column named \p name, or -1 */
+int rta_store_find_column(const rta_store_t * store, const char * name);
+
+/** @return name of \p block, empty if unnamed */
+const char * rta_store_get_block_name(const rta_store_t * store, const int block);
+
+/**
+ * @return array of the num_blocks block pointers, each to a (rows,
+ * num_columns) read-only matrix
+ */
+rta_real_t ** rta_store_get_blocks(const rta_store_t * store);
+
+/** @return array of the num_blocks numbers of rows */
+int * rta_store_get_block_rows(const rta_store_t * store);
+
+/**
+ * @return read-only vector of \p statistics for each column, or NULL
+ * if the store has no statistics
+ */
+rta_real_t * rta_store_get_statistics(const rta_store_t * store,
+                                      const rta_store_statistics_t statistics);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_STORE_H_ */
@@ -0,0 +1,184 @@
+/**
+ * @file   rta_thread.c
+ * @ingroup rta_util
+ *
+ * @brief  Portable threads and semaphores for the executor and thread pool.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_thread.h"
+#include "rta_stdlib.h" /* rta_malloc, rta_free */
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <process.h> /* _beginthreadex */
+#else
+#include <sched.h> /* sched_yield */
+#include <unistd.h> /* sysconf */
+#endif
+
+typedef struct thread_start
+{
+  rta_thread_function_t fun;
+  void * arg;
+} thread_start_t;
+
+#if defined(_WIN32)
+static unsigned __stdcall
+thread_main(void * arg)
+#else
+static void *
+thread_main(void * arg)
+#endif
+{
+  thread_start_t start = *(thread_start_t *) arg;
+
+  rta_free(arg);
+  start.fun(start.arg);
+
+  return 0;
+}
+
+int
+rta_thread_create(rta_thread_t * thread, rta_thread_function_t fun, void * arg)
+{
+  thread_start_t * start = (thread_start_t *) rta_malloc(sizeof(thread_start_t));
+  int ret;
+
+  if(start == NULL)
+  {
+    return 0;
+  }
+
+  start->fun = fun;
+  start->arg = arg;
+
+#if defined(_WIN32)
+  *thread = (rta_thread_t) _beginthreadex(NULL, 0, thread_main, start, 0, NULL);
+  ret = (*thread != NULL);
+#else
+  ret = (pthread_create(thread, NULL, thread_main, start) == 0);
+#endif
+
+  if(ret == 0)
+  {
+    rta_free(start);
+  }
+
+  return ret;
+}
+
+void
+rta_thread_join(rta_thread_t thread)
+{
+#if defined(_WIN32)
+  WaitForSingleObject((HANDLE) thread, INFINITE);
+  CloseHandle((HANDLE) thread);
+#else
+  pthread_join(thread, NULL);
+#endif
+}
+
+int
+rta_thread_num_processors(void)
+{
+#if defined(_WIN32)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return info.dwNumberOfProcessors > 0 ? (int) info.dwNumberOfProcessors : 1;
+#else
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? (int) n : 1;
+#endif
+}
+
+void
+rta_thread_yield(void)
+{
+#if defined(_WIN32)
+  SwitchToThread();
+#else
+  sched_yield();
+#endif
+}
+
+
+int
+rta_semaphore_init(rta_semaphore_t * sem, const unsigned int value)
+{
+#if defined(_WIN32)
+  *sem = (rta_semaphore_t) CreateSemaphore(NULL, value, 0x7fffffff, NULL);
+  return *sem != NULL;
+#elif defined(__APPLE__)
+  *sem = dispatch_semaphore_create(value);
+  return *sem != NULL;
+#else
+  return sem_init(sem, 0, value) == 0;
+#endif
+}
+
+void
+rta_semaphore_deinit(rta_semaphore_t * sem)
+{
+#if defined(_WIN32)
+  CloseHandle((HANDLE) *sem);
+#elif defined(__APPLE__)
+  dispatch_release(*sem);
+#else
+  sem_destroy(sem);
+#endif
+}
+
+void
+rta_semaphore_post(rta_semaphore_t * sem)
+{
+#if defined(_WIN32)
+  ReleaseSemaphore((HANDLE) *sem, 1, NULL);
+#elif defined(__APPLE__)
+  dispatch_semaphore_signal(*sem);
+#else
+  sem_post(sem);
+#endif
+}
+
+void
+rta_semaphore_wait(rta_semaphore_t * sem)
+{
+#if defined(_WIN32)
+  WaitForSingleObject((HANDLE) *sem, INFINITE);
+#elif defined(__APPLE__)
+  dispatch_semaphore_wait(*sem, DISPATCH_TIME_FOREVER);
+#else
+  while(sem_wait(sem) != 0)
+    ; /* interrupted by a signal */
+#endif
+}
@@ -0,0 +1,122 @@
+/**
+ * @file   rta_thread.h
+ * @ingroup rta_util
+ *
+ * @brief  Portable threads and semaphores for the executor and thread pool.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_THREAD_H_
+#define _RTA_THREAD_H_ 1
+
+#include "rta.h"
+
+#if defined(_WIN32)
+/* HANDLE, without pulling windows.h into the library headers */
+typedef void * rta_thread_t;
+typedef void * rta_semaphore_t;
+#else
+#include <pthread.h>
+typedef pthread_t rta_thread_t;
+#if defined(__APPLE__)
+#include <dispatch/dispatch.h> /* unnamed POSIX semaphores are not implemented */
+typedef dispatch_semaphore_t rta_semaphore_t;
+#else
+#include <semaphore.h>
+typedef sem_t rta_semaphore_t;
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** thread body */
+typedef void (*rta_thread_function_t) (void * arg);
+
+/**
+ * Start a thread running \p fun(\p arg).
+ *
+ * @return 1 on success, 0 on fail
+ */
+int rta_thread_create(rta_thread_t * thread, rta_thread_function_t fun, void * arg);
+
+/** wait for the end of \p thread and release it */
+void rta_thread_join(rta_thread_t thread);
+
+/** @return number of processors available to the process, at least 1 */
+int rta_thread_num_processors(void);
+
+/** give the rest of the time slice to other threads */
+void rta_thread_yield(void);
+
+/**
+ * Initialise counting semaphore \p sem to \p value.
+ *
+ * @return 1 on success, 0 on fail
+ */
+int rta_semaphore_init(rta_semaphore_t * sem, const unsigned int value);
+
+/** release the semaphore, no thread may be waiting on it */
+void rta_semaphore_deinit(rta_semaphore_t * sem);
+
+/** increment the count and wake a waiting thread: does not lock nor
+    allocate, so it can be called from a real-time thread */
+void rta_semaphore_post(rta_semaphore_t * sem);
+
+/** wait until the count is positive, and decrement it */
+void rta_semaphore_wait(rta_semaphore_t * sem);
+
+
+/**
+ * Atomic access to ints shared between threads: loads
+ * acquire and stores release, so that data written before a store is
+ * visible to the thread that loads the stored value.
+ */
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define rta_atomic_load(ptr) (_ReadWriteBarrier(), *(volatile long *) (ptr))
+#define rta_atomic_store(ptr, value) \
+  (_ReadWriteBarrier(), *(volatile long *) (ptr) = (value))
+#define rta_atomic_add(ptr, value) \
+  (_InterlockedExchangeAdd((volatile long *) (ptr), (value)) + (value))
+#else
+#define rta_atomic_load(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define rta_atomic_store(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#define rta_atomic_add(ptr, value) __atomic_add_fetch((ptr), (value), __ATOMIC_ACQ_REL)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_THREAD_H_ */
@@ -0,0 +1,345 @@
+/**
+ * @file   rta_trace.c
+ * @ingroup rta_util
+ *
+ * @brief  Low-overhead tracing of the processing entry points: call counts, latency and histograms.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rta_trace.h"
+#include "rta_stdlib.h" /* rta_zalloc */
+
+#include <string.h> /* memset */
+#include <time.h> /* clock_gettime */
+
+#if defined(_MSC_VER)
+#  define RTA_TRACE_THREAD __declspec(thread)
+#else
+#  define RTA_TRACE_THREAD __thread
+#endif
+
+typedef struct trace_counters
+{
+  uint64_t calls;
+  uint64_t items;
+  uint64_t total;
+  uint64_t max;
+  uint64_t histogram[RTA_TRACE_HISTOGRAM_SIZE];
+} trace_counters_t;
+
+/* counters of one thread, linked into the list of all threads; a
+   block released by its thread is reused by the next new thread */
+typedef struct trace_block
+{
+  trace_counters_t counters[rta_trace_num_ids];
+  int in_use;
+  struct trace_block *next;
+} trace_block_t;
+
+static const char * trace_names[rta_trace_num_ids] =
+{
+  "fft_execute",
+  "biquad_vector",
+  "onepole_vector",
+  "spectrum_to_bands",
+  "yin",
+  "psy",
+  "kdtree_build",
+  "kdtree_search",
+  "msdr_update"
+};
+
+static RTA_TRACE_THREAD trace_block_t *thread_block = NULL;
+static trace_block_t *all_blocks = NULL;
+
+/* calibration origin */
+static uint64_t origin_ticks = 0;
+static double origin_ns = 0;
+
+
+static double
+monotonic_ns(void)
+{
+  struct timespec ts;
+#if defined(_MSC_VER)
+  timespec_get(&ts, TIME_UTC);
+#else
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+  return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+/* lock-free push on the list of all threads' counters, never popped */
+static void
+push_block(trace_block_t * block)
+{
+#if defined(_MSC_VER)
+  trace_block_t * head;
+  do
+  {
+    head = all_blocks;
+    block->next = head;
+  }
+  while(_InterlockedCompareExchangePointer((void * volatile *) &all_blocks,
+                                           block, head) != head);
+#else
+  block->next = __atomic_load_n(&all_blocks, __ATOMIC_ACQUIRE);
+  while(!__atomic_compare_exchange_n(&all_blocks, &block->next, block, 0,
+                                     __ATOMIC_RELEASE, __ATOMIC_ACQUIRE))
+    ;
+#endif
+}
+
+static trace_block_t *
+first_block(void)
+{
+#if defined(_MSC_VER)
+  return (trace_block_t *) all_blocks;
+#else
+  return __atomic_load_n(&all_blocks, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/* take a released block, keeping its counters */
+static trace_block_t *
+claim_block(void)
+{
+  trace_block_t * block;
+
+  for(block = first_block(); block != NULL; block = block->next)
+  {
+#if defined(_MSC_VER)
+    if(_InterlockedCompareExchange((volatile long *) &block->in_use, 1, 0) == 0)
+#else
+    int expected = 0;
+
+    if(__atomic_compare_exchange_n(&block->in_use, &expected, 1, 0,
+                                   __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+#endif
+    {
+      return block;
+    }
+  }
+
+  return NULL;
+}
+
+static trace_block_t *
+get_thread_block(void)
+{
+  if(thread_block == NULL)
+  {
+    trace_block_t * block = claim_block();
+
+    if(block != NULL)
+    {
+      thread_block = block;
+      return block;
+    }
+
+    block = (trace_block_t *) rta_zalloc(sizeof(trace_block_t));
+
+    if(block == NULL)
+    {
+      return NULL;
+    }
+
+    block->in_use = 1;
+
+    if(origin_ticks == 0)
+    {
+      origin_ns = monotonic_ns();
+      origin_ticks = rta_trace_now();
+    }
+
+    push_block(block);
+    thread_block = block;
+  }
+
+  return thread_block;
+}
+
+/* floor(log2(ticks)), clipped to the last bin */
+static int
+histogram_bin(uint64_t ticks)
+{
+  int bin = 0;
+
+#if defined(__GNUC__) || defined(__clang__)
+  bin = ticks > 1 ? 63 - __builtin_clzll(ticks) : 0;
+#else
+  while(ticks > 1)
+  {
+    ticks >>= 1;
+    bin++;
+  }
+#endif
+
+  return bin < RTA_TRACE_HISTOGRAM_SIZE ? bin : RTA_TRACE_HISTOGRAM_SIZE - 1;
+}
+
+
+void
+rta_trace_end(const rta_trace_id_t id, const uint64_t start)
+{
+  const uint64_t ticks = rta_trace_now() - start;
+  trace_block_t * block = get_thread_block();
+  trace_counters_t * counters;
+
+  if(block == NULL)
+  {
+    return;
+  }
+
+  counters = &block->counters[id];
+  counters->calls++;
+  counters->total += ticks;
+  if(ticks > counters->max)
+  {
+    counters->max = ticks;
+  }
+  counters->histogram[histogram_bin(ticks)]++;
+}
+
+void
+rta_trace_count(const rta_trace_id_t id, const uint64_t n)
+{
+  trace_block_t * block = get_thread_block();
+
+  if(block != NULL)
+  {
+    block->counters[id].items += n;
+  }
+}
+
+int
+rta_trace_thread_init(void)
+{
+  return get_thread_block() != NULL;
+}
+
+void
+rta_trace_thread_deinit(void)
+{
+  if(thread_block != NULL)
+  {
+#if defined(_MSC_VER)
+    _InterlockedExchange((volatile long *) &thread_block->in_use, 0);
+#else
+    __atomic_store_n(&thread_block->in_use, 0, __ATOMIC_RELEASE);
+#endif
+    thread_block = NULL;
+  }
+}
+
+double
+rta_trace_ns_per_tick(void)
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+  double elapsed_ns;
+
+  if(origin_ticks == 0)
+  {
+    origin_ns = monotonic_ns();
+    origin_ticks = rta_trace_now();
+  }
+
+  /* wait for 10 ms since the origin, for 1e-4 relative precision */
+  while((elapsed_ns = monotonic_ns() - origin_ns) < 1e7)
+    ;
+
+  return elapsed_ns / (double) (rta_trace_now() - origin_ticks);
+#elif defined(__aarch64__)
+  uint64_t frequency;
+  __asm__ __volatile__ ("mrs %0, cntfrq_el0" : "=r" (frequency));
+  return 1e9 / (double) frequency;
+#else
+  return 1.;
+#endif
+}
+
+int
+rta_trace_get_stats(rta_trace_stats_t * stats, const int nstats)
+{
+  const double ns_per_tick = rta_trace_ns_per_tick();
+  const int n = nstats < rta_trace_num_ids ? nstats : rta_trace_num_ids;
+  trace_block_t * block;
+  int i, b;
+
+  for(i = 0; i < n; i++)
+  {
+    uint64_t total = 0, max = 0;
+
+    memset(&stats[i], 0, sizeof(rta_trace_stats_t));
+    stats[i].name = trace_names[i];
+
+    for(block = first_block(); block != NULL; block = block->next)
+    {
+      const trace_counters_t * counters = &block->counters[i];
+
+      stats[i].calls += counters->calls;
+      stats[i].items += counters->items;
+      total += counters->total;
+      if(counters->max > max)
+      {
+        max = counters->max;
+      }
+
+      for(b = 0; b < RTA_TRACE_HISTOGRAM_SIZE; b++)
+      {
+        stats[i].histogram[b] += counters->histogram[b];
+      }
+    }
+
+    stats[i].total_ns = (double) total * ns_per_tick;
+    stats[i].max_ns = (double) max * ns_per_tick;
+  }
+
+  return n;
+}
+
+void
+rta_trace_reset(void)
+{
+  trace_block_t * block;
+
+  for(block = first_block(); block != NULL; block = block->next)
+  {
+    memset(block->counters, 0, sizeof(block->counters));
+  }
+}
+
+int
+rta_trace_enabled(void)
+{
+  return RTA_TRACE;
+}
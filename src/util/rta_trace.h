@@ -0,0 +1,195 @@
+/**
+ * @file   rta_trace.h
+ * @ingroup rta_util
+ *
+ * @brief  Low-overhead tracing of the processing entry points: call counts, latency and histograms.
+ *
+ * @copyright
+ * Copyright (C) 2026 by IRCAM-Centre Georges Pompidou, Paris, France.
+ * All rights reserved.
+ *
+ * License (BSD 3-clause)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived from
+ *    this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTA_TRACE_H_
+#define _RTA_TRACE_H_ 1
+
+#include "rta.h"
+#include <stdint.h>
+
+#if defined(_MSC_VER)
+#  include <intrin.h> /* __rdtsc */
+#elif defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h> /* __rdtsc */
+#elif !defined(__aarch64__)
+#  include <time.h> /* clock_gettime */
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The processing entry points of the library are wrapped in scoped
+ * timers, which only exist when compiling with RTA_TRACE defined to 1
+ * (in rta_configuration.h or with -DRTA_TRACE=1). Otherwise the
+ * macros below expand to nothing and cost nothing.
+ *
+ * Each thread accumulates into its own counters, without locks or
+ * atomics. rta_trace_get_stats() sums the counters of all threads
+ * that traced anything. The first traced call on a thread allocates
+ * its counters; call rta_trace_thread_init() beforehand on real-time
+ * threads.
+ *
+ * The counters stay allocated until the end of the process. A thread
+ * that ends calls rta_trace_thread_deinit() to hand them over to the
+ * next thread that traces, so that hosts creating and destroying
+ * threads only allocate as many counters as threads trace at once.
+ * The counts of ended threads stay in the statistics. The library's
+ * own worker threads (rta_parallel.h, rta_executor.h) release their
+ * counters when they end.
+ *
+ * Times are read from the time stamp counter (rdtsc on x86, the
+ * virtual counter on ARM64, the monotonic clock elsewhere) and
+ * converted to nanoseconds when reading the statistics.
+ */
+#ifndef RTA_TRACE
+#define RTA_TRACE 0
+#endif
+
+/** traced functions, stride variants are counted with the plain ones */
+typedef enum
+{
+  rta_trace_fft_execute = 0,    /**< rta_fft_execute, also called by rta_fft_real_execute */
+  rta_trace_biquad_vector,      /**< rta_biquad_df1_vector, rta_biquad_df2t_vector */
+  rta_trace_onepole_vector,     /**< rta_onepole_lowpass_vector, rta_onepole_highpass_vector */
+  rta_trace_spectrum_to_bands,  /**< rta_spectrum_to_bands_abs, rta_spectrum_to_bands_square_abs */
+  rta_trace_yin,                /**< rta_yin */
+  rta_trace_psy,                /**< rta_psy_calculate_input_vector */
+  rta_trace_kdtree_build,       /**< rta_kdtree_build */
+  rta_trace_kdtree_search,      /**< rta_kdtree_search_knn */
+  rta_trace_msdr_update,        /**< rta_msdr_update and variants */
+  rta_trace_num_ids
+} rta_trace_id_t;
+
+/** number of histogram bins: bin i counts calls of [2^i, 2^(i+1)[
+    ticks, the last bin also all longer calls */
+#define RTA_TRACE_HISTOGRAM_SIZE 32
+
+/** statistics of one traced function, summed over threads */
+typedef struct rta_trace_stats
+{
+  const char *name;     /**< function name */
+  uint64_t calls;       /**< number of calls */
+  uint64_t items;       /**< number of items processed (samples, vectors, masses) */
+  double total_ns;      /**< total time in ns */
+  double max_ns;        /**< longest call in ns */
+  uint64_t histogram[RTA_TRACE_HISTOGRAM_SIZE]; /**< call durations, in ticks */
+} rta_trace_stats_t;
+
+
+/** time stamp counter */
+static inline uint64_t rta_trace_now (void)
+{
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t ticks;
+  __asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (ticks));
+  return ticks;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/** add a call of function \p id started at tick \p start */
+void rta_trace_end(const rta_trace_id_t id, const uint64_t start);
+
+/** add \p n processed items to function \p id */
+void rta_trace_count(const rta_trace_id_t id, const uint64_t n);
+
+/**
+ * Allocate the counters of the calling thread, so that tracing does
+ * not allocate on this thread later.
+ *
+ * @return 1 on success, 0 if allocation failed
+ */
+int rta_trace_thread_init(void);
+
+/**
+ * Release the counters of the calling thread for reuse by another
+ * thread, when the calling thread ends or stops tracing. Their counts
+ * stay in the statistics. Tracing again on the calling thread takes
+ * counters anew.
+ */
+void rta_trace_thread_deinit(void);
+
+/**
+ * Get the statistics of all traced functions, summed over threads.
+ * Counters of threads that are running may be read in the middle of
+ * an update, which can make their last call missing.
+ *
+ * @param stats array of \p nstats elements, filled in
+ * rta_trace_id_t order
+ * @param nstats size of \p stats
+ *
+ * @return number of elements filled: min(nstats, rta_trace_num_ids)
+ */
+int rta_trace_get_stats(rta_trace_stats_t *stats, const int nstats);
+
+/** clear the counters of all threads (not synchronised with running threads) */
+void rta_trace_reset(void);
+
+/** duration of one tick in ns, calibrated against the monotonic clock */
+double rta_trace_ns_per_tick(void);
+
+/** @return 1 if the library was compiled with RTA_TRACE, 0 otherwise */
+int rta_trace_enabled(void);
+
+
+/**
+ * Scoped timer: RTA_TRACE_BEGIN declares the start tick, so it goes
+ * after the other declarations of the function. RTA_TRACE_END must
+ * precede each return.
+ */
+#if RTA_TRACE
+#define RTA_TRACE_BEGIN(id) const uint64_t rta_trace_start_ = rta_trace_now()
+#define RTA_TRACE_END(id) rta_trace_end((id), rta_trace_start_)
+#define RTA_TRACE_COUNT(id, n) rta_trace_count((id), (n))
+#else
+#define RTA_TRACE_BEGIN(id)
+#define RTA_TRACE_END(id)
+#define RTA_TRACE_COUNT(id, n)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTA_TRACE_H_ */
@@ -0,0 +1,262 @@
+/*
+
+Shared helpers for the rta benchmarks (rta_*_bench.c): monotonic timer,
+seeded random generator, JSON result lines and comparison of two runs.
+
+Header only, so that each benchmark still compiles as a single
+command line, like the tests.
+
+JSON output is one result object per line, between a header and a
+footer line, so that two runs can be compared without a JSON library:
+
+{ "bench": "rta_signal", ...,
+  "results": [
+    { "name": "fft_complex_1024", "size": 1024, "ns_per_sample": 1.2, ... },
+    ...
+  ] }
+
+*/
+
+#ifndef _RTA_BENCH_H_
+#define _RTA_BENCH_H_ 1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <sys/resource.h> /* getrusage */
+#endif
+
+
+/*
+ *  timing
+ */
+
+static inline double rta_bench_now_ns (void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double) ts.tv_sec * 1e9 + (double) ts.tv_nsec;
+}
+
+typedef void (*rta_bench_function_t) (void *context);
+
+#define RTA_BENCH_TRIALS 7
+
+static inline int rta_bench_compare_double (const void *a, const void *b)
+{
+  double x = *(const double *) a, y = *(const double *) b;
+  return (x > y) - (x < y);
+}
+
+/* Median time per call in ns over RTA_BENCH_TRIALS trials of at least
+   min_ns each, after one warm-up call.  The repetition count is
+   calibrated once, so that all trials run the same number of calls. */
+static inline double rta_bench_time (rta_bench_function_t fun, void *context, double min_ns)
+{
+  double trials[RTA_BENCH_TRIALS];
+  double start, elapsed = 0;
+  long reps = 1, r;
+  int t;
+
+  fun(context); /* warm-up: caches, page faults, lazy init */
+
+  /* calibrate */
+  while (1)
+  {
+    start = rta_bench_now_ns();
+    for (r = 0; r < reps; r++)
+      fun(context);
+    elapsed = rta_bench_now_ns() - start;
+
+    if (elapsed >= min_ns  ||  reps >= (1L << 30))
+      break;
+
+    reps *= (elapsed > 0  &&  min_ns / elapsed < 100)  ?  (long) (min_ns / elapsed) + 1  :  100;
+  }
+
+  for (t = 0; t < RTA_BENCH_TRIALS; t++)
+  {
+    start = rta_bench_now_ns();
+    for (r = 0; r < reps; r++)
+      fun(context);
+    trials[t] = (rta_bench_now_ns() - start) / reps;
+  }
+
+  qsort(trials, RTA_BENCH_TRIALS, sizeof(double), rta_bench_compare_double);
+  return trials[RTA_BENCH_TRIALS / 2];
+}
+
+/* value at fraction p (0..1) of a sorted array */
+static inline double rta_bench_percentile (const double *sorted, int n, double p)
+{
+  int i = (int) (p * (n - 1) + 0.5);
+  return n > 0  ?  sorted[i < 0 ? 0 : i >= n ? n - 1 : i]  :  0;
+}
+
+/* peak resident set size in bytes, 0 if unknown */
+static inline double rta_bench_peak_memory (void)
+{
+#if defined(__linux__)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+    return (double) usage.ru_maxrss * 1024.;
+#endif
+  return 0;
+}
+
+
+/*
+ *  seeded random numbers (xorshift64*), identical on all platforms
+ */
+
+static uint64_t rta_bench_state = 88172645463325252ULL;
+
+static inline void rta_bench_seed (uint64_t seed)
+{
+  rta_bench_state = seed ? seed : 88172645463325252ULL;
+}
+
+/* uniform in [0, 1) */
+static inline double rta_bench_uniform (void)
+{
+  rta_bench_state ^= rta_bench_state >> 12;
+  rta_bench_state ^= rta_bench_state << 25;
+  rta_bench_state ^= rta_bench_state >> 27;
+  return (double) ((rta_bench_state * 2685821657736338717ULL) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/* standard normal (Box-Muller) */
+static inline double rta_bench_gauss (void)
+{
+  double u = rta_bench_uniform(), v = rta_bench_uniform();
+  return sqrt(-2. * log(1. - u)) * cos(2. * M_PI * v);
+}
+
+
+/*
+ *  JSON output
+ */
+
+typedef struct rta_bench_output
+{
+  FILE *file;       /* JSON output, or NULL */
+  int   nresults;   /* results written so far */
+} rta_bench_output_t;
+
+static inline void rta_bench_json_begin (rta_bench_output_t *out, const char *bench, const char *attributes)
+{
+  if (out->file)
+    fprintf(out->file, "{ \"bench\": \"%s\"%s%s,\n  \"results\": [\n",
+            bench, attributes && *attributes ? ", " : "", attributes ? attributes : "");
+  out->nresults = 0;
+}
+
+/* fields: comma-separated "key": value pairs, without braces */
+static inline void rta_bench_json_result (rta_bench_output_t *out, const char *name, const char *fields)
+{
+  if (out->file)
+    fprintf(out->file, "%s    { \"name\": \"%s\", %s }",
+            out->nresults > 0 ? ",\n" : "", name, fields);
+  out->nresults++;
+}
+
+static inline void rta_bench_json_end (rta_bench_output_t *out)
+{
+  if (out->file)
+    fprintf(out->file, "\n  ] }\n");
+}
+
+
+/*
+ *  comparison of two JSON runs
+ */
+
+#define RTA_BENCH_MAX_RESULTS 4096
+#define RTA_BENCH_NAME_SIZE   128
+
+typedef struct rta_bench_entry
+{
+  char   name[RTA_BENCH_NAME_SIZE];
+  double value;
+} rta_bench_entry_t;
+
+/* read "name" and the given metric from each result line,
+   return number of entries or -1 if the file can't be read */
+static inline int rta_bench_read (const char *filename, const char *metric,
+                                  rta_bench_entry_t *entries, int maxentries)
+{
+  FILE *file = fopen(filename, "r");
+  char line[4096], key[RTA_BENCH_NAME_SIZE + 8];
+  int n = 0;
+
+  if (file == NULL)
+    return -1;
+
+  snprintf(key, sizeof(key), "\"%s\":", metric);
+
+  while (n < maxentries  &&  fgets(line, sizeof(line), file) != NULL)
+  {
+    char *name = strstr(line, "\"name\": \"");
+    char *value = strstr(line, key);
+
+    if (name != NULL  &&  value != NULL)
+    {
+      char *end;
+      name += strlen("\"name\": \"");
+      end = strchr(name, '"');
+
+      if (end != NULL  &&  end - name < RTA_BENCH_NAME_SIZE)
+      {
+        memcpy(entries[n].name, name, end - name);
+        entries[n].name[end - name] = '\0';
+        entries[n].value = strtod(value + strlen(key), NULL);
+        n++;
+      }
+    }
+  }
+
+  fclose(file);
+  return n;
+}
+
+/* Print metric of new run relative to base run for all common results.
+   Return number of regressions worse than threshold (e.g. 0.05 for 5%),
+   or -1 on read error. */
+static inline int rta_bench_compare (const char *basefile, const char *newfile,
+                                     const char *metric, int higher_is_better, double threshold)
+{
+  static rta_bench_entry_t base[RTA_BENCH_MAX_RESULTS], cur[RTA_BENCH_MAX_RESULTS];
+  int nbase = rta_bench_read(basefile, metric, base, RTA_BENCH_MAX_RESULTS);
+  int ncur  = rta_bench_read(newfile,  metric, cur,  RTA_BENCH_MAX_RESULTS);
+  int i, j, nregress = 0;
+
+  if (nbase < 0  ||  ncur < 0)
+  {
+    fprintf(stderr, "can't read %s\n", nbase < 0 ? basefile : newfile);
+    return -1;
+  }
+
+  printf("%-40s %14s %14s %9s\n", "name", "base", "new", "change");
+
+  for (i = 0; i < ncur; i++)
+    for (j = 0; j < nbase; j++)
+      if (strcmp(cur[i].name, base[j].name) == 0)
+      {
+        double change = base[j].value != 0  ?  cur[i].value / base[j].value - 1  :  0;
+        int worse = higher_is_better  ?  change < -threshold  :  change > threshold;
+
+        printf("%-40s %14.4g %14.4g %+8.1f%%%s\n", cur[i].name,
+               base[j].value, cur[i].value, change * 100, worse ? "  REGRESSION" : "");
+        nregress += worse;
+        break;
+      }
+
+  return nregress;
+}
+
+#endif /* _RTA_BENCH_H_ */
@@ -0,0 +1,84 @@
+/*
+
+Test of the CPU dispatch (rta_cpu.h): threads released together make
+the first calls to rta_cpu_get_level() at once, and must all get the
+same, valid level; forcing a level then falls back to a supported one.
+
+- compile
+
+cc -O2 ../src/util/rta_cpu.c ../src/util/rta_thread.c rta_cpu_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -lpthread -o rta_cpu_test
+
+- run
+
+./rta_cpu_test
+RTA_CPU_LEVEL=sse2 ./rta_cpu_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+
+#include "rta_configuration.h"
+#include "rta_cpu.h"
+#include "rta_thread.h"
+
+#define NTHREADS 16
+
+static int start = 0;
+static int ready = 0;
+static int levels[NTHREADS];
+
+static void first_call (void *arg)
+{
+  int *level = (int *) arg;
+
+  rta_atomic_add(&ready, 1);
+  while (!rta_atomic_load(&start))
+    ;
+
+  *level = rta_cpu_get_level();
+}
+
+int main (int argc, char *argv[])
+{
+  rta_thread_t threads[NTHREADS];
+  int i, level;
+
+  for (i = 0; i < NTHREADS; i++)
+  {
+    levels[i] = -2;
+    assert(rta_thread_create(&threads[i], first_call, &levels[i]));
+  }
+
+  while (rta_atomic_load(&ready) < NTHREADS)
+    rta_thread_yield();
+  rta_atomic_store(&start, 1);
+
+  for (i = 0; i < NTHREADS; i++)
+    rta_thread_join(threads[i]);
+
+  level = rta_cpu_get_level();
+  assert(level >= rta_cpu_generic  &&  level < rta_cpu_num_levels);
+  assert(rta_cpu_has(level));
+  assert(rta_cpu_has(rta_cpu_generic));
+  assert(!rta_cpu_has(rta_cpu_num_levels));
+
+  for (i = 0; i < NTHREADS; i++)
+    assert(levels[i] == level);
+
+  printf("%d concurrent first calls: level %s\n", NTHREADS, rta_cpu_level_name(level));
+
+  /* forced levels fall back to supported ones, then back to the default */
+  for (i = rta_cpu_generic; i < rta_cpu_num_levels; i++)
+  {
+    const int forced = rta_cpu_set_level(i);
+
+    assert(forced <= i  &&  rta_cpu_has(forced));
+    assert(rta_cpu_get_level() == forced);
+  }
+
+  assert(rta_cpu_set_level(rta_cpu_num_levels) == level);
+
+  printf("rta_cpu_test: ok\n");
+  return 0;
+}
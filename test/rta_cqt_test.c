@@ -0,0 +1,203 @@
+/*
+
+Test of the constant-Q transform (rta_cqt.h): sinusoids at the centre
+of a bin give their amplitude there, the sparse spectral product
+matches the direct inner product with the temporal kernels, the
+multi-rate transform matches the single-rate one, and every dispatch
+level gives the same bins.
+
+- compile
+
+cc -O2 ../src/signal/rta_*.c ../src/statistics/rta_selection.c ../src/util/rta_*.c rta_cqt_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -I ../src/statistics/ -lm -lpthread -o rta_cqt_test
+
+- run
+
+./rta_cqt_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_cqt.h"
+#include "rta_cpu.h"
+#include "rta_window.h"
+
+#define SAMPLE_RATE 22050.
+
+/* direct inner product of the frame with the temporal kernel of 'bin' */
+static double direct_bin (const rta_cqt_t *cqt, const rta_real_t *frame,
+                          const rta_cqt_params_t *params, unsigned int bin)
+{
+  const double quality = params->q_scale / (pow(2., 1. / params->bins_per_octave) - 1.);
+  const double freq = rta_cqt_get_frequency(cqt, bin);
+  const unsigned int length = ceil(quality * SAMPLE_RATE / freq);
+  const unsigned int middle = rta_cqt_get_frame_size(cqt) / 2;
+  double re = 0, im = 0, sum = 0;
+  unsigned int n;
+
+  for (n = 0; n < length; n++)
+  {
+    const double w = 0.5 - 0.5 * cos(2 * M_PI * n / length);
+    const double phase = 2 * M_PI * freq / SAMPLE_RATE * (n - length * 0.5);
+    const double x = frame[middle - length / 2 + n];
+
+    re += x * w * cos(phase);
+    im -= x * w * sin(phase);
+    sum += w;
+  }
+
+  return 2 * sqrt(re * re + im * im) / sum;
+}
+
+/* largest difference of two transforms, relative to their peak */
+static double compare (const rta_real_t *a, const rta_real_t *b, unsigned int size)
+{
+  double peak = 0, error = 0;
+  unsigned int i;
+
+  for (i = 0; i < size; i++)
+  {
+    if (fabs(a[i]) > peak)
+      peak = fabs(a[i]);
+    if (fabs(a[i] - b[i]) > error)
+      error = fabs(a[i] - b[i]);
+  }
+
+  return error / peak;
+}
+
+static void sinusoid (rta_real_t *frame, unsigned int size, double freq, double amplitude)
+{
+  unsigned int n;
+
+  for (n = 0; n < size; n++)
+    frame[n] = amplitude * cos(2 * M_PI * freq / SAMPLE_RATE * n + 0.3);
+}
+
+int main (int argc, char *argv[])
+{
+  rta_cqt_params_t params;
+  rta_cqt_t *single, *multi;
+  rta_real_t *frame, *out_single, *out_multi, *out_level;
+  unsigned int num_bins, frame_size, bins[4] = { 0, 31, 45, 0 };
+  double error;
+  int b, i, level;
+
+  /* 5 octaves from 110 Hz, 12 bins per octave */
+  rta_cqt_params_default(&params, SAMPLE_RATE);
+  params.min_freq = 110;
+  params.max_freq = 3520;
+  params.bins_per_octave = 12;
+  params.multirate = 0;
+  assert(rta_cqt_new(&single, &params));
+  params.multirate = 1;
+  assert(rta_cqt_new(&multi, &params));
+
+  num_bins = rta_cqt_get_num_bins(single);
+  assert(num_bins == 61  &&  rta_cqt_get_num_bins(multi) == num_bins);
+  assert(rta_cqt_get_num_octaves(single) == 1);
+  assert(rta_cqt_get_num_octaves(multi) == 6);
+  assert(fabs(rta_cqt_get_frequency(single, 12) - 220) < 1e-3);
+  bins[3] = num_bins - 1;
+
+  /* the multi-rate frame is at least as long as the single-rate one */
+  frame_size = rta_cqt_get_frame_size(multi);
+  assert(frame_size >= rta_cqt_get_frame_size(single));
+
+  printf("%u bins, frame %u/%u samples, FFT %u/%u, coefficients %u/%u\n",
+         num_bins, rta_cqt_get_frame_size(single), frame_size,
+         rta_cqt_get_fft_size(single), rta_cqt_get_fft_size(multi),
+         rta_cqt_get_num_coefficients(single), rta_cqt_get_num_coefficients(multi));
+
+  /* sparse: a few coefficients per kernel */
+  assert(rta_cqt_get_num_coefficients(single) < num_bins * rta_cqt_get_fft_size(single) / 20);
+
+  frame = malloc(frame_size * sizeof(rta_real_t));
+  out_single = malloc(num_bins * sizeof(rta_real_t));
+  out_multi = malloc(num_bins * sizeof(rta_real_t));
+  out_level = malloc(num_bins * sizeof(rta_real_t));
+
+  /* sinusoids at bin centres */
+  for (b = 0; b < 4; b++)
+  {
+    const double freq = rta_cqt_get_frequency(single, bins[b]);
+
+    sinusoid(frame, frame_size, freq, 0.5);
+    rta_cqt_execute(single,
+                    out_single,
+                    frame + (frame_size - rta_cqt_get_frame_size(single)) / 2);
+    rta_cqt_execute(multi, out_multi, frame);
+
+    for (i = 0; i < (int) num_bins; i++)
+    {
+      assert(out_single[i] <= out_single[bins[b]]);
+      assert(out_multi[i] <= out_multi[bins[b]]);
+    }
+    assert(fabs(out_single[bins[b]] - 0.5) < 0.01);
+    assert(fabs(out_multi[bins[b]] - 0.5) < 0.01);
+    printf("%7.1f Hz: %f single-rate, %f multi-rate, next bin %f\n",
+           freq, out_single[bins[b]], out_multi[bins[b]],
+           out_single[bins[b] > 0 ? bins[b] - 1 : 1]);
+  }
+
+  /* noise and chords: against the direct inner product, and between
+     the two transforms */
+  for (i = 0; i < (int) frame_size; i++)
+    frame[i] = 0.1 * ((i * 7919) % 1009 / 1009. - 0.5)
+      + 0.3 * sin(2 * M_PI * 261.6 / SAMPLE_RATE * i)
+      + 0.2 * sin(2 * M_PI * 1318.5 / SAMPLE_RATE * i)
+      + 0.1 * sin(2 * M_PI * 147.1 / SAMPLE_RATE * i);
+
+  rta_cqt_execute(single, out_single,
+                  frame + (frame_size - rta_cqt_get_frame_size(single)) / 2);
+  rta_cqt_execute(multi, out_multi, frame);
+
+  for (i = 0; i < (int) num_bins; i++)
+    out_level[i] = direct_bin(single, frame + (frame_size - rta_cqt_get_frame_size(single)) / 2,
+                              &params, i);
+
+  error = compare(out_level, out_single, num_bins);
+  printf("single-rate against direct: %g\n", error);
+  assert(error < 0.01);
+
+  error = compare(out_single, out_multi, num_bins);
+  printf("multi-rate against single-rate: %g\n", error);
+  assert(error < 0.02);
+
+  /* every dispatch level */
+  for (level = 0; level < rta_cpu_num_levels; level++)
+  {
+    if (!rta_cpu_has(level))
+      continue;
+
+    rta_cpu_set_level(level);
+    rta_cqt_execute(multi, out_level, frame);
+    error = compare(out_multi, out_level, num_bins);
+    printf("%-8s %g\n", rta_cpu_level_name(level), error);
+    assert(error < 1e-5);
+  }
+  rta_cpu_set_level(rta_cpu_num_levels);
+  rta_cqt_delete(single);
+
+  /* invalid parameters */
+  params.max_freq = 0.45 * SAMPLE_RATE;
+  assert(!rta_cqt_new(&single, &params) && single == NULL);
+  params.multirate = 0;
+  params.max_freq = 0.5 * SAMPLE_RATE;
+  assert(!rta_cqt_new(&single, &params));
+  params.max_freq = 50;
+  assert(!rta_cqt_new(&single, &params));
+
+  rta_cqt_delete(multi);
+  free(frame);
+  free(out_single);
+  free(out_multi);
+  free(out_level);
+
+  printf("rta_cqt_test: ok\n");
+  return 0;
+}
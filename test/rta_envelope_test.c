@@ -0,0 +1,193 @@
+/*
+
+Test of the envelope bank (rta_envelope.h): with equal attack and
+release, the RMS envelopes match the one-pole low-pass of the squared
+channels (rta_onepole.h); the attack and release times of the peak
+followers; decibels; and the same output for any block size, number
+of channels and dispatch level.
+
+- compile
+
+cc -O2 ../src/signal/rta_*.c ../src/statistics/rta_selection.c ../src/util/rta_*.c rta_envelope_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -I ../src/statistics/ -lm -lpthread -o rta_envelope_test
+
+- run
+
+./rta_envelope_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_envelope.h"
+#include "rta_onepole.h"
+#include "rta_cpu.h"
+
+#define SAMPLE_RATE 48000.
+#define MAX_CHANNELS 19
+#define NFRAMES 4800
+
+static rta_real_t input[NFRAMES * MAX_CHANNELS];
+static rta_real_t channel[NFRAMES], squares[NFRAMES], smoothed[NFRAMES];
+static rta_real_t reference[NFRAMES * MAX_CHANNELS], output[NFRAMES * MAX_CHANNELS];
+
+/* channel c: sinusoid with an amplitude ramp, and some noise */
+static void fill (unsigned int num_channels)
+{
+  unsigned int f, c;
+
+  for (f = 0; f < NFRAMES; f++)
+    for (c = 0; c < num_channels; c++)
+      input[f * num_channels + c] = (0.1 + 0.9 * f / NFRAMES) / (c + 1)
+        * sin(2 * M_PI * (100. + 50 * c) / SAMPLE_RATE * f)
+        + 0.01 * ((f * 7919 + c * 31) % 101 / 101. - 0.5);
+}
+
+/* process in blocks of increasing size, return the output frames */
+static unsigned int process_blocks (rta_envelope_t *envelope, rta_real_t *out,
+                                    unsigned int num_channels)
+{
+  unsigned int f = 0, n = 0, size = 1;
+
+  rta_envelope_reset(envelope);
+  while (f < NFRAMES)
+  {
+    unsigned int written;
+
+    if (size > NFRAMES - f)
+      size = NFRAMES - f;
+
+    written = rta_envelope_get_output_frames(envelope, size);
+    assert(rta_envelope_process(envelope, out + n * num_channels,
+                                input + f * num_channels, size) == written);
+    n += written;
+    f += size;
+    size = size * 2 + 1;
+  }
+
+  return n;
+}
+
+int main (int argc, char *argv[])
+{
+  rta_envelope_params_t params;
+  rta_envelope_t *envelope;
+  unsigned int num_channels, c, f, n;
+  rta_real_t state, error;
+  int level;
+
+  /* RMS against the one-pole low-pass of the squares */
+  num_channels = 5;
+  fill(num_channels);
+  rta_envelope_params_default(&params, SAMPLE_RATE, num_channels);
+  params.attack = params.release = 0.01;
+  params.decimation = 1;
+  params.decibels = 0;
+  assert(rta_envelope_new(&envelope, &params));
+  assert(rta_envelope_process(envelope, output, input, NFRAMES) == NFRAMES);
+
+  for (c = 0; c < num_channels; c++)
+  {
+    for (f = 0; f < NFRAMES; f++)
+    {
+      channel[f] = input[f * num_channels + c];
+      squares[f] = channel[f] * channel[f];
+    }
+
+    state = 0;
+    rta_onepole_lowpass_vector(smoothed, squares, NFRAMES,
+                               1 - exp(-1. / (0.01 * SAMPLE_RATE)), &state);
+
+    for (f = 0; f < NFRAMES; f++)
+      assert(fabs(output[f * num_channels + c] - sqrt(smoothed[f])) < 1e-4);
+  }
+  printf("rms against one-pole: ok\n");
+  rta_envelope_delete(envelope);
+
+  /* peak follower: attack and release on a step */
+  rta_envelope_params_default(&params, SAMPLE_RATE, 1);
+  params.mode = rta_envelope_peak;
+  params.attack = 0.001;
+  params.release = 0.02;
+  params.decimation = 48;
+  params.decibels = 0;
+  assert(rta_envelope_new(&envelope, &params));
+
+  for (f = 0; f < NFRAMES; f++)
+    input[f] = f < NFRAMES / 2 ? (f % 2 ? -0.5 : 0.5) : 0;
+
+  assert(rta_envelope_process(envelope, output, input, NFRAMES) == NFRAMES / 48);
+  assert(fabs(output[0] - 0.5 * (1 - exp(-1.))) < 1e-3);       /* after 1 ms */
+  assert(fabs(output[49] - 0.5) < 1e-4);                       /* held */
+  assert(fabs(output[49 + 20] - 0.5 * exp(-1.)) < 1e-3);       /* 20 ms later */
+  printf("peak attack %f release %f: ok\n", output[0], output[49 + 20]);
+  rta_envelope_delete(envelope);
+
+  /* decibels, against 10 log10 of the powers */
+  num_channels = 3;
+  fill(num_channels);
+  rta_envelope_params_default(&params, SAMPLE_RATE, num_channels);
+  params.decimation = 16;
+  params.decibels = 0;
+  assert(rta_envelope_new(&envelope, &params));
+  n = rta_envelope_process(envelope, reference, input, NFRAMES);
+  rta_envelope_delete(envelope);
+
+  params.decibels = 1;
+  params.floor_db = -60;
+  assert(rta_envelope_new(&envelope, &params));
+  assert(rta_envelope_process(envelope, output, input, NFRAMES) == n);
+  error = 0;
+  for (f = 0; f < n * num_channels; f++)
+  {
+    const rta_real_t db = reference[f] > 1e-3 ? 20 * log10(reference[f]) : -60;
+
+    if (fabs(output[f] - db) > error)
+      error = fabs(output[f] - db);
+  }
+  printf("decibels: max error %g dB\n", error);
+  assert(error < 1e-3);
+  rta_envelope_delete(envelope);
+
+  /* any block size, number of channels and dispatch level */
+  for (num_channels = 1; num_channels <= MAX_CHANNELS; num_channels++)
+  {
+    fill(num_channels);
+    rta_envelope_params_default(&params, SAMPLE_RATE, num_channels);
+    params.decimation = 7;
+    params.mode = num_channels % 2 ? rta_envelope_rms : rta_envelope_peak;
+    assert(rta_envelope_new(&envelope, &params));
+
+    rta_cpu_set_level(rta_cpu_generic);
+    n = rta_envelope_process(envelope, reference, input, NFRAMES);
+    assert(n == NFRAMES / 7);
+
+    for (level = 0; level < rta_cpu_num_levels; level++)
+    {
+      if (!rta_cpu_has(level))
+        continue;
+
+      rta_cpu_set_level(level);
+      assert(process_blocks(envelope, output, num_channels) == n);
+
+      for (f = 0; f < n * num_channels; f++)
+        assert(fabs(output[f] - reference[f]) < 1e-4);
+    }
+    rta_cpu_set_level(rta_cpu_num_levels);
+    rta_envelope_delete(envelope);
+  }
+  printf("channels, blocks and dispatch levels: ok\n");
+
+  /* invalid parameters */
+  rta_envelope_params_default(&params, SAMPLE_RATE, 0);
+  assert(!rta_envelope_new(&envelope, &params)  &&  envelope == NULL);
+  params.num_channels = 2;
+  params.decimation = 0;
+  assert(!rta_envelope_new(&envelope, &params));
+
+  printf("rta_envelope_test: ok\n");
+  return 0;
+}
@@ -0,0 +1,204 @@
+/*
+
+Test of the SPSC ring buffers (rta_ringbuffer.h) and of the offload
+executor (rta_executor.h): a producer thread streams a counter through
+a ring buffer in chunks of varying size, then a "real-time" loop
+submits sample blocks to two analysis stages, whose results come back
+through ring buffers.
+
+- compile
+
+cc -O2 ../src/statistics/rta_mean_variance.c ../src/util/rta_*.c rta_executor_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/statistics/ -lm -lpthread -o rta_executor_test
+
+- run
+
+./rta_executor_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_ringbuffer.h"
+#include "rta_executor.h"
+#include "rta_thread.h"
+#include "rta_mean_variance.h"
+
+#define NVALUES 1000000
+#define BLOCK_SIZE 256
+#define NBLOCKS 2000
+
+static rta_ringbuffer_t stream;
+
+static void producer (void *arg)
+{
+  unsigned int chunk[37];
+  unsigned int next = 0, n = 1;
+
+  while (next < NVALUES)
+  {
+    unsigned int i, written;
+
+    if (n > 37  ||  next + n > NVALUES)
+      n = 1;
+
+    for (i = 0; i < n; i++)
+      chunk[i] = next + i;
+
+    written = rta_ringbuffer_write(&stream, chunk, n);
+    next += written;
+    n += 3;
+
+    if (written == 0)
+      rta_thread_yield();
+  }
+}
+
+
+/* analysis stages: mean and variance of a block, and its peak */
+typedef struct block
+{
+  int index;
+  rta_real_t samples[BLOCK_SIZE];
+} block_t;
+
+typedef struct result
+{
+  int index;
+  rta_real_t value;
+} result_t;
+
+static void stage_variance (void *context, void *record)
+{
+  block_t *block = (block_t *) record;
+  result_t result;
+  rta_real_t mean;
+
+  result.index = block->index;
+  rta_mean_variance(&mean, &result.value, block->samples, BLOCK_SIZE);
+  assert(rta_ringbuffer_push((rta_ringbuffer_t *) context, &result, 1));
+}
+
+static void stage_peak (void *context, void *record)
+{
+  block_t *block = (block_t *) record;
+  result_t result;
+  int i;
+
+  result.index = block->index;
+  result.value = 0;
+  for (i = 0; i < BLOCK_SIZE; i++)
+    if (fabs(block->samples[i]) > result.value)
+      result.value = fabs(block->samples[i]);
+
+  assert(rta_ringbuffer_push((rta_ringbuffer_t *) context, &result, 1));
+}
+
+
+int main (int argc, char *argv[])
+{
+  rta_thread_t thread;
+  unsigned int values[64], expected = 0;
+  rta_executor_t *executor;
+  rta_ringbuffer_t variances, peaks;
+  rta_executor_stats_t stats;
+  block_t block;
+  result_t result;
+  int i, b, s0, s1, nvariances = 0, npeaks = 0;
+
+  /* single thread: wrap around and all-or-nothing push/pop */
+  assert(rta_ringbuffer_init(&stream, 5, sizeof(unsigned int)));
+  assert(stream.capacity == 8);
+
+  for (i = 0; i < 20; i++)
+  {
+    values[0] = i; values[1] = i + 1; values[2] = i + 2;
+    assert(rta_ringbuffer_write(&stream, values, 3) == 3);
+    assert(rta_ringbuffer_read_available(&stream) == 3);
+    assert(rta_ringbuffer_read(&stream, values, 8) == 3);
+    assert(values[0] == i  &&  values[2] == i + 2);
+  }
+  assert(rta_ringbuffer_write(&stream, values, 10) == 8);
+  assert(rta_ringbuffer_push(&stream, values, 1) == 0);
+  assert(rta_ringbuffer_pop(&stream, values, 9) == 0);
+  assert(rta_ringbuffer_pop(&stream, values, 8) == 1);
+  rta_ringbuffer_deinit(&stream);
+
+  /* producer and consumer threads */
+  assert(rta_ringbuffer_init(&stream, 256, sizeof(unsigned int)));
+  assert(rta_thread_create(&thread, producer, NULL));
+
+  while (expected < NVALUES)
+  {
+    unsigned int n = rta_ringbuffer_read(&stream, values, (expected % 64) + 1);
+
+    for (i = 0; i < (int) n; i++)
+      assert(values[i] == expected++);
+
+    if (n == 0)
+      rta_thread_yield();
+  }
+
+  rta_thread_join(thread);
+  assert(rta_ringbuffer_read_available(&stream) == 0);
+  rta_ringbuffer_deinit(&stream);
+  printf("ring buffer: %d values in order\n", NVALUES);
+
+  /* executor with two stages on two workers */
+  assert(rta_ringbuffer_init(&variances, NBLOCKS, sizeof(result_t)));
+  assert(rta_ringbuffer_init(&peaks, NBLOCKS, sizeof(result_t)));
+  assert(rta_executor_new(&executor, 2, 4));
+  s0 = rta_executor_add_stage(executor, stage_variance, &variances, sizeof(block_t), 64, 50);
+  s1 = rta_executor_add_stage(executor, stage_peak, &peaks, sizeof(block_t), 64, 50);
+  assert(s0 == 0  &&  s1 == 1);
+  assert(rta_executor_start(executor));
+
+  for (b = 0; b < NBLOCKS; b++)
+  {
+    block.index = b;
+    for (i = 0; i < BLOCK_SIZE; i++)
+      block.samples[i] = (b % 10 + 1) * sin(0.05 * (i + b * BLOCK_SIZE));
+
+    /* a real-time producer would drop the block instead of waiting */
+    while (!rta_executor_submit(executor, s0, &block))
+      rta_thread_yield();
+    while (!rta_executor_submit(executor, s1, &block))
+      rta_thread_yield();
+
+    while (rta_ringbuffer_pop(&variances, &result, 1))
+      assert(result.index == nvariances++  &&  result.value > 0);
+  }
+
+  rta_executor_stop(executor);
+
+  while (rta_ringbuffer_pop(&variances, &result, 1))
+    assert(result.index == nvariances++  &&  result.value > 0);
+  while (rta_ringbuffer_pop(&peaks, &result, 1))
+  {
+    assert(result.index == npeaks++);
+    assert(result.value <= (result.index % 10 + 1) + 1e-5);
+  }
+
+  assert(nvariances == NBLOCKS  &&  npeaks == NBLOCKS);
+
+  for (i = 0; i < 2; i++)
+  {
+    rta_executor_get_stats(executor, i, &stats);
+    printf("stage %d: submitted %lu dropped %lu processed %lu late %lu  "
+           "latency mean %.3f max %.3f ms  process mean %.4f max %.4f ms\n",
+           i, stats.submitted, stats.dropped, stats.processed, stats.late,
+           stats.mean_latency_ms, stats.max_latency_ms,
+           stats.mean_process_ms, stats.max_process_ms);
+    assert(stats.processed == NBLOCKS  &&  stats.submitted == NBLOCKS);
+    assert(stats.max_latency_ms >= stats.mean_latency_ms);
+  }
+
+  rta_executor_delete(executor);
+  rta_ringbuffer_deinit(&variances);
+  rta_ringbuffer_deinit(&peaks);
+
+  printf("rta_executor_test: ok\n");
+  return 0;
+}
@@ -0,0 +1,230 @@
+/*
+
+Test of the granular voice pool (rta_granular.h): a grain without
+envelope at rate 1 copies its buffer, up to the accuracy of the fades;
+many grains at random rates and positions match a reference reading
+one sample at a time with the rta_cubic_idefix_interpolate macro,
+whatever the block size and the dispatch level; and the reading never
+leaves the buffers.
+
+- compile
+
+cc -O2 ../src/signal/rta_*.c ../src/statistics/rta_selection.c ../src/util/rta_*.c rta_granular_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -I ../src/statistics/ -lm -lpthread -o rta_granular_test
+
+- run
+
+./rta_granular_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_granular.h"
+#include "rta_cubic.h"
+#include "rta_util.h"
+#include "rta_cpu.h"
+
+#define BUFFER_SIZE 10000
+#define GUARD 8
+#define NGRAINS 300
+#define NBUSES 3
+#define NFRAMES 6000
+
+/* buffer with NaN guards around it */
+static rta_real_t storage[BUFFER_SIZE + 2 * GUARD];
+static rta_real_t *buffer = storage + GUARD;
+static rta_real_t reference[NBUSES][NFRAMES], output[NBUSES][NFRAMES];
+static rta_granular_grain_t grains[NGRAINS];
+
+static unsigned int seed = 1;
+
+static double uniform (void)
+{
+  seed = seed * 1664525 + 1013904223;
+  return (seed >> 8) / 16777216.;
+}
+
+/* one sample at a time, as the voice pool should */
+static void render_reference (const rta_granular_grain_t *grain)
+{
+  rta_idefix_t position, increment;
+  double frames = 1e300;
+  unsigned int duration = grain->duration, t;
+
+  rta_idefix_set_float(&position, grain->onset);
+  rta_idefix_set_float(&increment, grain->rate);
+
+  if (grain->rate > 0)
+    frames = floor((BUFFER_SIZE - 3 - rta_idefix_get_float(position)) / rta_idefix_get_float(increment));
+  else if (grain->rate < 0)
+    frames = floor((rta_idefix_get_float(position) - 1) / -rta_idefix_get_float(increment));
+  if (duration > frames)
+    duration = frames < 1 ? 1 : frames;
+
+  for (t = 0; t < duration && grain->delay + t < NFRAMES; t++)
+  {
+    double in = grain->attack > 0 ? (double) t / grain->attack : 1;
+    double out = grain->release > 0 ? (double) (duration - 1 - t) / grain->release : 1;
+    rta_real_t y;
+
+    if (out < in)
+      in = out;
+    in = sin(M_PI / 2 * (in < 1 ? in : 1));
+    rta_cubic_idefix_interpolate(buffer, position, &y);
+    reference[grain->bus][grain->delay + t] += grain->gain * in * in * y;
+    rta_idefix_incr(&position, increment);
+  }
+}
+
+/* trigger all the grains, render in blocks of increasing size */
+static void render_blocks (rta_granular_t *granular, int increasing)
+{
+  rta_real_t *buses[NBUSES];
+  unsigned int f = 0, size = increasing ? 1 : NFRAMES, g, b;
+
+  memset(output, 0, sizeof(output));
+  for (g = 0; g < NGRAINS; g++)
+    assert(rta_granular_trigger(granular, grains + g));
+
+  while (f < NFRAMES)
+  {
+    if (size > NFRAMES - f)
+      size = NFRAMES - f;
+
+    for (b = 0; b < NBUSES; b++)
+      buses[b] = output[b] + f;
+
+    /* delays count from the next block */
+    rta_granular_render(granular, buses, size);
+    for (g = 0; g < NGRAINS; g++)
+      grains[g].delay = grains[g].delay > size ? grains[g].delay - size : 0;
+
+    f += size;
+    size = size * 2 + 3;
+  }
+}
+
+static double compare (void)
+{
+  double error = 0;
+  unsigned int b, f;
+
+  for (b = 0; b < NBUSES; b++)
+    for (f = 0; f < NFRAMES; f++)
+    {
+      assert(output[b][f] == output[b][f]); /* not NaN */
+      if (fabs(output[b][f] - reference[b][f]) > error)
+        error = fabs(output[b][f] - reference[b][f]);
+    }
+
+  return error;
+}
+
+int main (int argc, char *argv[])
+{
+  static unsigned int delays[NGRAINS];
+  rta_granular_t *granular;
+  rta_granular_grain_t grain;
+  rta_real_t *buses[NBUSES];
+  double error;
+  unsigned int i, g;
+  int level;
+
+  for (i = 0; i < BUFFER_SIZE + 2 * GUARD; i++)
+    storage[i] = NAN;
+  for (i = 0; i < BUFFER_SIZE; i++)
+    buffer[i] = sin(0.01 * i) + 0.3 * sin(0.37 * i) + 0.1 * ((i * 7919) % 101 / 101. - 0.5);
+
+  assert(!rta_granular_new(&granular, 0, 1)  &&  granular == NULL);
+  assert(rta_granular_new(&granular, NGRAINS, NBUSES));
+  for (i = 0; i < NBUSES; i++)
+    buses[i] = output[i];
+
+  /* plain copy */
+  memset(&grain, 0, sizeof(grain));
+  grain.buffer = buffer;
+  grain.buffer_size = BUFFER_SIZE;
+  grain.onset = 100;
+  grain.rate = 1;
+  grain.duration = 1000;
+  grain.gain = 1;
+  grain.bus = 1;
+  grain.delay = 10;
+  assert(rta_granular_trigger(granular, &grain));
+  assert(rta_granular_get_num_voices(granular) == 1);
+
+  memset(output, 0, sizeof(output));
+  rta_granular_render(granular, buses, 2000);
+  for (i = 0; i < 2000; i++)
+  {
+    assert(output[0][i] == 0  &&  output[2][i] == 0);
+    assert(fabs(output[1][i] - (i >= 10  &&  i < 1010 ? buffer[100 + i - 10] : 0)) < 1e-5);
+  }
+  assert(rta_granular_get_num_voices(granular) == 0);
+  printf("copy: ok\n");
+
+  /* invalid grains */
+  grain.onset = 0.5;
+  assert(!rta_granular_trigger(granular, &grain));
+  grain.onset = BUFFER_SIZE - 2.5;
+  assert(!rta_granular_trigger(granular, &grain));
+  grain.onset = 100;
+  grain.bus = NBUSES;
+  assert(!rta_granular_trigger(granular, &grain));
+
+  /* random grains, some reaching the ends of the buffer */
+  for (g = 0; g < NGRAINS; g++)
+  {
+    grains[g].buffer = buffer;
+    grains[g].buffer_size = BUFFER_SIZE;
+    grains[g].onset = 1 + uniform() * (BUFFER_SIZE - 4);
+    grains[g].rate = (uniform() * 4 - 1.5) * (g % 10 == 0 ? 10 : 1);
+    if (g % 17 == 0)
+      grains[g].rate = 0;
+    grains[g].duration = 1 + uniform() * 3000;
+    grains[g].attack = g % 3 ? uniform() * grains[g].duration : 0;
+    grains[g].release = g % 5 ? uniform() * grains[g].duration : 0;
+    grains[g].gain = uniform();
+    grains[g].bus = g % NBUSES;
+    grains[g].delay = uniform() * 3000;
+    delays[g] = grains[g].delay;
+    render_reference(grains + g);
+  }
+
+  /* pool full */
+  for (g = 0; g < NGRAINS; g++)
+    assert(rta_granular_trigger(granular, grains + g));
+  assert(!rta_granular_trigger(granular, grains));
+  rta_granular_stop(granular);
+  assert(rta_granular_get_num_voices(granular) == 0);
+
+  for (level = 0; level < rta_cpu_num_levels; level++)
+  {
+    if (!rta_cpu_has(level))
+      continue;
+
+    rta_cpu_set_level(level);
+    for (i = 0; i < 2; i++)
+    {
+      for (g = 0; g < NGRAINS; g++)
+        grains[g].delay = delays[g];
+
+      render_blocks(granular, i);
+      error = compare();
+      printf("%-8s %s blocks: max error %g\n", rta_cpu_level_name(level),
+             i ? "increasing" : "single", error);
+      assert(error < 1e-4);
+      assert(rta_granular_get_num_voices(granular) == 0);
+    }
+  }
+  rta_cpu_set_level(rta_cpu_num_levels);
+
+  rta_granular_delete(granular);
+
+  printf("rta_granular_test: ok\n");
+  return 0;
+}
@@ -0,0 +1,468 @@
+/*
+
+Recall versus latency benchmark of the kd-tree: for each dataset and
+tree configuration (decomposition mode, pivot mode, height, sigma
+weighting), report build time, index memory, query latency
+percentiles, recall@k against brute force search and the
+rta_kdtree_profile_t counters.
+
+- compile
+
+cc -O2 -DNDEBUG ../src/recognition/rta_kdtree*.c ../src/util/rta_*.c rta_kdtree_bench.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/recognition/ -lm -o rta_kdtree_bench
+
+- run
+
+./rta_kdtree_bench [-n vectors] [-d dimensions] [-q queries] [-k neighbours] [-l data.txt] [-o result.json]
+./rta_kdtree_bench -c base.json new.json [regression-threshold-percent]
+
+Datasets are generated from a fixed seed: uniform, clustered (gaussian
+mixture) and correlated (low-rank latent factors with per-dimension
+scales and noise, like audio descriptors).  With -l, vectors are read
+from a text file, one vector per line, and queries are taken from the
+data with added noise.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_kdtree.h"
+
+#include "rta_bench.h"
+
+#define NUM_CLUSTERS 32
+#define NUM_FACTORS  3
+
+typedef struct dataset
+{
+  const char *name;
+  int         n, ndim;
+  rta_real_t *data;     /* (n, ndim) */
+  rta_real_t *queries;  /* (nq, ndim) */
+  rta_real_t *sigma;    /* per-dimension standard deviation */
+} dataset_t;
+
+typedef struct config
+{
+  rta_kdtree_dmode_t dmode;
+  rta_kdtree_mmode_t mmode;
+  int givenheight;
+  int use_sigma;
+} config_t;
+
+static int nq = 1000;
+static int k  = 10;
+
+
+/*
+ *  datasets
+ */
+
+static void generate (dataset_t *set, const char *type, int n, int ndim)
+{
+  int total = n + nq;
+  rta_real_t *v = malloc(total * ndim * sizeof(rta_real_t));
+  int i, j, f;
+
+  set->name = type;
+  set->n    = n;
+  set->ndim = ndim;
+
+  if (strcmp(type, "uniform") == 0)
+  {
+    for (i = 0; i < total * ndim; i++)
+      v[i] = rta_bench_uniform();
+  }
+  else if (strcmp(type, "clustered") == 0)
+  {
+    double *centers = malloc(NUM_CLUSTERS * ndim * sizeof(double));
+
+    for (i = 0; i < NUM_CLUSTERS * ndim; i++)
+      centers[i] = rta_bench_uniform();
+
+    for (i = 0; i < total; i++)
+    {
+      int c = (int) (rta_bench_uniform() * NUM_CLUSTERS);
+
+      for (j = 0; j < ndim; j++)
+        v[i * ndim + j] = centers[c * ndim + j] + 0.03 * rta_bench_gauss();
+    }
+    free(centers);
+  }
+  else /* correlated */
+  {
+    double *mix   = malloc(NUM_FACTORS * ndim * sizeof(double));
+    double *scale = malloc(ndim * sizeof(double));
+
+    for (i = 0; i < NUM_FACTORS * ndim; i++)
+      mix[i] = rta_bench_gauss();
+    for (j = 0; j < ndim; j++)
+      scale[j] = pow(10., 3. * rta_bench_uniform() - 1.); /* 0.1 .. 100 */
+
+    for (i = 0; i < total; i++)
+    {
+      double factor[NUM_FACTORS];
+
+      for (f = 0; f < NUM_FACTORS; f++)
+        factor[f] = rta_bench_gauss();
+
+      for (j = 0; j < ndim; j++)
+      {
+        double x = 0.1 * rta_bench_gauss();
+
+        for (f = 0; f < NUM_FACTORS; f++)
+          x += mix[f * ndim + j] * factor[f];
+
+        v[i * ndim + j] = scale[j] * x;
+      }
+    }
+    free(mix);
+    free(scale);
+  }
+
+  set->data    = v;
+  set->queries = v + n * ndim;
+}
+
+/* read vectors, one per line, the first line gives the dimension */
+static int load (dataset_t *set, const char *filename)
+{
+  FILE *file = fopen(filename, "r");
+  int alloc = 1024, n = 0, ndim = 0, i, j;
+  char line[65536];
+  rta_real_t *v;
+
+  if (file == NULL)
+    return 0;
+
+  v = malloc(alloc * sizeof(rta_real_t));
+
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    char *p = line, *end;
+    int d = 0;
+    double x;
+
+    for (x = strtod(p, &end); end != p; x = strtod(p, &end))
+    {
+      if (n * ndim + d + 1 > alloc)
+        v = realloc(v, (alloc *= 2) * sizeof(rta_real_t));
+      v[n * ndim + d++] = x; /* ndim is 0 while reading the first line */
+      p = end;
+    }
+
+    if (d == 0)
+      continue;
+    if (ndim == 0)
+      ndim = d;
+    if (d == ndim)
+      n++;
+  }
+  fclose(file);
+
+  if (n <= 1)
+  {
+    free(v);
+    return 0;
+  }
+
+  /* queries: data vectors with 1% noise */
+  v = realloc(v, (n + nq) * ndim * sizeof(rta_real_t));
+
+  for (i = 0; i < nq; i++)
+  {
+    int src = (int) (rta_bench_uniform() * n);
+
+    for (j = 0; j < ndim; j++)
+      v[(n + i) * ndim + j] = v[src * ndim + j] * (1 + 0.01 * rta_bench_gauss());
+  }
+
+  set->name    = strrchr(filename, '/')  ?  strrchr(filename, '/') + 1  :  filename;
+  set->n       = n;
+  set->ndim    = ndim;
+  set->data    = v;
+  set->queries = v + n * ndim;
+  return 1;
+}
+
+static void compute_sigma (dataset_t *set)
+{
+  int i, j;
+
+  set->sigma = malloc(set->ndim * sizeof(rta_real_t));
+
+  for (j = 0; j < set->ndim; j++)
+  {
+    double sum = 0, sum2 = 0, var;
+
+    for (i = 0; i < set->n; i++)
+    {
+      double x = set->data[i * set->ndim + j];
+      sum  += x;
+      sum2 += x * x;
+    }
+    var = sum2 / set->n - (sum / set->n) * (sum / set->n);
+    set->sigma[j] = var > 0  ?  sqrt(var)  :  0;
+  }
+}
+
+
+/*
+ *  brute force ground truth: distance of k-th neighbour of each query
+ */
+
+static double distance (const rta_real_t *a, const rta_real_t *b, const rta_real_t *sigma, int ndim)
+{
+  double d = 0;
+  int j;
+
+  for (j = 0; j < ndim; j++)
+    if (sigma == NULL)
+      d += (a[j] - b[j]) * (a[j] - b[j]);
+    else if (sigma[j] > 0)
+      d += (a[j] - b[j]) * (a[j] - b[j]) / (sigma[j] * sigma[j]);
+
+  return d;
+}
+
+static void brute_force (const dataset_t *set, const rta_real_t *sigma, double *kth)
+{
+  double *best = malloc(k * sizeof(double));
+  int q, i, l;
+
+  for (q = 0; q < nq; q++)
+  {
+    const rta_real_t *x = set->queries + q * set->ndim;
+    int nbest = 0;
+
+    for (i = 0; i < set->n; i++)
+    {
+      double d = distance(x, set->data + i * set->ndim, sigma, set->ndim);
+
+      if (nbest < k  ||  d < best[nbest - 1])
+      { /* insertion into sorted list of k best */
+        l = nbest < k  ?  nbest++  :  nbest - 1;
+
+        while (l > 0  &&  best[l - 1] > d)
+        {
+          best[l] = best[l - 1];
+          l--;
+        }
+        best[l] = d;
+      }
+    }
+
+    kth[q] = best[nbest - 1];
+  }
+
+  free(best);
+}
+
+
+/*
+ *  one configuration
+ */
+
+static void run (rta_bench_output_t *out, const dataset_t *set, const config_t *cfg,
+                 const double *kth)
+{
+  rta_kdtree_t tree;
+  rta_real_t *data = set->data;
+  int n = set->n;
+  rta_kdtree_object_t *found = malloc(k * sizeof(rta_kdtree_object_t));
+  rta_real_t *dist = malloc(k * sizeof(rta_real_t));
+  double *latency = malloc(nq * sizeof(double));
+  double build_ns = 0, memory, recall = 0, mean_ns = 0;
+  int build_mean, build_hyperp, trial, q, i;
+  char name[256], fields[1024];
+
+  /* build three times, keep the fastest */
+  for (trial = 0; trial < 3; trial++)
+  {
+    double start;
+
+    if (trial > 0)
+      rta_kdtree_free(&tree);
+
+    rta_kdtree_init(&tree);
+    tree.dmode = cfg->dmode;
+    tree.mmode = cfg->mmode;
+    tree.givenheight = cfg->givenheight;
+
+    start = rta_bench_now_ns();
+    rta_kdtree_set_data(&tree, 1, &data, NULL, &n, set->ndim);
+    rta_kdtree_init_nodes(&tree, NULL, NULL, NULL);
+    if (cfg->use_sigma)
+      rta_kdtree_set_sigma(&tree, set->sigma);
+    rta_kdtree_build(&tree, cfg->use_sigma);
+    start = rta_bench_now_ns() - start;
+
+    if (trial == 0  ||  start < build_ns)
+      build_ns = start;
+  }
+
+  build_mean   = tree.profile.mean;
+  build_hyperp = tree.profile.hyperp;
+  memory = tree.nnodes * (sizeof(rta_kdtree_node_t) + set->ndim * sizeof(rta_real_t)
+                          * (tree.split != NULL ? 2 : 1))
+         + tree.ndatatot * sizeof(rta_kdtree_object_t);
+
+  /* queries */
+  rta_kdtree_profile_clear(&tree);
+
+  for (q = 0; q < nq; q++)
+  {
+    const double bound = kth[q] * (1 + 1e-5) + 1e-12;
+    double start = rta_bench_now_ns();
+    int nfound = rta_kdtree_search_knn(&tree, set->queries + q * set->ndim, 1, k, 0,
+                                       cfg->use_sigma, found, dist);
+    int hits = 0;
+
+    latency[q] = rta_bench_now_ns() - start;
+    mean_ns += latency[q];
+
+    /* a neighbour is correct if within the true k-th distance (ties) */
+    for (i = 0; i < nfound; i++)
+      hits += distance(set->queries + q * set->ndim,
+                       set->data + found[i].index * set->ndim,
+                       cfg->use_sigma ? set->sigma : NULL, set->ndim) <= bound;
+
+    recall += (double) hits / k;
+  }
+
+  qsort(latency, nq, sizeof(double), rta_bench_compare_double);
+  recall  /= nq;
+  mean_ns /= nq;
+
+  snprintf(name, sizeof(name), "%s_%s_%s_h%d%s", set->name,
+           rta_kdtree_dmodestr[cfg->dmode], rta_kdtree_mmodestr[cfg->mmode],
+           tree.height, cfg->use_sigma ? "_sigma" : "");
+
+  printf("%-44s build %8.2f ms  mem %8.1f kB  query p50 %7.2f p90 %7.2f p99 %7.2f us"
+         "  recall@%d %.4f  v2v %7.1f v2n %6.1f\n",
+         name, build_ns * 1e-6, memory / 1024.,
+         rta_bench_percentile(latency, nq, .5) * 1e-3,
+         rta_bench_percentile(latency, nq, .9) * 1e-3,
+         rta_bench_percentile(latency, nq, .99) * 1e-3,
+         k, recall,
+         (double) tree.profile.v2v / nq, (double) tree.profile.v2n / nq);
+
+  snprintf(fields, sizeof(fields),
+           "\"n\": %d, \"ndim\": %d, \"k\": %d, \"height\": %d, \"build_ms\": %.6g, "
+           "\"memory_bytes\": %.0f, \"query_mean_us\": %.6g, \"query_p50_us\": %.6g, "
+           "\"query_p90_us\": %.6g, \"query_p99_us\": %.6g, \"recall\": %.6g, "
+           "\"build_mean\": %d, \"build_hyperp\": %d, \"v2v_per_query\": %.6g, "
+           "\"v2n_per_query\": %.6g, \"neighbours\": %d, \"maxstack\": %d",
+           set->n, set->ndim, k, tree.height, build_ns * 1e-6, memory, mean_ns * 1e-3,
+           rta_bench_percentile(latency, nq, .5) * 1e-3,
+           rta_bench_percentile(latency, nq, .9) * 1e-3,
+           rta_bench_percentile(latency, nq, .99) * 1e-3, recall,
+           build_mean, build_hyperp,
+           (double) tree.profile.v2v / nq, (double) tree.profile.v2n / nq,
+           tree.profile.neighbours, tree.profile.maxstack);
+  rta_bench_json_result(out, name, fields);
+
+  rta_kdtree_free(&tree);
+  free(found);
+  free(dist);
+  free(latency);
+}
+
+
+int main (int argc, char *argv[])
+{
+  static const char *types[] = { "uniform", "clustered", "correlated" };
+  static const rta_kdtree_dmode_t dmodes[] = { dmode_orthogonal, dmode_hyperplane };
+  static const rta_kdtree_mmode_t mmodes[] = { mmode_mean, mmode_middle };
+  static const int heights[] = { -1, -2, -4 };
+  rta_bench_output_t out = { NULL, 0 };
+  const char *loadfile = NULL;
+  int n = 20000, ndim = 12, nsets, s, a, b, c, d, i;
+  double *kth, *kth_sigma;
+  char attributes[256];
+
+  if (argc >= 4  &&  strcmp(argv[1], "-c") == 0)
+  {
+    double threshold = argc >= 5  ?  atof(argv[4]) / 100.  :  0.05;
+    int nregress = rta_bench_compare(argv[2], argv[3], "query_p50_us", 0, threshold);
+    nregress += rta_bench_compare(argv[2], argv[3], "recall", 1, 0.001);
+    return nregress != 0;
+  }
+
+  for (i = 1; i < argc - 1; i += 2)
+  {
+    if (strcmp(argv[i], "-n") == 0)
+      n = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-d") == 0)
+      ndim = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-q") == 0)
+      nq = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-k") == 0)
+      k = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-l") == 0)
+      loadfile = argv[i + 1];
+    else if (strcmp(argv[i], "-o") == 0)
+      out.file = fopen(argv[i + 1], "w");
+  }
+
+  snprintf(attributes, sizeof(attributes), "\"real_size\": %d, \"queries\": %d",
+           (int) sizeof(rta_real_t), nq);
+  rta_bench_json_begin(&out, "rta_kdtree", attributes);
+
+  nsets = loadfile  ?  1  :  3;
+  kth       = malloc(nq * sizeof(double));
+  kth_sigma = malloc(nq * sizeof(double));
+
+  for (s = 0; s < nsets; s++)
+  {
+    dataset_t set;
+
+    rta_bench_seed(s + 1);
+
+    if (loadfile)
+    {
+      if (!load(&set, loadfile))
+      {
+        fprintf(stderr, "can't read vectors from %s\n", loadfile);
+        return 1;
+      }
+    }
+    else
+      generate(&set, types[s], n, ndim);
+
+    compute_sigma(&set);
+    brute_force(&set, NULL, kth);
+    brute_force(&set, set.sigma, kth_sigma);
+
+    for (a = 0; a < 2; a++)
+      for (b = 0; b < 2; b++)
+        for (c = 0; c < 3; c++)
+          for (d = 0; d < 2; d++)
+          {
+            config_t cfg;
+
+            cfg.dmode = dmodes[a];
+            cfg.mmode = mmodes[b];
+            cfg.givenheight = heights[c];
+            cfg.use_sigma = d;
+            run(&out, &set, &cfg, d ? kth_sigma : kth);
+          }
+
+    free(set.data);
+    free(set.sigma);
+  }
+
+  rta_bench_json_end(&out);
+  printf("peak memory %.1f MB\n", rta_bench_peak_memory() / 1048576.);
+
+  if (out.file)
+    fclose(out.file);
+
+  free(kth);
+  free(kth_sigma);
+
+  return 0;
+}
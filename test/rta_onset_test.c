@@ -0,0 +1,170 @@
+/*
+
+Test of the onset detector (rta_onset.h): noise bursts and tones
+starting at known times over a quiet background are found once each,
+whatever the input block sizes, and at every dispatch level.
+
+- compile
+
+cc -O2 ../src/signal/rta_*.c ../src/statistics/rta_selection.c ../src/util/rta_*.c rta_onset_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -I ../src/statistics/ -lm -lpthread -o rta_onset_test
+
+- run
+
+./rta_onset_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_onset.h"
+#include "rta_cpu.h"
+
+#define SAMPLE_RATE 44100
+#define DURATION 5
+#define SIZE (SAMPLE_RATE * DURATION)
+#define NEVENTS 7
+#define MAX_ONSETS 64
+
+static const double event_times[NEVENTS] = { 0.5, 1.05, 1.6, 2.2, 2.9, 3.5, 4.3 };
+
+typedef struct onsets
+{
+  int count;
+  double times[MAX_ONSETS];
+} onsets_t;
+
+static void collect (void *receiver, double time, rta_real_t strength)
+{
+  onsets_t *onsets = (onsets_t *) receiver;
+
+  assert(strength > 0);
+  if (onsets->count < MAX_ONSETS)
+    onsets->times[onsets->count] = time;
+  onsets->count++;
+}
+
+static unsigned int seed = 1;
+
+static double noise (void)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 8) / 8388608. - 1.;
+}
+
+/* decaying noise bursts, alternating with harmonic tones of short attack */
+static void generate (rta_real_t *x)
+{
+  int i, e;
+
+  for (i = 0; i < SIZE; i++)
+    x[i] = 0.001 * noise();
+
+  for (e = 0; e < NEVENTS; e++)
+  {
+    const int start = (int) (event_times[e] * SAMPLE_RATE);
+
+    for (i = start; i < SIZE; i++)
+    {
+      const double t = (double) (i - start) / SAMPLE_RATE;
+      const double f = 110 * (e + 1);
+
+      if (e % 2 == 0)
+        x[i] += 0.8 * exp(-t * 20) * noise();
+      else
+        x[i] += 0.3 * (t < 0.005 ? t / 0.005 : exp(-(t - 0.005) * 8))
+          * (sin(2 * M_PI * f * t) + 0.5 * sin(4 * M_PI * f * t)
+             + 0.25 * sin(6 * M_PI * f * t));
+    }
+  }
+}
+
+/* run the detector on x in blocks of varying sizes */
+static void detect (rta_onset_t *onset, const rta_real_t *x, int max_block, onsets_t *onsets)
+{
+  int i = 0, n = 1, found = 0;
+
+  onsets->count = 0;
+  rta_onset_reset(onset);
+  rta_onset_set_callback(onset, onsets, collect);
+
+  while (i < SIZE)
+  {
+    if (n > SIZE - i)
+      n = SIZE - i;
+
+    found += rta_onset_process(onset, x + i, n);
+    i += n;
+    n = (n * 7 + 13) % max_block + (max_block == 1);
+  }
+
+  assert(found == onsets->count);
+}
+
+static void check (const onsets_t *onsets, double tolerance)
+{
+  int e;
+
+  assert(onsets->count == NEVENTS);
+
+  for (e = 0; e < NEVENTS; e++)
+    assert(fabs(onsets->times[e] - event_times[e]) < tolerance);
+}
+
+
+int main (int argc, char *argv[])
+{
+  static rta_real_t x[SIZE];
+  rta_onset_params_t params;
+  rta_onset_t *onset;
+  onsets_t reference, onsets;
+  int level, e;
+
+  generate(x);
+
+  /* default parameters: mel bands, log compression */
+  rta_onset_params_default(&params, SAMPLE_RATE);
+  assert(params.frame_size == 1024  &&  params.hop_size == 256);
+  assert(rta_onset_new(&onset, &params));
+  printf("latency %.1f ms\n", rta_onset_get_latency(onset) * 1000);
+
+  detect(onset, x, SIZE, &reference);
+  for (e = 0; e < reference.count  &&  e < MAX_ONSETS; e++)
+    printf("onset %.3f s\n", reference.times[e]);
+  check(&reference, (double) params.hop_size / SAMPLE_RATE * 2);
+
+  /* the same onsets, whatever the blocks and the dispatch level */
+  for (level = 0; level < rta_cpu_num_levels; level++)
+  {
+    if (!rta_cpu_has(level))
+      continue;
+
+    rta_cpu_set_level(level);
+    detect(onset, x, 1000, &onsets);
+    check(&onsets, (double) params.hop_size / SAMPLE_RATE * 2);
+    detect(onset, x, 1, &onsets);
+    assert(onsets.count == reference.count);
+    for (e = 0; e < NEVENTS; e++)
+      assert(onsets.times[e] == reference.times[e]);
+  }
+  rta_cpu_set_level(rta_cpu_num_levels);
+  rta_onset_delete(onset);
+
+  /* flux on the spectrum bins, without compression */
+  params.num_bands = 0;
+  params.compression = 0;
+  params.threshold = 0.01;
+  assert(rta_onset_new(&onset, &params));
+  detect(onset, x, 512, &onsets);
+  check(&onsets, (double) params.hop_size / SAMPLE_RATE * 2);
+  rta_onset_delete(onset);
+
+  /* invalid parameters */
+  params.frame_size = 1000;
+  assert(!rta_onset_new(&onset, &params)  &&  onset == NULL);
+
+  printf("rta_onset_test: ok\n");
+  return 0;
+}
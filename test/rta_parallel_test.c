@@ -0,0 +1,196 @@
+/*
+
+Test of the parallel loops (rta_parallel.h): every iteration runs
+exactly once, reductions give the same result whatever the number of
+threads, and the adopted functions (Mahalanobis distances, kd-tree
+build) match their serial results.
+
+- compile
+
+cc -O2 ../src/recognition/rta_kdtree*.c ../src/recognition/rta_mahalanobis.c ../src/util/rta_*.c rta_parallel_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/recognition/ -lm -lpthread -o rta_parallel_test
+
+- run
+
+./rta_parallel_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_parallel.h"
+#include "rta_mahalanobis.h"
+#include "rta_kdtree.h"
+
+#define N 100000
+#define M 64
+#define C 500
+#define DIM 8
+#define NVECTORS 20000
+
+static int hits[N];
+
+static void mark (void *context, int begin, int end)
+{
+  int i;
+
+  for (i = begin; i < end; i++)
+    hits[i]++;
+}
+
+/* float sum: the result depends on the order of the additions */
+static void sum (void *context, int begin, int end, void *partial)
+{
+  const float *x = (const float *) context;
+  int i;
+
+  for (i = begin; i < end; i++)
+    *(float *) partial += x[i];
+}
+
+static void add (void *context, void *accumulator, const void *partial)
+{
+  *(float *) accumulator += *(const float *) partial;
+}
+
+/* nested loop: runs serially inside the outer one */
+static void outer (void *context, int begin, int end)
+{
+  int i;
+
+  for (i = begin; i < end; i++)
+    rta_parallel_for(10, 1, mark, NULL);
+}
+
+/* host thread pool running the tasks on the calling thread */
+static int host_tasks = 0;
+
+static void host (void *context, int num_tasks, rta_parallel_task_t task, void *arg)
+{
+  int i;
+
+  for (i = num_tasks - 1; i >= 0; i--)
+  {
+    task(arg, i);
+    host_tasks++;
+  }
+}
+
+static float reduce_sum (const float *x)
+{
+  const float zero = 0;
+  float result = -1;
+
+  assert(rta_parallel_reduce(N, 64, sizeof(float), &zero, sum, add, (void *) x, &result));
+  return result;
+}
+
+static void build_tree (rta_kdtree_t *tree, rta_real_t **data, int *nvectors)
+{
+  rta_kdtree_init(tree);
+  rta_kdtree_set_data(tree, 1, data, NULL, nvectors, DIM);
+  rta_kdtree_init_nodes(tree, NULL, NULL, NULL);
+  rta_kdtree_build(tree, 0);
+}
+
+
+int main (int argc, char *argv[])
+{
+  static float x[N];
+  static rta_real_t in[M * DIM], mu[C * DIM], sigma[C * DIM];
+  static rta_real_t out_serial[C * M], out_parallel[C * M];
+  static rta_real_t data[NVECTORS * DIM];
+  rta_real_t *datablock = data;
+  int nvectors = NVECTORS;
+  rta_kdtree_t serial_tree, parallel_tree;
+  float serial_sum;
+  int i;
+
+  assert(rta_parallel_get_num_threads() >= 1);
+
+  for (i = 0; i < N; i++)
+    x[i] = 1.f / (1 + i % 1000) + (i % 7) * 1e-3f;
+
+  /* serial reference */
+  rta_parallel_set_num_threads(1);
+  rta_parallel_for(N, 64, mark, NULL);
+  serial_sum = reduce_sum(x);
+
+  /* parallel for: each iteration exactly once */
+  assert(rta_parallel_set_num_threads(4) == 4);
+  rta_parallel_for(N, 64, mark, NULL);
+  rta_parallel_for(N, 1, mark, NULL);
+
+  for (i = 0; i < N; i++)
+    assert(hits[i] == 3);
+
+  /* deterministic reduction */
+  for (i = 0; i < 10; i++)
+    assert(reduce_sum(x) == serial_sum);
+
+  printf("parallel for and reduce: ok, sum %f with %d threads\n",
+         serial_sum, rta_parallel_get_num_threads());
+
+  /* nested loops */
+  memset(hits, 0, sizeof(hits));
+  rta_parallel_for(100, 1, outer, NULL);
+
+  for (i = 0; i < 10; i++)
+    assert(hits[i] == 100);
+
+  /* host thread pool */
+  rta_parallel_set_host(host, NULL, 3);
+  assert(rta_parallel_get_num_threads() == 3);
+  assert(reduce_sum(x) == serial_sum);
+  assert(host_tasks == 3);
+  rta_parallel_set_host(NULL, NULL, 0);
+  assert(rta_parallel_get_num_threads() == 4);
+
+  /* Mahalanobis distances */
+  for (i = 0; i < M * DIM; i++)
+    in[i] = sin(0.37 * i);
+  for (i = 0; i < C * DIM; i++)
+  {
+    mu[i] = cos(0.11 * i);
+    sigma[i] = 1 + (i % 5) * 0.25;
+  }
+
+  rta_parallel_set_num_threads(1);
+  rta_mahalanobis(M, DIM, C, in, 1, DIM, mu, 1, DIM, sigma, 1, DIM, out_serial, M, 1);
+  rta_parallel_set_num_threads(4);
+  rta_mahalanobis(M, DIM, C, in, 1, DIM, mu, 1, DIM, sigma, 1, DIM, out_parallel, M, 1);
+  assert(memcmp(out_serial, out_parallel, sizeof(out_serial)) == 0);
+  printf("rta_mahalanobis: ok\n");
+
+  /* kd-tree build */
+  for (i = 0; i < NVECTORS * DIM; i++)
+    data[i] = (i * 7919) % 1009 / 1009.;
+
+  rta_parallel_set_num_threads(1);
+  build_tree(&serial_tree, &datablock, &nvectors);
+  rta_parallel_set_num_threads(4);
+  build_tree(&parallel_tree, &datablock, &nvectors);
+
+  assert(serial_tree.nnodes == parallel_tree.nnodes);
+  assert(memcmp(serial_tree.dataindex, parallel_tree.dataindex,
+                NVECTORS * sizeof(rta_kdtree_object_t)) == 0);
+  assert(memcmp(serial_tree.nodes, parallel_tree.nodes,
+                serial_tree.nnodes * sizeof(rta_kdtree_node_t)) == 0);
+  assert(memcmp(serial_tree.mean, parallel_tree.mean,
+                serial_tree.nnodes * DIM * sizeof(rta_real_t)) == 0);
+#if RTA_KDTREE_PROFILE_BUILD
+  assert(memcmp(&serial_tree.profile, &parallel_tree.profile,
+                sizeof(rta_kdtree_profile_t)) == 0);
+#endif
+  printf("rta_kdtree_build: ok, %d nodes\n", parallel_tree.nnodes);
+
+  rta_kdtree_free(&serial_tree);
+  rta_kdtree_free(&parallel_tree);
+  rta_parallel_shutdown();
+
+  printf("rta_parallel_test: ok\n");
+  return 0;
+}
@@ -0,0 +1,159 @@
+/*
+
+Test of the integer PCM framing (rta_pcm.h): for each sample format,
+channel layout, frame size and supported dispatch level, the fused
+frame matches the conversion followed by rta_preemphasis_signal and
+rta_window_apply, and consecutive frames chain their pre-emphasis.
+
+- compile
+
+cc -O2 ../src/signal/rta_pcm.c ../src/signal/rta_preemphasis.c ../src/signal/rta_window.c ../src/signal/rta_tables.c ../src/util/rta_cpu.c rta_pcm_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -lm -o rta_pcm_test
+
+- run
+
+./rta_pcm_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_pcm.h"
+#include "rta_cpu.h"
+#include "rta_preemphasis.h"
+#include "rta_window.h"
+
+#define MAX_SIZE 1100
+#define MAX_CHANNELS 3
+
+static unsigned char input[MAX_SIZE * MAX_CHANNELS * 4];
+static const double full_scales[] = { 32768., 8388608., 2147483648. };
+
+/* pseudo-random samples over the full range of format */
+static void fill (rta_pcm_format_t format, unsigned int n)
+{
+  unsigned int i, seed = 12345;
+
+  for (i = 0; i < n; i++)
+  {
+    int32_t value;
+
+    seed = seed * 1103515245 + 12345;
+    value = (int32_t) seed;
+
+    switch (format)
+    {
+      case rta_pcm_int16:
+      {
+        int16_t v16 = (int16_t) (value >> 16);
+        memcpy(input + 2 * i, &v16, 2);
+        break;
+      }
+      case rta_pcm_int24:
+        input[3 * i] = (unsigned char) (value >> 8);
+        input[3 * i + 1] = (unsigned char) (value >> 16);
+        input[3 * i + 2] = (unsigned char) (value >> 24);
+        break;
+      case rta_pcm_int32:
+        memcpy(input + 4 * i, &value, 4);
+        break;
+    }
+  }
+}
+
+/* sample i of channel, converted as before */
+static rta_real_t sample (rta_pcm_format_t format, unsigned int channels,
+                          unsigned int channel, unsigned int i, rta_real_t gain)
+{
+  const unsigned int size = rta_pcm_sample_size(format);
+  const unsigned char *p = input + (i * channels + channel) * size;
+  int32_t value = 0;
+
+  switch (format)
+  {
+    case rta_pcm_int16:
+    {
+      int16_t v16;
+      memcpy(&v16, p, 2);
+      value = v16;
+      break;
+    }
+    case rta_pcm_int24:
+      value = (int32_t) ((uint32_t) p[0] << 8 | (uint32_t) p[1] << 16 | (uint32_t) p[2] << 24) >> 8;
+      break;
+    case rta_pcm_int32:
+      memcpy(&value, p, 4);
+      break;
+  }
+
+  return gain * (value / full_scales[format]);
+}
+
+static void check (rta_pcm_format_t format, unsigned int channels,
+                   unsigned int channel, unsigned int size, int windowed)
+{
+  static rta_real_t x[MAX_SIZE], expected[MAX_SIZE], output[MAX_SIZE], weights[MAX_SIZE];
+  const rta_real_t gain = 0.5, preemphasis = 0.97;
+  const unsigned int half = size / 2;
+  rta_real_t previous_expected = 0.25, previous = 0.25;
+  unsigned int i;
+
+  for (i = 0; i < size; i++)
+    x[i] = sample(format, channels, channel, i, gain);
+
+  rta_window_hann_weights(weights, size);
+  rta_preemphasis_signal(expected, x, size, &previous_expected, preemphasis);
+  if (windowed)
+    rta_window_apply_in_place(expected, size, weights);
+
+  /* in two frames, the second one continuing the pre-emphasis */
+  rta_pcm_frame(output, input, format, channels, channel, half, gain,
+                &previous, preemphasis, windowed ? weights : NULL);
+  rta_pcm_frame(output + half, input + half * channels * rta_pcm_sample_size(format),
+                format, channels, channel, size - half, gain,
+                &previous, preemphasis, windowed ? weights + half : NULL);
+
+  assert(previous == x[size - 1]);
+  for (i = 0; i < size; i++)
+    assert(fabs(output[i] - expected[i]) <= 1e-6 * (1 + fabs(expected[i])));
+}
+
+
+int main (int argc, char *argv[])
+{
+  const unsigned int sizes[] = { 2, 3, 9, 16, 17, 33, 1024, MAX_SIZE };
+  unsigned int level, format, channels, channel, s;
+  int nlevels = 0;
+
+  for (level = 0; level < rta_cpu_num_levels; level++)
+  {
+    if (!rta_cpu_has(level))
+      continue;
+
+    rta_cpu_set_level(level);
+    nlevels++;
+
+    for (format = rta_pcm_int16; format <= rta_pcm_int32; format++)
+    {
+      fill(format, MAX_SIZE * MAX_CHANNELS);
+
+      for (channels = 1; channels <= MAX_CHANNELS; channels++)
+        for (channel = 0; channel < channels; channel++)
+          for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+          {
+            check(format, channels, channel, sizes[s], 1);
+            check(format, channels, channel, sizes[s], 0);
+          }
+    }
+  }
+
+  rta_cpu_set_level(rta_cpu_num_levels);
+
+  assert(rta_pcm_sample_size(rta_pcm_int24) == 3);
+  printf("rta_pcm_test: ok, %d dispatch levels\n", nlevels);
+  return 0;
+}
@@ -0,0 +1,464 @@
+/*
+
+Scaling benchmark of the physical models: for problem sizes from 1k
+to 1M points, run rta_msdr_update on a perturbed spring lattice and
+UniSpring::update (2D, plain and multilevel) and UniSpring::update_3D
+on clustered points until convergence or a step or time limit, and
+report setup time, time per step (mean and median), iterations to
+convergence, retriangulation count and peak memory.
+
+Before the runs, the cached distance grid of a non-convex polygon is
+checked against the exact signed distance.
+
+The solver runs use UniSpringSolver: the host thread reads snapshots
+while the worker iterates, cancels it after half of maxsteps, and
+checks that the final snapshot equals the points of as many
+synchronous update() steps.
+
+- compile (UniSpring needs the TTL halfedge library, see rta_unispring.h)
+
+cc -O2 -DNDEBUG -c ../src/physical-models/rta_msdr.c ../src/util/rta_alloc.c ../src/util/rta_parallel.c ../src/util/rta_thread.c ../src/util/rta_trace.c -I ../bindings/console/ -I ../src -I ../src/util/
+c++ -O2 -DNDEBUG -std=c++11 ../src/physical-models/rta_unispring*.cpp rta_physical_models_bench.cpp rta_msdr.o rta_alloc.o rta_parallel.o rta_thread.o rta_trace.o -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/physical-models/ -I <ttl>/include -L <ttl>/lib -lttl -lm -lpthread -o rta_physical_models_bench
+
+For the 3D mass-spring path, add -DRTA_MSDR_NDIM=3 -DRTA_MSDR_NDIM_STR=\"3\" to both lines.
+
+- run
+
+./rta_physical_models_bench [-n maxsize] [-s maxsteps] [-t seconds-per-run] [-k filter] [-o result.json]
+./rta_physical_models_bench -c base.json new.json [regression-threshold-percent]
+
+Sizes go from 1000 up to maxsize (default 1000000) by factors of 10.
+Each run stops at convergence, after maxsteps steps (default 1000) or
+after the given time (default 10 s), whichever comes first; converged
+is 0 in the two latter cases.  Peak memory is the process peak after
+the run, which is meaningful since sizes grow.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+#include "rta_configuration.h"
+#include "rta_msdr.h"
+#include "rta_unispring.h"
+#include "rta_unispring_solver.h"
+
+#include "rta_bench.h"
+
+using namespace UniSpringSpace;
+
+#define NUM_CLUSTERS 8
+
+static int    maxsteps = 1000;
+static double maxtime  = 10e9;   /* ns */
+static const char *filter = NULL;
+
+typedef struct run_result
+{
+  double setup_ns;
+  std::vector<double> step_ns;
+  int    converged;
+  int    triangulations;
+  int    edges;
+} run_result_t;
+
+
+static void report (rta_bench_output_t *out, const char *name, int size, run_result_t *res)
+{
+  std::vector<double> sorted(res->step_ns);
+  int nsteps = (int) sorted.size();
+  double sum = 0, mean, p50;
+  char fields[512];
+
+  for (int i = 0; i < nsteps; i++)
+    sum += sorted[i];
+  std::sort(sorted.begin(), sorted.end());
+
+  mean = nsteps > 0  ?  sum / nsteps  :  0;
+  p50  = rta_bench_percentile(nsteps > 0 ? &sorted[0] : NULL, nsteps, 0.5);
+
+  printf("%-24s %8d %10.2f %12.2f %12.2f %7d %5d %7d %9.1f\n", name, size,
+         res->setup_ns * 1e-6, mean * 1e-3, p50 * 1e-3, nsteps, res->converged,
+         res->triangulations, rta_bench_peak_memory() / 1048576.);
+
+  snprintf(fields, sizeof(fields),
+           "\"size\": %d, \"setup_ms\": %g, \"step_us\": %g, \"step_p50_us\": %g, "
+           "\"steps\": %d, \"converged\": %d, \"triangulations\": %d, \"edges\": %d, \"peak_mb\": %g",
+           size, res->setup_ns * 1e-6, mean * 1e-3, p50 * 1e-3, nsteps, res->converged,
+           res->triangulations, res->edges, rta_bench_peak_memory() / 1048576.);
+  rta_bench_json_result(out, name, fields);
+}
+
+
+/*
+ *  mass-spring-damper: lattice of side n^(1/D) with links to the next
+ *  neighbour along each dimension, started from jittered positions
+ */
+
+static void run_msdr (int n, run_result_t *res)
+{
+  const int ndim = RTA_MSDR_NDIM;
+  int side = (int) floor(pow((double) n, 1. / ndim) + 0.5);
+  int nmass = 1, i, d;
+  rta_msdr_t sys;
+  double start, elapsed = 0;
+
+  for (d = 0; d < ndim; d++)
+    nmass *= side;
+
+  std::vector<float> pos(nmass * ndim), invmass(nmass, 1.f);
+
+  for (i = 0; i < nmass * ndim; i++)
+  {
+    int coord = (i / ndim);
+
+    for (d = 0; d < i % ndim; d++)
+      coord /= side;
+
+    pos[i] = (float) (coord % side) + 0.3f * (float) (rta_bench_uniform() - 0.5);
+  }
+
+  start = rta_bench_now_ns();
+  rta_msdr_init(&sys, nmass, nmass * ndim, 2 * ndim);
+  rta_msdr_set(&sys, nmass, &pos[0], &invmass[0]);
+
+  for (i = 0; i < nmass; i++)
+  {
+    int stride = 1;
+
+    for (d = 0; d < ndim; d++, stride *= side)
+      if ((i / stride) % side < side - 1)
+        rta_msdr_add_link(&sys, i, i + stride, 1.f, 0, 0.1f, 0.05f, 0.02f, 0.f, 0.f);
+  }
+  res->setup_ns = rta_bench_now_ns() - start;
+
+  res->converged = 0;
+  res->triangulations = 0;
+  res->edges = rta_msdr_get_num_links(&sys);
+  res->step_ns.clear();
+
+  while ((int) res->step_ns.size() < maxsteps  &&  elapsed < maxtime)
+  {
+    double t0 = rta_bench_now_ns(), dt;
+
+    rta_msdr_update(&sys);
+    dt = rta_bench_now_ns() - t0;
+    res->step_ns.push_back(dt);
+    elapsed += dt;
+
+    /* mean speed per mass under 1e-4 lattice spacing per step */
+    if (rta_msdr_get_movement(&sys) < 1e-4f * nmass)
+    {
+      res->converged = 1;
+      break;
+    }
+  }
+
+  rta_msdr_free(&sys);
+}
+
+
+/*
+ *  UniSpring: points drawn from a mixture of gaussian clusters, so that
+ *  uniformisation has to move most of them
+ */
+
+static void clustered_points (int n, int ndim, std::vector<float> &points)
+{
+  double centers[NUM_CLUSTERS][3];
+  int c, i, d;
+
+  for (c = 0; c < NUM_CLUSTERS; c++)
+    for (d = 0; d < ndim; d++)
+      centers[c][d] = 0.2 + 0.6 * rta_bench_uniform();
+
+  points.resize(n * ndim);
+
+  for (i = 0; i < n; i++)
+  {
+    c = (int) (rta_bench_uniform() * NUM_CLUSTERS);
+
+    for (d = 0; d < ndim; d++)
+      points[i * ndim + d] = (float) (centers[c][d] + 0.05 * rta_bench_gauss());
+  }
+}
+
+static void run_unispring (int n, int ndim, int multilevel, run_result_t *res)
+{
+  UniSpring us;
+  Square square;
+  Cube cube;
+  std::vector<float> points;
+  double start, elapsed = 0;
+
+  clustered_points(n, ndim, points);
+
+  if (multilevel)
+    us.set_multilevel(256, 4);
+
+  start = rta_bench_now_ns();
+  if (ndim == 2)
+    us.set_points(n, 2, &points[0], &square, false);
+  else
+    us.set_points_3D(n, &points[0], &cube, false);
+  res->setup_ns = rta_bench_now_ns() - start;
+
+  res->converged = 0;
+  res->step_ns.clear();
+
+  while ((int) res->step_ns.size() < maxsteps  &&  elapsed < maxtime)
+  {
+    double t0 = rta_bench_now_ns(), dt;
+    int stop = ndim == 2  ?  us.update()  :  us.update_3D();
+
+    dt = rta_bench_now_ns() - t0;
+    res->step_ns.push_back(dt);
+    elapsed += dt;
+
+    if (stop)
+    {
+      res->converged = 1;
+      break;
+    }
+  }
+
+  res->triangulations = us.get_num_triangulations();
+  res->edges = us.get_num_edges();
+}
+
+
+/*
+ *  polygon distance grid: bilinear lookup against the exact distance, on
+ *  random points inside the scaled bounding box and up to 0.3 outside.
+ *  The distance is 1-Lipschitz, so the error is at most a cell diagonal.
+ */
+
+static int check_polygon_grid (double res)
+{
+  /* C shape, 4 wide and 3 high, scaled to [0, 8/3] x [0, 2] */
+  const double corners[8][2] = { {0, 0}, {4, 0}, {4, 1}, {1, 1}, {1, 2}, {4, 2}, {4, 3}, {0, 3} };
+  const int npoints = 100000;
+  std::vector< std::vector<double> > vertices;
+  std::vector<double> px(npoints), py(npoints), exact(npoints);
+  double bound, maxerr = 0;
+  int i, ok;
+
+  for (i = 0; i < 8; i++)
+    vertices.push_back(std::vector<double>(corners[i], corners[i] + 2));
+
+  UniSpringSpace::Polygon poly(vertices);
+
+  for (i = 0; i < npoints; i++)
+  {
+    px[i] = -0.3 + (2 * poly.ratio + 0.6) * rta_bench_uniform();
+    py[i] = -0.3 + 2.6 * rta_bench_uniform();
+    exact[i] = poly.fd_compute(px[i], py[i]);
+  }
+
+  poly.buildDistanceGrid(res);
+
+  for (i = 0; i < npoints; i++)
+    maxerr = std::max(maxerr, fabs(poly.fd_compute(px[i], py[i]) - exact[i]));
+
+  bound = hypot(2 * poly.ratio * res, 2 * res) + 1e-9;
+  ok = poly.hasDistanceGrid()  &&  maxerr <= bound;
+  printf("polygon_grid res %-8g max error %.6f bound %.6f %s\n", res, maxerr, bound, ok ? "ok" : "FAILED");
+
+  return ok;
+}
+
+/*
+ *  UniSpringSolver: the same uniformisation on the worker thread, read
+ *  by snapshots and cancelled mid-run, against synchronous steps
+ */
+
+static int run_solver (int n, int ndim, run_result_t *res)
+{
+  UniSpring us, ref;
+  UniSpringSolver solver(&us);
+  Square square;
+  Cube cube;
+  std::vector<float> points, snapshot(n * ndim), expected(n * ndim);
+  const int cancel_at = std::max(maxsteps / 2, 1);
+  int serial, last_serial, nsnapshots = 0, iterations, i, ok = 1;
+  solver_status_t status;
+  double start, elapsed, maxdiff = 0;
+
+  clustered_points(n, ndim, points);
+
+  start = rta_bench_now_ns();
+  if (ndim == 2)
+    solver.set_points(n, 2, &points[0], &square, false);
+  else
+    solver.set_points_3D(n, &points[0], &cube, false);
+  res->setup_ns = rta_bench_now_ns() - start;
+
+  last_serial = solver.get_points_scaled(&snapshot[0]);
+  ok &= last_serial > 0;
+
+  start = rta_bench_now_ns();
+  solver.start(maxtime * 1e-9, 1);
+
+  while (solver.is_running())
+  {
+    serial = solver.get_points_scaled(&snapshot[0]);
+    ok &= serial >= last_serial  &&  std::isfinite(snapshot[0])  &&  std::isfinite(snapshot[n * ndim - 1]);
+    nsnapshots += serial > last_serial;
+    last_serial = serial;
+
+    if (solver.get_num_iterations() >= cancel_at)
+      solver.cancel();
+  }
+
+  solver.cancel(); /* join the finished worker */
+  elapsed = rta_bench_now_ns() - start;
+  status = solver.get_status();
+  iterations = solver.get_num_iterations();
+  ok &= solver.get_points_scaled(&snapshot[0]) > last_serial  ||  iterations == 0;
+
+  /* as many synchronous steps on the same points */
+  if (ndim == 2)
+    ref.set_points(n, 2, &points[0], &square, false);
+  else
+    ref.set_points_3D(n, &points[0], &cube, false);
+
+  for (i = 0; i < iterations; i++)
+    if (ndim == 2)
+      ref.update();
+    else
+      ref.update_3D();
+
+  if (ndim == 2)
+    ref.get_points_scaled(&expected[0]);
+  else
+    ref.get_points_scaled_3D(&expected[0]);
+
+  for (i = 0; i < n * ndim; i++)
+    maxdiff = std::max(maxdiff, fabs((double) snapshot[i] - expected[i]));
+  ok &= maxdiff == 0;
+
+  printf("  solver %s after %d steps, %d snapshots read while running, "
+         "max difference to synchronous steps %g %s\n",
+         status == solver_cancelled  ?  "cancelled"  :  status == solver_converged  ?  "converged"  :  "timed out",
+         iterations, nsnapshots, maxdiff, ok  ?  "ok"  :  "FAILED");
+
+  res->converged = status == solver_converged;
+  res->step_ns.assign(iterations, iterations > 0  ?  elapsed / iterations  :  0);
+  res->triangulations = us.get_num_triangulations();
+  res->edges = us.get_num_edges();
+
+  return ok;
+}
+
+
+static int selected (const char *name)
+{
+  return filter == NULL  ||  strstr(name, filter) != NULL;
+}
+
+int main (int argc, char *argv[])
+{
+  rta_bench_output_t out = { NULL, 0 };
+  int maxsize = 1000000, size, i, nfailed = 0;
+  char attributes[256], name[64];
+
+  if (argc >= 4  &&  strcmp(argv[1], "-c") == 0)
+  {
+    double threshold = argc >= 5  ?  atof(argv[4]) / 100.  :  0.05;
+    int nregress = rta_bench_compare(argv[2], argv[3], "step_us", 0, threshold);
+    nregress += rta_bench_compare(argv[2], argv[3], "steps", 0, threshold);
+    return nregress != 0;
+  }
+
+  for (i = 1; i < argc - 1; i += 2)
+  {
+    if (strcmp(argv[i], "-n") == 0)
+      maxsize = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-s") == 0)
+      maxsteps = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-t") == 0)
+      maxtime = atof(argv[i + 1]) * 1e9;
+    else if (strcmp(argv[i], "-k") == 0)
+      filter = argv[i + 1];
+    else if (strcmp(argv[i], "-o") == 0)
+      out.file = fopen(argv[i + 1], "w");
+  }
+
+  snprintf(attributes, sizeof(attributes), "\"msdr_ndim\": %d, \"max_steps\": %d, \"max_seconds\": %g",
+           RTA_MSDR_NDIM, maxsteps, maxtime * 1e-9);
+  rta_bench_json_begin(&out, "rta_physical_models", attributes);
+
+  if (selected("polygon_grid"))
+  {
+    rta_bench_seed(1);
+    nfailed += !check_polygon_grid(POLYGON_GRID_RES);
+    nfailed += !check_polygon_grid(1. / 16 - 1e-12);
+  }
+
+  printf("%-24s %8s %10s %12s %12s %7s %5s %7s %9s\n", "name", "size", "setup_ms",
+         "step_us", "step_p50_us", "steps", "conv", "triang", "peak_mb");
+
+  for (size = 1000; size <= maxsize; size *= 10)
+  {
+    run_result_t res;
+
+    rta_bench_seed(size);
+    snprintf(name, sizeof(name), "msdr_%dd_%d", RTA_MSDR_NDIM, size);
+    if (selected(name))
+    {
+      run_msdr(size, &res);
+      report(&out, name, size, &res);
+    }
+
+    rta_bench_seed(size);
+    snprintf(name, sizeof(name), "unispring_2d_%d", size);
+    if (selected(name))
+    {
+      run_unispring(size, 2, 0, &res);
+      report(&out, name, size, &res);
+    }
+
+    rta_bench_seed(size);
+    snprintf(name, sizeof(name), "unispring_2d_multilevel_%d", size);
+    if (selected(name))
+    {
+      run_unispring(size, 2, 1, &res);
+      report(&out, name, size, &res);
+    }
+
+    rta_bench_seed(size);
+    snprintf(name, sizeof(name), "unispring_3d_%d", size);
+    if (selected(name))
+    {
+      run_unispring(size, 3, 0, &res);
+      report(&out, name, size, &res);
+    }
+
+    rta_bench_seed(size);
+    snprintf(name, sizeof(name), "unispring_2d_solver_%d", size);
+    if (selected(name))
+    {
+      nfailed += !run_solver(size, 2, &res);
+      report(&out, name, size, &res);
+    }
+
+    rta_bench_seed(size);
+    snprintf(name, sizeof(name), "unispring_3d_solver_%d", size);
+    if (selected(name))
+    {
+      nfailed += !run_solver(size, 3, &res);
+      report(&out, name, size, &res);
+    }
+  }
+
+  rta_bench_json_end(&out);
+
+  if (out.file)
+    fclose(out.file);
+
+  return nfailed != 0;
+}
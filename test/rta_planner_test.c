@@ -0,0 +1,225 @@
+/*
+
+Test of the planner (rta_planner.h) and of the FFT radix it chooses:
+the radix-4 passes compute the same transforms as the radix-2 ones,
+of all types and sizes, and match a DFT; measuring picks the fastest
+candidate and keeps it in the wisdom, which survives an export and an
+import.
+
+- compile
+
+cc -O2 ../src/signal/rta_*.c ../src/statistics/rta_selection.c ../src/util/rta_*.c rta_planner_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -I ../src/statistics/ -lm -lpthread -o rta_planner_test
+
+- run
+
+./rta_planner_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_planner.h"
+#include "rta_fft.h"
+#include "rta_cpu.h"
+
+#define MAX_SIZE 65536
+#define PATH "rta_planner_test.wisdom"
+
+static rta_real_t input[2 * MAX_SIZE];
+static rta_real_t radix2[2 * MAX_SIZE + 2], radix4[2 * MAX_SIZE + 2];
+
+/* transform of 'input' with the passes of 'radix', forced by the wisdom */
+static void transform (rta_real_t *output, const rta_fft_t type,
+                       const unsigned int size, const int radix)
+{
+  const int real = (type == rta_fft_real_to_complex_1d  ||  type == rta_fft_complex_to_real_1d);
+  rta_real_t scale = 1, nyquist = 0;
+  rta_fft_setup_t *fft;
+
+  rta_planner_wisdom_add(real ? "fft_real" : "fft_complex", real ? size / 2 : size,
+                         radix == 4);
+
+  if (real)
+  {
+    /* spectrum input: half-spectrum with the Nyquist value apart */
+    assert(rta_fft_real_setup_new(&fft, type, &scale, input, size, output, size,
+                                  &nyquist));
+    if (type == rta_fft_complex_to_real_1d)
+      nyquist = input[1];
+    rta_fft_real_execute(output, input, size, fft, &nyquist);
+    output[size] = nyquist;
+  }
+  else
+  {
+    assert(rta_fft_setup_new(&fft, type, &scale, (rta_complex_t *) input, size,
+                             (rta_complex_t *) output, size));
+    rta_fft_execute(output, input, size, fft);
+  }
+
+  rta_fft_setup_delete(fft);
+}
+
+/* radix-2 and radix-4 agree, for all types and sizes */
+static void check_radix (void)
+{
+  unsigned int size, i;
+  int type;
+
+  for (i = 0; i < 2 * MAX_SIZE; i++)
+    input[i] = sin(0.37 * i) + 0.25 * cos(0.011 * i * i);
+
+  for (type = rta_fft_real_to_complex_1d; type <= rta_fft_complex_inverse_1d; type++)
+    for (size = 4; size <= MAX_SIZE; size *= 2)
+    {
+      const unsigned int n = (type <= rta_fft_complex_to_real_1d) ? size + 1 : 2 * size;
+      double error = 0, norm = 0;
+
+      transform(radix2, type, size, 2);
+      transform(radix4, type, size, 4);
+
+      for (i = 0; i < n; i++)
+      {
+        error = fmax(error, fabs(radix2[i] - radix4[i]));
+        norm = fmax(norm, fabs(radix2[i]));
+      }
+
+      if (error > 1e-5 * norm)
+      {
+        printf("type %d size %u: radix-4 error %g of %g\n", type, size, error, norm);
+        assert(0);
+      }
+    }
+
+  rta_planner_wisdom_forget();
+  printf("radix-4 passes: ok, sizes 4 to %d\n", MAX_SIZE);
+}
+
+/* complex radix-4 of odd and even numbers of passes, against a DFT */
+static void check_dft (void)
+{
+  const unsigned int sizes[] = { 2, 8, 32, 64 };
+  unsigned int s, k, i;
+
+  for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+  {
+    const unsigned int size = sizes[s];
+
+    transform(radix4, rta_fft_complex_1d, size, 4);
+
+    for (k = 0; k < size; k++)
+    {
+      double re = 0, im = 0;
+
+      for (i = 0; i < size; i++)
+      {
+        const double phase = -2 * M_PI * i * k / size;
+
+        re += input[2 * i] * cos(phase) - input[2 * i + 1] * sin(phase);
+        im += input[2 * i] * sin(phase) + input[2 * i + 1] * cos(phase);
+      }
+
+      assert(fabs(radix4[2 * k] - re) < 1e-4 * size);
+      assert(fabs(radix4[2 * k + 1] - im) < 1e-4 * size);
+    }
+  }
+
+  rta_planner_wisdom_forget();
+  printf("radix-4 against DFT: ok\n");
+}
+
+
+/* candidates of increasing cost */
+static volatile double sink;
+
+static void run (void *context, const unsigned int candidate)
+{
+  const int slowest = *(int *) context;
+  int i, n = 20000 * (candidate == (unsigned int) slowest ? 10 : (int) candidate + 1);
+  double x = 0;
+
+  for (i = 0; i < n; i++)
+    x += sqrt((double) i);
+  sink = x;
+}
+
+static void check_planner (void)
+{
+  rta_real_t scale = 1;
+  rta_fft_setup_t *fft;
+  FILE *file;
+  int slowest = 0;
+
+  /* estimate: heuristic, nothing kept */
+  rta_planner_set_mode(rta_planner_estimate);
+  assert(rta_planner_get_mode() == rta_planner_estimate);
+  assert(rta_planner_choose("cost", 1, 3, 2, run, &slowest) == 2);
+  assert(rta_planner_choose("cost", 1, 3, 7, run, &slowest) == 0);
+  assert(rta_planner_wisdom_find("cost", 1) == -1);
+
+  /* measure: the fastest, kept */
+  rta_planner_set_mode(rta_planner_measure);
+  assert(rta_planner_choose("cost", 1, 3, 2, run, &slowest) == 1);
+  assert(rta_planner_wisdom_find("cost", 1) == 1);
+  assert(rta_planner_wisdom_find("cost", 2) == -1);
+
+  /* the wisdom wins over measuring */
+  slowest = 1;
+  assert(rta_planner_choose("cost", 1, 3, 2, run, &slowest) == 1);
+  assert(rta_planner_choose("cost", 2, 3, 2, run, &slowest) == 0);
+
+  /* but not when it names a candidate that does not exist */
+  rta_planner_wisdom_add("cost", 3, 5);
+  assert(rta_planner_choose("cost", 3, 3, 2, run, &slowest) == 0);
+
+  /* FFT setups measure too */
+  assert(rta_fft_setup_new(&fft, rta_fft_complex_1d, &scale, (rta_complex_t *) input, 1024,
+                           (rta_complex_t *) radix2, 1024));
+  rta_fft_setup_delete(fft);
+  assert(rta_planner_wisdom_find("fft_complex", 1024) >= 0);
+
+  /* export, forget, import */
+  assert(rta_planner_wisdom_export(PATH));
+  rta_planner_wisdom_forget();
+  assert(rta_planner_wisdom_find("cost", 1) == -1);
+  assert(rta_planner_wisdom_import(PATH));
+  assert(rta_planner_wisdom_find("cost", 1) == 1);
+  assert(rta_planner_wisdom_find("cost", 2) == 0);
+  assert(rta_planner_wisdom_find("fft_complex", 1024) >= 0);
+
+  /* lines of unknown levels and malformed lines are skipped */
+  file = fopen(PATH, "w");
+  fprintf(file, "rta-wisdom 1\ncost 10 %s 2\ncost 11 z80 1\ncost\n",
+          rta_cpu_level_name(rta_cpu_get_level()));
+  fclose(file);
+  rta_planner_wisdom_forget();
+  assert(rta_planner_wisdom_import(PATH));
+  assert(rta_planner_wisdom_find("cost", 10) == 2);
+  assert(rta_planner_wisdom_find("cost", 11) == -1);
+
+  /* not a wisdom file */
+  file = fopen(PATH, "w");
+  fprintf(file, "rta-wisdom 99\ncost 10 generic 2\n");
+  fclose(file);
+  assert(!rta_planner_wisdom_import(PATH));
+  assert(!rta_planner_wisdom_import("does/not/exist"));
+  assert(!rta_planner_wisdom_export("does/not/exist"));
+  remove(PATH);
+
+  rta_planner_wisdom_forget();
+  rta_planner_set_mode(rta_planner_estimate);
+  printf("rta_planner: ok\n");
+}
+
+int main (int argc, char *argv[])
+{
+  check_radix();
+  check_dft();
+  check_planner();
+
+  printf("rta_planner_test: ok\n");
+  return 0;
+}
@@ -0,0 +1,93 @@
+/*
+
+Test of the float and double kernel instances (rta_precision.h): both
+precisions are linked next to the rta_real_t build and must agree.
+
+- compile
+
+cc -g ../src/signal/rta_window.c ../src/signal/rta_tables.c ../src/signal/rta_correlation.c ../src/signal/rta_preemphasis.c ../src/signal/rta_delta.c ../src/signal/rta_dct.c ../src/signal/rta_lpc.c ../src/signal/rta_signal_*.c ../src/statistics/rta_mean_variance.c ../src/statistics/rta_moments.c ../src/statistics/rta_svd.c ../src/statistics/rta_statistics_*.c ../src/util/rta_*.c rta_precision_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -I ../src/statistics/ -lm -o rta_precision_test
+
+- run
+
+./rta_precision_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "rta_configuration.h"
+#include "rta_precision.h"
+
+#define N 64
+#define M 6
+
+int main (int argc, char *argv[])
+{
+  float      xf[N], wf[N], cf[M];
+  double     xd[N], wd[N], cd[M];
+  rta_real_t xr[N], wr[N], cr[M];
+  int i;
+
+  for (i = 0; i < N; i++)
+    xr[i] = xd[i] = xf[i] = sin(0.3 * i) + 0.1 * (i % 7);
+
+  /* window */
+  rta_window_hann_weights_f(wf, N);
+  rta_window_hann_weights_d(wd, N);
+  rta_window_hann_weights(wr, N);
+
+  for (i = 0; i < N; i++)
+  {
+    assert(fabs(wf[i] - wd[i]) < 1e-6);
+    assert(fabs(wr[i] - wd[i]) < 1e-6);
+  }
+
+  /* correlation */
+  rta_correlation_raw_f(cf, M, xf, xf, N - M);
+  rta_correlation_raw_d(cd, M, xd, xd, N - M);
+  rta_correlation_raw(cr, M, xr, xr, N - M);
+
+  for (i = 0; i < M; i++)
+  {
+    assert(fabs(cf[i] - cd[i]) < 1e-4 * fabs(cd[i]) + 1e-5);
+    assert(fabs(cr[i] - cd[i]) < 1e-4 * fabs(cd[i]) + 1e-5);
+  }
+
+  /* mean and variance: double resolves what float can't */
+  {
+    double big[2] = { 1e4 + 1, 1e4 + 3 };
+    double mean, variance;
+
+    rta_mean_variance_d(&mean, &variance, big, 2);
+    assert(mean == 1e4 + 2  &&  variance == 1);
+  }
+
+  /* svd of a 4 x 3 matrix in both precisions */
+  {
+    double Ad[12] = { 4, 0, 1,  2, 3, 0,  0, 1, 5,  1, 2, 1 };
+    float  Af[12];
+    double Ud[12], Sd[3], Vd[9];
+    float  Uf[12], Sf[3], Vf[9];
+    rta_svd_setup_d_t *setup_d;
+    rta_svd_setup_f_t *setup_f;
+
+    for (i = 0; i < 12; i++)
+      Af[i] = Ad[i];
+
+    assert(rta_svd_setup_new_d(&setup_d, rta_svd_out_of_place, Ud, Sd, Vd, Ad, 4, 3));
+    assert(rta_svd_setup_new_f(&setup_f, rta_svd_out_of_place, Uf, Sf, Vf, Af, 4, 3));
+    rta_svd_d(Ud, Sd, Vd, Ad, setup_d);
+    rta_svd_f(Uf, Sf, Vf, Af, setup_f);
+
+    for (i = 0; i < 3; i++)
+      assert(fabs(Sf[i] - Sd[i]) < 1e-5 * Sd[0]);
+
+    rta_svd_setup_delete_d(setup_d);
+    rta_svd_setup_delete_f(setup_f);
+  }
+
+  printf("rta_precision_test: float and double kernels agree\n");
+  return 0;
+}
@@ -0,0 +1,364 @@
+/*
+
+Test of the real-time allocation guard (rta_rtguard.h): run the
+processing functions of the library, each inside its own real-time
+section, and report any allocation they make.  Setup functions run
+outside of the sections.
+
+Functions that are known to allocate are listed as such: the test
+fails if one of the others allocates, or if the guard misses the
+allocations of the known ones.
+
+- compile
+
+cc -O2 -DRTA_RTGUARD=1 ../src/signal/rta_*.c ../src/statistics/rta_mean_variance.c ../src/statistics/rta_moments.c ../src/statistics/rta_selection.c ../src/recognition/rta_kdtree*.c ../src/recognition/rta_dtw.c ../src/physical-models/rta_msdr.c ../src/util/rta_*.c rta_rtguard_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -I ../src/statistics/ -I ../src/recognition/ -I ../src/physical-models/ -lm -lpthread -o rta_rtguard_test
+
+- run
+
+./rta_rtguard_test [-v]
+
+With -v, each allocation is printed with its source location.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_rtguard.h"
+#include "rta_fft.h"
+#include "rta_biquad.h"
+#include "rta_onepole.h"
+#include "rta_window.h"
+#include "rta_bands.h"
+#include "rta_dct.h"
+#include "rta_delta.h"
+#include "rta_lifter.h"
+#include "rta_correlation.h"
+#include "rta_preemphasis.h"
+#include "rta_lpc.h"
+#include "rta_yin.h"
+#include "rta_psy.h"
+#include "rta_resample.h"
+#include "rta_onset.h"
+#include "rta_cqt.h"
+#include "rta_envelope.h"
+#include "rta_granular.h"
+#include "rta_mean_variance.h"
+#include "rta_moments.h"
+#include "rta_selection.h"
+#include "rta_kdtree.h"
+#include "rta_dtw.h"
+#include "rta_parallel.h"
+#include "rta_msdr.h"
+
+#define SIZE 1024
+#define ORDER 32
+#define NBANDS 24
+#define NVECTORS 2000
+#define NDIM 4
+#define NMASSES 64
+
+static int verbose = 0;
+static int nfailed = 0;
+
+static void count_handler (const rta_rtguard_event_t *event, void *context)
+{
+  if (verbose)
+    printf("    %s: %lu bytes at %s:%d\n", event->section,
+           (unsigned long) event->size, event->file, event->line);
+}
+
+/* end the section of function name, check the allocation count */
+static void check (const char *name, int may_allocate)
+{
+  unsigned long count = rta_rtguard_thread_count();
+
+  rta_rtguard_leave();
+
+  printf("%-36s %6lu %s\n", name, count,
+         may_allocate ? "(known to allocate)" : count > 0 ? "FAILED" : "");
+
+  if (may_allocate ? count == 0 : count > 0)
+    nfailed++;
+
+  rta_rtguard_reset();
+}
+
+static int psy_callback (void *receiver, double time, double freq, double energy, double ac1, double voiced)
+{
+  return 0;
+}
+
+static void sum (void *context, int begin, int end, void *partial)
+{
+  int i;
+
+  for (i = begin; i < end; i++)
+    *(rta_real_t *) partial += ((const rta_real_t *) context)[i];
+}
+
+static void add (void *context, void *accumulator, const void *partial)
+{
+  *(rta_real_t *) accumulator += *(const rta_real_t *) partial;
+}
+
+
+int main (int argc, char *argv[])
+{
+  static rta_real_t x[SIZE], y[SIZE], w[SIZE * ORDER], spectrum[SIZE + 2], out[SIZE];
+  static float fx[SIZE];
+  static unsigned int bounds[NBANDS * 2];
+  static rta_real_t data[NVECTORS * NDIM];
+  static float dtw_a[64 * 2], dtw_b[48 * 2], dtw_p[112], dtw_q[112];
+  static float dtw_oa[112 * 2], dtw_ob[112 * 2], dtw_sm[64 * 48];
+  rta_real_t b[3], a[2], states[4] = { 0 }, state = 0, previous = 0;
+  rta_real_t scale = 1, nyquist, mean, variance, error, abs_min;
+  rta_fft_setup_t *fft;
+  rta_yin_setup_t *yin;
+  rta_psy_ana_t psy;
+  rta_onset_params_t onset_params;
+  rta_onset_t *onset;
+  rta_cqt_params_t cqt_params;
+  rta_cqt_t *cqt;
+  rta_envelope_params_t envelope_params;
+  rta_envelope_t *envelope;
+  rta_granular_grain_t grain;
+  rta_granular_t *granular;
+  rta_real_t *bus = y;
+  rta_kdtree_t tree;
+  rta_kdtree_object_t found[5];
+  rta_real_t dist[5];
+  rta_real_t *datablock = data;
+  int nvectors = NVECTORS;
+  rta_msdr_t sys;
+  float pos[NMASSES * RTA_MSDR_NDIM], invmass[NMASSES];
+  int i, length;
+
+  verbose = argc > 1  &&  strcmp(argv[1], "-v") == 0;
+
+  if (!rta_rtguard_enabled())
+  {
+    printf("rta_rtguard_test: compile with -DRTA_RTGUARD=1\n");
+    return 1;
+  }
+
+  rta_rtguard_set_handler(count_handler, NULL);
+
+  for (i = 0; i < SIZE; i++)
+    fx[i] = x[i] = sin(2 * M_PI * i / 100.) + 0.1 * ((i * 7919) % 101 / 101. - 0.5);
+
+  /* the guard sees allocations at all */
+  rta_rtguard_enter("self-test");
+  rta_free(rta_malloc(16));
+  check("rta_malloc, rta_free", 1);
+
+  /* fft */
+  rta_fft_real_setup_new(&fft, rta_fft_real_to_complex_1d, &scale, x, SIZE, spectrum, SIZE, &nyquist);
+  rta_rtguard_enter("rta_fft_real_execute");
+  rta_fft_real_execute(spectrum, x, SIZE, fft, &nyquist);
+  check("rta_fft_real_execute", 0);
+  rta_fft_setup_delete(fft);
+
+  /* filters */
+  rta_biquad_coefs(b, a, rta_lowpass, 0.1, 0.707, 1.);
+  rta_rtguard_enter("rta_biquad_df1_vector");
+  rta_biquad_df1_vector(y, x, SIZE, b, a, states);
+  check("rta_biquad_df1_vector", 0);
+
+  rta_rtguard_enter("rta_biquad_df2t_vector");
+  rta_biquad_df2t_vector(y, x, SIZE, b, a, states);
+  check("rta_biquad_df2t_vector", 0);
+
+  rta_rtguard_enter("rta_onepole_lowpass_vector");
+  rta_onepole_lowpass_vector(y, x, SIZE, 0.1, &state);
+  check("rta_onepole_lowpass_vector", 0);
+
+  rta_rtguard_enter("rta_preemphasis_signal");
+  rta_preemphasis_signal(y, x, SIZE, &previous, 0.97);
+  check("rta_preemphasis_signal", 0);
+
+  /* window, bands, cepstrum */
+  rta_window_hann_weights(w, SIZE);
+  rta_rtguard_enter("rta_window_apply");
+  rta_window_apply(y, SIZE, x, w);
+  check("rta_window_apply", 0);
+
+  rta_spectrum_to_mel_bands_weights(w, bounds, SIZE / 2, 44100., NBANDS, 0., 22050., 1.,
+                                    rta_hz_to_mel_slaney, rta_mel_to_hz_slaney, rta_mel_slaney);
+  rta_rtguard_enter("rta_spectrum_to_bands_abs");
+  rta_spectrum_to_bands_abs(y, x, w, bounds, SIZE / 2, NBANDS);
+  check("rta_spectrum_to_bands_abs", 0);
+
+  rta_dct_weights(w, NBANDS, ORDER, rta_dct_slaney);
+  rta_rtguard_enter("rta_dct");
+  rta_dct(y, x, w, NBANDS, ORDER);
+  check("rta_dct", 0);
+
+  rta_lifter_weights(w, ORDER, 22., rta_lifter_exponential, rta_lifter_mode_normal);
+  rta_rtguard_enter("rta_lifter_cepstrum");
+  rta_lifter_cepstrum(out, y, w, ORDER);
+  check("rta_lifter_cepstrum", 0);
+
+  rta_delta_weights(w, 5);
+  rta_rtguard_enter("rta_delta_vector");
+  rta_delta_vector(y, x, ORDER, w, 5);
+  check("rta_delta_vector", 0);
+
+  /* correlation, lpc, pitch */
+  rta_rtguard_enter("rta_correlation_fast");
+  rta_correlation_fast(y, ORDER, x, x, SIZE - ORDER);
+  check("rta_correlation_fast", 0);
+
+  rta_rtguard_enter("rta_lpc");
+  rta_lpc(y, 12, &error, out, x, SIZE);
+  check("rta_lpc", 0);
+
+  rta_yin_setup_new(&yin, SIZE / 2);
+  rta_rtguard_enter("rta_yin");
+  rta_yin(&abs_min, y, SIZE / 2, x, SIZE, yin, 0.1);
+  check("rta_yin", 0);
+  rta_yin_setup_delete(yin);
+
+  rta_psy_init(&psy);
+  rta_psy_set_callback(&psy, NULL, psy_callback);
+  rta_rtguard_enter("rta_psy_reset");
+  rta_psy_reset(&psy, 50., 2000., 44100., SIZE, 2);
+  check("rta_psy_reset", 1);
+
+  rta_rtguard_enter("rta_psy_calculate_input_vector");
+  rta_psy_calculate_input_vector(&psy, fx, SIZE, 1);
+  check("rta_psy_calculate_input_vector", 0);
+  rta_psy_deinit(&psy);
+
+  /* onset detection */
+  rta_onset_params_default(&onset_params, 44100.);
+  rta_onset_new(&onset, &onset_params);
+  rta_rtguard_enter("rta_onset_process");
+  rta_onset_process(onset, x, SIZE);
+  check("rta_onset_process", 0);
+  rta_onset_delete(onset);
+
+  /* constant-Q transform, on frames of at most SIZE samples */
+  rta_cqt_params_default(&cqt_params, 44100.);
+  cqt_params.min_freq = 1760.;
+  cqt_params.bins_per_octave = 12;
+  rta_cqt_new(&cqt, &cqt_params);
+  rta_rtguard_enter("rta_cqt_execute");
+  rta_cqt_execute(cqt, y, x);
+  check("rta_cqt_execute", 0);
+  rta_cqt_delete(cqt);
+
+  /* envelopes of 8 interleaved channels */
+  rta_envelope_params_default(&envelope_params, 44100., 8);
+  rta_envelope_new(&envelope, &envelope_params);
+  rta_rtguard_enter("rta_envelope_process");
+  rta_envelope_process(envelope, y, x, SIZE / 8);
+  check("rta_envelope_process", 0);
+  rta_envelope_delete(envelope);
+
+  /* granular voices, triggered in the real-time section too */
+  rta_granular_new(&granular, 16, 1);
+  memset(&grain, 0, sizeof(grain));
+  grain.buffer = x;
+  grain.buffer_size = SIZE;
+  grain.onset = 100.5;
+  grain.duration = SIZE / 4;
+  grain.attack = grain.release = SIZE / 16;
+  grain.gain = 1;
+  rta_rtguard_enter("rta_granular_render");
+  for (i = 0; i < 16; i++)
+  {
+    grain.rate = 0.5 + i * 0.0625;
+    rta_granular_trigger(granular, &grain);
+  }
+  rta_granular_render(granular, &bus, SIZE / 2);
+  check("rta_granular_render", 0);
+  rta_granular_delete(granular);
+
+  /* resampling */
+  rta_rtguard_enter("rta_downsample_int_mean");
+  rta_downsample_int_mean(y, x, SIZE, 4);
+  check("rta_downsample_int_mean", 0);
+
+  rta_rtguard_enter("rta_resample_cubic");
+  rta_resample_cubic(y, x, SIZE / 2, SIZE, 1, 1.5);
+  check("rta_resample_cubic", 0);
+
+  /* statistics */
+  rta_rtguard_enter("rta_mean_variance");
+  rta_mean_variance(&mean, &variance, x, SIZE);
+  check("rta_mean_variance", 0);
+
+  rta_rtguard_enter("rta_weighted_moment_1_indexes");
+  rta_weighted_moment_1_indexes(&mean, x, SIZE);
+  check("rta_weighted_moment_1_indexes", 0);
+
+  memcpy(y, x, sizeof(x));
+  rta_rtguard_enter("rta_selection");
+  rta_selection(y, SIZE, 0.5);
+  check("rta_selection", 0);
+
+  /* kd-tree search */
+  for (i = 0; i < NVECTORS * NDIM; i++)
+    data[i] = (i * 7919) % 1009 / 1009.;
+
+  rta_kdtree_init(&tree);
+  rta_kdtree_set_data(&tree, 1, &datablock, NULL, &nvectors, NDIM);
+  rta_kdtree_init_nodes(&tree, NULL, NULL, NULL);
+  rta_kdtree_build(&tree, 0);
+
+  rta_rtguard_enter("rta_kdtree_search_knn");
+  for (i = 0; i < 100; i++)
+    rta_kdtree_search_knn(&tree, data + i * NDIM, 1, 5, 0, 0, found, dist);
+  check("rta_kdtree_search_knn", 0);
+  rta_kdtree_free(&tree);
+
+  /* mass-spring-damper */
+  for (i = 0; i < NMASSES * RTA_MSDR_NDIM; i++)
+    pos[i] = (float) (i / RTA_MSDR_NDIM) + 0.1f * (i % 3);
+  for (i = 0; i < NMASSES; i++)
+    invmass[i] = 1;
+
+  rta_msdr_init(&sys, NMASSES, NMASSES, 2);
+  rta_msdr_set(&sys, NMASSES, pos, invmass);
+  for (i = 0; i < NMASSES - 1; i++)
+    rta_msdr_add_link(&sys, i, i + 1, 1.f, 0, 0.1f, 0.05f, 0.02f, 0.f, 0.f);
+
+  rta_rtguard_enter("rta_msdr_update");
+  for (i = 0; i < 10; i++)
+    rta_msdr_update(&sys);
+  check("rta_msdr_update", 0);
+  rta_msdr_free(&sys);
+
+  /* parallel reductions, serial by default */
+  {
+    const rta_real_t zero = 0;
+    rta_real_t total;
+
+    rta_rtguard_enter("rta_parallel_reduce");
+    rta_parallel_reduce(SIZE, 16, sizeof(rta_real_t), &zero, sum, add, x, &total);
+    check("rta_parallel_reduce", 0);
+  }
+
+  /* dynamic time warping allocates its score and path matrices */
+  for (i = 0; i < 64 * 2; i++)
+    dtw_a[i] = sin(0.1 * i);
+  for (i = 0; i < 48 * 2; i++)
+    dtw_b[i] = sin(0.13 * i);
+
+  rta_rtguard_enter("rta_dtw");
+  rta_dtw(dtw_a, 64, 2, dtw_b, 48, 2, dtw_p, dtw_q, dtw_oa, dtw_ob, dtw_sm, &length);
+  check("rta_dtw", 1);
+
+  if (nfailed > 0)
+  {
+    printf("rta_rtguard_test: %d functions failed\n", nfailed);
+    return 1;
+  }
+
+  printf("rta_rtguard_test: ok\n");
+  return 0;
+}
@@ -0,0 +1,593 @@
+/*
+
+Micro-benchmark of the signal-processing kernels: time per call,
+ns per sample and throughput in GB/s of input plus output data.
+
+- compile
+
+cc -O2 -DNDEBUG ../src/signal/rta_*.c ../src/statistics/rta_selection.c ../src/util/rta_*.c rta_signal_bench.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -I ../src/statistics/ -lm -lpthread -o rta_signal_bench
+
+- run
+
+./rta_signal_bench [-o result.json] [-t min-ms-per-trial] [-k kernel-name-substring]
+./rta_signal_bench -c base.json new.json [regression-threshold-percent]
+
+The data are generated from a fixed seed.  RTA_CPU_LEVEL forces the
+dispatch level of the SIMD kernels (see rta_cpu.h); correlation is
+measured at each supported level anyway.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_cpu.h"
+#include "rta_fft.h"
+#include "rta_planner.h"
+#include "rta_biquad.h"
+#include "rta_onepole.h"
+#include "rta_window.h"
+#include "rta_mel.h"
+#include "rta_bands.h"
+#include "rta_dct.h"
+#include "rta_delta.h"
+#include "rta_correlation.h"
+#include "rta_yin.h"
+#include "rta_psy.h"
+#include "rta_resample.h"
+#include "rta_preemphasis.h"
+#include "rta_pcm.h"
+#include "rta_cqt.h"
+#include "rta_envelope.h"
+#include "rta_granular.h"
+#include "rta_cubic.h"
+#include "rta_util.h"
+
+#include "rta_bench.h"
+
+#define MAX_SIZE 16384
+#define BLOCK_SIZE 4096
+
+
+/* all kernel arguments, set up before timing */
+typedef struct bench_context
+{
+  rta_real_t *x, *y, *w;
+  rta_complex_t *cx, *cy;
+  unsigned int size, size2;
+  unsigned int *bounds;
+  rta_real_t coefs_a[2], coefs_b[3], states[4], scale, nyquist;
+  rta_fft_setup_t *fft;
+  rta_yin_setup_t *yin;
+  rta_psy_ana_t psy;
+  float *fx;
+  short *pcm;
+  rta_cqt_t *cqt;
+  rta_envelope_t *envelope;
+  rta_granular_t *granular;
+  double factor;
+} bench_context_t;
+
+static rta_bench_output_t output = { NULL, 0 };
+static double min_ns = 20e6;
+static const char *kernel_filter = NULL;
+
+
+/* time one kernel and report it:
+   samples: number of samples processed per call,
+   bytes: input plus output bytes touched per call */
+static void report (const char *name, rta_bench_function_t fun, bench_context_t *ctx,
+                    unsigned int size, double samples, double bytes)
+{
+  char fields[256];
+  double ns;
+
+  if (kernel_filter != NULL  &&  strstr(name, kernel_filter) == NULL)
+    return;
+
+  ns = rta_bench_time(fun, ctx, min_ns);
+
+  printf("%-36s %8u %12.1f ns %9.3f ns/sample %8.3f GB/s\n",
+         name, size, ns, ns / samples, bytes / ns);
+
+  snprintf(fields, sizeof(fields),
+           "\"size\": %u, \"ns_per_call\": %.6g, \"ns_per_sample\": %.6g, \"gb_per_s\": %.6g",
+           size, ns, ns / samples, bytes / ns);
+  rta_bench_json_result(&output, name, fields);
+}
+
+static void fill (rta_real_t *v, unsigned int n)
+{
+  unsigned int i;
+
+  for (i = 0; i < n; i++)
+    v[i] = rta_bench_uniform() * 2 - 1;
+}
+
+
+/*
+ *  kernels
+ */
+
+static void bench_fft (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_fft_execute(ctx->cy, ctx->cx, ctx->size, ctx->fft);
+}
+
+static void bench_fft_real (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_fft_real_execute(ctx->cy, ctx->cx, ctx->size, ctx->fft, &ctx->nyquist);
+}
+
+static void bench_biquad_df1 (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_biquad_df1_vector(ctx->y, ctx->x, ctx->size, ctx->coefs_b, ctx->coefs_a, ctx->states);
+}
+
+static void bench_biquad_df2t (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_biquad_df2t_vector(ctx->y, ctx->x, ctx->size, ctx->coefs_b, ctx->coefs_a, ctx->states);
+}
+
+static void bench_onepole_lowpass (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_onepole_lowpass_vector(ctx->y, ctx->x, ctx->size, 0.1, ctx->states);
+}
+
+static void bench_onepole_highpass (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_onepole_highpass_vector(ctx->y, ctx->x, ctx->size, 0.1, ctx->states);
+}
+
+static void bench_window_apply (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_window_apply(ctx->y, ctx->size, ctx->x, ctx->w);
+}
+
+/* 16-bit PCM to windowed frame: converted first, or in one pass */
+static void bench_pcm_separate (void *c)
+{
+  bench_context_t *ctx = c;
+  unsigned int i;
+
+  for (i = 0; i < ctx->size; i++)
+    ctx->x[i] = ctx->pcm[i] * (1. / 32768.);
+  rta_preemphasis_signal(ctx->y, ctx->x, ctx->size, ctx->states, 0.97);
+  rta_window_apply_in_place(ctx->y, ctx->size, ctx->w);
+}
+
+static void bench_pcm_frame (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_pcm_frame(ctx->y, ctx->pcm, rta_pcm_int16, 1, 0, ctx->size, 1,
+                ctx->states, 0.97, ctx->w);
+}
+
+static void bench_cqt (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_cqt_execute(ctx->cqt, ctx->y, ctx->x);
+}
+
+/* RMS in dB of interleaved channels: one channel at a time with the
+   one-pole low-pass of the squares, or with the envelope bank */
+static void bench_envelope_separate (void *c)
+{
+  bench_context_t *ctx = c;
+  const unsigned int channels = ctx->size2;
+  const unsigned int frames = ctx->size / channels;
+  unsigned int ch, f;
+
+  for (ch = 0; ch < channels; ch++)
+  {
+    for (f = 0; f < frames; f++)
+      ctx->w[f] = ctx->x[f * channels + ch] * ctx->x[f * channels + ch];
+    rta_onepole_lowpass_vector(ctx->w, ctx->w, frames, 1e-3, ctx->states + (ch % 4));
+    for (f = 63; f < frames; f += 64)
+      ctx->y[f / 64 * channels + ch] = 10 * log10(ctx->w[f] + 1e-12);
+  }
+}
+
+static void bench_envelope (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_envelope_process(ctx->envelope, ctx->y, ctx->x, ctx->size / ctx->size2);
+}
+
+/* 64 Hann grains of 512 samples at rates from 0.5 to 1.5: one sample
+   at a time with the cubic macro and a window table, or with the
+   voice pool */
+#define GRAINS 64
+#define GRAIN_SIZE 512
+
+static void bench_grains_macro (void *c)
+{
+  bench_context_t *ctx = c;
+  unsigned int v, i;
+
+  for (v = 0; v < GRAINS; v++)
+  {
+    rta_idefix_t position, increment;
+
+    rta_idefix_set_float(&position, 1000. + v * 100);
+    rta_idefix_set_float(&increment, 0.5 + v / (double) GRAINS);
+
+    for (i = 0; i < GRAIN_SIZE; i++)
+    {
+      rta_real_t y;
+
+      rta_cubic_idefix_interpolate(ctx->x, position, &y);
+      ctx->y[i] += ctx->w[i] * y;
+      rta_idefix_incr(&position, increment);
+    }
+  }
+}
+
+static void bench_grains (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_granular_grain_t grain;
+  unsigned int v;
+
+  memset(&grain, 0, sizeof(grain));
+  grain.buffer = ctx->x;
+  grain.buffer_size = MAX_SIZE * 2;
+  grain.duration = GRAIN_SIZE;
+  grain.attack = grain.release = GRAIN_SIZE / 2;
+  grain.gain = 1;
+
+  for (v = 0; v < GRAINS; v++)
+  {
+    grain.onset = 1000. + v * 100;
+    grain.rate = 0.5 + v / (double) GRAINS;
+    rta_granular_trigger(ctx->granular, &grain);
+  }
+
+  rta_granular_render(ctx->granular, &ctx->y, GRAIN_SIZE);
+}
+
+static void bench_bands (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_spectrum_to_bands_square_abs(ctx->y, ctx->x, ctx->w, ctx->bounds, ctx->size, ctx->size2);
+}
+
+static void bench_dct (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_dct(ctx->y, ctx->x, ctx->w, ctx->size, ctx->size2);
+}
+
+static void bench_delta (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_delta_vector(ctx->y, ctx->x, ctx->size, ctx->w, ctx->size2);
+}
+
+static void bench_correlation (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_correlation_fast(ctx->y, ctx->size2, ctx->x, ctx->x, ctx->size);
+}
+
+static void bench_yin (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_real_t abs_min;
+  rta_yin(&abs_min, ctx->y, ctx->size2, ctx->x, ctx->size, ctx->yin, 0.1);
+}
+
+static int psy_callback (void *receiver, double time, double freq, double energy, double ac1, double voiced)
+{
+  return 1; /* continue analysis */
+}
+
+static void bench_psy (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_psy_calculate_input_vector(&ctx->psy, ctx->fx, ctx->size, 1);
+}
+
+static void bench_downsample (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_downsample_int_mean(ctx->y, ctx->x, ctx->size, ctx->size2);
+}
+
+static void bench_resample_cubic (void *c)
+{
+  bench_context_t *ctx = c;
+  rta_resample_cubic(ctx->y, ctx->x, ctx->size, MAX_SIZE * 2, 1, ctx->factor);
+}
+
+
+static void run_all (bench_context_t *ctx)
+{
+  static const char *fft_names[] = { "", "fft_real_to_complex", "fft_complex_to_real",
+                                     "fft_complex", "fft_complex_inverse" };
+  const rta_real_t sz = sizeof(rta_real_t);
+  char name[128];
+  unsigned int n, i;
+  int type, level, radix;
+
+  /* FFT, all types, 64 to 16384 points, with each radix of the planner */
+  for (type = rta_fft_real_to_complex_1d; type <= rta_fft_complex_inverse_1d; type++)
+    for (n = 64; n <= MAX_SIZE; n *= 4)
+      for (radix = 2; radix <= 4; radix += 2)
+      {
+        int ok, real = (type == rta_fft_real_to_complex_1d  ||  type == rta_fft_complex_to_real_1d);
+
+        ctx->size = n;
+        ctx->scale = 1. / n;
+        fill((rta_real_t *) ctx->cx, 2 * n);
+        rta_planner_wisdom_add(real ? "fft_real" : "fft_complex", real ? n / 2 : n,
+                               radix == 4);
+
+        if (real)
+          ok = rta_fft_real_setup_new(&ctx->fft, type, &ctx->scale, ctx->cx, n, ctx->cy, n, &ctx->nyquist);
+        else
+          ok = rta_fft_setup_new(&ctx->fft, type, &ctx->scale, ctx->cx, n, ctx->cy, n);
+
+        if (!ok)
+          continue;
+
+        snprintf(name, sizeof(name), "%s_%u_radix%d", fft_names[type], n, radix);
+        report(name, real ? bench_fft_real : bench_fft, ctx, n, n,
+               (real ? 2 : 4) * n * sz);
+        rta_fft_setup_delete(ctx->fft);
+      }
+  rta_planner_wisdom_forget();
+
+  /* vector filters */
+  ctx->size = BLOCK_SIZE;
+  fill(ctx->x, BLOCK_SIZE);
+  rta_biquad_coefs(ctx->coefs_b, ctx->coefs_a, rta_lowpass, 0.1, 0.707, 1.);
+  memset(ctx->states, 0, sizeof(ctx->states));
+  report("biquad_df1_vector", bench_biquad_df1, ctx, BLOCK_SIZE, BLOCK_SIZE, 2 * BLOCK_SIZE * sz);
+  memset(ctx->states, 0, sizeof(ctx->states));
+  report("biquad_df2t_vector", bench_biquad_df2t, ctx, BLOCK_SIZE, BLOCK_SIZE, 2 * BLOCK_SIZE * sz);
+  ctx->states[0] = 0;
+  report("onepole_lowpass_vector", bench_onepole_lowpass, ctx, BLOCK_SIZE, BLOCK_SIZE, 2 * BLOCK_SIZE * sz);
+  ctx->states[0] = 0;
+  report("onepole_highpass_vector", bench_onepole_highpass, ctx, BLOCK_SIZE, BLOCK_SIZE, 2 * BLOCK_SIZE * sz);
+
+  /* window */
+  for (n = 256; n <= MAX_SIZE; n *= 4)
+  {
+    ctx->size = n;
+    rta_window_hann_weights(ctx->w, n);
+    snprintf(name, sizeof(name), "window_apply_%u", n);
+    report(name, bench_window_apply, ctx, n, n, 3 * n * sz);
+  }
+
+  /* 16-bit PCM framing, at each supported dispatch level */
+  ctx->size = 1024;
+  for (i = 0; i < ctx->size; i++)
+    ctx->pcm[i] = (short) ((rta_bench_uniform() * 2 - 1) * 32767);
+  rta_window_hann_weights(ctx->w, ctx->size);
+  report("pcm_int16_separate_1024", bench_pcm_separate, ctx, ctx->size, ctx->size,
+         (ctx->size * 3 + ctx->size * 3) * sz + ctx->size * sizeof(short));
+  for (level = 0; level < rta_cpu_num_levels; level++)
+    if (rta_cpu_has(level))
+    {
+      rta_cpu_set_level(level);
+      snprintf(name, sizeof(name), "pcm_frame_int16_1024_%s", rta_cpu_level_name(level));
+      report(name, bench_pcm_frame, ctx, ctx->size, ctx->size,
+             2 * ctx->size * sz + ctx->size * sizeof(short));
+    }
+  rta_cpu_set_level(rta_cpu_num_levels);
+
+  /* mel bands: 1024-point spectrum to 40 bands */
+  ctx->size  = 1024 / 2 + 1;
+  ctx->size2 = 40;
+  fill(ctx->x, ctx->size);
+  if (rta_spectrum_to_mel_bands_weights(ctx->w, ctx->bounds, ctx->size, 44100., ctx->size2,
+                                        0., 22050., 1., rta_hz_to_mel_slaney,
+                                        rta_mel_to_hz_slaney, rta_mel_slaney))
+    report("bands_square_abs_513_40", bench_bands, ctx, ctx->size, ctx->size,
+           (ctx->size + ctx->size2) * sz);
+
+  /* constant-Q, 44.1 kHz, 6 octaves from 110 Hz, 24 bins per octave:
+     single-rate, then multi-rate at each supported dispatch level */
+  {
+    rta_cqt_params_t params;
+
+    rta_cqt_params_default(&params, 44100.);
+    params.min_freq = 110.;
+    params.max_freq = 7000.;
+    fill(ctx->x, MAX_SIZE * 2);
+
+    for (params.multirate = 0; params.multirate <= 1; params.multirate++)
+    {
+      if (!rta_cqt_new(&ctx->cqt, &params)  ||  rta_cqt_get_frame_size(ctx->cqt) > MAX_SIZE * 2)
+        continue;
+
+      ctx->size = rta_cqt_get_frame_size(ctx->cqt);
+      ctx->size2 = rta_cqt_get_num_bins(ctx->cqt);
+      for (level = 0; level < rta_cpu_num_levels; level++)
+        if (rta_cpu_has(level))
+        {
+          rta_cpu_set_level(level);
+          snprintf(name, sizeof(name), "cqt_%s_%u_%s",
+                   params.multirate ? "multirate" : "single_rate", ctx->size2,
+                   rta_cpu_level_name(level));
+          report(name, bench_cqt, ctx, ctx->size, ctx->size,
+                 (ctx->size + ctx->size2 + 4 * rta_cqt_get_num_coefficients(ctx->cqt)) * sz);
+        }
+      rta_cpu_set_level(rta_cpu_num_levels);
+      rta_cqt_delete(ctx->cqt);
+    }
+  }
+
+  /* RMS envelopes in dB, 1024 frames of 32 interleaved channels */
+  {
+    rta_envelope_params_t params;
+
+    ctx->size = 1024 * 32;
+    ctx->size2 = 32;
+    fill(ctx->x, ctx->size);
+    memset(ctx->states, 0, sizeof(ctx->states));
+    report("envelope_onepole_separate_32", bench_envelope_separate, ctx, ctx->size, ctx->size,
+           (ctx->size + ctx->size / 64) * sz);
+
+    rta_envelope_params_default(&params, 44100., ctx->size2);
+    if (rta_envelope_new(&ctx->envelope, &params))
+    {
+      for (level = 0; level < rta_cpu_num_levels; level++)
+        if (rta_cpu_has(level))
+        {
+          rta_cpu_set_level(level);
+          snprintf(name, sizeof(name), "envelope_rms_db_32_%s", rta_cpu_level_name(level));
+          report(name, bench_envelope, ctx, ctx->size, ctx->size,
+                 (ctx->size + ctx->size / 64) * sz);
+        }
+      rta_cpu_set_level(rta_cpu_num_levels);
+      rta_envelope_delete(ctx->envelope);
+    }
+  }
+
+  /* granular voices */
+  fill(ctx->x, MAX_SIZE * 2);
+  memset(ctx->y, 0, GRAIN_SIZE * sizeof(rta_real_t));
+  rta_window_hann_weights(ctx->w, GRAIN_SIZE);
+  report("grains_cubic_macro_64_512", bench_grains_macro, ctx, GRAINS * GRAIN_SIZE,
+         GRAINS * GRAIN_SIZE, (GRAINS * GRAIN_SIZE * 2 + GRAIN_SIZE) * sz);
+  if (rta_granular_new(&ctx->granular, GRAINS, 1))
+  {
+    for (level = 0; level < rta_cpu_num_levels; level++)
+      if (rta_cpu_has(level))
+      {
+        rta_cpu_set_level(level);
+        snprintf(name, sizeof(name), "granular_64_512_%s", rta_cpu_level_name(level));
+        report(name, bench_grains, ctx, GRAINS * GRAIN_SIZE, GRAINS * GRAIN_SIZE,
+               (GRAINS * GRAIN_SIZE + GRAIN_SIZE) * sz);
+      }
+    rta_cpu_set_level(rta_cpu_num_levels);
+    rta_granular_delete(ctx->granular);
+  }
+
+  /* dct: 40 bands to 13 coefficients */
+  ctx->size  = 40;
+  ctx->size2 = 13;
+  if (rta_dct_weights(ctx->w, ctx->size, ctx->size2, rta_dct_slaney))
+    report("dct_40_13", bench_dct, ctx, ctx->size, ctx->size,
+           (ctx->size * ctx->size2 + ctx->size + ctx->size2) * sz);
+
+  /* delta over 7 frames of 40 coefficients */
+  ctx->size  = 40;
+  ctx->size2 = 7;
+  if (rta_delta_weights(ctx->w, ctx->size2))
+    report("delta_vector_40_7", bench_delta, ctx, ctx->size, ctx->size * ctx->size2,
+           (ctx->size * ctx->size2 + ctx->size) * sz);
+
+  /* autocorrelation at each supported dispatch level */
+  ctx->size  = 2048;
+  ctx->size2 = 512;
+  fill(ctx->x, ctx->size + ctx->size2);
+  for (level = 0; level < rta_cpu_num_levels; level++)
+    if (rta_cpu_has(level))
+    {
+      rta_cpu_set_level(level);
+      snprintf(name, sizeof(name), "correlation_fast_2048_512_%s", rta_cpu_level_name(level));
+      report(name, bench_correlation, ctx, ctx->size, (double) ctx->size * ctx->size2,
+             (ctx->size + ctx->size2) * sz);
+    }
+  rta_cpu_set_level(rta_cpu_num_levels);
+
+  /* yin on a periodic signal */
+  ctx->size  = 2048;
+  ctx->size2 = 1024;
+  for (i = 0; i < ctx->size; i++)
+    ctx->x[i] = sin(2 * M_PI * i / 100.) + 0.1 * (rta_bench_uniform() - 0.5);
+  if (rta_yin_setup_new(&ctx->yin, 128))
+  {
+    report("yin_2048_1024", bench_yin, ctx, ctx->size, ctx->size, (ctx->size + ctx->size2) * sz);
+    rta_yin_setup_delete(ctx->yin);
+  }
+
+  /* psy pitch tracking, 44.1 kHz, blocks of 512 */
+  ctx->size = 512;
+  for (i = 0; i < ctx->size; i++)
+    ctx->fx[i] = sin(2 * M_PI * i / 100.) + 0.1 * (rta_bench_uniform() - 0.5);
+  rta_psy_init(&ctx->psy);
+  rta_psy_set_callback(&ctx->psy, NULL, psy_callback);
+  rta_psy_reset(&ctx->psy, 50., 2000., 44100., ctx->size, 2);
+  report("psy_512", bench_psy, ctx, ctx->size, ctx->size, ctx->size * sizeof(float));
+  rta_psy_deinit(&ctx->psy);
+
+  /* resampling */
+  ctx->size  = BLOCK_SIZE;
+  ctx->size2 = 4;
+  fill(ctx->x, BLOCK_SIZE);
+  report("downsample_int_mean_4", bench_downsample, ctx, BLOCK_SIZE, BLOCK_SIZE,
+         (BLOCK_SIZE + BLOCK_SIZE / 4) * sz);
+  ctx->factor = 0.75;
+  report("resample_cubic_0.75", bench_resample_cubic, ctx, BLOCK_SIZE, BLOCK_SIZE,
+         (BLOCK_SIZE + BLOCK_SIZE / 0.75) * sz);
+}
+
+
+int main (int argc, char *argv[])
+{
+  bench_context_t ctx;
+  char attributes[256];
+  int i;
+
+  if (argc >= 4  &&  strcmp(argv[1], "-c") == 0)
+  {
+    double threshold = argc >= 5  ?  atof(argv[4]) / 100.  :  0.05;
+    int nregress = rta_bench_compare(argv[2], argv[3], "ns_per_sample", 0, threshold);
+    return nregress != 0;
+  }
+
+  for (i = 1; i < argc - 1; i += 2)
+  {
+    if (strcmp(argv[i], "-o") == 0)
+      output.file = fopen(argv[i + 1], "w");
+    else if (strcmp(argv[i], "-t") == 0)
+      min_ns = atof(argv[i + 1]) * 1e6;
+    else if (strcmp(argv[i], "-k") == 0)
+      kernel_filter = argv[i + 1];
+  }
+
+  rta_bench_seed(1);
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.x  = calloc(MAX_SIZE * 2, sizeof(rta_real_t));
+  ctx.y  = calloc(MAX_SIZE * 2, sizeof(rta_real_t));
+  ctx.w  = calloc(MAX_SIZE * 2, sizeof(rta_real_t));
+  ctx.cx = calloc(MAX_SIZE, sizeof(rta_complex_t));
+  ctx.cy = calloc(MAX_SIZE, sizeof(rta_complex_t));
+  ctx.fx = calloc(MAX_SIZE, sizeof(float));
+  ctx.bounds = calloc(MAX_SIZE, sizeof(unsigned int));
+  ctx.pcm = calloc(MAX_SIZE, sizeof(short));
+
+  snprintf(attributes, sizeof(attributes), "\"real_size\": %d, \"cpu_level\": \"%s\"",
+           (int) sizeof(rta_real_t), rta_cpu_level_name(rta_cpu_get_level()));
+  rta_bench_json_begin(&output, "rta_signal", attributes);
+  run_all(&ctx);
+  rta_bench_json_end(&output);
+
+  if (output.file)
+    fclose(output.file);
+
+  free(ctx.x);
+  free(ctx.y);
+  free(ctx.w);
+  free(ctx.cx);
+  free(ctx.cy);
+  free(ctx.fx);
+  free(ctx.bounds);
+  free(ctx.pcm);
+
+  return 0;
+}
@@ -0,0 +1,163 @@
+/*
+
+Test of the descriptor store (rta_store.h): write blocks, map them
+back, and use them in place for a kd-tree, Mahalanobis distances and
+statistics.
+
+- compile
+
+cc -O2 ../src/recognition/rta_kdtree*.c ../src/recognition/rta_mahalanobis.c ../src/statistics/rta_mean_variance.c ../src/util/rta_*.c rta_store_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/recognition/ -I ../src/statistics/ -lm -lpthread -o rta_store_test
+
+- run
+
+./rta_store_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_store.h"
+#include "rta_alloc.h"
+#include "rta_kdtree.h"
+#include "rta_mahalanobis.h"
+#include "rta_mean_variance.h"
+
+#define NCOLUMNS 5
+#define NBLOCKS 3
+#define PATH "rta_store_test.rtastore"
+
+static const int rows[NBLOCKS] = { 500, 0, 1200 };
+static const char * block_names[NBLOCKS] = { "first.wav", "empty.wav", "last.wav" };
+static const char * column_names[NCOLUMNS] =
+{ "loudness", "pitch", "centroid", "spread", "periodicity" };
+
+int main (int argc, char *argv[])
+{
+  static rta_real_t data[NBLOCKS][1200 * NCOLUMNS], all[1700 * NCOLUMNS];
+  static rta_real_t distances[4 * 10];
+  rta_real_t *copies[NBLOCKS], **blocks, *std, *mean;
+  rta_real_t dist_store[5], dist_copy[5];
+  rta_kdtree_object_t found_store[5], found_copy[5];
+  int copy_rows[NBLOCKS];
+  rta_store_writer_t *writer;
+  rta_store_t *store;
+  rta_kdtree_t tree_store, tree_copy;
+  FILE *file;
+  char *memory;
+  long size;
+  int b, i, c, n = 0;
+
+  for (b = 0; b < NBLOCKS; b++)
+  {
+    for (i = 0; i < rows[b] * NCOLUMNS; i++)
+      all[n++] = data[b][i] = (i % NCOLUMNS + 1) * sin(0.37 * i + b) + (i % NCOLUMNS) * 10;
+
+    copies[b] = data[b];
+    copy_rows[b] = rows[b];
+  }
+
+  /* write */
+  assert(rta_store_writer_new(&writer, PATH, NCOLUMNS, column_names));
+  for (b = 0; b < NBLOCKS; b++)
+    assert(rta_store_writer_add_block(writer, block_names[b], data[b], rows[b]));
+  assert(rta_store_writer_close(writer, 1));
+
+  /* map */
+  assert(!rta_store_open(&store, "does/not/exist"));
+  assert(rta_store_open(&store, PATH));
+  assert(rta_store_get_num_columns(store) == NCOLUMNS);
+  assert(rta_store_get_num_blocks(store) == NBLOCKS);
+  assert(rta_store_get_num_rows(store) == 1700);
+  assert(strcmp(rta_store_get_column_name(store, 2), "centroid") == 0);
+  assert(rta_store_find_column(store, "periodicity") == 4);
+  assert(rta_store_find_column(store, "mfcc0") == -1);
+
+  blocks = rta_store_get_blocks(store);
+  for (b = 0; b < NBLOCKS; b++)
+  {
+    assert(strcmp(rta_store_get_block_name(store, b), block_names[b]) == 0);
+    assert(rta_store_get_block_rows(store)[b] == rows[b]);
+    assert((size_t) blocks[b] % RTA_ALIGNMENT == 0);
+    assert(memcmp(blocks[b], data[b], rows[b] * NCOLUMNS * sizeof(rta_real_t)) == 0);
+  }
+
+  /* statistics over all rows */
+  mean = rta_store_get_statistics(store, rta_store_mean);
+  std = rta_store_get_statistics(store, rta_store_std);
+  for (c = 0; c < NCOLUMNS; c++)
+  {
+    rta_real_t m, v;
+
+    rta_mean_variance_stride(&m, &v, all + c, NCOLUMNS, 1700);
+    assert(fabs(mean[c] - m) < 1e-4 * (1 + fabs(m)));
+    assert(fabs(std[c] - sqrt(v)) < 1e-3 * (1 + sqrt(v)));
+    assert(rta_store_get_statistics(store, rta_store_min)[c] <= m);
+    assert(rta_store_get_statistics(store, rta_store_max)[c] >= m);
+  }
+
+  /* kd-tree on the mapped blocks, against one on the copies */
+  rta_kdtree_init(&tree_store);
+  rta_kdtree_set_data(&tree_store, NBLOCKS, blocks, NULL,
+                      rta_store_get_block_rows(store), NCOLUMNS);
+  rta_kdtree_init_nodes(&tree_store, NULL, NULL, NULL);
+  rta_kdtree_build(&tree_store, 0);
+
+  rta_kdtree_init(&tree_copy);
+  rta_kdtree_set_data(&tree_copy, NBLOCKS, copies, NULL, copy_rows, NCOLUMNS);
+  rta_kdtree_init_nodes(&tree_copy, NULL, NULL, NULL);
+  rta_kdtree_build(&tree_copy, 0);
+
+  for (i = 0; i < 100; i++)
+  {
+    rta_real_t *x = all + (i * 17) * NCOLUMNS;
+
+    n = rta_kdtree_search_knn(&tree_store, x, 1, 5, 0, 0, found_store, dist_store);
+    assert(n == rta_kdtree_search_knn(&tree_copy, x, 1, 5, 0, 0, found_copy, dist_copy));
+    assert(memcmp(found_store, found_copy, n * sizeof(rta_kdtree_object_t)) == 0);
+    assert(dist_store[0] == 0);
+  }
+
+  rta_kdtree_free(&tree_store);
+  rta_kdtree_free(&tree_copy);
+
+  /* Mahalanobis distances to the first rows, weighted by the std */
+  assert(rta_mahalanobis(4, NCOLUMNS, 10, blocks[2], 1, NCOLUMNS,
+                         blocks[0], 1, NCOLUMNS, std, 1, 0,
+                         distances, 4, 1));
+  for (i = 0; i < 4 * 10; i++)
+    assert(distances[i] >= 0);
+
+  rta_store_close(store);
+
+  /* from memory, e.g. loaded by a host */
+  file = fopen(PATH, "rb");
+  fseek(file, 0, SEEK_END);
+  size = ftell(file);
+  rewind(file);
+  memory = rta_aligned_malloc(size, 0);
+  assert(fread(memory, size, 1, file) == 1);
+  fclose(file);
+
+  assert(rta_store_open_memory(&store, memory, size));
+  assert(memcmp(rta_store_get_blocks(store)[2], data[2],
+                rows[2] * NCOLUMNS * sizeof(rta_real_t)) == 0);
+  rta_store_close(store);
+
+  /* refused: truncated, other version, unaligned */
+  assert(!rta_store_open_memory(&store, memory, size / 2));
+  memory[12]++;
+  assert(!rta_store_open_memory(&store, memory, size));
+  memory[12]--;
+  memmove(memory + 8, memory, size - 8);
+  assert(!rta_store_open_memory(&store, memory + 8, size - 8));
+
+  rta_aligned_free(memory);
+  remove(PATH);
+
+  printf("rta_store_test: ok, %ld bytes\n", size);
+  return 0;
+}
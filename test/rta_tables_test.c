@@ -0,0 +1,184 @@
+/*
+
+Test of the generated tables (rta_tables.h) and of the compile-time
+cubic interpolation table (rta_cubic.h): the tables hold the values
+that were computed at run time before, and the FFT and windows of the
+tabulated sizes still compute the same transforms.
+
+- compile
+
+cc -O2 ../src/signal/rta_*.c ../src/statistics/rta_selection.c ../src/util/rta_*.c rta_tables_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -I ../src/statistics/ -lm -lpthread -o rta_tables_test
+
+- run
+
+./rta_tables_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "rta_configuration.h"
+#include "rta_tables.h"
+#include "rta_cubic.h"
+#include "rta_fft.h"
+#include "rta_window.h"
+#include "rta_precision.h"
+
+#define MAX_SIZE (1 << (RTA_TABLES_MAX_LOG2 + 1))
+
+/* the former run-time initialisation of rta_cubic_table */
+static void check_cubic_table (void)
+{
+  int i;
+
+  for (i = 0; i < RTA_CUBIC_TABLE_SIZE; i++)
+  {
+    const rta_cubic_coefs_t *p = rta_cubic_table + i;
+    float f = i * (1.0 / RTA_CUBIC_TABLE_SIZE);
+
+    assert(p->pm1 == (float) (-0.1666667 * f * (1 - f) * (2 - f)));
+    assert(p->p0 == (float) (0.5 * (1 + f) * (1 - f) * (2 - f)));
+    assert(p->p1 == (float) (0.5 * (1 + f) * f * (2 - f)));
+    assert(p->p2 == (float) (-0.1666667 * (1 + f) * f * (1 - f)));
+  }
+
+  printf("rta_cubic_table: ok\n");
+}
+
+/* bit reversal as computed by the FFT setup */
+static unsigned int bitrev (unsigned int i, unsigned int log2_size)
+{
+  unsigned int j, xdi = 0;
+
+  for (j = 1; j < log2_size; j++)
+  {
+    xdi += (i & 1);
+    xdi <<= 1;
+    i >>= 1;
+  }
+
+  return xdi + (i & 1);
+}
+
+static void check_tables (void)
+{
+  unsigned int log2_size, i;
+
+  assert(rta_tables_sin(1 << (RTA_TABLES_MIN_LOG2 - 1)) == NULL);
+  assert(rta_tables_sin(1 << (RTA_TABLES_MAX_LOG2 + 1)) == NULL);
+  assert(rta_tables_sin(1000) == NULL);
+  assert(rta_tables_bitrev(1000) == NULL);
+
+  for (log2_size = RTA_TABLES_MIN_LOG2; log2_size <= RTA_TABLES_MAX_LOG2; log2_size++)
+  {
+    const unsigned int size = 1 << log2_size;
+    const rta_tables_real_t *sin_table = rta_tables_sin(size);
+    const unsigned int *bitrev_table = rta_tables_bitrev(size);
+
+    assert(sin_table != NULL  &&  bitrev_table != NULL);
+
+    for (i = 0; i <= size * 5 / 4; i++)
+      assert(fabs(sin_table[i] - sin(2 * M_PI * i / size)) < 1e-7);
+
+    /* exact at the quarter periods */
+    assert(sin_table[0] == 0  &&  sin_table[size / 4] == 1);
+    assert(sin_table[size / 2] == 0  &&  sin_table[size * 3 / 4] == -1);
+
+    for (i = 0; i < size; i++)
+      assert(bitrev_table[i] == bitrev(i, log2_size));
+  }
+
+  printf("rta_tables: ok, sizes %d to %d\n",
+         1 << RTA_TABLES_MIN_LOG2, 1 << RTA_TABLES_MAX_LOG2);
+}
+
+/* windows of tabulated and computed sizes, at both precisions */
+static void check_windows (void)
+{
+  static rta_real_t w[MAX_SIZE];
+  static double wd[MAX_SIZE];
+  const unsigned int sizes[] = { 256, 1000, 1024, MAX_SIZE };
+  unsigned int s, i;
+
+  for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+  {
+    const unsigned int size = sizes[s];
+
+    rta_window_hann_weights(w, size);
+    rta_window_hann_weights_d(wd, size);
+    for (i = 0; i < size; i++)
+    {
+      const double hann = 0.5 - 0.5 * cos(2 * M_PI * i / size);
+
+      assert(fabs(w[i] - hann) < 1e-6);
+      assert(fabs(wd[i] - hann) < 1e-12);
+    }
+
+    rta_window_hamming_weights(w, size, 0.08);
+    for (i = 0; i < size; i++)
+      assert(fabs(w[i] - (0.08 + 0.46 * (1 - cos(2 * M_PI * i / size)))) < 1e-6);
+
+    for (i = 0; i < size; i++)
+      w[i] = 2;
+    rta_window_hann_apply_in_place(w, size);
+    for (i = 0; i < size; i++)
+      assert(fabs(w[i] - 2 * (0.5 - 0.5 * cos(2 * M_PI * i / size))) < 2e-6);
+  }
+
+  printf("rta_window: ok\n");
+}
+
+/* real FFT of a tabulated and of a computed size, against a DFT */
+static void check_fft (void)
+{
+  static rta_real_t x[MAX_SIZE], spectrum[MAX_SIZE + 2];
+  const unsigned int sizes[] = { 16, 1024, MAX_SIZE };
+  const unsigned int bins[] = { 1, 3, 7 };
+  unsigned int s, b, i;
+
+  for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+  {
+    const unsigned int size = sizes[s];
+    rta_fft_setup_t *fft;
+    rta_real_t scale = 1, nyquist;
+
+    for (i = 0; i < size; i++)
+      x[i] = sin(2 * M_PI * 3 * i / size) + 0.5 * cos(2 * M_PI * 7 * i / size + 0.3)
+        + 0.01 * ((i * 7919) % 101 / 101. - 0.5);
+
+    assert(rta_fft_real_setup_new(&fft, rta_fft_real_to_complex_1d, &scale,
+                                  x, size, spectrum, size, &nyquist));
+    rta_fft_real_execute(spectrum, x, size, fft, &nyquist);
+    rta_fft_setup_delete(fft);
+
+    for (b = 0; b < sizeof(bins) / sizeof(bins[0]); b++)
+    {
+      const unsigned int k = bins[b];
+      double re = 0, im = 0;
+
+      for (i = 0; i < size; i++)
+      {
+        re += x[i] * cos(2 * M_PI * k * i / size);
+        im -= x[i] * sin(2 * M_PI * k * i / size);
+      }
+
+      assert(fabs(hypot(spectrum[2 * k], spectrum[2 * k + 1]) - hypot(re, im))
+             < 1e-5 * size);
+    }
+  }
+
+  printf("rta_fft: ok\n");
+}
+
+int main (int argc, char *argv[])
+{
+  check_cubic_table();
+  check_tables();
+  check_windows();
+  check_fft();
+
+  printf("rta_tables_test: ok\n");
+  return 0;
+}
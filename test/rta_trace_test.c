@@ -0,0 +1,137 @@
+/*
+
+Test of the hot-path tracing (rta_trace.h): calls from several
+threads must all be counted, with consistent times and histograms.
+Threads that end release their counters, which the next threads reuse
+without allocating.
+
+- compile
+
+cc -O2 -DRTA_TRACE=1 -DRTA_RTGUARD=1 ../src/signal/rta_biquad.c ../src/signal/rta_onepole.c ../src/signal/rta_fft.c ../src/signal/rta_tables.c ../src/util/rta_*.c rta_trace_test.c -I ../bindings/console/ -I ../src -I ../src/util/ -I ../src/signal/ -lm -lpthread -o rta_trace_test
+
+- run
+
+./rta_trace_test
+
+*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "rta_configuration.h"
+#include "rta_trace.h"
+#include "rta_rtguard.h"
+#include "rta_biquad.h"
+#include "rta_onepole.h"
+#include "rta_fft.h"
+
+#define NTHREADS 4
+#define NCALLS 1000
+#define SIZE 256
+
+static void *run (void *arg)
+{
+  rta_real_t x[SIZE], y[SIZE], spectrum[SIZE + 2], nyquist;
+  rta_real_t b[3] = { 0.2, 0.4, 0.2 }, a[2] = { -0.5, 0.1 }, states[4] = { 0 };
+  rta_real_t state = 0, scale = 1;
+  rta_fft_setup_t *fft;
+  int i;
+
+  assert(rta_trace_thread_init());
+
+  for (i = 0; i < SIZE; i++)
+    x[i] = (i % 17) / 17.;
+
+  assert(rta_fft_real_setup_new(&fft, rta_fft_real_to_complex_1d, &scale,
+                                x, SIZE, spectrum, SIZE, &nyquist));
+
+  for (i = 0; i < NCALLS; i++)
+  {
+    rta_biquad_df1_vector(y, x, SIZE, b, a, states);
+    rta_onepole_lowpass_vector(y, x, SIZE, 0.1, &state);
+    rta_fft_real_execute(spectrum, x, SIZE, fft, &nyquist);
+  }
+
+  rta_fft_setup_delete(fft);
+  rta_trace_thread_deinit();
+  return NULL;
+}
+
+/* a later thread: takes released counters */
+static void *reuse (void *arg)
+{
+  rta_real_t x[SIZE], y[SIZE], state = 0;
+  int i;
+
+  for (i = 0; i < SIZE; i++)
+    x[i] = (i % 17) / 17.;
+
+  rta_rtguard_enter("rta_trace_thread_init");
+  assert(rta_trace_thread_init());
+  *(unsigned long *) arg = rta_rtguard_thread_count();
+  rta_rtguard_leave();
+
+  rta_onepole_lowpass_vector(y, x, SIZE, 0.1, &state);
+  rta_trace_thread_deinit();
+  return NULL;
+}
+
+int main (int argc, char *argv[])
+{
+  pthread_t threads[NTHREADS];
+  rta_trace_stats_t stats[rta_trace_num_ids];
+  unsigned long allocations[NTHREADS];
+  int i, b, n;
+
+  assert(rta_trace_enabled());
+
+  for (i = 0; i < NTHREADS; i++)
+    pthread_create(&threads[i], NULL, run, NULL);
+  for (i = 0; i < NTHREADS; i++)
+    pthread_join(threads[i], NULL);
+
+  n = rta_trace_get_stats(stats, rta_trace_num_ids);
+  assert(n == rta_trace_num_ids);
+
+  for (i = 0; i < n; i++)
+  {
+    uint64_t hist = 0;
+
+    for (b = 0; b < RTA_TRACE_HISTOGRAM_SIZE; b++)
+      hist += stats[i].histogram[b];
+
+    printf("%-20s calls %8llu  items %10llu  total %10.3f ms  mean %8.1f ns  max %8.1f ns\n",
+           stats[i].name, (unsigned long long) stats[i].calls,
+           (unsigned long long) stats[i].items, stats[i].total_ns * 1e-6,
+           stats[i].calls ? stats[i].total_ns / stats[i].calls : 0, stats[i].max_ns);
+
+    assert(hist == stats[i].calls);
+    assert(stats[i].max_ns <= stats[i].total_ns);
+  }
+
+  assert(stats[rta_trace_biquad_vector].calls == NTHREADS * NCALLS);
+  assert(stats[rta_trace_biquad_vector].items == NTHREADS * NCALLS * SIZE);
+  assert(stats[rta_trace_onepole_vector].calls == NTHREADS * NCALLS);
+  assert(stats[rta_trace_fft_execute].calls == NTHREADS * NCALLS);
+  assert(stats[rta_trace_yin].calls == 0);
+
+  /* new threads reuse the counters of the ended ones, keeping their counts */
+  for (i = 0; i < NTHREADS; i++)
+    pthread_create(&threads[i], NULL, reuse, &allocations[i]);
+  for (i = 0; i < NTHREADS; i++)
+  {
+    pthread_join(threads[i], NULL);
+    assert(allocations[i] == 0);
+  }
+
+  rta_trace_get_stats(stats, rta_trace_num_ids);
+  assert(stats[rta_trace_onepole_vector].calls == NTHREADS * (NCALLS + 1));
+  assert(stats[rta_trace_biquad_vector].calls == NTHREADS * NCALLS);
+
+  rta_trace_reset();
+  rta_trace_get_stats(stats, rta_trace_num_ids);
+  assert(stats[rta_trace_biquad_vector].calls == 0);
+
+  printf("rta_trace_test: ok\n");
+  return 0;
+}